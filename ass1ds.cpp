@@ -1,7 +1,9 @@
 #include "ass1ds.hpp"
 
 extern "C" {
-	char*                         kalloc();
+	struct slabcache;
+	struct slabcache*             slabcreate(char*, uint, void (*)(void*));
+	void*                         slaballoc(struct slabcache*);
 	void                          panic(char*) __attribute__((noreturn));
 	void*                         memset(void*, int, uint);
 	void                          initSchedDS();
@@ -37,7 +39,6 @@ extern "C" {
 	RunningProcessesHolder        rpholder;
 }
 
-#define PGSIZE                    4096
 #define NPROCLIST                 (2*NPROC) //take some extra space
 #define NPROCMAP                  (2*NPROC) //take some extra space
 
@@ -45,24 +46,18 @@ static Map                        *priorityQ;
 static LinkedList                 *roundRobinQ;
 static LinkedList                 *runningProcHolder;
 
+//raw storage: global constructors and destructors don't run in the kernel, the objects are assigned in initSchedDS
+static char                       priorityQStore[sizeof(Map)] __attribute__((aligned(8)));
+static char                       roundRobinQStore[sizeof(LinkedList)] __attribute__((aligned(8)));
+static char                       runningProcHolderStore[sizeof(LinkedList)] __attribute__((aligned(8)));
+
+//the free lists are a reserve, so the scheduler never fails an allocation in the common case.
+//they are filled from slab caches at boot and topped up from them when they run dry.
 static Link                       *freeLinks;
 static MapNode                    *freeNodes;
 
-static char                       *data;
-static uint                       spaceLeft;
-
-static char* mymalloc(uint size) {
-	if(spaceLeft < size) {
-		data = kalloc();
-		memset(data, 0, PGSIZE);
-		spaceLeft = PGSIZE;
-	}
-
-	char* ans = data;
-	data += size;
-	spaceLeft -= size;
-	return ans;
-}
+static struct slabcache           *linkCache;
+static struct slabcache           *nodeCache;
 
 //for pq
 static boolean isEmptyPriorityQueue() {
@@ -124,21 +119,23 @@ static boolean getMinAccumulatorRunningProcessHolder(long long *pkey) {
 }
 
 void initSchedDS() { //called once by the "pioneer" cpu from the main function in main.c
-	data               = null;
-	spaceLeft          = 0u;
+	linkCache          = slabcreate((char*)"link", sizeof(Link), null);
+	nodeCache          = slabcreate((char*)"mapnode", sizeof(MapNode), null);
 
-	priorityQ          = (Map*)mymalloc(sizeof(Map));
+	priorityQ          = (Map*)priorityQStore;
 	*priorityQ         = Map();
 
-	roundRobinQ        = (LinkedList*)mymalloc(sizeof(LinkedList));
+	roundRobinQ        = (LinkedList*)roundRobinQStore;
 	*roundRobinQ       = LinkedList();
 
-	runningProcHolder  = (LinkedList*)mymalloc(sizeof(LinkedList));
+	runningProcHolder  = (LinkedList*)runningProcHolderStore;
 	*runningProcHolder = LinkedList();
 
 	freeLinks = null;
 	for(int i = 0; i < NPROCLIST; ++i) {
-		Link *link = (Link*)mymalloc(sizeof(Link));
+		Link *link = (Link*)slaballoc(linkCache);
+		if(!link)
+			panic((char*)"initSchedDS: no memory");
 		*link = Link();
 		link->next = freeLinks;
 		freeLinks = link;
@@ -146,7 +143,9 @@ void initSchedDS() { //called once by the "pioneer" cpu from the main function i
 
 	freeNodes = null;
 	for(int i = 0; i < NPROCMAP; ++i) {
-		MapNode *node = (MapNode*)mymalloc(sizeof(MapNode));
+		MapNode *node = (MapNode*)slaballoc(nodeCache);
+		if(!node)
+			panic((char*)"initSchedDS: no memory");
 		*node = MapNode();
 		node->next = freeNodes;
 		freeNodes = node;
@@ -174,8 +173,13 @@ void initSchedDS() { //called once by the "pioneer" cpu from the main function i
 }
 
 static Link* allocLink(Proc *p) {
-	if(!freeLinks)
-		return null;
+	if(!freeLinks) {
+		Link *link = (Link*)slaballoc(linkCache);
+		if(!link)
+			return null;
+		*link = Link();
+		freeLinks = link;
+	}
 
 	Link *ans = freeLinks;
 	freeLinks = freeLinks->next;
@@ -196,8 +200,13 @@ static void deallocNode(MapNode *node) {
 }
 
 static MapNode* allocNode(long long key) {
-	if(!freeNodes)
-		return null;
+	if(!freeNodes) {
+		MapNode *node = (MapNode*)slaballoc(nodeCache);
+		if(!node)
+			return null;
+		*node = MapNode();
+		freeNodes = node;
+	}
 
 	MapNode *ans = freeNodes;
 	freeNodes = freeNodes->next;
@@ -207,9 +216,6 @@ static MapNode* allocNode(long long key) {
 }
 
 static MapNode* allocNode(Proc *p, long long key) {
-	if(!freeNodes)
-		return null;
-
 	MapNode *ans = allocNode(key);
 	if(!ans)
 		return null;
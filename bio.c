@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a set of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,288 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are found through a hash table keyed by (dev, blockno),
+// with a lock per bucket, so lookups of different blocks don't
+// contend. A bucket's lock protects its chain and the dev,
+// blockno and refcnt of the buffers on it. Unused buffers are
+// recycled by a clock sweep over the ring of all buffers, done
+// under bcache.lock so that only one CPU evicts at a time; the
+// evicting CPU is the only one ever to hold two bucket locks.
+//
+// The cache starts with NBUF buffers and grows, instead of
+// evicting, while it is under BCACHEPCT percent of memory and
+// free memory is not low. When kalloc() runs out of pages it
+// calls bshrink() to give clean, unused buffers back.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "memstat.h"
 
-struct {
+#define NBUCKET 1021
+#define NODEV   ((uint)-1)  // dev of a buffer that holds no block
+#define SHRINKBATCH 8       // buffers bshrink() frees between reclaims
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;   // Chain through hnext
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct spinlock lock;  // Serializes eviction; protects the ring
+  struct slabcache *cache;
+  uint nbuf;             // Buffers in the cache
+
+  // Ring of all buffers, through prev/next, swept by the clock.
+  struct buf *hand;
+
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+static struct bucket*
+hash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev * 7 + blockno) % NBUCKET];
+}
+
+static void
+bufctor(void *obj)
+{
+  initsleeplock(&((struct buf*)obj)->lock, "buffer");
+}
+
+// Allocate a buffer holding no block and add it to the ring,
+// just behind the clock hand. Returns 0 if out of memory.
+// Caller must hold bcache.lock.
+static struct buf*
+bgrow(void)
+{
+  struct buf *b;
+
+  if((b = slaballoc(bcache.cache)) == 0)
+    return 0;
+  b->dev = NODEV;
+  b->flags = 0;
+  b->refcnt = 0;
+  b->used = 0;
+  b->hnext = 0;
+  if(bcache.hand == 0){
+    b->next = b->prev = b;
+    bcache.hand = b;
+  } else {
+    b->next = bcache.hand;
+    b->prev = bcache.hand->prev;
+    b->prev->next = b;
+    b->next->prev = b;
+  }
+  bcache.nbuf++;
+  return b;
+}
+
+// Should a miss add a buffer rather than recycle one?
+// Caller must hold bcache.lock.
+static int
+shouldgrow(void)
+{
+  struct memstat ms;
+
+  if(bcache.nbuf < NBUF)
+    return 1;
+  kmemstat(&ms);
+  return bcache.nbuf < ms.total / 100 * BCACHEPCT * (PGSIZE / sizeof(struct buf)) &&
+         ms.free > ms.total / 16;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  for(i = 0; i < NBUCKET; i++)
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
+  bcache.cache = slabcreate("buf", sizeof(struct buf), bufctor);
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
+  // Create the initial ring of buffers. None is on a hash
+  // chain until it is first used.
+  acquire(&bcache.lock);
+  for(i = 0; i < NBUF; i++)
+    if(bgrow() == 0)
+      panic("binit");
+  release(&bcache.lock);
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Look for block blockno on device dev in bucket bk, which
+// must be locked.
 static struct buf*
-bget(uint dev, uint blockno)
+find(struct bucket *bk, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
       return b;
-    }
+  return 0;
+}
+
+// Like find, but take a reference to the buffer found.
+static struct buf*
+lookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = find(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    b->used = 1;
   }
+  return b;
+}
+
+// Take b off the chain of bucket bk, which must be locked.
+static void
+unchain(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+}
+
+// Take b off its hash chain if it is unused and clean.
+// bk is a bucket the caller has locked, or 0.
+// Returns 0 if b is in use. Caller must hold bcache.lock,
+// which keeps b->dev and b->blockno from changing.
+static int
+bdetach(struct buf *b, struct bucket *bk)
+{
+  struct bucket *old;
+  int ok;
 
-  // Not cached; recycle an unused buffer.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  if(b->dev == NODEV)
+    return b->refcnt == 0;
+  old = hash(b->dev, b->blockno);
+  if(old != bk)
+    acquire(&old->lock);
+  ok = b->refcnt == 0 && (b->flags & B_DIRTY) == 0;
+  if(ok){
+    unchain(old, b);
+    b->dev = NODEV;
+  }
+  if(old != bk)
+    release(&old->lock);
+  return ok;
+}
+
+// Find a buffer for block blockno on dev and put it in bucket
+// bk, which must be locked: a new one if the cache may grow,
+// else an unused one chosen by the clock algorithm. Buffers
+// used since the hand last passed get a second chance.
+// If every buffer is in use or pinned by the log, grows the
+// cache past its limit; returns 0 only if that fails too.
+// Caller must hold bcache.lock.
+static struct buf*
+evict(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+  int i, n;
+
+  b = 0;
+  if(shouldgrow())
+    b = bgrow();
+  n = 2*bcache.nbuf;
+  for(i = 0; b == 0 && i < n; i++){
+    b = bcache.hand;
+    bcache.hand = b->next;
+    // Unlocked peek; bdetach() checks again.
+    if(b->refcnt != 0 || (b->flags & B_DIRTY) || b->used){
+      b->used = 0;
+      b = 0;
+    } else if(!bdetach(b, bk))
+      b = 0;
   }
-  panic("bget: no buffers");
+  if(b == 0)
+    b = bgrow();  // Everything is pinned or in use: go over the limit.
+  if(b == 0)
+    return 0;
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->used = 1;
+  b->hnext = bk->head;
+  bk->head = b;
+  return b;
+}
+
+// Free unused, clean buffers, keeping at least NBUF, until n
+// pages have gone back to kalloc. Buffers share slab pages, so
+// this frees a batch at a time and then reclaims empty slabs.
+// Called by kalloc() when memory runs out, with no locks held.
+// Returns the number of pages freed.
+int
+bshrink(int n)
+{
+  struct buf *b;
+  int i, nfreed, npages, scan;
+
+  nfreed = npages = 0;
+  acquire(&bcache.lock);
+  scan = bcache.nbuf;
+  for(i = 0; i < scan && npages < n && bcache.nbuf > NBUF; i++){
+    b = bcache.hand;
+    bcache.hand = b->next;
+    if(b->refcnt != 0 || (b->flags & B_DIRTY) || !bdetach(b, 0))
+      continue;
+    b->prev->next = b->next;
+    b->next->prev = b->prev;
+    bcache.nbuf--;
+    slabfree(bcache.cache, b);
+    if(++nfreed % SHRINKBATCH == 0)
+      npages += slabreclaim(bcache.cache);
+  }
+  release(&bcache.lock);
+  if(nfreed % SHRINKBATCH != 0)
+    npages += slabreclaim(bcache.cache);
+  return npages;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = hash(dev, blockno);
+  acquire(&bk->lock);
+  b = lookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b == 0){
+    // Not cached; recycle an unused buffer. Look again once
+    // we may evict, in case another CPU added the block.
+    acquire(&bcache.lock);
+    acquire(&bk->lock);
+    if((b = lookup(bk, dev, blockno)) == 0)
+      b = evict(bk, dev, blockno);
+    release(&bk->lock);
+    release(&bcache.lock);
+    if(b == 0)
+      panic("bget: no buffers");
+  }
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -105,6 +314,63 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Return a locked buf for the indicated block without reading
+// it from disk, for a caller that will overwrite all of it.
+struct buf*
+bclaim(uint dev, uint blockno)
+{
+  return bget(dev, blockno);
+}
+
+// Start reading block blockno on device dev into the cache,
+// unless it is there already, without waiting for the disk.
+// Gives up quietly if no buffer is free.
+void
+bprefetch(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = hash(dev, blockno);
+  acquire(&bk->lock);
+  b = find(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return;
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  b = 0;
+  if(find(bk, dev, blockno) == 0)
+    b = evict(bk, dev, blockno);
+  release(&bk->lock);
+  release(&bcache.lock);
+  if(b == 0)
+    return;
+  acquiresleep(&b->lock);
+  if(b->flags & B_VALID){
+    // Someone else read it while we waited for the lock.
+    brelse(b);
+    return;
+  }
+  // ideintr() calls bdone(), which releases b, when it's read.
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
+// Release a buffer whose B_ASYNC request has finished.
+// Called from ideintr(), not by the process that locked b.
+void
+bdone(struct buf *b)
+{
+  struct bucket *bk;
+
+  releasesleep(&b->lock);
+  bk = hash(b->dev, b->blockno);
+  acquire(&bk->lock);
+  b->refcnt--;
+  release(&bk->lock);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,29 +381,41 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write the locked buffers bp[0..n-1] to disk and release them.
+// All are queued before waiting for any, so the disk driver can
+// sort and merge them.
+void
+bwritev(struct buf **bp, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bp[i]->lock))
+      panic("bwritev");
+    bp[i]->flags |= B_DIRTY;
+    idesubmit(bp[i]);
+  }
+  for(i = 0; i < n; i++){
+    idewaitbuf(bp[i]);
+    brelse(bp[i]);
+  }
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = hash(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+  release(&bk->lock);
 }
 //PAGEBREAK!
 // Blank page.
@@ -4,11 +4,15 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  uint used;        // referenced since the clock hand last passed
+  struct buf *hnext; // hash chain
+  struct buf *prev; // ring of all buffers
   struct buf *next;
   struct buf *qnext; // disk queue
+  uint qtime;        // ticks when queued to the disk
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // nobody waits for the disk; ide calls bdone()
 
@@ -9,12 +9,20 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct vma;
 struct perf;
+struct memstat;
+struct procinfo;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     bclaim(uint, uint);
 void            brelse(struct buf*);
+int             bshrink(int);
+void            bprefetch(uint, uint);
+void            bdone(struct buf*);
+void            bwritev(struct buf**, int);
 void            bwrite(struct buf*);
 
 // console.c
@@ -39,6 +47,7 @@ int             filewrite(struct file*, char*, int n);
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+void            dcacheinval(struct inode*, char*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
@@ -58,6 +67,8 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idesubmit(struct buf*);
+void            idewaitbuf(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -66,9 +77,16 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kzalloc(void);
+void            kzeroidle(void);
+char*           kalloc_pages(int);
+void            kfree_pages(char*, int);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kincref(char*);
+int             krefcount(char*);
+void            kmemstat(struct memstat*);
 
 // kbd.c
 void            kbdintr(void);
@@ -86,17 +104,24 @@ void            microdelay(int);
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
 
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+int             pcifind(uint, uint);
+uint            pciread(int, int);
+void            pciwrite(int, int, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
@@ -125,15 +150,34 @@ int             detach(int pid);
 void            policy(int policy);
 void            priority(int priority);
 int             wait_stat(int *status, struct perf *performance);
+int             getprocs(struct procinfo*, int);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// shm.c
+void            shminit(void);
+int             shmget(int, uint);
+int             shmat(int);
+int             shmdt(uint);
+int             shmctl(int, int);
+void            shmdup(int);
+void            shmput(int);
+
+// slab.c
+struct slabcache;
+void            slabinit(void);
+struct slabcache* slabcreate(char*, uint, void (*)(void*));
+void*           slaballoc(struct slabcache*);
+void            slabfree(struct slabcache*, void*);
+int             slabreclaim(struct slabcache*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            lockdump(int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -156,6 +200,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argwptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -185,11 +230,21 @@ int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
-pde_t*          copyuvm(pde_t*, uint);
+pde_t*          copyuvm(pde_t*, uint, struct vma*);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(uint, uint);
+int             prefault(uint, uint, int);
+void            vmaclear(struct vma*, int);
+void            vmasync(pde_t*, struct vma*);
+uint            uvmlimit(uint);
+uint            mmap(struct inode*, uint, uint, uint, int, int);
+int             munmap(uint, uint);
+int             mapshared(pde_t*, uint, char**, int, int);
+uint            vmptpages(void);
+void            uvmstat(pde_t*, uint*, uint*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,2417 @@
+
+_dirtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    fail("unlink");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 e4 f0             	and    $0xfffffff0,%esp
+       6:	83 ec 10             	sub    $0x10,%esp
+  dirtest();
+       9:	e8 92 01 00 00       	call   1a0 <dirtest>
+  bigtest();
+       e:	e8 ad 09 00 00       	call   9c0 <bigtest>
+  printf(1, "dirtest ok\n");
+      13:	b8 23 15 00 00       	mov    $0x1523,%eax
+      18:	89 44 24 04          	mov    %eax,0x4(%esp)
+      1c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+      23:	e8 38 0f 00 00       	call   f60 <printf>
+  exit(0);
+      28:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      2f:	e8 5f 0d 00 00       	call   d93 <exit>
+      34:	66 90                	xchg   %ax,%ax
+      36:	66 90                	xchg   %ax,%ax
+      38:	66 90                	xchg   %ax,%ax
+      3a:	66 90                	xchg   %ax,%ax
+      3c:	66 90                	xchg   %ax,%ax
+      3e:	66 90                	xchg   %ax,%ax
+
+00000040 <fail>:
+{
+      40:	55                   	push   %ebp
+  printf(1, "dirtest: %s %s failed\n", what, path);
+      41:	b8 60 1b 00 00       	mov    $0x1b60,%eax
+{
+      46:	89 e5                	mov    %esp,%ebp
+      48:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "dirtest: %s %s failed\n", what, path);
+      4b:	89 44 24 0c          	mov    %eax,0xc(%esp)
+      4f:	ba 34 14 00 00       	mov    $0x1434,%edx
+      54:	8b 45 08             	mov    0x8(%ebp),%eax
+      57:	89 54 24 04          	mov    %edx,0x4(%esp)
+      5b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+      62:	89 44 24 08          	mov    %eax,0x8(%esp)
+      66:	e8 f5 0e 00 00       	call   f60 <printf>
+  exit(1);
+      6b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+      72:	e8 1c 0d 00 00       	call   d93 <exit>
+      77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7e:	66 90                	xchg   %ax,%ax
+
+00000080 <name>:
+{
+      80:	55                   	push   %ebp
+  strcpy(path, "dd/");
+      81:	ba 4b 14 00 00       	mov    $0x144b,%edx
+{
+      86:	89 e5                	mov    %esp,%ebp
+      88:	57                   	push   %edi
+    *p++ = '0' + n / i % 10;
+      89:	bf 67 66 66 66       	mov    $0x66666667,%edi
+{
+      8e:	56                   	push   %esi
+  *p++ = c;
+      8f:	be 64 1b 00 00       	mov    $0x1b64,%esi
+{
+      94:	53                   	push   %ebx
+      95:	83 ec 1c             	sub    $0x1c,%esp
+      98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  strcpy(path, "dd/");
+      9b:	89 54 24 04          	mov    %edx,0x4(%esp)
+      9f:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+      a6:	e8 a5 0a 00 00       	call   b50 <strcpy>
+  *p++ = c;
+      ab:	88 1d 63 1b 00 00    	mov    %bl,0x1b63
+  for(i = 100; i > 0; i /= 10)
+      b1:	bb 64 00 00 00       	mov    $0x64,%ebx
+    *p++ = '0' + n / i % 10;
+      b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+      b9:	46                   	inc    %esi
+      ba:	99                   	cltd
+      bb:	f7 fb                	idiv   %ebx
+      bd:	89 c1                	mov    %eax,%ecx
+      bf:	f7 ef                	imul   %edi
+      c1:	89 c8                	mov    %ecx,%eax
+      c3:	c1 f8 1f             	sar    $0x1f,%eax
+      c6:	c1 fa 02             	sar    $0x2,%edx
+      c9:	29 c2                	sub    %eax,%edx
+      cb:	8d 04 92             	lea    (%edx,%edx,4),%eax
+      ce:	01 c0                	add    %eax,%eax
+      d0:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+      d2:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+      d7:	f7 e3                	mul    %ebx
+    *p++ = '0' + n / i % 10;
+      d9:	80 c1 30             	add    $0x30,%cl
+      dc:	88 4e ff             	mov    %cl,-0x1(%esi)
+  for(i = 100; i > 0; i /= 10)
+      df:	89 d3                	mov    %edx,%ebx
+      e1:	c1 eb 03             	shr    $0x3,%ebx
+      e4:	81 fe 67 1b 00 00    	cmp    $0x1b67,%esi
+      ea:	75 ca                	jne    b6 <name+0x36>
+  *p = 0;
+      ec:	31 c0                	xor    %eax,%eax
+      ee:	a2 67 1b 00 00       	mov    %al,0x1b67
+}
+      f3:	83 c4 1c             	add    $0x1c,%esp
+      f6:	b8 60 1b 00 00       	mov    $0x1b60,%eax
+      fb:	5b                   	pop    %ebx
+      fc:	5e                   	pop    %esi
+      fd:	5f                   	pop    %edi
+      fe:	5d                   	pop    %ebp
+      ff:	c3                   	ret
+
+00000100 <exists>:
+{
+     100:	55                   	push   %ebp
+  if((fd = open(p, O_RDONLY)) < 0)
+     101:	31 c0                	xor    %eax,%eax
+{
+     103:	89 e5                	mov    %esp,%ebp
+     105:	83 ec 18             	sub    $0x18,%esp
+  if((fd = open(p, O_RDONLY)) < 0)
+     108:	89 44 24 04          	mov    %eax,0x4(%esp)
+     10c:	8b 45 08             	mov    0x8(%ebp),%eax
+     10f:	89 04 24             	mov    %eax,(%esp)
+     112:	e8 bc 0c 00 00       	call   dd3 <open>
+     117:	31 d2                	xor    %edx,%edx
+     119:	85 c0                	test   %eax,%eax
+     11b:	78 0d                	js     12a <exists+0x2a>
+  close(fd);
+     11d:	89 04 24             	mov    %eax,(%esp)
+     120:	e8 96 0c 00 00       	call   dbb <close>
+  return 1;
+     125:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+     12a:	89 ec                	mov    %ebp,%esp
+     12c:	89 d0                	mov    %edx,%eax
+     12e:	5d                   	pop    %ebp
+     12f:	c3                   	ret
+
+00000130 <mkfile>:
+{
+     130:	55                   	push   %ebp
+  if((fd = open(p, O_CREATE | O_RDWR)) < 0)
+     131:	ba 02 02 00 00       	mov    $0x202,%edx
+{
+     136:	89 e5                	mov    %esp,%ebp
+     138:	83 ec 18             	sub    $0x18,%esp
+     13b:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  if((fd = open(p, O_CREATE | O_RDWR)) < 0)
+     13e:	89 54 24 04          	mov    %edx,0x4(%esp)
+     142:	8b 45 08             	mov    0x8(%ebp),%eax
+     145:	89 04 24             	mov    %eax,(%esp)
+     148:	e8 86 0c 00 00       	call   dd3 <open>
+     14d:	85 c0                	test   %eax,%eax
+     14f:	78 2e                	js     17f <mkfile+0x4f>
+     151:	89 c3                	mov    %eax,%ebx
+  if(write(fd, &n, sizeof(n)) != sizeof(n))
+     153:	b8 04 00 00 00       	mov    $0x4,%eax
+     158:	89 44 24 08          	mov    %eax,0x8(%esp)
+     15c:	8d 45 0c             	lea    0xc(%ebp),%eax
+     15f:	89 44 24 04          	mov    %eax,0x4(%esp)
+     163:	89 1c 24             	mov    %ebx,(%esp)
+     166:	e8 48 0c 00 00       	call   db3 <write>
+     16b:	83 f8 04             	cmp    $0x4,%eax
+     16e:	75 1b                	jne    18b <mkfile+0x5b>
+  close(fd);
+     170:	89 1c 24             	mov    %ebx,(%esp)
+     173:	e8 43 0c 00 00       	call   dbb <close>
+}
+     178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     17b:	89 ec                	mov    %ebp,%esp
+     17d:	5d                   	pop    %ebp
+     17e:	c3                   	ret
+    fail("create");
+     17f:	c7 04 24 85 14 00 00 	movl   $0x1485,(%esp)
+     186:	e8 b5 fe ff ff       	call   40 <fail>
+    fail("write");
+     18b:	c7 04 24 4f 14 00 00 	movl   $0x144f,(%esp)
+     192:	e8 a9 fe ff ff       	call   40 <fail>
+     197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <dirtest>:
+{
+     1a0:	55                   	push   %ebp
+  printf(1, "dirtest: directory of %d names\n", 2*NFILE);
+     1a1:	b9 c8 00 00 00       	mov    $0xc8,%ecx
+{
+     1a6:	89 e5                	mov    %esp,%ebp
+     1a8:	57                   	push   %edi
+     1a9:	56                   	push   %esi
+     1aa:	53                   	push   %ebx
+  printf(1, "dirtest: directory of %d names\n", 2*NFILE);
+     1ab:	bb 30 15 00 00       	mov    $0x1530,%ebx
+{
+     1b0:	83 ec 3c             	sub    $0x3c,%esp
+  printf(1, "dirtest: directory of %d names\n", 2*NFILE);
+     1b3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+     1b7:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     1bb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1c2:	e8 99 0d 00 00       	call   f60 <printf>
+  if(mkdir("dd") < 0)
+     1c7:	c7 04 24 5b 14 00 00 	movl   $0x145b,(%esp)
+     1ce:	e8 28 0c 00 00       	call   dfb <mkdir>
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	0f 88 c3 07 00 00    	js     99e <dirtest+0x7fe>
+  for(i = 0; i < NFILE; i++)
+     1db:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    *p++ = '0' + n / i % 10;
+     1e2:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ee:	66 90                	xchg   %ax,%ax
+  strcpy(path, "dd/");
+     1f0:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     1f7:	b8 4b 14 00 00       	mov    $0x144b,%eax
+  *p++ = c;
+     1fc:	be 64 1b 00 00       	mov    $0x1b64,%esi
+  strcpy(path, "dd/");
+     201:	89 44 24 04          	mov    %eax,0x4(%esp)
+  for(i = 100; i > 0; i /= 10)
+     205:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     20a:	e8 41 09 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     20f:	b2 66                	mov    $0x66,%dl
+     211:	88 15 63 1b 00 00    	mov    %dl,0x1b63
+    *p++ = '0' + n / i % 10;
+     217:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     21a:	46                   	inc    %esi
+     21b:	99                   	cltd
+     21c:	f7 fb                	idiv   %ebx
+     21e:	89 c1                	mov    %eax,%ecx
+     220:	f7 e7                	mul    %edi
+     222:	c1 ea 03             	shr    $0x3,%edx
+     225:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     228:	01 c0                	add    %eax,%eax
+     22a:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     22c:	89 d8                	mov    %ebx,%eax
+     22e:	f7 e7                	mul    %edi
+    *p++ = '0' + n / i % 10;
+     230:	80 c1 30             	add    $0x30,%cl
+     233:	88 4e ff             	mov    %cl,-0x1(%esi)
+  for(i = 100; i > 0; i /= 10)
+     236:	89 d3                	mov    %edx,%ebx
+     238:	c1 eb 03             	shr    $0x3,%ebx
+     23b:	81 fe 67 1b 00 00    	cmp    $0x1b67,%esi
+     241:	75 d4                	jne    217 <dirtest+0x77>
+    mkfile(name('f', i), i);
+     243:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  *p = 0;
+     246:	31 c0                	xor    %eax,%eax
+    mkfile(name('f', i), i);
+     248:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     24f:	a2 67 1b 00 00       	mov    %al,0x1b67
+    mkfile(name('f', i), i);
+     254:	89 74 24 04          	mov    %esi,0x4(%esp)
+     258:	e8 d3 fe ff ff       	call   130 <mkfile>
+  for(i = 0; i < NFILE; i++)
+     25d:	89 f0                	mov    %esi,%eax
+     25f:	40                   	inc    %eax
+     260:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     263:	83 f8 64             	cmp    $0x64,%eax
+     266:	75 88                	jne    1f0 <dirtest+0x50>
+  for(i = 0; i < NFILE; i++){
+     268:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    *p++ = '0' + n / i % 10;
+     26f:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+     274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     27f:	90                   	nop
+  strcpy(path, "dd/");
+     280:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     287:	b8 4b 14 00 00       	mov    $0x144b,%eax
+  for(i = 100; i > 0; i /= 10)
+     28c:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     291:	89 44 24 04          	mov    %eax,0x4(%esp)
+  *p++ = c;
+     295:	bf 64 1b 00 00       	mov    $0x1b64,%edi
+  strcpy(path, "dd/");
+     29a:	e8 b1 08 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     29f:	b0 66                	mov    $0x66,%al
+     2a1:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     2a6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     2a9:	47                   	inc    %edi
+     2aa:	99                   	cltd
+     2ab:	f7 fb                	idiv   %ebx
+     2ad:	89 c1                	mov    %eax,%ecx
+     2af:	f7 e6                	mul    %esi
+     2b1:	c1 ea 03             	shr    $0x3,%edx
+     2b4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     2b7:	01 c0                	add    %eax,%eax
+     2b9:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     2bb:	89 d8                	mov    %ebx,%eax
+     2bd:	f7 e6                	mul    %esi
+    *p++ = '0' + n / i % 10;
+     2bf:	80 c1 30             	add    $0x30,%cl
+     2c2:	88 4f ff             	mov    %cl,-0x1(%edi)
+  for(i = 100; i > 0; i /= 10)
+     2c5:	89 d3                	mov    %edx,%ebx
+     2c7:	c1 eb 03             	shr    $0x3,%ebx
+     2ca:	81 ff 67 1b 00 00    	cmp    $0x1b67,%edi
+     2d0:	75 d4                	jne    2a6 <dirtest+0x106>
+    strcpy(buf, path);
+     2d2:	bb 60 1b 00 00       	mov    $0x1b60,%ebx
+  *p = 0;
+     2d7:	31 c9                	xor    %ecx,%ecx
+    strcpy(buf, path);
+     2d9:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  strcpy(path, "dd/");
+     2dd:	bf 4b 14 00 00       	mov    $0x144b,%edi
+  for(i = 100; i > 0; i /= 10)
+     2e2:	bb 64 00 00 00       	mov    $0x64,%ebx
+    strcpy(buf, path);
+     2e7:	c7 04 24 60 19 00 00 	movl   $0x1960,(%esp)
+  *p = 0;
+     2ee:	88 0d 67 1b 00 00    	mov    %cl,0x1b67
+    strcpy(buf, path);
+     2f4:	e8 57 08 00 00       	call   b50 <strcpy>
+  strcpy(path, "dd/");
+     2f9:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  *p++ = c;
+     2fd:	bf 64 1b 00 00       	mov    $0x1b64,%edi
+  strcpy(path, "dd/");
+     302:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     309:	e8 42 08 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     30e:	b0 6c                	mov    $0x6c,%al
+     310:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     315:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     318:	47                   	inc    %edi
+     319:	99                   	cltd
+     31a:	f7 fb                	idiv   %ebx
+     31c:	89 c1                	mov    %eax,%ecx
+     31e:	f7 e6                	mul    %esi
+     320:	c1 ea 03             	shr    $0x3,%edx
+     323:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     326:	01 c0                	add    %eax,%eax
+     328:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     32a:	89 d8                	mov    %ebx,%eax
+     32c:	f7 e6                	mul    %esi
+    *p++ = '0' + n / i % 10;
+     32e:	80 c1 30             	add    $0x30,%cl
+     331:	88 4f ff             	mov    %cl,-0x1(%edi)
+  for(i = 100; i > 0; i /= 10)
+     334:	89 d3                	mov    %edx,%ebx
+     336:	c1 eb 03             	shr    $0x3,%ebx
+     339:	81 ff 67 1b 00 00    	cmp    $0x1b67,%edi
+     33f:	75 d4                	jne    315 <dirtest+0x175>
+    if(link(buf, name('l', i)) < 0)
+     341:	c7 04 24 60 19 00 00 	movl   $0x1960,(%esp)
+     348:	ba 60 1b 00 00       	mov    $0x1b60,%edx
+  *p = 0;
+     34d:	31 c0                	xor    %eax,%eax
+    if(link(buf, name('l', i)) < 0)
+     34f:	89 54 24 04          	mov    %edx,0x4(%esp)
+  *p = 0;
+     353:	a2 67 1b 00 00       	mov    %al,0x1b67
+    if(link(buf, name('l', i)) < 0)
+     358:	e8 96 0a 00 00       	call   df3 <link>
+     35d:	85 c0                	test   %eax,%eax
+     35f:	0f 88 21 06 00 00    	js     986 <dirtest+0x7e6>
+  for(i = 0; i < NFILE; i++){
+     365:	ff 45 d4             	incl   -0x2c(%ebp)
+     368:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     36b:	83 f8 64             	cmp    $0x64,%eax
+     36e:	0f 85 0c ff ff ff    	jne    280 <dirtest+0xe0>
+  for(i = 0; i < NFILE; i++){
+     374:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    *p++ = '0' + n / i % 10;
+     37b:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  strcpy(path, "dd/");
+     380:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     387:	b8 4b 14 00 00       	mov    $0x144b,%eax
+  for(i = 100; i > 0; i /= 10)
+     38c:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     391:	89 44 24 04          	mov    %eax,0x4(%esp)
+  *p++ = c;
+     395:	bf 64 1b 00 00       	mov    $0x1b64,%edi
+  strcpy(path, "dd/");
+     39a:	e8 b1 07 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     39f:	b0 6c                	mov    $0x6c,%al
+     3a1:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     3a6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     3a9:	47                   	inc    %edi
+     3aa:	99                   	cltd
+     3ab:	f7 fb                	idiv   %ebx
+     3ad:	89 c1                	mov    %eax,%ecx
+     3af:	f7 e6                	mul    %esi
+     3b1:	c1 ea 03             	shr    $0x3,%edx
+     3b4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     3b7:	01 c0                	add    %eax,%eax
+     3b9:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     3bb:	89 d8                	mov    %ebx,%eax
+     3bd:	f7 e6                	mul    %esi
+    *p++ = '0' + n / i % 10;
+     3bf:	80 c1 30             	add    $0x30,%cl
+     3c2:	88 4f ff             	mov    %cl,-0x1(%edi)
+  for(i = 100; i > 0; i /= 10)
+     3c5:	89 d3                	mov    %edx,%ebx
+     3c7:	c1 eb 03             	shr    $0x3,%ebx
+     3ca:	81 ff 67 1b 00 00    	cmp    $0x1b67,%edi
+     3d0:	75 d4                	jne    3a6 <dirtest+0x206>
+    if((fd = open(name('l', i), O_RDONLY)) < 0)
+     3d2:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     3d9:	31 c0                	xor    %eax,%eax
+     3db:	a2 67 1b 00 00       	mov    %al,0x1b67
+    if((fd = open(name('l', i), O_RDONLY)) < 0)
+     3e0:	31 c0                	xor    %eax,%eax
+     3e2:	89 44 24 04          	mov    %eax,0x4(%esp)
+     3e6:	e8 e8 09 00 00       	call   dd3 <open>
+     3eb:	85 c0                	test   %eax,%eax
+     3ed:	89 c3                	mov    %eax,%ebx
+     3ef:	0f 88 9d 05 00 00    	js     992 <dirtest+0x7f2>
+    if(read(fd, &n, sizeof(n)) != sizeof(n) || n != i)
+     3f5:	89 1c 24             	mov    %ebx,(%esp)
+     3f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     3fb:	bf 04 00 00 00       	mov    $0x4,%edi
+     400:	89 7c 24 08          	mov    %edi,0x8(%esp)
+     404:	89 44 24 04          	mov    %eax,0x4(%esp)
+     408:	e8 9e 09 00 00       	call   dab <read>
+     40d:	83 f8 04             	cmp    $0x4,%eax
+     410:	0f 85 64 05 00 00    	jne    97a <dirtest+0x7da>
+     416:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     419:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+     41c:	0f 85 58 05 00 00    	jne    97a <dirtest+0x7da>
+    close(fd);
+     422:	89 1c 24             	mov    %ebx,(%esp)
+  *p++ = c;
+     425:	bf 64 1b 00 00       	mov    $0x1b64,%edi
+  for(i = 100; i > 0; i /= 10)
+     42a:	bb 64 00 00 00       	mov    $0x64,%ebx
+    close(fd);
+     42f:	e8 87 09 00 00       	call   dbb <close>
+  strcpy(path, "dd/");
+     434:	ba 4b 14 00 00       	mov    $0x144b,%edx
+     439:	89 54 24 04          	mov    %edx,0x4(%esp)
+     43d:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     444:	e8 07 07 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     449:	b1 66                	mov    $0x66,%cl
+     44b:	88 0d 63 1b 00 00    	mov    %cl,0x1b63
+    *p++ = '0' + n / i % 10;
+     451:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     454:	47                   	inc    %edi
+     455:	99                   	cltd
+     456:	f7 fb                	idiv   %ebx
+     458:	89 c1                	mov    %eax,%ecx
+     45a:	f7 e6                	mul    %esi
+     45c:	c1 ea 03             	shr    $0x3,%edx
+     45f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     462:	01 c0                	add    %eax,%eax
+     464:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     466:	89 d8                	mov    %ebx,%eax
+     468:	f7 e6                	mul    %esi
+    *p++ = '0' + n / i % 10;
+     46a:	80 c1 30             	add    $0x30,%cl
+     46d:	88 4f ff             	mov    %cl,-0x1(%edi)
+  for(i = 100; i > 0; i /= 10)
+     470:	89 d3                	mov    %edx,%ebx
+     472:	c1 eb 03             	shr    $0x3,%ebx
+     475:	81 ff 67 1b 00 00    	cmp    $0x1b67,%edi
+     47b:	75 d4                	jne    451 <dirtest+0x2b1>
+  if((fd = open(p, O_RDONLY)) < 0)
+     47d:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     484:	31 c0                	xor    %eax,%eax
+     486:	a2 67 1b 00 00       	mov    %al,0x1b67
+  if((fd = open(p, O_RDONLY)) < 0)
+     48b:	31 c0                	xor    %eax,%eax
+     48d:	89 44 24 04          	mov    %eax,0x4(%esp)
+     491:	e8 3d 09 00 00       	call   dd3 <open>
+     496:	85 c0                	test   %eax,%eax
+     498:	0f 88 da 00 00 00    	js     578 <dirtest+0x3d8>
+  close(fd);
+     49e:	89 04 24             	mov    %eax,(%esp)
+     4a1:	e8 15 09 00 00       	call   dbb <close>
+  for(i = 0; i < NFILE; i++){
+     4a6:	ff 45 d4             	incl   -0x2c(%ebp)
+     4a9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     4ac:	83 f8 64             	cmp    $0x64,%eax
+     4af:	0f 85 cb fe ff ff    	jne    380 <dirtest+0x1e0>
+  strcpy(path, "dd/");
+     4b5:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     4bc:	be 4b 14 00 00       	mov    $0x144b,%esi
+     4c1:	89 74 24 04          	mov    %esi,0x4(%esp)
+     4c5:	e8 86 06 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     4ca:	b0 78                	mov    $0x78,%al
+     4cc:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     4d1:	b8 30 30 30 00       	mov    $0x303030,%eax
+     4d6:	a3 64 1b 00 00       	mov    %eax,0x1b64
+  if((fd = open(p, O_RDONLY)) < 0)
+     4db:	31 c0                	xor    %eax,%eax
+     4dd:	89 44 24 04          	mov    %eax,0x4(%esp)
+     4e1:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     4e8:	e8 e6 08 00 00       	call   dd3 <open>
+     4ed:	85 c0                	test   %eax,%eax
+     4ef:	78 14                	js     505 <dirtest+0x365>
+  close(fd);
+     4f1:	89 04 24             	mov    %eax,(%esp)
+     4f4:	e8 c2 08 00 00       	call   dbb <close>
+    fail("negative lookup");
+     4f9:	c7 04 24 68 14 00 00 	movl   $0x1468,(%esp)
+     500:	e8 3b fb ff ff       	call   40 <fail>
+  mkfile(path, 0);
+     505:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     50c:	31 c9                	xor    %ecx,%ecx
+  if((fd = open(p, O_RDONLY)) < 0)
+     50e:	31 db                	xor    %ebx,%ebx
+  mkfile(path, 0);
+     510:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+     514:	e8 17 fc ff ff       	call   130 <mkfile>
+  if((fd = open(p, O_RDONLY)) < 0)
+     519:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     51d:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     524:	e8 aa 08 00 00       	call   dd3 <open>
+     529:	85 c0                	test   %eax,%eax
+     52b:	78 57                	js     584 <dirtest+0x3e4>
+  close(fd);
+     52d:	89 04 24             	mov    %eax,(%esp)
+     530:	e8 86 08 00 00       	call   dbb <close>
+  if(unlink(path) < 0)
+     535:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     53c:	e8 a2 08 00 00       	call   de3 <unlink>
+     541:	85 c0                	test   %eax,%eax
+     543:	0f 88 de 00 00 00    	js     627 <dirtest+0x487>
+  if((fd = open(p, O_RDONLY)) < 0)
+     549:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     550:	31 d2                	xor    %edx,%edx
+     552:	89 54 24 04          	mov    %edx,0x4(%esp)
+     556:	e8 78 08 00 00       	call   dd3 <open>
+     55b:	85 c0                	test   %eax,%eax
+     55d:	78 31                	js     590 <dirtest+0x3f0>
+  close(fd);
+     55f:	89 04 24             	mov    %eax,(%esp)
+     562:	e8 54 08 00 00       	call   dbb <close>
+    fail("lookup after unlink");
+     567:	c7 04 24 8c 14 00 00 	movl   $0x148c,(%esp)
+     56e:	e8 cd fa ff ff       	call   40 <fail>
+     573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     577:	90                   	nop
+      fail("lookup");
+     578:	c7 04 24 71 14 00 00 	movl   $0x1471,(%esp)
+     57f:	e8 bc fa ff ff       	call   40 <fail>
+    fail("lookup after create");
+     584:	c7 04 24 78 14 00 00 	movl   $0x1478,(%esp)
+     58b:	e8 b0 fa ff ff       	call   40 <fail>
+  for(i = 0; i < NFILE; i++){
+     590:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    *p++ = '0' + n / i % 10;
+     597:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+     59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  strcpy(path, "dd/");
+     5a0:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     5a7:	b8 4b 14 00 00       	mov    $0x144b,%eax
+  for(i = 100; i > 0; i /= 10)
+     5ac:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     5b1:	89 44 24 04          	mov    %eax,0x4(%esp)
+  *p++ = c;
+     5b5:	bf 64 1b 00 00       	mov    $0x1b64,%edi
+  strcpy(path, "dd/");
+     5ba:	e8 91 05 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     5bf:	b0 6c                	mov    $0x6c,%al
+     5c1:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     5c6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     5c9:	47                   	inc    %edi
+     5ca:	99                   	cltd
+     5cb:	f7 fb                	idiv   %ebx
+     5cd:	89 c1                	mov    %eax,%ecx
+     5cf:	f7 e6                	mul    %esi
+     5d1:	c1 ea 03             	shr    $0x3,%edx
+     5d4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     5d7:	01 c0                	add    %eax,%eax
+     5d9:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     5db:	89 d8                	mov    %ebx,%eax
+     5dd:	f7 e6                	mul    %esi
+    *p++ = '0' + n / i % 10;
+     5df:	80 c1 30             	add    $0x30,%cl
+     5e2:	88 4f ff             	mov    %cl,-0x1(%edi)
+  for(i = 100; i > 0; i /= 10)
+     5e5:	89 d3                	mov    %edx,%ebx
+     5e7:	c1 eb 03             	shr    $0x3,%ebx
+     5ea:	81 ff 67 1b 00 00    	cmp    $0x1b67,%edi
+     5f0:	75 d4                	jne    5c6 <dirtest+0x426>
+    if(unlink(name('l', i)) < 0 || exists(path))
+     5f2:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     5f9:	31 c0                	xor    %eax,%eax
+     5fb:	a2 67 1b 00 00       	mov    %al,0x1b67
+    if(unlink(name('l', i)) < 0 || exists(path))
+     600:	e8 de 07 00 00       	call   de3 <unlink>
+     605:	85 c0                	test   %eax,%eax
+     607:	78 1e                	js     627 <dirtest+0x487>
+  if((fd = open(p, O_RDONLY)) < 0)
+     609:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     610:	31 c0                	xor    %eax,%eax
+     612:	89 44 24 04          	mov    %eax,0x4(%esp)
+     616:	e8 b8 07 00 00       	call   dd3 <open>
+     61b:	85 c0                	test   %eax,%eax
+     61d:	78 19                	js     638 <dirtest+0x498>
+  close(fd);
+     61f:	89 04 24             	mov    %eax,(%esp)
+     622:	e8 94 07 00 00       	call   dbb <close>
+    fail("unlink");
+     627:	c7 04 24 99 14 00 00 	movl   $0x1499,(%esp)
+     62e:	e8 0d fa ff ff       	call   40 <fail>
+     633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     637:	90                   	nop
+  strcpy(path, "dd/");
+     638:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     63f:	bb 4b 14 00 00       	mov    $0x144b,%ebx
+  *p++ = c;
+     644:	bf 64 1b 00 00       	mov    $0x1b64,%edi
+  strcpy(path, "dd/");
+     649:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  for(i = 100; i > 0; i /= 10)
+     64d:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     652:	e8 f9 04 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     657:	b0 66                	mov    $0x66,%al
+     659:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     65e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     661:	47                   	inc    %edi
+     662:	99                   	cltd
+     663:	f7 fb                	idiv   %ebx
+     665:	89 c1                	mov    %eax,%ecx
+     667:	f7 e6                	mul    %esi
+     669:	c1 ea 03             	shr    $0x3,%edx
+     66c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     66f:	01 c0                	add    %eax,%eax
+     671:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     673:	89 d8                	mov    %ebx,%eax
+     675:	f7 e6                	mul    %esi
+    *p++ = '0' + n / i % 10;
+     677:	80 c1 30             	add    $0x30,%cl
+     67a:	88 4f ff             	mov    %cl,-0x1(%edi)
+  for(i = 100; i > 0; i /= 10)
+     67d:	89 d3                	mov    %edx,%ebx
+     67f:	c1 eb 03             	shr    $0x3,%ebx
+     682:	81 ff 67 1b 00 00    	cmp    $0x1b67,%edi
+     688:	75 d4                	jne    65e <dirtest+0x4be>
+    if(unlink(name('f', i)) < 0 || exists(path))
+     68a:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     691:	31 c9                	xor    %ecx,%ecx
+     693:	88 0d 67 1b 00 00    	mov    %cl,0x1b67
+    if(unlink(name('f', i)) < 0 || exists(path))
+     699:	e8 45 07 00 00       	call   de3 <unlink>
+     69e:	85 c0                	test   %eax,%eax
+     6a0:	78 85                	js     627 <dirtest+0x487>
+  if((fd = open(p, O_RDONLY)) < 0)
+     6a2:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     6a9:	31 d2                	xor    %edx,%edx
+     6ab:	89 54 24 04          	mov    %edx,0x4(%esp)
+     6af:	e8 1f 07 00 00       	call   dd3 <open>
+     6b4:	85 c0                	test   %eax,%eax
+     6b6:	0f 89 63 ff ff ff    	jns    61f <dirtest+0x47f>
+  for(i = 0; i < NFILE; i++){
+     6bc:	ff 45 d4             	incl   -0x2c(%ebp)
+     6bf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     6c2:	83 f8 64             	cmp    $0x64,%eax
+     6c5:	0f 85 d5 fe ff ff    	jne    5a0 <dirtest+0x400>
+  for(i = 0; i < NFILE; i++){
+     6cb:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    *p++ = '0' + n / i % 10;
+     6d2:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     6d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6de:	66 90                	xchg   %ax,%ax
+  strcpy(path, "dd/");
+     6e0:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     6e7:	b8 4b 14 00 00       	mov    $0x144b,%eax
+  for(i = 100; i > 0; i /= 10)
+     6ec:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     6f1:	89 44 24 04          	mov    %eax,0x4(%esp)
+  *p++ = c;
+     6f5:	be 64 1b 00 00       	mov    $0x1b64,%esi
+  strcpy(path, "dd/");
+     6fa:	e8 51 04 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     6ff:	b0 66                	mov    $0x66,%al
+     701:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     706:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     709:	46                   	inc    %esi
+     70a:	99                   	cltd
+     70b:	f7 fb                	idiv   %ebx
+     70d:	89 c1                	mov    %eax,%ecx
+     70f:	f7 e7                	mul    %edi
+     711:	c1 ea 03             	shr    $0x3,%edx
+     714:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     717:	01 c0                	add    %eax,%eax
+     719:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     71b:	89 d8                	mov    %ebx,%eax
+     71d:	f7 e7                	mul    %edi
+    *p++ = '0' + n / i % 10;
+     71f:	80 c1 30             	add    $0x30,%cl
+     722:	88 4e ff             	mov    %cl,-0x1(%esi)
+  for(i = 100; i > 0; i /= 10)
+     725:	89 d3                	mov    %edx,%ebx
+     727:	c1 eb 03             	shr    $0x3,%ebx
+     72a:	81 fe 67 1b 00 00    	cmp    $0x1b67,%esi
+     730:	75 d4                	jne    706 <dirtest+0x566>
+    mkfile(name('f', i), i);
+     732:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  *p = 0;
+     735:	31 c0                	xor    %eax,%eax
+    mkfile(name('f', i), i);
+     737:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     73e:	a2 67 1b 00 00       	mov    %al,0x1b67
+    mkfile(name('f', i), i);
+     743:	89 74 24 04          	mov    %esi,0x4(%esp)
+     747:	e8 e4 f9 ff ff       	call   130 <mkfile>
+  if((fd = open(p, O_RDONLY)) < 0)
+     74c:	31 c0                	xor    %eax,%eax
+     74e:	89 44 24 04          	mov    %eax,0x4(%esp)
+     752:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     759:	e8 75 06 00 00       	call   dd3 <open>
+     75e:	85 c0                	test   %eax,%eax
+     760:	0f 88 4a 01 00 00    	js     8b0 <dirtest+0x710>
+  close(fd);
+     766:	89 04 24             	mov    %eax,(%esp)
+  for(i = 0; i < NFILE; i++){
+     769:	46                   	inc    %esi
+  close(fd);
+     76a:	e8 4c 06 00 00       	call   dbb <close>
+  for(i = 0; i < NFILE; i++){
+     76f:	83 fe 64             	cmp    $0x64,%esi
+     772:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     775:	0f 85 65 ff ff ff    	jne    6e0 <dirtest+0x540>
+  for(i = 0; i < NFILE; i++)
+     77b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    *p++ = '0' + n / i % 10;
+     782:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78e:	66 90                	xchg   %ax,%ax
+  strcpy(path, "dd/");
+     790:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     797:	bb 4b 14 00 00       	mov    $0x144b,%ebx
+  *p++ = c;
+     79c:	be 64 1b 00 00       	mov    $0x1b64,%esi
+  strcpy(path, "dd/");
+     7a1:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  for(i = 100; i > 0; i /= 10)
+     7a5:	bb 64 00 00 00       	mov    $0x64,%ebx
+  strcpy(path, "dd/");
+     7aa:	e8 a1 03 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     7af:	b0 66                	mov    $0x66,%al
+     7b1:	a2 63 1b 00 00       	mov    %al,0x1b63
+    *p++ = '0' + n / i % 10;
+     7b6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7b9:	46                   	inc    %esi
+     7ba:	99                   	cltd
+     7bb:	f7 fb                	idiv   %ebx
+     7bd:	89 c1                	mov    %eax,%ecx
+     7bf:	f7 e7                	mul    %edi
+     7c1:	c1 ea 03             	shr    $0x3,%edx
+     7c4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     7c7:	01 c0                	add    %eax,%eax
+     7c9:	29 c1                	sub    %eax,%ecx
+  for(i = 100; i > 0; i /= 10)
+     7cb:	89 d8                	mov    %ebx,%eax
+     7cd:	f7 e7                	mul    %edi
+    *p++ = '0' + n / i % 10;
+     7cf:	80 c1 30             	add    $0x30,%cl
+     7d2:	88 4e ff             	mov    %cl,-0x1(%esi)
+  for(i = 100; i > 0; i /= 10)
+     7d5:	89 d3                	mov    %edx,%ebx
+     7d7:	c1 eb 03             	shr    $0x3,%ebx
+     7da:	81 fe 67 1b 00 00    	cmp    $0x1b67,%esi
+     7e0:	75 d4                	jne    7b6 <dirtest+0x616>
+    if(unlink(name('f', i)) < 0)
+     7e2:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     7e9:	31 c9                	xor    %ecx,%ecx
+     7eb:	88 0d 67 1b 00 00    	mov    %cl,0x1b67
+    if(unlink(name('f', i)) < 0)
+     7f1:	e8 ed 05 00 00       	call   de3 <unlink>
+     7f6:	85 c0                	test   %eax,%eax
+     7f8:	0f 88 29 fe ff ff    	js     627 <dirtest+0x487>
+  for(i = 0; i < NFILE; i++)
+     7fe:	ff 45 d4             	incl   -0x2c(%ebp)
+     801:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     804:	83 f8 64             	cmp    $0x64,%eax
+     807:	75 87                	jne    790 <dirtest+0x5f0>
+  strcpy(path, "dd");
+     809:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     810:	ba 5b 14 00 00       	mov    $0x145b,%edx
+     815:	89 54 24 04          	mov    %edx,0x4(%esp)
+     819:	e8 32 03 00 00       	call   b50 <strcpy>
+  if(unlink("dd") < 0)
+     81e:	c7 04 24 5b 14 00 00 	movl   $0x145b,(%esp)
+     825:	e8 b9 05 00 00       	call   de3 <unlink>
+     82a:	85 c0                	test   %eax,%eax
+     82c:	0f 88 78 01 00 00    	js     9aa <dirtest+0x80a>
+  strcpy(path, "dd/");
+     832:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     839:	b8 4b 14 00 00       	mov    $0x144b,%eax
+    *p++ = '0' + n / i % 10;
+     83e:	31 f6                	xor    %esi,%esi
+  strcpy(path, "dd/");
+     840:	89 44 24 04          	mov    %eax,0x4(%esp)
+  for(i = 100; i > 0; i /= 10)
+     844:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  strcpy(path, "dd/");
+     849:	e8 02 03 00 00       	call   b50 <strcpy>
+  *p++ = c;
+     84e:	b0 66                	mov    $0x66,%al
+  for(i = 100; i > 0; i /= 10)
+     850:	ba 64 00 00 00       	mov    $0x64,%edx
+  *p++ = c;
+     855:	a2 63 1b 00 00       	mov    %al,0x1b63
+     85a:	b9 64 1b 00 00       	mov    $0x1b64,%ecx
+    *p++ = '0' + n / i % 10;
+     85f:	8d 42 01             	lea    0x1(%edx),%eax
+     862:	41                   	inc    %ecx
+     863:	83 f8 02             	cmp    $0x2,%eax
+     866:	89 f0                	mov    %esi,%eax
+     868:	0f 46 c2             	cmovbe %edx,%eax
+     86b:	04 30                	add    $0x30,%al
+     86d:	88 41 ff             	mov    %al,-0x1(%ecx)
+  for(i = 100; i > 0; i /= 10)
+     870:	89 d0                	mov    %edx,%eax
+     872:	f7 e3                	mul    %ebx
+     874:	c1 ea 03             	shr    $0x3,%edx
+     877:	81 f9 67 1b 00 00    	cmp    $0x1b67,%ecx
+     87d:	75 e0                	jne    85f <dirtest+0x6bf>
+  if((fd = open(p, O_RDONLY)) < 0)
+     87f:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+  *p = 0;
+     886:	31 c0                	xor    %eax,%eax
+     888:	a2 67 1b 00 00       	mov    %al,0x1b67
+  if((fd = open(p, O_RDONLY)) < 0)
+     88d:	31 c0                	xor    %eax,%eax
+     88f:	89 44 24 04          	mov    %eax,0x4(%esp)
+     893:	e8 3b 05 00 00       	call   dd3 <open>
+     898:	85 c0                	test   %eax,%eax
+     89a:	78 20                	js     8bc <dirtest+0x71c>
+  close(fd);
+     89c:	89 04 24             	mov    %eax,(%esp)
+     89f:	e8 17 05 00 00       	call   dbb <close>
+    fail("lookup in removed directory");
+     8a4:	c7 04 24 bd 14 00 00 	movl   $0x14bd,(%esp)
+     8ab:	e8 90 f7 ff ff       	call   40 <fail>
+      fail("lookup after re-create");
+     8b0:	c7 04 24 a0 14 00 00 	movl   $0x14a0,(%esp)
+     8b7:	e8 84 f7 ff ff       	call   40 <fail>
+  if(mkdir("dd") < 0)
+     8bc:	c7 04 24 5b 14 00 00 	movl   $0x145b,(%esp)
+     8c3:	e8 33 05 00 00       	call   dfb <mkdir>
+     8c8:	85 c0                	test   %eax,%eax
+     8ca:	0f 88 ce 00 00 00    	js     99e <dirtest+0x7fe>
+  strcpy(path, "dd/");
+     8d0:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     8d7:	bb 4b 14 00 00       	mov    $0x144b,%ebx
+    *p++ = '0' + n / i % 10;
+     8dc:	31 f6                	xor    %esi,%esi
+  strcpy(path, "dd/");
+     8de:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  for(i = 100; i > 0; i /= 10)
+     8e2:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  strcpy(path, "dd/");
+     8e7:	e8 64 02 00 00       	call   b50 <strcpy>
+  for(i = 100; i > 0; i /= 10)
+     8ec:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  *p++ = c;
+     8ef:	b0 66                	mov    $0x66,%al
+     8f1:	a2 63 1b 00 00       	mov    %al,0x1b63
+     8f6:	b9 64 1b 00 00       	mov    $0x1b64,%ecx
+    *p++ = '0' + n / i % 10;
+     8fb:	8d 42 01             	lea    0x1(%edx),%eax
+     8fe:	41                   	inc    %ecx
+     8ff:	83 f8 02             	cmp    $0x2,%eax
+     902:	89 f0                	mov    %esi,%eax
+     904:	0f 46 c2             	cmovbe %edx,%eax
+     907:	04 30                	add    $0x30,%al
+     909:	88 41 ff             	mov    %al,-0x1(%ecx)
+  for(i = 100; i > 0; i /= 10)
+     90c:	89 d0                	mov    %edx,%eax
+     90e:	f7 e3                	mul    %ebx
+     910:	c1 ea 03             	shr    $0x3,%edx
+     913:	81 f9 67 1b 00 00    	cmp    $0x1b67,%ecx
+     919:	75 e0                	jne    8fb <dirtest+0x75b>
+  if((fd = open(p, O_RDONLY)) < 0)
+     91b:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     922:	31 c9                	xor    %ecx,%ecx
+  *p = 0;
+     924:	31 d2                	xor    %edx,%edx
+  if((fd = open(p, O_RDONLY)) < 0)
+     926:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  *p = 0;
+     92a:	88 15 67 1b 00 00    	mov    %dl,0x1b67
+  if((fd = open(p, O_RDONLY)) < 0)
+     930:	e8 9e 04 00 00       	call   dd3 <open>
+     935:	85 c0                	test   %eax,%eax
+     937:	78 14                	js     94d <dirtest+0x7ad>
+  close(fd);
+     939:	89 04 24             	mov    %eax,(%esp)
+     93c:	e8 7a 04 00 00       	call   dbb <close>
+    fail("lookup in new directory");
+     941:	c7 04 24 d9 14 00 00 	movl   $0x14d9,(%esp)
+     948:	e8 f3 f6 ff ff       	call   40 <fail>
+  strcpy(path, "dd");
+     94d:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     954:	b8 5b 14 00 00       	mov    $0x145b,%eax
+     959:	89 44 24 04          	mov    %eax,0x4(%esp)
+     95d:	e8 ee 01 00 00       	call   b50 <strcpy>
+  if(unlink("dd") < 0)
+     962:	c7 04 24 5b 14 00 00 	movl   $0x145b,(%esp)
+     969:	e8 75 04 00 00       	call   de3 <unlink>
+     96e:	85 c0                	test   %eax,%eax
+     970:	78 38                	js     9aa <dirtest+0x80a>
+}
+     972:	83 c4 3c             	add    $0x3c,%esp
+     975:	5b                   	pop    %ebx
+     976:	5e                   	pop    %esi
+     977:	5f                   	pop    %edi
+     978:	5d                   	pop    %ebp
+     979:	c3                   	ret
+      fail("read");
+     97a:	c7 04 24 63 14 00 00 	movl   $0x1463,(%esp)
+     981:	e8 ba f6 ff ff       	call   40 <fail>
+      fail("link");
+     986:	c7 04 24 9b 14 00 00 	movl   $0x149b,(%esp)
+     98d:	e8 ae f6 ff ff       	call   40 <fail>
+      fail("open");
+     992:	c7 04 24 5e 14 00 00 	movl   $0x145e,(%esp)
+     999:	e8 a2 f6 ff ff       	call   40 <fail>
+    fail("mkdir dd");
+     99e:	c7 04 24 55 14 00 00 	movl   $0x1455,(%esp)
+     9a5:	e8 96 f6 ff ff       	call   40 <fail>
+    fail("rmdir");
+     9aa:	c7 04 24 b7 14 00 00 	movl   $0x14b7,(%esp)
+     9b1:	e8 8a f6 ff ff       	call   40 <fail>
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <bigtest>:
+{
+     9c0:	55                   	push   %ebp
+  printf(1, "dirtest: file of %d blocks\n", BIGBLOCKS);
+     9c1:	b8 9e 00 00 00       	mov    $0x9e,%eax
+{
+     9c6:	89 e5                	mov    %esp,%ebp
+     9c8:	56                   	push   %esi
+     9c9:	53                   	push   %ebx
+     9ca:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "dirtest: file of %d blocks\n", BIGBLOCKS);
+     9cd:	89 44 24 08          	mov    %eax,0x8(%esp)
+     9d1:	b8 f1 14 00 00       	mov    $0x14f1,%eax
+     9d6:	89 44 24 04          	mov    %eax,0x4(%esp)
+     9da:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     9e1:	e8 7a 05 00 00       	call   f60 <printf>
+  strcpy(path, "dirtest.big");
+     9e6:	ba 0d 15 00 00       	mov    $0x150d,%edx
+     9eb:	89 54 24 04          	mov    %edx,0x4(%esp)
+     9ef:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     9f6:	e8 55 01 00 00       	call   b50 <strcpy>
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0)
+     9fb:	b9 02 02 00 00       	mov    $0x202,%ecx
+     a00:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+     a04:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     a0b:	e8 c3 03 00 00       	call   dd3 <open>
+     a10:	85 c0                	test   %eax,%eax
+     a12:	0f 88 1d 01 00 00    	js     b35 <bigtest+0x175>
+     a18:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     a1a:	31 db                	xor    %ebx,%ebx
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, sizeof(buf));
+     a20:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     a24:	b8 00 02 00 00       	mov    $0x200,%eax
+     a29:	89 44 24 08          	mov    %eax,0x8(%esp)
+     a2d:	c7 04 24 60 19 00 00 	movl   $0x1960,(%esp)
+     a34:	e8 c7 01 00 00       	call   c00 <memset>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     a39:	b8 00 02 00 00       	mov    $0x200,%eax
+     a3e:	89 44 24 08          	mov    %eax,0x8(%esp)
+     a42:	b8 60 19 00 00       	mov    $0x1960,%eax
+     a47:	89 44 24 04          	mov    %eax,0x4(%esp)
+     a4b:	89 34 24             	mov    %esi,(%esp)
+    ((int*)buf)[0] = i;
+     a4e:	89 1d 60 19 00 00    	mov    %ebx,0x1960
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     a54:	e8 5a 03 00 00       	call   db3 <write>
+     a59:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a5e:	0f 85 a1 00 00 00    	jne    b05 <bigtest+0x145>
+  for(i = 0; i < BIGBLOCKS; i++){
+     a64:	43                   	inc    %ebx
+     a65:	81 fb 9e 00 00 00    	cmp    $0x9e,%ebx
+     a6b:	75 b3                	jne    a20 <bigtest+0x60>
+  close(fd);
+     a6d:	89 34 24             	mov    %esi,(%esp)
+     a70:	e8 46 03 00 00       	call   dbb <close>
+  if((fd = open(path, O_RDONLY)) < 0)
+     a75:	31 c9                	xor    %ecx,%ecx
+     a77:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+     a7b:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     a82:	e8 4c 03 00 00       	call   dd3 <open>
+     a87:	85 c0                	test   %eax,%eax
+     a89:	89 c6                	mov    %eax,%esi
+     a8b:	0f 88 98 00 00 00    	js     b29 <bigtest+0x169>
+  for(i = 0; i < BIGBLOCKS; i++){
+     a91:	31 db                	xor    %ebx,%ebx
+     a93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf))
+     aa0:	89 34 24             	mov    %esi,(%esp)
+     aa3:	b8 00 02 00 00       	mov    $0x200,%eax
+     aa8:	ba 60 19 00 00       	mov    $0x1960,%edx
+     aad:	89 44 24 08          	mov    %eax,0x8(%esp)
+     ab1:	89 54 24 04          	mov    %edx,0x4(%esp)
+     ab5:	e8 f1 02 00 00       	call   dab <read>
+     aba:	3d 00 02 00 00       	cmp    $0x200,%eax
+     abf:	75 50                	jne    b11 <bigtest+0x151>
+    if(((int*)buf)[0] != i || buf[BSIZE-1] != (char)i)
+     ac1:	39 1d 60 19 00 00    	cmp    %ebx,0x1960
+     ac7:	75 30                	jne    af9 <bigtest+0x139>
+     ac9:	38 1d 5f 1b 00 00    	cmp    %bl,0x1b5f
+     acf:	75 28                	jne    af9 <bigtest+0x139>
+  for(i = 0; i < BIGBLOCKS; i++){
+     ad1:	43                   	inc    %ebx
+     ad2:	81 fb 9e 00 00 00    	cmp    $0x9e,%ebx
+     ad8:	75 c6                	jne    aa0 <bigtest+0xe0>
+  close(fd);
+     ada:	89 34 24             	mov    %esi,(%esp)
+     add:	e8 d9 02 00 00       	call   dbb <close>
+  if(unlink(path) < 0)
+     ae2:	c7 04 24 60 1b 00 00 	movl   $0x1b60,(%esp)
+     ae9:	e8 f5 02 00 00       	call   de3 <unlink>
+     aee:	85 c0                	test   %eax,%eax
+     af0:	78 2b                	js     b1d <bigtest+0x15d>
+}
+     af2:	83 c4 10             	add    $0x10,%esp
+     af5:	5b                   	pop    %ebx
+     af6:	5e                   	pop    %esi
+     af7:	5d                   	pop    %ebp
+     af8:	c3                   	ret
+      fail("read back");
+     af9:	c7 04 24 19 15 00 00 	movl   $0x1519,(%esp)
+     b00:	e8 3b f5 ff ff       	call   40 <fail>
+      fail("write");
+     b05:	c7 04 24 4f 14 00 00 	movl   $0x144f,(%esp)
+     b0c:	e8 2f f5 ff ff       	call   40 <fail>
+      fail("read");
+     b11:	c7 04 24 63 14 00 00 	movl   $0x1463,(%esp)
+     b18:	e8 23 f5 ff ff       	call   40 <fail>
+    fail("unlink");
+     b1d:	c7 04 24 99 14 00 00 	movl   $0x1499,(%esp)
+     b24:	e8 17 f5 ff ff       	call   40 <fail>
+    fail("open");
+     b29:	c7 04 24 5e 14 00 00 	movl   $0x145e,(%esp)
+     b30:	e8 0b f5 ff ff       	call   40 <fail>
+    fail("create");
+     b35:	c7 04 24 85 14 00 00 	movl   $0x1485,(%esp)
+     b3c:	e8 ff f4 ff ff       	call   40 <fail>
+     b41:	66 90                	xchg   %ax,%ax
+     b43:	66 90                	xchg   %ax,%ax
+     b45:	66 90                	xchg   %ax,%ax
+     b47:	66 90                	xchg   %ax,%ax
+     b49:	66 90                	xchg   %ax,%ax
+     b4b:	66 90                	xchg   %ax,%ax
+     b4d:	66 90                	xchg   %ax,%ax
+     b4f:	90                   	nop
+
+00000b50 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     b50:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     b51:	31 c0                	xor    %eax,%eax
+{
+     b53:	89 e5                	mov    %esp,%ebp
+     b55:	53                   	push   %ebx
+     b56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     b59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     b60:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     b64:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     b67:	40                   	inc    %eax
+     b68:	84 d2                	test   %dl,%dl
+     b6a:	75 f4                	jne    b60 <strcpy+0x10>
+    ;
+  return os;
+}
+     b6c:	5b                   	pop    %ebx
+     b6d:	89 c8                	mov    %ecx,%eax
+     b6f:	5d                   	pop    %ebp
+     b70:	c3                   	ret
+     b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+
+00000b80 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	53                   	push   %ebx
+     b84:	8b 55 08             	mov    0x8(%ebp),%edx
+     b87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+     b8a:	0f b6 02             	movzbl (%edx),%eax
+     b8d:	84 c0                	test   %al,%al
+     b8f:	75 15                	jne    ba6 <strcmp+0x26>
+     b91:	eb 30                	jmp    bc3 <strcmp+0x43>
+     b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b97:	90                   	nop
+     b98:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b9c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+     b9f:	42                   	inc    %edx
+  while(*p && *p == *q)
+     ba0:	84 c0                	test   %al,%al
+     ba2:	74 14                	je     bb8 <strcmp+0x38>
+    p++, q++;
+     ba4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+     ba6:	0f b6 0b             	movzbl (%ebx),%ecx
+     ba9:	38 c1                	cmp    %al,%cl
+     bab:	74 eb                	je     b98 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+     bad:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+     bae:	29 c8                	sub    %ecx,%eax
+}
+     bb0:	5d                   	pop    %ebp
+     bb1:	c3                   	ret
+     bb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     bb8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+     bbc:	31 c0                	xor    %eax,%eax
+}
+     bbe:	5b                   	pop    %ebx
+     bbf:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+     bc0:	29 c8                	sub    %ecx,%eax
+}
+     bc2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     bc3:	0f b6 0b             	movzbl (%ebx),%ecx
+     bc6:	31 c0                	xor    %eax,%eax
+     bc8:	eb e3                	jmp    bad <strcmp+0x2d>
+     bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000bd0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     bd6:	80 3a 00             	cmpb   $0x0,(%edx)
+     bd9:	74 15                	je     bf0 <strlen+0x20>
+     bdb:	31 c0                	xor    %eax,%eax
+     bdd:	8d 76 00             	lea    0x0(%esi),%esi
+     be0:	40                   	inc    %eax
+     be1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     be5:	89 c1                	mov    %eax,%ecx
+     be7:	75 f7                	jne    be0 <strlen+0x10>
+    ;
+  return n;
+}
+     be9:	5d                   	pop    %ebp
+     bea:	89 c8                	mov    %ecx,%eax
+     bec:	c3                   	ret
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+     bf0:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+     bf1:	31 c9                	xor    %ecx,%ecx
+}
+     bf3:	89 c8                	mov    %ecx,%eax
+     bf5:	c3                   	ret
+     bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c00 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	57                   	push   %edi
+     c04:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c0d:	89 d7                	mov    %edx,%edi
+     c0f:	fc                   	cld
+     c10:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     c12:	5f                   	pop    %edi
+     c13:	89 d0                	mov    %edx,%eax
+     c15:	5d                   	pop    %ebp
+     c16:	c3                   	ret
+     c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1e:	66 90                	xchg   %ax,%ax
+
+00000c20 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	8b 45 08             	mov    0x8(%ebp),%eax
+     c26:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     c2a:	0f b6 10             	movzbl (%eax),%edx
+     c2d:	84 d2                	test   %dl,%dl
+     c2f:	75 10                	jne    c41 <strchr+0x21>
+     c31:	eb 1d                	jmp    c50 <strchr+0x30>
+     c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c37:	90                   	nop
+     c38:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     c3c:	40                   	inc    %eax
+     c3d:	84 d2                	test   %dl,%dl
+     c3f:	74 0f                	je     c50 <strchr+0x30>
+    if(*s == c)
+     c41:	38 d1                	cmp    %dl,%cl
+     c43:	75 f3                	jne    c38 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     c45:	5d                   	pop    %ebp
+     c46:	c3                   	ret
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+     c50:	5d                   	pop    %ebp
+  return 0;
+     c51:	31 c0                	xor    %eax,%eax
+}
+     c53:	c3                   	ret
+     c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	57                   	push   %edi
+     c64:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     c65:	31 f6                	xor    %esi,%esi
+{
+     c67:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+     c68:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+     c6b:	83 ec 3c             	sub    $0x3c,%esp
+     c6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+     c71:	eb 32                	jmp    ca5 <gets+0x45>
+     c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c77:	90                   	nop
+    cc = read(0, &c, 1);
+     c78:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     c7c:	b8 01 00 00 00       	mov    $0x1,%eax
+     c81:	89 44 24 08          	mov    %eax,0x8(%esp)
+     c85:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     c8c:	e8 1a 01 00 00       	call   dab <read>
+    if(cc < 1)
+     c91:	85 c0                	test   %eax,%eax
+     c93:	7e 19                	jle    cae <gets+0x4e>
+      break;
+    buf[i++] = c;
+     c95:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c99:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+     c9d:	3c 0a                	cmp    $0xa,%al
+     c9f:	74 10                	je     cb1 <gets+0x51>
+     ca1:	3c 0d                	cmp    $0xd,%al
+     ca3:	74 0c                	je     cb1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+     ca5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     ca8:	46                   	inc    %esi
+     ca9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+     cac:	7c ca                	jl     c78 <gets+0x18>
+     cae:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+     cb1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+     cb5:	83 c4 3c             	add    $0x3c,%esp
+     cb8:	89 d8                	mov    %ebx,%eax
+     cba:	5b                   	pop    %ebx
+     cbb:	5e                   	pop    %esi
+     cbc:	5f                   	pop    %edi
+     cbd:	5d                   	pop    %ebp
+     cbe:	c3                   	ret
+     cbf:	90                   	nop
+
+00000cc0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     cc0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     cc1:	31 c0                	xor    %eax,%eax
+{
+     cc3:	89 e5                	mov    %esp,%ebp
+     cc5:	83 ec 18             	sub    $0x18,%esp
+     cc8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+     ccb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+     cce:	89 44 24 04          	mov    %eax,0x4(%esp)
+     cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd5:	89 04 24             	mov    %eax,(%esp)
+     cd8:	e8 f6 00 00 00       	call   dd3 <open>
+  if(fd < 0)
+     cdd:	85 c0                	test   %eax,%eax
+     cdf:	78 2f                	js     d10 <stat+0x50>
+     ce1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     ce3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ce6:	89 1c 24             	mov    %ebx,(%esp)
+     ce9:	89 44 24 04          	mov    %eax,0x4(%esp)
+     ced:	e8 f9 00 00 00       	call   deb <fstat>
+  close(fd);
+     cf2:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     cf5:	89 c6                	mov    %eax,%esi
+  close(fd);
+     cf7:	e8 bf 00 00 00       	call   dbb <close>
+  return r;
+}
+     cfc:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+     cff:	89 f0                	mov    %esi,%eax
+     d01:	8b 75 fc             	mov    -0x4(%ebp),%esi
+     d04:	89 ec                	mov    %ebp,%esp
+     d06:	5d                   	pop    %ebp
+     d07:	c3                   	ret
+     d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+    return -1;
+     d10:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d15:	eb e5                	jmp    cfc <stat+0x3c>
+     d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1e:	66 90                	xchg   %ax,%ax
+
+00000d20 <atoi>:
+
+int
+atoi(const char *s)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	53                   	push   %ebx
+     d24:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     d27:	0f be 02             	movsbl (%edx),%eax
+     d2a:	88 c1                	mov    %al,%cl
+     d2c:	80 e9 30             	sub    $0x30,%cl
+     d2f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     d32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     d37:	77 1c                	ja     d55 <atoi+0x35>
+     d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+     d40:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     d43:	42                   	inc    %edx
+     d44:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     d48:	0f be 02             	movsbl (%edx),%eax
+     d4b:	88 c3                	mov    %al,%bl
+     d4d:	80 eb 30             	sub    $0x30,%bl
+     d50:	80 fb 09             	cmp    $0x9,%bl
+     d53:	76 eb                	jbe    d40 <atoi+0x20>
+  return n;
+}
+     d55:	5b                   	pop    %ebx
+     d56:	89 c8                	mov    %ecx,%eax
+     d58:	5d                   	pop    %ebp
+     d59:	c3                   	ret
+     d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d60 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	56                   	push   %esi
+     d65:	8b 45 10             	mov    0x10(%ebp),%eax
+     d68:	8b 55 08             	mov    0x8(%ebp),%edx
+     d6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     d6e:	85 c0                	test   %eax,%eax
+     d70:	7e 13                	jle    d85 <memmove+0x25>
+     d72:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     d74:	89 d7                	mov    %edx,%edi
+     d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     d80:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     d81:	39 f8                	cmp    %edi,%eax
+     d83:	75 fb                	jne    d80 <memmove+0x20>
+  return vdst;
+}
+     d85:	5e                   	pop    %esi
+     d86:	89 d0                	mov    %edx,%eax
+     d88:	5f                   	pop    %edi
+     d89:	5d                   	pop    %ebp
+     d8a:	c3                   	ret
+
+00000d8b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     d8b:	b8 01 00 00 00       	mov    $0x1,%eax
+     d90:	cd 40                	int    $0x40
+     d92:	c3                   	ret
+
+00000d93 <exit>:
+SYSCALL(exit)
+     d93:	b8 02 00 00 00       	mov    $0x2,%eax
+     d98:	cd 40                	int    $0x40
+     d9a:	c3                   	ret
+
+00000d9b <wait>:
+SYSCALL(wait)
+     d9b:	b8 03 00 00 00       	mov    $0x3,%eax
+     da0:	cd 40                	int    $0x40
+     da2:	c3                   	ret
+
+00000da3 <pipe>:
+SYSCALL(pipe)
+     da3:	b8 04 00 00 00       	mov    $0x4,%eax
+     da8:	cd 40                	int    $0x40
+     daa:	c3                   	ret
+
+00000dab <read>:
+SYSCALL(read)
+     dab:	b8 05 00 00 00       	mov    $0x5,%eax
+     db0:	cd 40                	int    $0x40
+     db2:	c3                   	ret
+
+00000db3 <write>:
+SYSCALL(write)
+     db3:	b8 10 00 00 00       	mov    $0x10,%eax
+     db8:	cd 40                	int    $0x40
+     dba:	c3                   	ret
+
+00000dbb <close>:
+SYSCALL(close)
+     dbb:	b8 15 00 00 00       	mov    $0x15,%eax
+     dc0:	cd 40                	int    $0x40
+     dc2:	c3                   	ret
+
+00000dc3 <kill>:
+SYSCALL(kill)
+     dc3:	b8 06 00 00 00       	mov    $0x6,%eax
+     dc8:	cd 40                	int    $0x40
+     dca:	c3                   	ret
+
+00000dcb <exec>:
+SYSCALL(exec)
+     dcb:	b8 07 00 00 00       	mov    $0x7,%eax
+     dd0:	cd 40                	int    $0x40
+     dd2:	c3                   	ret
+
+00000dd3 <open>:
+SYSCALL(open)
+     dd3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     dd8:	cd 40                	int    $0x40
+     dda:	c3                   	ret
+
+00000ddb <mknod>:
+SYSCALL(mknod)
+     ddb:	b8 11 00 00 00       	mov    $0x11,%eax
+     de0:	cd 40                	int    $0x40
+     de2:	c3                   	ret
+
+00000de3 <unlink>:
+SYSCALL(unlink)
+     de3:	b8 12 00 00 00       	mov    $0x12,%eax
+     de8:	cd 40                	int    $0x40
+     dea:	c3                   	ret
+
+00000deb <fstat>:
+SYSCALL(fstat)
+     deb:	b8 08 00 00 00       	mov    $0x8,%eax
+     df0:	cd 40                	int    $0x40
+     df2:	c3                   	ret
+
+00000df3 <link>:
+SYSCALL(link)
+     df3:	b8 13 00 00 00       	mov    $0x13,%eax
+     df8:	cd 40                	int    $0x40
+     dfa:	c3                   	ret
+
+00000dfb <mkdir>:
+SYSCALL(mkdir)
+     dfb:	b8 14 00 00 00       	mov    $0x14,%eax
+     e00:	cd 40                	int    $0x40
+     e02:	c3                   	ret
+
+00000e03 <chdir>:
+SYSCALL(chdir)
+     e03:	b8 09 00 00 00       	mov    $0x9,%eax
+     e08:	cd 40                	int    $0x40
+     e0a:	c3                   	ret
+
+00000e0b <dup>:
+SYSCALL(dup)
+     e0b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     e10:	cd 40                	int    $0x40
+     e12:	c3                   	ret
+
+00000e13 <getpid>:
+SYSCALL(getpid)
+     e13:	b8 0b 00 00 00       	mov    $0xb,%eax
+     e18:	cd 40                	int    $0x40
+     e1a:	c3                   	ret
+
+00000e1b <sbrk>:
+SYSCALL(sbrk)
+     e1b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+
+00000e23 <sleep>:
+SYSCALL(sleep)
+     e23:	b8 0d 00 00 00       	mov    $0xd,%eax
+     e28:	cd 40                	int    $0x40
+     e2a:	c3                   	ret
+
+00000e2b <uptime>:
+SYSCALL(uptime)
+     e2b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     e30:	cd 40                	int    $0x40
+     e32:	c3                   	ret
+
+00000e33 <detach>:
+SYSCALL(detach)
+     e33:	b8 16 00 00 00       	mov    $0x16,%eax
+     e38:	cd 40                	int    $0x40
+     e3a:	c3                   	ret
+
+00000e3b <policy>:
+SYSCALL(policy)
+     e3b:	b8 17 00 00 00       	mov    $0x17,%eax
+     e40:	cd 40                	int    $0x40
+     e42:	c3                   	ret
+
+00000e43 <priority>:
+SYSCALL(priority)
+     e43:	b8 18 00 00 00       	mov    $0x18,%eax
+     e48:	cd 40                	int    $0x40
+     e4a:	c3                   	ret
+
+00000e4b <wait_stat>:
+SYSCALL(wait_stat)
+     e4b:	b8 19 00 00 00       	mov    $0x19,%eax
+     e50:	cd 40                	int    $0x40
+     e52:	c3                   	ret
+
+00000e53 <lockstat>:
+SYSCALL(lockstat)
+     e53:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     e58:	cd 40                	int    $0x40
+     e5a:	c3                   	ret
+
+00000e5b <mmap>:
+SYSCALL(mmap)
+     e5b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     e60:	cd 40                	int    $0x40
+     e62:	c3                   	ret
+
+00000e63 <munmap>:
+SYSCALL(munmap)
+     e63:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     e68:	cd 40                	int    $0x40
+     e6a:	c3                   	ret
+
+00000e6b <shmget>:
+SYSCALL(shmget)
+     e6b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     e70:	cd 40                	int    $0x40
+     e72:	c3                   	ret
+
+00000e73 <shmat>:
+SYSCALL(shmat)
+     e73:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     e78:	cd 40                	int    $0x40
+     e7a:	c3                   	ret
+
+00000e7b <shmdt>:
+SYSCALL(shmdt)
+     e7b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     e80:	cd 40                	int    $0x40
+     e82:	c3                   	ret
+
+00000e83 <memstat>:
+SYSCALL(memstat)
+     e83:	b8 20 00 00 00       	mov    $0x20,%eax
+     e88:	cd 40                	int    $0x40
+     e8a:	c3                   	ret
+
+00000e8b <getprocs>:
+SYSCALL(getprocs)
+     e8b:	b8 21 00 00 00       	mov    $0x21,%eax
+     e90:	cd 40                	int    $0x40
+     e92:	c3                   	ret
+
+00000e93 <shmctl>:
+SYSCALL(shmctl)
+     e93:	b8 22 00 00 00       	mov    $0x22,%eax
+     e98:	cd 40                	int    $0x40
+     e9a:	c3                   	ret
+     e9b:	66 90                	xchg   %ax,%ax
+     e9d:	66 90                	xchg   %ax,%ax
+     e9f:	90                   	nop
+
+00000ea0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	89 cb                	mov    %ecx,%ebx
+     ea8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     eab:	89 d1                	mov    %edx,%ecx
+{
+     ead:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+     eb0:	89 d0                	mov    %edx,%eax
+     eb2:	c1 e8 1f             	shr    $0x1f,%eax
+     eb5:	84 c0                	test   %al,%al
+     eb7:	0f 84 93 00 00 00    	je     f50 <printint+0xb0>
+     ebd:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     ec1:	0f 84 89 00 00 00    	je     f50 <printint+0xb0>
+    x = -xx;
+     ec7:	f7 d9                	neg    %ecx
+    neg = 1;
+     ec9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ece:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     ed5:	8d 75 d7             	lea    -0x29(%ebp),%esi
+     ed8:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     edf:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+     ee0:	89 c8                	mov    %ecx,%eax
+     ee2:	31 d2                	xor    %edx,%edx
+     ee4:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+     ee7:	f7 f3                	div    %ebx
+     ee9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     eec:	0f b6 92 b0 15 00 00 	movzbl 0x15b0(%edx),%edx
+     ef3:	8d 47 01             	lea    0x1(%edi),%eax
+     ef6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ef9:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+     efd:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+     eff:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+     f02:	39 da                	cmp    %ebx,%edx
+     f04:	73 da                	jae    ee0 <printint+0x40>
+  if(neg)
+     f06:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     f09:	85 c0                	test   %eax,%eax
+     f0b:	74 0a                	je     f17 <printint+0x77>
+    buf[i++] = '-';
+     f0d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     f10:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+     f15:	89 c7                	mov    %eax,%edi
+     f17:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     f1a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+     f1e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     f20:	0f b6 07             	movzbl (%edi),%eax
+     f23:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+     f26:	b8 01 00 00 00       	mov    $0x1,%eax
+     f2b:	89 44 24 08          	mov    %eax,0x8(%esp)
+     f2f:	89 74 24 04          	mov    %esi,0x4(%esp)
+     f33:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     f36:	89 04 24             	mov    %eax,(%esp)
+     f39:	e8 75 fe ff ff       	call   db3 <write>
+  while(--i >= 0)
+     f3e:	89 f8                	mov    %edi,%eax
+     f40:	4f                   	dec    %edi
+     f41:	39 d8                	cmp    %ebx,%eax
+     f43:	75 db                	jne    f20 <printint+0x80>
+}
+     f45:	83 c4 4c             	add    $0x4c,%esp
+     f48:	5b                   	pop    %ebx
+     f49:	5e                   	pop    %esi
+     f4a:	5f                   	pop    %edi
+     f4b:	5d                   	pop    %ebp
+     f4c:	c3                   	ret
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+     f50:	31 c0                	xor    %eax,%eax
+     f52:	e9 77 ff ff ff       	jmp    ece <printint+0x2e>
+     f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5e:	66 90                	xchg   %ax,%ax
+
+00000f60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	53                   	push   %ebx
+     f66:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     f69:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     f6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     f6f:	0f b6 1e             	movzbl (%esi),%ebx
+     f72:	84 db                	test   %bl,%bl
+     f74:	74 6f                	je     fe5 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+     f76:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+     f79:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+     f7b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+     f7e:	88 d9                	mov    %bl,%cl
+     f80:	46                   	inc    %esi
+     f81:	89 d3                	mov    %edx,%ebx
+     f83:	eb 2b                	jmp    fb0 <printf+0x50>
+     f85:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     f88:	83 f8 25             	cmp    $0x25,%eax
+     f8b:	74 4b                	je     fd8 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+     f8d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+     f90:	b8 01 00 00 00       	mov    $0x1,%eax
+     f95:	89 44 24 08          	mov    %eax,0x8(%esp)
+     f99:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f9c:	89 44 24 04          	mov    %eax,0x4(%esp)
+     fa0:	89 3c 24             	mov    %edi,(%esp)
+     fa3:	e8 0b fe ff ff       	call   db3 <write>
+  for(i = 0; fmt[i]; i++){
+     fa8:	0f b6 0e             	movzbl (%esi),%ecx
+     fab:	46                   	inc    %esi
+     fac:	84 c9                	test   %cl,%cl
+     fae:	74 35                	je     fe5 <printf+0x85>
+    if(state == 0){
+     fb0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+     fb2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+     fb5:	74 d1                	je     f88 <printf+0x28>
+      }
+    } else if(state == '%'){
+     fb7:	83 fb 25             	cmp    $0x25,%ebx
+     fba:	75 ec                	jne    fa8 <printf+0x48>
+      if(c == 'd'){
+     fbc:	83 f8 25             	cmp    $0x25,%eax
+     fbf:	0f 84 53 01 00 00    	je     1118 <printf+0x1b8>
+     fc5:	83 e8 63             	sub    $0x63,%eax
+     fc8:	83 f8 15             	cmp    $0x15,%eax
+     fcb:	77 23                	ja     ff0 <printf+0x90>
+     fcd:	ff 24 85 58 15 00 00 	jmp    *0x1558(,%eax,4)
+     fd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     fd8:	0f b6 0e             	movzbl (%esi),%ecx
+     fdb:	46                   	inc    %esi
+        state = '%';
+     fdc:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+     fe1:	84 c9                	test   %cl,%cl
+     fe3:	75 cb                	jne    fb0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     fe5:	83 c4 3c             	add    $0x3c,%esp
+     fe8:	5b                   	pop    %ebx
+     fe9:	5e                   	pop    %esi
+     fea:	5f                   	pop    %edi
+     feb:	5d                   	pop    %ebp
+     fec:	c3                   	ret
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+     ff0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+     ff3:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+     ff6:	b8 01 00 00 00       	mov    $0x1,%eax
+     ffb:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     fff:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+    1003:	89 44 24 08          	mov    %eax,0x8(%esp)
+    1007:	89 3c 24             	mov    %edi,(%esp)
+    100a:	e8 a4 fd ff ff       	call   db3 <write>
+        putc(fd, c);
+    100f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+    1013:	ba 01 00 00 00       	mov    $0x1,%edx
+    1018:	88 4d e7             	mov    %cl,-0x19(%ebp)
+    101b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+    101f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+    1021:	89 54 24 08          	mov    %edx,0x8(%esp)
+    1025:	89 3c 24             	mov    %edi,(%esp)
+    1028:	e8 86 fd ff ff       	call   db3 <write>
+    102d:	e9 76 ff ff ff       	jmp    fa8 <printf+0x48>
+    1032:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+    1038:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    103b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1040:	8b 13                	mov    (%ebx),%edx
+    1042:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+    1049:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    104c:	89 f8                	mov    %edi,%eax
+    104e:	e8 4d fe ff ff       	call   ea0 <printint>
+        ap++;
+    1053:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+    1056:	31 db                	xor    %ebx,%ebx
+    1058:	e9 4b ff ff ff       	jmp    fa8 <printf+0x48>
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1060:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1063:	8b 08                	mov    (%eax),%ecx
+        ap++;
+    1065:	83 c0 04             	add    $0x4,%eax
+    1068:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+    106b:	85 c9                	test   %ecx,%ecx
+    106d:	0f 84 cd 00 00 00    	je     1140 <printf+0x1e0>
+        while(*s != 0){
+    1073:	0f b6 01             	movzbl (%ecx),%eax
+    1076:	84 c0                	test   %al,%al
+    1078:	0f 84 ce 00 00 00    	je     114c <printf+0x1ec>
+    107e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    1081:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    1084:	89 ce                	mov    %ecx,%esi
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+    1090:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1093:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+    1098:	46                   	inc    %esi
+  write(fd, &c, 1);
+    1099:	89 44 24 08          	mov    %eax,0x8(%esp)
+    109d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+    10a1:	89 3c 24             	mov    %edi,(%esp)
+    10a4:	e8 0a fd ff ff       	call   db3 <write>
+        while(*s != 0){
+    10a9:	0f b6 06             	movzbl (%esi),%eax
+    10ac:	84 c0                	test   %al,%al
+    10ae:	75 e0                	jne    1090 <printf+0x130>
+      state = 0;
+    10b0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    10b3:	31 db                	xor    %ebx,%ebx
+    10b5:	e9 ee fe ff ff       	jmp    fa8 <printf+0x48>
+    10ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    10c0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    10c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    10c8:	8b 13                	mov    (%ebx),%edx
+    10ca:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    10d1:	e9 73 ff ff ff       	jmp    1049 <printf+0xe9>
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+    10e0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+    10e3:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+    10e8:	8b 10                	mov    (%eax),%edx
+    10ea:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    10ed:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+    10f1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    10f4:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+    10f8:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    10fb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+    10ff:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+    1101:	89 3c 24             	mov    %edi,(%esp)
+    1104:	e8 aa fc ff ff       	call   db3 <write>
+        ap++;
+    1109:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+    110d:	e9 96 fe ff ff       	jmp    fa8 <printf+0x48>
+    1112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+    1118:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+    111b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    111e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1123:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+    1127:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+    1129:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+    112d:	89 3c 24             	mov    %edi,(%esp)
+    1130:	e8 7e fc ff ff       	call   db3 <write>
+    1135:	e9 6e fe ff ff       	jmp    fa8 <printf+0x48>
+    113a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1140:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+    1142:	b9 50 15 00 00       	mov    $0x1550,%ecx
+    1147:	e9 32 ff ff ff       	jmp    107e <printf+0x11e>
+      state = 0;
+    114c:	31 db                	xor    %ebx,%ebx
+    114e:	66 90                	xchg   %ax,%ax
+    1150:	e9 53 fe ff ff       	jmp    fa8 <printf+0x48>
+    1155:	66 90                	xchg   %ax,%ax
+    1157:	66 90                	xchg   %ax,%ax
+    1159:	66 90                	xchg   %ax,%ax
+    115b:	66 90                	xchg   %ax,%ax
+    115d:	66 90                	xchg   %ax,%ax
+    115f:	90                   	nop
+
+00001160 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	83 ec 18             	sub    $0x18,%esp
+    1166:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+    1169:	89 c3                	mov    %eax,%ebx
+    116b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+    116e:	a1 84 1b 00 00       	mov    0x1b84,%eax
+    1173:	8b 15 80 1b 00 00    	mov    0x1b80,%edx
+    1179:	29 c2                	sub    %eax,%edx
+    117b:	39 da                	cmp    %ebx,%edx
+    117d:	72 19                	jb     1198 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+    117f:	01 c3                	add    %eax,%ebx
+    1181:	89 1d 84 1b 00 00    	mov    %ebx,0x1b84
+  return p;
+}
+    1187:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+    118a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+    118d:	89 ec                	mov    %ebp,%esp
+    118f:	5d                   	pop    %ebp
+    1190:	c3                   	ret
+    1191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+    1198:	b8 00 00 01 00       	mov    $0x10000,%eax
+    119d:	39 c3                	cmp    %eax,%ebx
+    119f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+    11a2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+    11a5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+    11a7:	e8 6f fc ff ff       	call   e1b <sbrk>
+    if(p == (char*)-1)
+    11ac:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+    11af:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+    11b1:	74 1d                	je     11d0 <morecore+0x70>
+    if(p != arenaend)
+    11b3:	39 05 80 1b 00 00    	cmp    %eax,0x1b80
+    11b9:	74 0d                	je     11c8 <morecore+0x68>
+    arenaend = p + grow;
+    11bb:	01 f2                	add    %esi,%edx
+    11bd:	89 15 80 1b 00 00    	mov    %edx,0x1b80
+    11c3:	eb ba                	jmp    117f <morecore+0x1f>
+    11c5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+    11c8:	a1 84 1b 00 00       	mov    0x1b84,%eax
+    11cd:	eb ec                	jmp    11bb <morecore+0x5b>
+    11cf:	90                   	nop
+      return 0;
+    11d0:	31 c0                	xor    %eax,%eax
+    11d2:	eb b3                	jmp    1187 <morecore+0x27>
+    11d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+
+000011e0 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	83 ec 0c             	sub    $0xc,%esp
+    11e6:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+    11e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ec:	89 75 f8             	mov    %esi,-0x8(%ebp)
+    11ef:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+    11f2:	85 c0                	test   %eax,%eax
+    11f4:	74 1e                	je     1214 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+    11f6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+    11f9:	83 fa 08             	cmp    $0x8,%edx
+    11fc:	77 16                	ja     1214 <free+0x34>
+  h = (Header*)ap - 1;
+    11fe:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+    1201:	74 25                	je     1228 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+    1203:	8b 3c 95 a0 1b 00 00 	mov    0x1ba0(,%edx,4),%edi
+    120a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+    120d:	89 0c 95 a0 1b 00 00 	mov    %ecx,0x1ba0(,%edx,4)
+}
+    1214:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    1217:	8b 75 f8             	mov    -0x8(%ebp),%esi
+    121a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    121d:	89 ec                	mov    %ebp,%esp
+    121f:	5d                   	pop    %ebp
+    1220:	c3                   	ret
+    1221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+    1228:	8b 15 c0 1b 00 00    	mov    0x1bc0,%edx
+    122e:	85 d2                	test   %edx,%edx
+    1230:	74 54                	je     1286 <free+0xa6>
+    1232:	39 ca                	cmp    %ecx,%edx
+    1234:	73 36                	jae    126c <free+0x8c>
+    1236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+    1240:	89 d3                	mov    %edx,%ebx
+    1242:	8b 12                	mov    (%edx),%edx
+    1244:	85 d2                	test   %edx,%edx
+    1246:	74 12                	je     125a <free+0x7a>
+    1248:	39 ca                	cmp    %ecx,%edx
+    124a:	72 f4                	jb     1240 <free+0x60>
+  if(p && END(h) == p){
+    124c:	85 d2                	test   %edx,%edx
+    124e:	74 0a                	je     125a <free+0x7a>
+    1250:	8b 70 fc             	mov    -0x4(%eax),%esi
+    1253:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+    1256:	39 fa                	cmp    %edi,%edx
+    1258:	74 4b                	je     12a5 <free+0xc5>
+  h->s.u.next = p;
+    125a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+    125d:	8b 53 04             	mov    0x4(%ebx),%edx
+    1260:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+    1264:	39 f1                	cmp    %esi,%ecx
+    1266:	74 29                	je     1291 <free+0xb1>
+    prev->s.u.next = h;
+    1268:	89 0b                	mov    %ecx,(%ebx)
+    126a:	eb a8                	jmp    1214 <free+0x34>
+  if(p && END(h) == p){
+    126c:	85 d2                	test   %edx,%edx
+    126e:	74 16                	je     1286 <free+0xa6>
+    1270:	8b 58 fc             	mov    -0x4(%eax),%ebx
+    1273:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+    1276:	39 f2                	cmp    %esi,%edx
+    1278:	75 0c                	jne    1286 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+    127a:	8b 72 04             	mov    0x4(%edx),%esi
+    127d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+    1281:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+    1284:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+    1286:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+    1289:	89 0d c0 1b 00 00    	mov    %ecx,0x1bc0
+    128f:	eb 83                	jmp    1214 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+    1291:	8b 48 fc             	mov    -0x4(%eax),%ecx
+    1294:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+    1298:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+    129b:	8b 40 f8             	mov    -0x8(%eax),%eax
+    129e:	89 03                	mov    %eax,(%ebx)
+    12a0:	e9 6f ff ff ff       	jmp    1214 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+    12a5:	8b 7a 04             	mov    0x4(%edx),%edi
+    12a8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+    12ac:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+    12af:	8b 12                	mov    (%edx),%edx
+    12b1:	eb a7                	jmp    125a <free+0x7a>
+    12b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000012c0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+    12c5:	53                   	push   %ebx
+    12c6:	83 ec 2c             	sub    $0x2c,%esp
+    12c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+    12cc:	83 f8 10             	cmp    $0x10,%eax
+    12cf:	0f 86 52 01 00 00    	jbe    1427 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+    12d5:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+    12d7:	ba 01 00 00 00       	mov    $0x1,%edx
+    12dc:	eb 0d                	jmp    12eb <malloc+0x2b>
+    12de:	66 90                	xchg   %ax,%ax
+    12e0:	83 c1 05             	add    $0x5,%ecx
+    12e3:	89 d6                	mov    %edx,%esi
+    12e5:	d3 e6                	shl    %cl,%esi
+    12e7:	39 c6                	cmp    %eax,%esi
+    12e9:	73 55                	jae    1340 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+    12eb:	89 d9                	mov    %ebx,%ecx
+    12ed:	43                   	inc    %ebx
+    12ee:	83 fb 08             	cmp    $0x8,%ebx
+    12f1:	75 ed                	jne    12e0 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+    12f3:	8d 58 07             	lea    0x7(%eax),%ebx
+    12f6:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+    12f9:	39 c3                	cmp    %eax,%ebx
+    12fb:	0f 82 1f 01 00 00    	jb     1420 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+    1301:	a1 c0 1b 00 00       	mov    0x1bc0,%eax
+    1306:	85 c0                	test   %eax,%eax
+    1308:	0f 84 ee 00 00 00    	je     13fc <malloc+0x13c>
+    130e:	b9 c0 1b 00 00       	mov    $0x1bc0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+    1313:	8b 50 04             	mov    0x4(%eax),%edx
+    1316:	39 da                	cmp    %ebx,%edx
+    1318:	0f 82 d2 00 00 00    	jb     13f0 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+    131e:	29 da                	sub    %ebx,%edx
+    1320:	83 fa 17             	cmp    $0x17,%edx
+    1323:	0f 87 b7 00 00 00    	ja     13e0 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+    1329:	8b 10                	mov    (%eax),%edx
+    132b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+    132d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+    1333:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+    1336:	83 c0 08             	add    $0x8,%eax
+}
+    1339:	5b                   	pop    %ebx
+    133a:	5e                   	pop    %esi
+    133b:	5f                   	pop    %edi
+    133c:	5d                   	pop    %ebp
+    133d:	c3                   	ret
+    133e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+    1340:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+    1342:	8b 04 9d a0 1b 00 00 	mov    0x1ba0(,%ebx,4),%eax
+    1349:	85 c0                	test   %eax,%eax
+    134b:	74 23                	je     1370 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+    134d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+    134f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+    1352:	89 14 9d a0 1b 00 00 	mov    %edx,0x1ba0(,%ebx,4)
+    h->s.u.cls = cls;
+    1359:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+    135c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+    135f:	83 c4 2c             	add    $0x2c,%esp
+    1362:	5b                   	pop    %ebx
+    1363:	5e                   	pop    %esi
+    1364:	5f                   	pop    %edi
+    1365:	5d                   	pop    %ebp
+    1366:	c3                   	ret
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+    1370:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+    1373:	31 d2                	xor    %edx,%edx
+    1375:	b8 00 10 00 00       	mov    $0x1000,%eax
+    137a:	f7 f6                	div    %esi
+    137c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+    137f:	0f af c6             	imul   %esi,%eax
+    1382:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1385:	e8 d6 fd ff ff       	call   1160 <morecore>
+    138a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    138d:	85 c0                	test   %eax,%eax
+    138f:	0f 84 8b 00 00 00    	je     1420 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+    1395:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+    1398:	8b 0c 9d a0 1b 00 00 	mov    0x1ba0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+    139f:	31 d2                	xor    %edx,%edx
+    13a1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+    13a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13a7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    13aa:	eb 06                	jmp    13b2 <malloc+0xf2>
+    13ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+    13b0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+    13b2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+    13b4:	42                   	inc    %edx
+    13b5:	89 c1                	mov    %eax,%ecx
+    13b7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+    13ba:	39 d7                	cmp    %edx,%edi
+    13bc:	75 f2                	jne    13b0 <malloc+0xf0>
+    13be:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+    13c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    13c4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    13c7:	89 04 9d a0 1b 00 00 	mov    %eax,0x1ba0(,%ebx,4)
+    13ce:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    13d1:	29 f0                	sub    %esi,%eax
+    13d3:	01 c2                	add    %eax,%edx
+    13d5:	89 d0                	mov    %edx,%eax
+    13d7:	e9 71 ff ff ff       	jmp    134d <malloc+0x8d>
+    13dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+    13e0:	8d 4a f8             	lea    -0x8(%edx),%ecx
+    13e3:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+    13e6:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+    13e8:	89 58 04             	mov    %ebx,0x4(%eax)
+    13eb:	e9 3d ff ff ff       	jmp    132d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+    13f0:	89 c1                	mov    %eax,%ecx
+    13f2:	8b 00                	mov    (%eax),%eax
+    13f4:	85 c0                	test   %eax,%eax
+    13f6:	0f 85 17 ff ff ff    	jne    1313 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+    13fc:	83 fb f8             	cmp    $0xfffffff8,%ebx
+    13ff:	74 1f                	je     1420 <malloc+0x160>
+    1401:	8d 43 08             	lea    0x8(%ebx),%eax
+    1404:	e8 57 fd ff ff       	call   1160 <morecore>
+    1409:	85 c0                	test   %eax,%eax
+    140b:	74 13                	je     1420 <malloc+0x160>
+  h->s.u.cls = LARGE;
+    140d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+    1413:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+    1416:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+    1419:	e9 41 ff ff ff       	jmp    135f <malloc+0x9f>
+    141e:	66 90                	xchg   %ax,%ax
+      return 0;
+    1420:	31 c0                	xor    %eax,%eax
+    1422:	e9 38 ff ff ff       	jmp    135f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+    1427:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+    142c:	31 db                	xor    %ebx,%ebx
+    142e:	e9 0f ff ff ff       	jmp    1342 <malloc+0x82>
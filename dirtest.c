@@ -0,0 +1,175 @@
+// Exercise hashed directories, the directory entry cache and
+// files large enough to need the double indirect block.
+//
+// Fills one directory with NFILE files and as many hard links to
+// them, which makes it hashed, checks every name is found, then
+// unlinks, re-creates and unlinks them all again before removing
+// the directory. Lookups of names just created or removed check
+// that no stale dentry survives. The links keep the test within
+// the few free inodes of fs.img.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define NFILE  100
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 20)
+
+char path[32];
+char buf[BSIZE];
+
+void
+fail(char *what)
+{
+  printf(1, "dirtest: %s %s failed\n", what, path);
+  exit(1);
+}
+
+// Set path to "dd/<c><n>".
+char*
+name(char c, int n)
+{
+  char *p;
+  int i;
+
+  strcpy(path, "dd/");
+  p = path + 3;
+  *p++ = c;
+  for(i = 100; i > 0; i /= 10)
+    *p++ = '0' + n / i % 10;
+  *p = 0;
+  return path;
+}
+
+int
+exists(char *p)
+{
+  int fd;
+
+  if((fd = open(p, O_RDONLY)) < 0)
+    return 0;
+  close(fd);
+  return 1;
+}
+
+void
+mkfile(char *p, int n)
+{
+  int fd;
+
+  if((fd = open(p, O_CREATE | O_RDWR)) < 0)
+    fail("create");
+  if(write(fd, &n, sizeof(n)) != sizeof(n))
+    fail("write");
+  close(fd);
+}
+
+void
+dirtest(void)
+{
+  int i, fd, n;
+
+  printf(1, "dirtest: directory of %d names\n", 2*NFILE);
+  if(mkdir("dd") < 0)
+    fail("mkdir dd");
+  for(i = 0; i < NFILE; i++)
+    mkfile(name('f', i), i);
+  for(i = 0; i < NFILE; i++){
+    name('f', i);
+    strcpy(buf, path);
+    if(link(buf, name('l', i)) < 0)
+      fail("link");
+  }
+
+  for(i = 0; i < NFILE; i++){
+    if((fd = open(name('l', i), O_RDONLY)) < 0)
+      fail("open");
+    if(read(fd, &n, sizeof(n)) != sizeof(n) || n != i)
+      fail("read");
+    close(fd);
+    if(!exists(name('f', i)))
+      fail("lookup");
+  }
+
+  // A name looked up while absent, then created, then removed.
+  if(exists(name('x', 0)))
+    fail("negative lookup");
+  mkfile(path, 0);
+  if(!exists(path))
+    fail("lookup after create");
+  if(unlink(path) < 0)
+    fail("unlink");
+  if(exists(path))
+    fail("lookup after unlink");
+
+  for(i = 0; i < NFILE; i++){
+    if(unlink(name('l', i)) < 0 || exists(path))
+      fail("unlink");
+    if(unlink(name('f', i)) < 0 || exists(path))
+      fail("unlink");
+  }
+  for(i = 0; i < NFILE; i++){
+    mkfile(name('f', i), i);
+    if(!exists(path))
+      fail("lookup after re-create");
+  }
+  for(i = 0; i < NFILE; i++)
+    if(unlink(name('f', i)) < 0)
+      fail("unlink");
+
+  strcpy(path, "dd");
+  if(unlink("dd") < 0)
+    fail("rmdir");
+  if(exists(name('f', 1)))
+    fail("lookup in removed directory");
+
+  // The directory's inode may come back: its old names must not.
+  if(mkdir("dd") < 0)
+    fail("mkdir dd");
+  if(exists(name('f', 1)))
+    fail("lookup in new directory");
+  strcpy(path, "dd");
+  if(unlink("dd") < 0)
+    fail("rmdir");
+}
+
+void
+bigtest(void)
+{
+  int i, fd;
+
+  printf(1, "dirtest: file of %d blocks\n", BIGBLOCKS);
+  strcpy(path, "dirtest.big");
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0)
+    fail("create");
+  for(i = 0; i < BIGBLOCKS; i++){
+    memset(buf, i, sizeof(buf));
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail("write");
+  }
+  close(fd);
+
+  if((fd = open(path, O_RDONLY)) < 0)
+    fail("open");
+  for(i = 0; i < BIGBLOCKS; i++){
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail("read");
+    if(((int*)buf)[0] != i || buf[BSIZE-1] != (char)i)
+      fail("read back");
+  }
+  close(fd);
+  if(unlink(path) < 0)
+    fail("unlink");
+}
+
+int
+main(int argc, char *argv[])
+{
+  dirtest();
+  bigtest();
+  printf(1, "dirtest ok\n");
+  exit(0);
+}
@@ -0,0 +1,1379 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 e4 f0             	and    $0xfffffff0,%esp
+   9:	83 ec 10             	sub    $0x10,%esp
+   c:	8b 75 08             	mov    0x8(%ebp),%esi
+   f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  12:	83 fe 01             	cmp    $0x1,%esi
+  15:	7e 66                	jle    7d <main+0x7d>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  17:	83 fe 02             	cmp    $0x2,%esi
+  1a:	8b 47 04             	mov    0x4(%edi),%eax
+  1d:	74 3c                	je     5b <main+0x5b>
+  1f:	bb 02 00 00 00       	mov    $0x2,%ebx
+  24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	89 44 24 08          	mov    %eax,0x8(%esp)
+  34:	ba 74 09 00 00       	mov    $0x974,%edx
+  39:	b9 76 09 00 00       	mov    $0x976,%ecx
+  3e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  42:	43                   	inc    %ebx
+  43:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  47:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  4e:	e8 4d 04 00 00       	call   4a0 <printf>
+  53:	39 f3                	cmp    %esi,%ebx
+  55:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  59:	75 d5                	jne    30 <main+0x30>
+  5b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  5f:	ba 7b 09 00 00       	mov    $0x97b,%edx
+  64:	b9 76 09 00 00       	mov    $0x976,%ecx
+  69:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  6d:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  71:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  78:	e8 23 04 00 00       	call   4a0 <printf>
+  exit(0);
+  7d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  84:	e8 4a 02 00 00       	call   2d3 <exit>
+  89:	66 90                	xchg   %ax,%ax
+  8b:	66 90                	xchg   %ax,%ax
+  8d:	66 90                	xchg   %ax,%ax
+  8f:	90                   	nop
+
+00000090 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  90:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  91:	31 c0                	xor    %eax,%eax
+{
+  93:	89 e5                	mov    %esp,%ebp
+  95:	53                   	push   %ebx
+  96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  a7:	40                   	inc    %eax
+  a8:	84 d2                	test   %dl,%dl
+  aa:	75 f4                	jne    a0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ac:	5b                   	pop    %ebx
+  ad:	89 c8                	mov    %ecx,%eax
+  af:	5d                   	pop    %ebp
+  b0:	c3                   	ret
+  b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	53                   	push   %ebx
+  c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+  ca:	0f b6 02             	movzbl (%edx),%eax
+  cd:	84 c0                	test   %al,%al
+  cf:	75 15                	jne    e6 <strcmp+0x26>
+  d1:	eb 30                	jmp    103 <strcmp+0x43>
+  d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  d7:	90                   	nop
+  d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  dc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  df:	42                   	inc    %edx
+  while(*p && *p == *q)
+  e0:	84 c0                	test   %al,%al
+  e2:	74 14                	je     f8 <strcmp+0x38>
+    p++, q++;
+  e4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+  e6:	0f b6 0b             	movzbl (%ebx),%ecx
+  e9:	38 c1                	cmp    %al,%cl
+  eb:	74 eb                	je     d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+  ed:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+  ee:	29 c8                	sub    %ecx,%eax
+}
+  f0:	5d                   	pop    %ebp
+  f1:	c3                   	ret
+  f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+  fc:	31 c0                	xor    %eax,%eax
+}
+  fe:	5b                   	pop    %ebx
+  ff:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 100:	29 c8                	sub    %ecx,%eax
+}
+ 102:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 103:	0f b6 0b             	movzbl (%ebx),%ecx
+ 106:	31 c0                	xor    %eax,%eax
+ 108:	eb e3                	jmp    ed <strcmp+0x2d>
+ 10a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	40                   	inc    %eax
+ 121:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 125:	89 c1                	mov    %eax,%ecx
+ 127:	75 f7                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 129:	5d                   	pop    %ebp
+ 12a:	89 c8                	mov    %ecx,%eax
+ 12c:	c3                   	ret
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+ 130:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 131:	31 c9                	xor    %ecx,%ecx
+}
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	5f                   	pop    %edi
+ 153:	89 d0                	mov    %edx,%eax
+ 155:	5d                   	pop    %ebp
+ 156:	c3                   	ret
+ 157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 10                	jne    181 <strchr+0x21>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	40                   	inc    %eax
+ 17d:	84 d2                	test   %dl,%dl
+ 17f:	74 0f                	je     190 <strchr+0x30>
+    if(*s == c)
+ 181:	38 d1                	cmp    %dl,%cl
+ 183:	75 f3                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 185:	5d                   	pop    %ebp
+ 186:	c3                   	ret
+ 187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18e:	66 90                	xchg   %ax,%ax
+ 190:	5d                   	pop    %ebp
+  return 0;
+ 191:	31 c0                	xor    %eax,%eax
+}
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1a5:	31 f6                	xor    %esi,%esi
+{
+ 1a7:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 1a8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 1ab:	83 ec 3c             	sub    $0x3c,%esp
+ 1ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 1b1:	eb 32                	jmp    1e5 <gets+0x45>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+    cc = read(0, &c, 1);
+ 1b8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 1bc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1c1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 1c5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 1cc:	e8 1a 01 00 00       	call   2eb <read>
+    if(cc < 1)
+ 1d1:	85 c0                	test   %eax,%eax
+ 1d3:	7e 19                	jle    1ee <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 1d5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1dd:	3c 0a                	cmp    $0xa,%al
+ 1df:	74 10                	je     1f1 <gets+0x51>
+ 1e1:	3c 0d                	cmp    $0xd,%al
+ 1e3:	74 0c                	je     1f1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 1e5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 1e8:	46                   	inc    %esi
+ 1e9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 1ec:	7c ca                	jl     1b8 <gets+0x18>
+ 1ee:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1f1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 1f5:	83 c4 3c             	add    $0x3c,%esp
+ 1f8:	89 d8                	mov    %ebx,%eax
+ 1fa:	5b                   	pop    %ebx
+ 1fb:	5e                   	pop    %esi
+ 1fc:	5f                   	pop    %edi
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 201:	31 c0                	xor    %eax,%eax
+{
+ 203:	89 e5                	mov    %esp,%ebp
+ 205:	83 ec 18             	sub    $0x18,%esp
+ 208:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 20b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 20e:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 212:	8b 45 08             	mov    0x8(%ebp),%eax
+ 215:	89 04 24             	mov    %eax,(%esp)
+ 218:	e8 f6 00 00 00       	call   313 <open>
+  if(fd < 0)
+ 21d:	85 c0                	test   %eax,%eax
+ 21f:	78 2f                	js     250 <stat+0x50>
+ 221:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 223:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 226:	89 1c 24             	mov    %ebx,(%esp)
+ 229:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 22d:	e8 f9 00 00 00       	call   32b <fstat>
+  close(fd);
+ 232:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 235:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 237:	e8 bf 00 00 00       	call   2fb <close>
+  return r;
+}
+ 23c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 23f:	89 f0                	mov    %esi,%eax
+ 241:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 244:	89 ec                	mov    %ebp,%esp
+ 246:	5d                   	pop    %ebp
+ 247:	c3                   	ret
+ 248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+    return -1;
+ 250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 255:	eb e5                	jmp    23c <stat+0x3c>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 267:	0f be 02             	movsbl (%edx),%eax
+ 26a:	88 c1                	mov    %al,%cl
+ 26c:	80 e9 30             	sub    $0x30,%cl
+ 26f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 272:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 277:	77 1c                	ja     295 <atoi+0x35>
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 280:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 283:	42                   	inc    %edx
+ 284:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 288:	0f be 02             	movsbl (%edx),%eax
+ 28b:	88 c3                	mov    %al,%bl
+ 28d:	80 eb 30             	sub    $0x30,%bl
+ 290:	80 fb 09             	cmp    $0x9,%bl
+ 293:	76 eb                	jbe    280 <atoi+0x20>
+  return n;
+}
+ 295:	5b                   	pop    %ebx
+ 296:	89 c8                	mov    %ecx,%eax
+ 298:	5d                   	pop    %ebp
+ 299:	c3                   	ret
+ 29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+ 2a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ae:	85 c0                	test   %eax,%eax
+ 2b0:	7e 13                	jle    2c5 <memmove+0x25>
+ 2b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2b4:	89 d7                	mov    %edx,%edi
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2c1:	39 f8                	cmp    %edi,%eax
+ 2c3:	75 fb                	jne    2c0 <memmove+0x20>
+  return vdst;
+}
+ 2c5:	5e                   	pop    %esi
+ 2c6:	89 d0                	mov    %edx,%eax
+ 2c8:	5f                   	pop    %edi
+ 2c9:	5d                   	pop    %ebp
+ 2ca:	c3                   	ret
+
+000002cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <exit>:
+SYSCALL(exit)
+ 2d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <wait>:
+SYSCALL(wait)
+ 2db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <pipe>:
+SYSCALL(pipe)
+ 2e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <read>:
+SYSCALL(read)
+ 2eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <write>:
+SYSCALL(write)
+ 2f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <close>:
+SYSCALL(close)
+ 2fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <kill>:
+SYSCALL(kill)
+ 303:	b8 06 00 00 00       	mov    $0x6,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <exec>:
+SYSCALL(exec)
+ 30b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <open>:
+SYSCALL(open)
+ 313:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mknod>:
+SYSCALL(mknod)
+ 31b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <unlink>:
+SYSCALL(unlink)
+ 323:	b8 12 00 00 00       	mov    $0x12,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <fstat>:
+SYSCALL(fstat)
+ 32b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <link>:
+SYSCALL(link)
+ 333:	b8 13 00 00 00       	mov    $0x13,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <mkdir>:
+SYSCALL(mkdir)
+ 33b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <chdir>:
+SYSCALL(chdir)
+ 343:	b8 09 00 00 00       	mov    $0x9,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <dup>:
+SYSCALL(dup)
+ 34b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getpid>:
+SYSCALL(getpid)
+ 353:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <sbrk>:
+SYSCALL(sbrk)
+ 35b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <sleep>:
+SYSCALL(sleep)
+ 363:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <uptime>:
+SYSCALL(uptime)
+ 36b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <detach>:
+SYSCALL(detach)
+ 373:	b8 16 00 00 00       	mov    $0x16,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <policy>:
+SYSCALL(policy)
+ 37b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <priority>:
+SYSCALL(priority)
+ 383:	b8 18 00 00 00       	mov    $0x18,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <wait_stat>:
+SYSCALL(wait_stat)
+ 38b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <lockstat>:
+SYSCALL(lockstat)
+ 393:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mmap>:
+SYSCALL(mmap)
+ 39b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <munmap>:
+SYSCALL(munmap)
+ 3a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <shmget>:
+SYSCALL(shmget)
+ 3ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <shmat>:
+SYSCALL(shmat)
+ 3b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <shmdt>:
+SYSCALL(shmdt)
+ 3bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <memstat>:
+SYSCALL(memstat)
+ 3c3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <getprocs>:
+SYSCALL(getprocs)
+ 3cb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <shmctl>:
+SYSCALL(shmctl)
+ 3d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+ 3db:	66 90                	xchg   %ax,%ax
+ 3dd:	66 90                	xchg   %ax,%ax
+ 3df:	90                   	nop
+
+000003e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	53                   	push   %ebx
+ 3e6:	89 cb                	mov    %ecx,%ebx
+ 3e8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3eb:	89 d1                	mov    %edx,%ecx
+{
+ 3ed:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 3f0:	89 d0                	mov    %edx,%eax
+ 3f2:	c1 e8 1f             	shr    $0x1f,%eax
+ 3f5:	84 c0                	test   %al,%al
+ 3f7:	0f 84 93 00 00 00    	je     490 <printint+0xb0>
+ 3fd:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 401:	0f 84 89 00 00 00    	je     490 <printint+0xb0>
+    x = -xx;
+ 407:	f7 d9                	neg    %ecx
+    neg = 1;
+ 409:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 40e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 415:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 418:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 420:	89 c8                	mov    %ecx,%eax
+ 422:	31 d2                	xor    %edx,%edx
+ 424:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 427:	f7 f3                	div    %ebx
+ 429:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 42c:	0f b6 92 dc 09 00 00 	movzbl 0x9dc(%edx),%edx
+ 433:	8d 47 01             	lea    0x1(%edi),%eax
+ 436:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 439:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 43d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 43f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 442:	39 da                	cmp    %ebx,%edx
+ 444:	73 da                	jae    420 <printint+0x40>
+  if(neg)
+ 446:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 449:	85 c0                	test   %eax,%eax
+ 44b:	74 0a                	je     457 <printint+0x77>
+    buf[i++] = '-';
+ 44d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 450:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 455:	89 c7                	mov    %eax,%edi
+ 457:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 45a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 45e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 460:	0f b6 07             	movzbl (%edi),%eax
+ 463:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 466:	b8 01 00 00 00       	mov    $0x1,%eax
+ 46b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 46f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 473:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 476:	89 04 24             	mov    %eax,(%esp)
+ 479:	e8 75 fe ff ff       	call   2f3 <write>
+  while(--i >= 0)
+ 47e:	89 f8                	mov    %edi,%eax
+ 480:	4f                   	dec    %edi
+ 481:	39 d8                	cmp    %ebx,%eax
+ 483:	75 db                	jne    460 <printint+0x80>
+}
+ 485:	83 c4 4c             	add    $0x4c,%esp
+ 488:	5b                   	pop    %ebx
+ 489:	5e                   	pop    %esi
+ 48a:	5f                   	pop    %edi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 490:	31 c0                	xor    %eax,%eax
+ 492:	e9 77 ff ff ff       	jmp    40e <printint+0x2e>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4af:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b2:	84 db                	test   %bl,%bl
+ 4b4:	74 6f                	je     525 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 4b6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 4b9:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 4bb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 4be:	88 d9                	mov    %bl,%cl
+ 4c0:	46                   	inc    %esi
+ 4c1:	89 d3                	mov    %edx,%ebx
+ 4c3:	eb 2b                	jmp    4f0 <printf+0x50>
+ 4c5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 4c8:	83 f8 25             	cmp    $0x25,%eax
+ 4cb:	74 4b                	je     518 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4cd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4d0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4d9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4dc:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 4e0:	89 3c 24             	mov    %edi,(%esp)
+ 4e3:	e8 0b fe ff ff       	call   2f3 <write>
+  for(i = 0; fmt[i]; i++){
+ 4e8:	0f b6 0e             	movzbl (%esi),%ecx
+ 4eb:	46                   	inc    %esi
+ 4ec:	84 c9                	test   %cl,%cl
+ 4ee:	74 35                	je     525 <printf+0x85>
+    if(state == 0){
+ 4f0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 4f2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 4f5:	74 d1                	je     4c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4f7:	83 fb 25             	cmp    $0x25,%ebx
+ 4fa:	75 ec                	jne    4e8 <printf+0x48>
+      if(c == 'd'){
+ 4fc:	83 f8 25             	cmp    $0x25,%eax
+ 4ff:	0f 84 53 01 00 00    	je     658 <printf+0x1b8>
+ 505:	83 e8 63             	sub    $0x63,%eax
+ 508:	83 f8 15             	cmp    $0x15,%eax
+ 50b:	77 23                	ja     530 <printf+0x90>
+ 50d:	ff 24 85 84 09 00 00 	jmp    *0x984(,%eax,4)
+ 514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 518:	0f b6 0e             	movzbl (%esi),%ecx
+ 51b:	46                   	inc    %esi
+        state = '%';
+ 51c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 521:	84 c9                	test   %cl,%cl
+ 523:	75 cb                	jne    4f0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 525:	83 c4 3c             	add    $0x3c,%esp
+ 528:	5b                   	pop    %ebx
+ 529:	5e                   	pop    %esi
+ 52a:	5f                   	pop    %edi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+ 530:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 533:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 536:	b8 01 00 00 00       	mov    $0x1,%eax
+ 53b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 53f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 543:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 547:	89 3c 24             	mov    %edi,(%esp)
+ 54a:	e8 a4 fd ff ff       	call   2f3 <write>
+        putc(fd, c);
+ 54f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 553:	ba 01 00 00 00       	mov    $0x1,%edx
+ 558:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 55b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 55f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 561:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 565:	89 3c 24             	mov    %edi,(%esp)
+ 568:	e8 86 fd ff ff       	call   2f3 <write>
+ 56d:	e9 76 ff ff ff       	jmp    4e8 <printf+0x48>
+ 572:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 578:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 57b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 580:	8b 13                	mov    (%ebx),%edx
+ 582:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 589:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 58c:	89 f8                	mov    %edi,%eax
+ 58e:	e8 4d fe ff ff       	call   3e0 <printint>
+        ap++;
+ 593:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 596:	31 db                	xor    %ebx,%ebx
+ 598:	e9 4b ff ff ff       	jmp    4e8 <printf+0x48>
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5a0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 5a3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 5a5:	83 c0 04             	add    $0x4,%eax
+ 5a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 5ab:	85 c9                	test   %ecx,%ecx
+ 5ad:	0f 84 cd 00 00 00    	je     680 <printf+0x1e0>
+        while(*s != 0){
+ 5b3:	0f b6 01             	movzbl (%ecx),%eax
+ 5b6:	84 c0                	test   %al,%al
+ 5b8:	0f 84 ce 00 00 00    	je     68c <printf+0x1ec>
+ 5be:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5c1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5c4:	89 ce                	mov    %ecx,%esi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 5d0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 5d8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 5d9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 5dd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 5e1:	89 3c 24             	mov    %edi,(%esp)
+ 5e4:	e8 0a fd ff ff       	call   2f3 <write>
+        while(*s != 0){
+ 5e9:	0f b6 06             	movzbl (%esi),%eax
+ 5ec:	84 c0                	test   %al,%al
+ 5ee:	75 e0                	jne    5d0 <printf+0x130>
+      state = 0;
+ 5f0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5f3:	31 db                	xor    %ebx,%ebx
+ 5f5:	e9 ee fe ff ff       	jmp    4e8 <printf+0x48>
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 600:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 603:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 608:	8b 13                	mov    (%ebx),%edx
+ 60a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 611:	e9 73 ff ff ff       	jmp    589 <printf+0xe9>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 620:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 623:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 628:	8b 10                	mov    (%eax),%edx
+ 62a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 62d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 631:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 634:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 638:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 63b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 63f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 641:	89 3c 24             	mov    %edi,(%esp)
+ 644:	e8 aa fc ff ff       	call   2f3 <write>
+        ap++;
+ 649:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 64d:	e9 96 fe ff ff       	jmp    4e8 <printf+0x48>
+ 652:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 658:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 65b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 65e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 663:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 667:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 669:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 66d:	89 3c 24             	mov    %edi,(%esp)
+ 670:	e8 7e fc ff ff       	call   2f3 <write>
+ 675:	e9 6e fe ff ff       	jmp    4e8 <printf+0x48>
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 680:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 682:	b9 7d 09 00 00       	mov    $0x97d,%ecx
+ 687:	e9 32 ff ff ff       	jmp    5be <printf+0x11e>
+      state = 0;
+ 68c:	31 db                	xor    %ebx,%ebx
+ 68e:	66 90                	xchg   %ax,%ax
+ 690:	e9 53 fe ff ff       	jmp    4e8 <printf+0x48>
+ 695:	66 90                	xchg   %ax,%ax
+ 697:	66 90                	xchg   %ax,%ax
+ 699:	66 90                	xchg   %ax,%ax
+ 69b:	66 90                	xchg   %ax,%ax
+ 69d:	66 90                	xchg   %ax,%ax
+ 69f:	90                   	nop
+
+000006a0 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 18             	sub    $0x18,%esp
+ 6a6:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 6a9:	89 c3                	mov    %eax,%ebx
+ 6ab:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 6ae:	a1 a4 0c 00 00       	mov    0xca4,%eax
+ 6b3:	8b 15 a0 0c 00 00    	mov    0xca0,%edx
+ 6b9:	29 c2                	sub    %eax,%edx
+ 6bb:	39 da                	cmp    %ebx,%edx
+ 6bd:	72 19                	jb     6d8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 6bf:	01 c3                	add    %eax,%ebx
+ 6c1:	89 1d a4 0c 00 00    	mov    %ebx,0xca4
+  return p;
+}
+ 6c7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 6ca:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 6cd:	89 ec                	mov    %ebp,%esp
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 6d8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 6dd:	39 c3                	cmp    %eax,%ebx
+ 6df:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 6e2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 6e5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 6e7:	e8 6f fc ff ff       	call   35b <sbrk>
+    if(p == (char*)-1)
+ 6ec:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 6ef:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 6f1:	74 1d                	je     710 <morecore+0x70>
+    if(p != arenaend)
+ 6f3:	39 05 a0 0c 00 00    	cmp    %eax,0xca0
+ 6f9:	74 0d                	je     708 <morecore+0x68>
+    arenaend = p + grow;
+ 6fb:	01 f2                	add    %esi,%edx
+ 6fd:	89 15 a0 0c 00 00    	mov    %edx,0xca0
+ 703:	eb ba                	jmp    6bf <morecore+0x1f>
+ 705:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 708:	a1 a4 0c 00 00       	mov    0xca4,%eax
+ 70d:	eb ec                	jmp    6fb <morecore+0x5b>
+ 70f:	90                   	nop
+      return 0;
+ 710:	31 c0                	xor    %eax,%eax
+ 712:	eb b3                	jmp    6c7 <morecore+0x27>
+ 714:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+
+00000720 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 72f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 732:	85 c0                	test   %eax,%eax
+ 734:	74 1e                	je     754 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 736:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 739:	83 fa 08             	cmp    $0x8,%edx
+ 73c:	77 16                	ja     754 <free+0x34>
+  h = (Header*)ap - 1;
+ 73e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 741:	74 25                	je     768 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 743:	8b 3c 95 c0 0c 00 00 	mov    0xcc0(,%edx,4),%edi
+ 74a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 74d:	89 0c 95 c0 0c 00 00 	mov    %ecx,0xcc0(,%edx,4)
+}
+ 754:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 757:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 75a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 75d:	89 ec                	mov    %ebp,%esp
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 768:	8b 15 e0 0c 00 00    	mov    0xce0,%edx
+ 76e:	85 d2                	test   %edx,%edx
+ 770:	74 54                	je     7c6 <free+0xa6>
+ 772:	39 ca                	cmp    %ecx,%edx
+ 774:	73 36                	jae    7ac <free+0x8c>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+ 780:	89 d3                	mov    %edx,%ebx
+ 782:	8b 12                	mov    (%edx),%edx
+ 784:	85 d2                	test   %edx,%edx
+ 786:	74 12                	je     79a <free+0x7a>
+ 788:	39 ca                	cmp    %ecx,%edx
+ 78a:	72 f4                	jb     780 <free+0x60>
+  if(p && END(h) == p){
+ 78c:	85 d2                	test   %edx,%edx
+ 78e:	74 0a                	je     79a <free+0x7a>
+ 790:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 793:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 796:	39 fa                	cmp    %edi,%edx
+ 798:	74 4b                	je     7e5 <free+0xc5>
+  h->s.u.next = p;
+ 79a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 79d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7a0:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 7a4:	39 f1                	cmp    %esi,%ecx
+ 7a6:	74 29                	je     7d1 <free+0xb1>
+    prev->s.u.next = h;
+ 7a8:	89 0b                	mov    %ecx,(%ebx)
+ 7aa:	eb a8                	jmp    754 <free+0x34>
+  if(p && END(h) == p){
+ 7ac:	85 d2                	test   %edx,%edx
+ 7ae:	74 16                	je     7c6 <free+0xa6>
+ 7b0:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 7b3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 7b6:	39 f2                	cmp    %esi,%edx
+ 7b8:	75 0c                	jne    7c6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 7ba:	8b 72 04             	mov    0x4(%edx),%esi
+ 7bd:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 7c1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 7c4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 7c6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 7c9:	89 0d e0 0c 00 00    	mov    %ecx,0xce0
+ 7cf:	eb 83                	jmp    754 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 7d1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 7d4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 7d8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 7db:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 7de:	89 03                	mov    %eax,(%ebx)
+ 7e0:	e9 6f ff ff ff       	jmp    754 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 7e5:	8b 7a 04             	mov    0x4(%edx),%edi
+ 7e8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 7ec:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 7ef:	8b 12                	mov    (%edx),%edx
+ 7f1:	eb a7                	jmp    79a <free+0x7a>
+ 7f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000800 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	83 ec 2c             	sub    $0x2c,%esp
+ 809:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 80c:	83 f8 10             	cmp    $0x10,%eax
+ 80f:	0f 86 52 01 00 00    	jbe    967 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 815:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 817:	ba 01 00 00 00       	mov    $0x1,%edx
+ 81c:	eb 0d                	jmp    82b <malloc+0x2b>
+ 81e:	66 90                	xchg   %ax,%ax
+ 820:	83 c1 05             	add    $0x5,%ecx
+ 823:	89 d6                	mov    %edx,%esi
+ 825:	d3 e6                	shl    %cl,%esi
+ 827:	39 c6                	cmp    %eax,%esi
+ 829:	73 55                	jae    880 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 82b:	89 d9                	mov    %ebx,%ecx
+ 82d:	43                   	inc    %ebx
+ 82e:	83 fb 08             	cmp    $0x8,%ebx
+ 831:	75 ed                	jne    820 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 833:	8d 58 07             	lea    0x7(%eax),%ebx
+ 836:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 839:	39 c3                	cmp    %eax,%ebx
+ 83b:	0f 82 1f 01 00 00    	jb     960 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 841:	a1 e0 0c 00 00       	mov    0xce0,%eax
+ 846:	85 c0                	test   %eax,%eax
+ 848:	0f 84 ee 00 00 00    	je     93c <malloc+0x13c>
+ 84e:	b9 e0 0c 00 00       	mov    $0xce0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 853:	8b 50 04             	mov    0x4(%eax),%edx
+ 856:	39 da                	cmp    %ebx,%edx
+ 858:	0f 82 d2 00 00 00    	jb     930 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 85e:	29 da                	sub    %ebx,%edx
+ 860:	83 fa 17             	cmp    $0x17,%edx
+ 863:	0f 87 b7 00 00 00    	ja     920 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 869:	8b 10                	mov    (%eax),%edx
+ 86b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 86d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 873:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 876:	83 c0 08             	add    $0x8,%eax
+}
+ 879:	5b                   	pop    %ebx
+ 87a:	5e                   	pop    %esi
+ 87b:	5f                   	pop    %edi
+ 87c:	5d                   	pop    %ebp
+ 87d:	c3                   	ret
+ 87e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 880:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 882:	8b 04 9d c0 0c 00 00 	mov    0xcc0(,%ebx,4),%eax
+ 889:	85 c0                	test   %eax,%eax
+ 88b:	74 23                	je     8b0 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 88d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 88f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 892:	89 14 9d c0 0c 00 00 	mov    %edx,0xcc0(,%ebx,4)
+    h->s.u.cls = cls;
+ 899:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 89c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 89f:	83 c4 2c             	add    $0x2c,%esp
+ 8a2:	5b                   	pop    %ebx
+ 8a3:	5e                   	pop    %esi
+ 8a4:	5f                   	pop    %edi
+ 8a5:	5d                   	pop    %ebp
+ 8a6:	c3                   	ret
+ 8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ae:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 8b0:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 8b3:	31 d2                	xor    %edx,%edx
+ 8b5:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 8ba:	f7 f6                	div    %esi
+ 8bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 8bf:	0f af c6             	imul   %esi,%eax
+ 8c2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 8c5:	e8 d6 fd ff ff       	call   6a0 <morecore>
+ 8ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 8cd:	85 c0                	test   %eax,%eax
+ 8cf:	0f 84 8b 00 00 00    	je     960 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 8d5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 8d8:	8b 0c 9d c0 0c 00 00 	mov    0xcc0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 8df:	31 d2                	xor    %edx,%edx
+ 8e1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 8e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 8ea:	eb 06                	jmp    8f2 <malloc+0xf2>
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 8f0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 8f2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 8f4:	42                   	inc    %edx
+ 8f5:	89 c1                	mov    %eax,%ecx
+ 8f7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 8fa:	39 d7                	cmp    %edx,%edi
+ 8fc:	75 f2                	jne    8f0 <malloc+0xf0>
+ 8fe:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 901:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 904:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 907:	89 04 9d c0 0c 00 00 	mov    %eax,0xcc0(,%ebx,4)
+ 90e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 911:	29 f0                	sub    %esi,%eax
+ 913:	01 c2                	add    %eax,%edx
+ 915:	89 d0                	mov    %edx,%eax
+ 917:	e9 71 ff ff ff       	jmp    88d <malloc+0x8d>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 920:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 923:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 926:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 928:	89 58 04             	mov    %ebx,0x4(%eax)
+ 92b:	e9 3d ff ff ff       	jmp    86d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 930:	89 c1                	mov    %eax,%ecx
+ 932:	8b 00                	mov    (%eax),%eax
+ 934:	85 c0                	test   %eax,%eax
+ 936:	0f 85 17 ff ff ff    	jne    853 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 93c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 93f:	74 1f                	je     960 <malloc+0x160>
+ 941:	8d 43 08             	lea    0x8(%ebx),%eax
+ 944:	e8 57 fd ff ff       	call   6a0 <morecore>
+ 949:	85 c0                	test   %eax,%eax
+ 94b:	74 13                	je     960 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 94d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ 953:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ 956:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ 959:	e9 41 ff ff ff       	jmp    89f <malloc+0x9f>
+ 95e:	66 90                	xchg   %ax,%ax
+      return 0;
+ 960:	31 c0                	xor    %eax,%eax
+ 962:	e9 38 ff ff ff       	jmp    89f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 967:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ 96c:	31 db                	xor    %ebx,%ebx
+ 96e:	e9 0f ff ff ff       	jmp    882 <malloc+0x82>
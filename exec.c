@@ -6,20 +6,22 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "mman.h"
 
 int
 exec(char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nvma;
   uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct vma vma[NVMA], oldvma[NVMA];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
   struct proc *curproc = myproc();
 
-  begin_op();
+  begin_opn(IPUTBLOCKS);
 
   if((ip = namei(path)) == 0){
     end_op();
@@ -27,6 +29,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  nvma = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -37,7 +40,8 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Map the program. Nothing is read yet: each segment becomes a
+  // vma, and pagefault() reads its pages on first touch.
   sz = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
@@ -48,12 +52,23 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.memsz == 0)
+      continue;
+    if(nvma == NVMA || ph.vaddr < sz)
       goto bad;
+    vma[nvma].start = ph.vaddr;
+    vma[nvma].end = ph.vaddr + ph.memsz;
+    vma[nvma].ip = idup(ip);
+    vma[nvma].off = ph.off;
+    vma[nvma].filesz = ph.filesz;
+    vma[nvma].perm = PTE_W|PTE_U;
+    vma[nvma].flags = MAP_PRIVATE|VMA_EXEC;
+    nvma++;
+    sz = ph.vaddr + ph.memsz;
   }
   iunlockput(ip);
   end_op();
@@ -92,21 +107,39 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
-  // Commit to the user image.
+  // Commit to the user image. getprocs() walks pgdir under
+  // p->lock, so swap it under p->lock: once that is released,
+  // nothing can still be walking the old one.
+  memmove(oldvma, curproc->vma, sizeof(oldvma));
+  memset(curproc->vma, 0, sizeof(curproc->vma));
+  memmove(curproc->vma, vma, nvma*sizeof(vma[0]));
+  acquire(&curproc->lock);
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
+  release(&curproc->lock);
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
+  for(i = 0; i < NVMA; i++)
+    vmasync(oldpgdir, &oldvma[i]);
   freevm(oldpgdir);
+  begin_op();
+  vmaclear(oldvma, NVMA);
+  end_op();
   return 0;
 
  bad:
   if(pgdir)
     freevm(pgdir);
   if(ip){
-    iunlockput(ip);
+    iunlock(ip);
+    vmaclear(vma, nvma);
+    iput(ip);
+    end_op();
+  } else if(nvma > 0){
+    begin_op();
+    vmaclear(vma, nvma);
     end_op();
   }
   return -1;
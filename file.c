@@ -73,7 +73,7 @@ fileclose(struct file *f)
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
-    begin_op();
+    begin_opn(IPUTBLOCKS);
     iput(ff.ip);
     end_op();
   }
@@ -127,10 +127,12 @@ filewrite(struct file *f, char *addr, int n)
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
     // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // the 2 indirect blocks above it in the double and
+    // triple indirect trees, and 2 blocks of slop for
+    // non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = ((MAXOPBLOCKS-1-1-2-2) / 2) * 512;
     int i = 0;
     while(i < n){
       int n1 = n - i;
@@ -22,7 +22,16 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NADDRS];
+
+  // Copy of the last indirect block bmap() reached the data
+  // through: it maps blocks mapbn..mapbn+NINDIRECT-1.
+  uint mapaddr;       // its block number; 0 if nothing is cached
+  uint mapbn;
+  uint map[NINDIRECT];
+
+  uint nextbn;        // block a sequential reader would read next
+  uint raend;         // blocks before this have been read ahead
 };
 
 // table mapping major device number to
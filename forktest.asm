@@ -0,0 +1,744 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+   6:	83 ec 10             	sub    $0x10,%esp
+  forktest();
+   9:	e8 42 00 00 00       	call   50 <forktest>
+  exit(0);
+   e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  15:	e8 a9 03 00 00       	call   3c3 <exit>
+  1a:	66 90                	xchg   %ax,%ax
+  1c:	66 90                	xchg   %ax,%ax
+  1e:	66 90                	xchg   %ax,%ax
+
+00000020 <printf>:
+{
+  20:	55                   	push   %ebp
+  21:	89 e5                	mov    %esp,%ebp
+  23:	83 ec 18             	sub    $0x18,%esp
+  26:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  29:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  2c:	89 1c 24             	mov    %ebx,(%esp)
+  2f:	e8 cc 01 00 00       	call   200 <strlen>
+  34:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  38:	89 44 24 08          	mov    %eax,0x8(%esp)
+  3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  3f:	89 04 24             	mov    %eax,(%esp)
+  42:	e8 9c 03 00 00       	call   3e3 <write>
+}
+  47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  4a:	89 ec                	mov    %ebp,%esp
+  4c:	5d                   	pop    %ebp
+  4d:	c3                   	ret
+  4e:	66 90                	xchg   %ax,%ax
+
+00000050 <forktest>:
+{
+  50:	55                   	push   %ebp
+  51:	89 e5                	mov    %esp,%ebp
+  53:	83 ec 18             	sub    $0x18,%esp
+  56:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  write(fd, s, strlen(s));
+  59:	bb cc 04 00 00       	mov    $0x4cc,%ebx
+  5e:	c7 04 24 cc 04 00 00 	movl   $0x4cc,(%esp)
+  65:	e8 96 01 00 00       	call   200 <strlen>
+  6a:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  for(n=0; n<N; n++){
+  6e:	31 db                	xor    %ebx,%ebx
+  write(fd, s, strlen(s));
+  70:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  77:	89 44 24 08          	mov    %eax,0x8(%esp)
+  7b:	e8 63 03 00 00       	call   3e3 <write>
+  for(n=0; n<N; n++){
+  80:	eb 15                	jmp    97 <forktest+0x47>
+  82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+  88:	0f 84 90 00 00 00    	je     11e <forktest+0xce>
+  for(n=0; n<N; n++){
+  8e:	43                   	inc    %ebx
+  8f:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  95:	74 6b                	je     102 <forktest+0xb2>
+    pid = fork();
+  97:	e8 1f 03 00 00       	call   3bb <fork>
+    if(pid < 0)
+  9c:	85 c0                	test   %eax,%eax
+  9e:	79 e8                	jns    88 <forktest+0x38>
+  for(; n > 0; n--){
+  a0:	85 db                	test   %ebx,%ebx
+  a2:	74 1f                	je     c3 <forktest+0x73>
+  a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  af:	90                   	nop
+    if(wait(0) < 0){
+  b0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  b7:	e8 0f 03 00 00       	call   3cb <wait>
+  bc:	85 c0                	test   %eax,%eax
+  be:	78 6a                	js     12a <forktest+0xda>
+  for(; n > 0; n--){
+  c0:	4b                   	dec    %ebx
+  c1:	75 ed                	jne    b0 <forktest+0x60>
+  if(wait(0) != -1){
+  c3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  ca:	e8 fc 02 00 00       	call   3cb <wait>
+  cf:	40                   	inc    %eax
+  d0:	0f 85 85 00 00 00    	jne    15b <forktest+0x10b>
+  write(fd, s, strlen(s));
+  d6:	c7 04 24 fe 04 00 00 	movl   $0x4fe,(%esp)
+  dd:	e8 1e 01 00 00       	call   200 <strlen>
+  e2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  e9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  ed:	b8 fe 04 00 00       	mov    $0x4fe,%eax
+  f2:	89 44 24 04          	mov    %eax,0x4(%esp)
+  f6:	e8 e8 02 00 00       	call   3e3 <write>
+}
+  fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fe:	89 ec                	mov    %ebp,%esp
+ 100:	5d                   	pop    %ebp
+ 101:	c3                   	ret
+    printf(1, "fork claimed to work N times!\n", N);
+ 102:	c7 44 24 08 e8 03 00 	movl   $0x3e8,0x8(%esp)
+ 109:	00 
+ 10a:	c7 44 24 04 0c 05 00 	movl   $0x50c,0x4(%esp)
+ 111:	00 
+ 112:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 119:	e8 02 ff ff ff       	call   20 <printf>
+    exit(0);
+ 11e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 125:	e8 99 02 00 00       	call   3c3 <exit>
+  write(fd, s, strlen(s));
+ 12a:	c7 04 24 d7 04 00 00 	movl   $0x4d7,(%esp)
+ 131:	e8 ca 00 00 00       	call   200 <strlen>
+ 136:	b9 d7 04 00 00       	mov    $0x4d7,%ecx
+ 13b:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+ 13f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 146:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 14a:	e8 94 02 00 00       	call   3e3 <write>
+      exit(0);
+ 14f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 156:	e8 68 02 00 00       	call   3c3 <exit>
+    printf(1, "wait got too many\n");
+ 15b:	c7 44 24 04 eb 04 00 	movl   $0x4eb,0x4(%esp)
+ 162:	00 
+ 163:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 16a:	e8 b1 fe ff ff       	call   20 <printf>
+    exit(0);
+ 16f:	31 d2                	xor    %edx,%edx
+ 171:	89 14 24             	mov    %edx,(%esp)
+ 174:	e8 4a 02 00 00       	call   3c3 <exit>
+ 179:	66 90                	xchg   %ax,%ax
+ 17b:	66 90                	xchg   %ax,%ax
+ 17d:	66 90                	xchg   %ax,%ax
+ 17f:	90                   	nop
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	40                   	inc    %eax
+ 198:	84 d2                	test   %dl,%dl
+ 19a:	75 f4                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19c:	5b                   	pop    %ebx
+ 19d:	89 c8                	mov    %ecx,%eax
+ 19f:	5d                   	pop    %ebp
+ 1a0:	c3                   	ret
+ 1a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 15                	jne    1d6 <strcmp+0x26>
+ 1c1:	eb 30                	jmp    1f3 <strcmp+0x43>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 1cf:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 1d0:	84 c0                	test   %al,%al
+ 1d2:	74 14                	je     1e8 <strcmp+0x38>
+    p++, q++;
+ 1d4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 1d6:	0f b6 0b             	movzbl (%ebx),%ecx
+ 1d9:	38 c1                	cmp    %al,%cl
+ 1db:	74 eb                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 1dd:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 1de:	29 c8                	sub    %ecx,%eax
+}
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1e8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 1ec:	31 c0                	xor    %eax,%eax
+}
+ 1ee:	5b                   	pop    %ebx
+ 1ef:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 1f0:	29 c8                	sub    %ecx,%eax
+}
+ 1f2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1f3:	0f b6 0b             	movzbl (%ebx),%ecx
+ 1f6:	31 c0                	xor    %eax,%eax
+ 1f8:	eb e3                	jmp    1dd <strcmp+0x2d>
+ 1fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000200 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 206:	80 3a 00             	cmpb   $0x0,(%edx)
+ 209:	74 15                	je     220 <strlen+0x20>
+ 20b:	31 c0                	xor    %eax,%eax
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+ 210:	40                   	inc    %eax
+ 211:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 215:	89 c1                	mov    %eax,%ecx
+ 217:	75 f7                	jne    210 <strlen+0x10>
+    ;
+  return n;
+}
+ 219:	5d                   	pop    %ebp
+ 21a:	89 c8                	mov    %ecx,%eax
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 221:	31 c9                	xor    %ecx,%ecx
+}
+ 223:	89 c8                	mov    %ecx,%eax
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 237:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23d:	89 d7                	mov    %edx,%edi
+ 23f:	fc                   	cld
+ 240:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 242:	5f                   	pop    %edi
+ 243:	89 d0                	mov    %edx,%eax
+ 245:	5d                   	pop    %ebp
+ 246:	c3                   	ret
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	84 d2                	test   %dl,%dl
+ 25f:	75 10                	jne    271 <strchr+0x21>
+ 261:	eb 1d                	jmp    280 <strchr+0x30>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 26c:	40                   	inc    %eax
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	74 0f                	je     280 <strchr+0x30>
+    if(*s == c)
+ 271:	38 d1                	cmp    %dl,%cl
+ 273:	75 f3                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 275:	5d                   	pop    %ebp
+ 276:	c3                   	ret
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+ 280:	5d                   	pop    %ebp
+  return 0;
+ 281:	31 c0                	xor    %eax,%eax
+}
+ 283:	c3                   	ret
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 295:	31 f6                	xor    %esi,%esi
+{
+ 297:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 298:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 29b:	83 ec 3c             	sub    $0x3c,%esp
+ 29e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 2a1:	eb 32                	jmp    2d5 <gets+0x45>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+    cc = read(0, &c, 1);
+ 2a8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 2ac:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 2b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 2bc:	e8 1a 01 00 00       	call   3db <read>
+    if(cc < 1)
+ 2c1:	85 c0                	test   %eax,%eax
+ 2c3:	7e 19                	jle    2de <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 2c5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2cd:	3c 0a                	cmp    $0xa,%al
+ 2cf:	74 10                	je     2e1 <gets+0x51>
+ 2d1:	3c 0d                	cmp    $0xd,%al
+ 2d3:	74 0c                	je     2e1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 2d5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 2d8:	46                   	inc    %esi
+ 2d9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 2dc:	7c ca                	jl     2a8 <gets+0x18>
+ 2de:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2e1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 2e5:	83 c4 3c             	add    $0x3c,%esp
+ 2e8:	89 d8                	mov    %ebx,%eax
+ 2ea:	5b                   	pop    %ebx
+ 2eb:	5e                   	pop    %esi
+ 2ec:	5f                   	pop    %edi
+ 2ed:	5d                   	pop    %ebp
+ 2ee:	c3                   	ret
+ 2ef:	90                   	nop
+
+000002f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2f0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f1:	31 c0                	xor    %eax,%eax
+{
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	83 ec 18             	sub    $0x18,%esp
+ 2f8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 2fb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 2fe:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 302:	8b 45 08             	mov    0x8(%ebp),%eax
+ 305:	89 04 24             	mov    %eax,(%esp)
+ 308:	e8 f6 00 00 00       	call   403 <open>
+  if(fd < 0)
+ 30d:	85 c0                	test   %eax,%eax
+ 30f:	78 2f                	js     340 <stat+0x50>
+ 311:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 313:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 316:	89 1c 24             	mov    %ebx,(%esp)
+ 319:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 31d:	e8 f9 00 00 00       	call   41b <fstat>
+  close(fd);
+ 322:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 325:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 327:	e8 bf 00 00 00       	call   3eb <close>
+  return r;
+}
+ 32c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 32f:	89 f0                	mov    %esi,%eax
+ 331:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 334:	89 ec                	mov    %ebp,%esp
+ 336:	5d                   	pop    %ebp
+ 337:	c3                   	ret
+ 338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb e5                	jmp    32c <stat+0x3c>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	88 c1                	mov    %al,%cl
+ 35c:	80 e9 30             	sub    $0x30,%cl
+ 35f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 362:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 367:	77 1c                	ja     385 <atoi+0x35>
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 370:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 373:	42                   	inc    %edx
+ 374:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 378:	0f be 02             	movsbl (%edx),%eax
+ 37b:	88 c3                	mov    %al,%bl
+ 37d:	80 eb 30             	sub    $0x30,%bl
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	5b                   	pop    %ebx
+ 386:	89 c8                	mov    %ecx,%eax
+ 388:	5d                   	pop    %ebp
+ 389:	c3                   	ret
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+
+000003bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <exit>:
+SYSCALL(exit)
+ 3c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <wait>:
+SYSCALL(wait)
+ 3cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <pipe>:
+SYSCALL(pipe)
+ 3d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <read>:
+SYSCALL(read)
+ 3db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <write>:
+SYSCALL(write)
+ 3e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <close>:
+SYSCALL(close)
+ 3eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <kill>:
+SYSCALL(kill)
+ 3f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <exec>:
+SYSCALL(exec)
+ 3fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <open>:
+SYSCALL(open)
+ 403:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mknod>:
+SYSCALL(mknod)
+ 40b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <unlink>:
+SYSCALL(unlink)
+ 413:	b8 12 00 00 00       	mov    $0x12,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <fstat>:
+SYSCALL(fstat)
+ 41b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <link>:
+SYSCALL(link)
+ 423:	b8 13 00 00 00       	mov    $0x13,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mkdir>:
+SYSCALL(mkdir)
+ 42b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <chdir>:
+SYSCALL(chdir)
+ 433:	b8 09 00 00 00       	mov    $0x9,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <dup>:
+SYSCALL(dup)
+ 43b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getpid>:
+SYSCALL(getpid)
+ 443:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sbrk>:
+SYSCALL(sbrk)
+ 44b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <sleep>:
+SYSCALL(sleep)
+ 453:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <uptime>:
+SYSCALL(uptime)
+ 45b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <detach>:
+SYSCALL(detach)
+ 463:	b8 16 00 00 00       	mov    $0x16,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <policy>:
+SYSCALL(policy)
+ 46b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <priority>:
+SYSCALL(priority)
+ 473:	b8 18 00 00 00       	mov    $0x18,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <wait_stat>:
+SYSCALL(wait_stat)
+ 47b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <lockstat>:
+SYSCALL(lockstat)
+ 483:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mmap>:
+SYSCALL(mmap)
+ 48b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <munmap>:
+SYSCALL(munmap)
+ 493:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <shmget>:
+SYSCALL(shmget)
+ 49b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <shmat>:
+SYSCALL(shmat)
+ 4a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <shmdt>:
+SYSCALL(shmdt)
+ 4ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <memstat>:
+SYSCALL(memstat)
+ 4b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getprocs>:
+SYSCALL(getprocs)
+ 4bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <shmctl>:
+SYSCALL(shmctl)
+ 4c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
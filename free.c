@@ -0,0 +1,21 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "memstat.h"
+
+// Print physical memory usage, in KB.
+int
+main(void)
+{
+  struct memstat ms;
+
+  if(memstat(&ms) < 0){
+    printf(2, "free: failed\n");
+    exit(1);
+  }
+  printf(1, "total %d KB\n", ms.total * 4);
+  printf(1, "used %d KB\n", (ms.total - ms.free) * 4);
+  printf(1, "free %d KB (%d KB zeroed)\n", ms.free * 4, ms.zeroed * 4);
+  printf(1, "page tables %d KB\n", ms.ptpages * 4);
+  exit(0);
+}
@@ -23,6 +23,8 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dcacheinit(void);
+static void dcachepurge(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -175,6 +177,7 @@ iinit(int dev)
   int i = 0;
   
   initlock(&icache.lock, "icache");
+  dcacheinit();
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
@@ -267,6 +270,9 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->mapaddr = 0;
+  ip->nextbn = 0;
+  ip->raend = 0;
   release(&icache.lock);
 
   return ip;
@@ -339,6 +345,8 @@ iput(struct inode *ip)
     release(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcachepurge(ip);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
@@ -366,14 +374,21 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], the next NDINDIRECT
+// in the indirect blocks listed in ip->addrs[NDIRECT+1], and
+// the last NTINDIRECT one level further down from
+// ip->addrs[NDIRECT+2].
+//
+// bmap() keeps a copy of the last bottom-level indirect block
+// it used in the inode, so that sequential access only walks
+// the tree once every NINDIRECT blocks.
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, level, span, div, i;
   struct buf *bp;
 
   if(bn < NDIRECT){
@@ -381,23 +396,101 @@ bmap(struct inode *ip, uint bn)
       ip->addrs[bn] = addr = balloc(ip->dev);
     return addr;
   }
+
+  if(ip->mapaddr && bn - ip->mapbn < NINDIRECT &&
+     (addr = ip->map[bn - ip->mapbn]) != 0)
+    return addr;
+
+  // Find the tree: level 1 is single indirect.
+  i = bn;
   bn -= NDIRECT;
+  for(level = 1, span = NINDIRECT; bn >= span; level++, span *= NINDIRECT){
+    if(level == 3)
+      panic("bmap: out of range");
+    bn -= span;
+  }
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Walk down it, allocating as necessary.
+  if((addr = ip->addrs[NDIRECT+level-1]) == 0)
+    ip->addrs[NDIRECT+level-1] = addr = balloc(ip->dev);
+  for(div = span / NINDIRECT; ; div /= NINDIRECT){
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[bn / div % NINDIRECT]) == 0){
+      a[bn / div % NINDIRECT] = addr = balloc(ip->dev);
       log_write(bp);
     }
+    if(div == 1){
+      ip->mapaddr = bp->blockno;
+      ip->mapbn = i - bn % NINDIRECT;
+      memmove(ip->map, a, sizeof(ip->map));
+      brelse(bp);
+      return addr;
+    }
     brelse(bp);
-    return addr;
   }
+}
+
+// Blocks one step of a truncation writes, so that the step
+// stays within what its transaction reserved.
+struct trunc {
+  int n, max;
+  uint blk[MAXOPBLOCKS];
+};
+
+// Note that block b will be written in this step.
+// Returns 0 if the step has no room left for it.
+static int
+tnote(struct trunc *t, uint b)
+{
+  int i;
+
+  for(i = 0; i < t->n; i++)
+    if(t->blk[i] == b)
+      return 1;
+  if(t->n == t->max)
+    return 0;
+  t->blk[t->n++] = b;
+  return 1;
+}
 
-  panic("bmap: out of range");
+// Free the tree of blocks rooted at block addr, level levels
+// above the data blocks, as far as t has room. The entries of
+// subtrees freed so far are zeroed, so a tree that can't all
+// be freed in one step is still valid. Returns 1 if it was.
+static int
+bfreetree(struct trunc *t, uint dev, uint addr, int level)
+{
+  struct buf *bp;
+  uint *a;
+  int j, dirty;
+
+  if(level > 0){
+    if(!tnote(t, addr))
+      return 0;
+    bp = bread(dev, addr);
+    a = (uint*)bp->data;
+    dirty = 0;
+    for(j = 0; j < NINDIRECT; j++){
+      if(a[j] == 0)
+        continue;
+      if(!bfreetree(t, dev, a[j], level - 1))
+        break;
+      a[j] = 0;
+      dirty = 1;
+    }
+    if(j < NINDIRECT){
+      if(dirty)
+        log_write(bp);
+      brelse(bp);
+      return 0;
+    }
+    brelse(bp);
+  }
+  if(!tnote(t, BBLOCK(addr, sb)))
+    return 0;
+  bfree(dev, addr);
+  return 1;
 }
 
 // Truncate inode (discard contents).
@@ -405,30 +498,34 @@ bmap(struct inode *ip, uint bn)
 // to it (no directory entries referring to it)
 // and has no in-memory reference to it (is
 // not an open file or current directory).
+// A large file touches more bitmap and indirect blocks than
+// one transaction may write, so it is freed in steps, each
+// committed before the next starts in a new transaction.
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
-
-  for(i = 0; i < NDIRECT; i++){
-    if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
-      ip->addrs[i] = 0;
-    }
-  }
-
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  struct trunc t;
+  int i;
+
+  ip->mapaddr = 0;
+  // The caller may have logged blocks in this transaction
+  // already; one more is left for the inode.
+  t.n = 0;
+  t.max = myproc()->logres - myproc()->logused - 1;
+  if(t.max < 0)
+    t.max = 0;
+  for(i = 0; i < NADDRS; i++){
+    while(ip->addrs[i]){
+      if(bfreetree(&t, ip->dev, ip->addrs[i], i < NDIRECT ? 0 : i - NDIRECT + 1)){
+        ip->addrs[i] = 0;
+        break;
+      }
+      iupdate(ip);
+      end_op();
+      begin_op();
+      t.n = 0;
+      t.max = MAXOPBLOCKS - 1;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
 
   ip->size = 0;
@@ -447,6 +544,31 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Note that block bn of ip is being read. If the file is being
+// read sequentially, start reading the next RAWINDOW blocks
+// into the buffer cache, so they are there when asked for.
+// Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint b, end, nblocks;
+
+  if(bn != ip->nextbn && bn + 1 != ip->nextbn){
+    // Random access; start over.
+    ip->nextbn = bn + 1;
+    ip->raend = bn + 1;
+    return;
+  }
+  ip->nextbn = bn + 1;
+  nblocks = (ip->size + BSIZE - 1) / BSIZE;
+  end = min(bn + 1 + RAWINDOW, nblocks);
+  b = ip->raend > bn + 1 ? ip->raend : bn + 1;
+  for(; b < end; b++)
+    bprefetch(ip->dev, bmap(ip, b));
+  if(end > ip->raend)
+    ip->raend = end;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -469,6 +591,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    readahead(ip, off/BSIZE);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
@@ -520,17 +643,582 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory entry cache.
+//
+// Maps (dev, directory inum, name) to the inum the name
+// refers to, or to 0 if the directory has no such entry, so
+// that namex can resolve path elements it has seen before
+// with a hash probe instead of locking and reading the
+// directory. Entries exist only for directories: namex fills
+// them in while holding the directory's lock, and dirlink,
+// unlink and freeing the directory drop them under that lock.
+// Replacement uses a clock over the table.
+
+struct dentry {
+  uint dev;
+  uint dir;              // Directory inum, 0 if unused
+  char name[DIRSIZ];
+  uint inum;             // 0 for a negative entry
+  int used;              // Referenced since the clock hand passed
+  struct dentry *next;   // Hash chain
+};
+
+#define NDHASH 127
+
+struct {
+  struct spinlock lock;
+  struct dentry ent[NDENTRY];
+  struct dentry *hash[NDHASH];
+  struct dentry *hand;
+} dcache;
+
+static void
+dcacheinit(void)
+{
+  initlock(&dcache.lock, "dcache");
+  dcache.hand = dcache.ent;
+}
+
+static struct dentry**
+dchain(uint dev, uint dir, char *name)
+{
+  return &dcache.hash[(dxhash(name) ^ (dev * 7 + dir)) % NDHASH];
+}
+
+// Find the entry for name in dir. Caller holds dcache.lock.
+static struct dentry*
+dfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = *dchain(dev, dir, name); d; d = d->next)
+    if(d->dev == dev && d->dir == dir && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Remove d from its hash chain and mark it unused.
+static void
+dunchain(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = dchain(d->dev, d->dir, d->name); *pp != d; pp = &(*pp)->next)
+    ;
+  *pp = d->next;
+  d->dir = 0;
+}
+
+// Look name up in directory dp without locking it. On a hit,
+// set *ipp to the referenced inode, or to 0 if the name is
+// known not to exist, and return 1. Return 0 on a miss.
+static int
+dcacheget(struct inode *dp, char *name, struct inode **ipp)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    release(&dcache.lock);
+    return 0;
+  }
+  d->used = 1;
+  // Take the reference before dropping dcache.lock, so that
+  // an unlink cannot free the inode in between.
+  *ipp = d->inum ? iget(d->dev, d->inum) : 0;
+  release(&dcache.lock);
+  return 1;
+}
+
+// Record that name in directory dp refers to inum (0 if it
+// does not exist). Caller holds dp->lock.
+static void
+dcacheput(struct inode *dp, char *name, uint inum)
+{
+  struct dentry *d, **pp;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    for(;;){
+      d = dcache.hand;
+      if(++dcache.hand == &dcache.ent[NDENTRY])
+        dcache.hand = dcache.ent;
+      if(d->dir == 0 || !d->used)
+        break;
+      d->used = 0;
+    }
+    if(d->dir != 0)
+      dunchain(d);
+    d->dev = dp->dev;
+    d->dir = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    pp = dchain(d->dev, d->dir, d->name);
+    d->next = *pp;
+    *pp = d;
+  }
+  d->inum = inum;
+  d->used = 1;
+  release(&dcache.lock);
+}
+
+// Drop the entry for name in directory dp, whose entries are
+// changing. Caller holds dp->lock.
+void
+dcacheinval(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) != 0)
+    dunchain(d);
+  release(&dcache.lock);
+}
+
+// Drop all entries of directory dp, which is being freed.
+static void
+dcachepurge(struct inode *dp)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.ent; d < &dcache.ent[NDENTRY]; d++)
+    if(d->dir == dp->inum && d->dev == dp->dev)
+      dunchain(d);
+  release(&dcache.lock);
+}
+
+//PAGEBREAK!
+// Hashed directories.
+
+// An index node: the root, whose entries follow ".", ".." and
+// the head, or an index block, whose entries follow the head.
+struct dxnode {
+  struct buf *bp;
+  struct dxhead *h;
+  struct dxslot *s;
+  uint max;
+};
+
+#define DXHASH(n, i) ((n)->s[(i)/2].hash[(i)%2])
+#define DXBLOCK(n, i) ((n)->s[(i)/2].block[(i)%2])
+
+static void
+dxnode(struct dxnode *n, struct buf *bp, int root)
+{
+  n->bp = bp;
+  n->h = (struct dxhead*)(bp->data + (root ? 2*sizeof(struct dirent) : 0));
+  n->s = (struct dxslot*)(n->h + 1);
+  n->max = root ? DXROOT : DXNODE;
+}
+
+// Read block bn of directory dp.
+static struct buf*
+dxread(struct inode *dp, uint bn)
+{
+  return bread(dp->dev, bmap(dp, bn));
+}
+
+// Return the locked root of dp if it is hashed, else 0.
+// A root's header sits where a linear directory's third entry
+// would, with inum 0 so that it reads as a free slot.
+static struct buf*
+dxroot(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxnode n;
+
+  if(dp->size <= BSIZE)
+    return 0;
+  bp = dxread(dp, 0);
+  dxnode(&n, bp, 1);
+  if(n.h->zero != 0 || n.h->magic != DXMAGIC){
+    brelse(bp);
+    return 0;
+  }
+  return bp;
+}
+
+// Append a zeroed block to dp; return its number in dp, or 0
+// if dp has as many blocks as the index can address.
+static uint
+dxgrow(struct inode *dp)
+{
+  uint bn;
+
+  bn = dp->size / BSIZE;
+  if(bn > 0xFFFF || bn >= MAXFILE)
+    return 0;
+  bmap(dp, bn);
+  dp->size += BSIZE;
+  iupdate(dp);
+  return bn;
+}
+
+// If slot i of leaf bp links to an overflow leaf, return that
+// leaf's block number, else 0.
+static uint
+dxnext(struct buf *bp, int i)
+{
+  struct dxlink *l;
+
+  l = (struct dxlink*)bp->data + i;
+  if(l->zero == 0 && l->magic == DXMAGIC)
+    return l->block;
+  return 0;
+}
+
+// Position of the last entry in n whose hash is <= hash.
+// Entry 0 covers hashes below entry 1.
+static int
+dxfind(struct dxnode *n, uint hash)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n->h->count - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(DXHASH(n, mid) <= hash)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+// Insert entry (hash, bn) at position i of n, which has room.
+static void
+dxinsert(struct dxnode *n, int i, uint hash, uint bn)
+{
+  int j;
+
+  for(j = n->h->count; j > i; j--){
+    DXHASH(n, j) = DXHASH(n, j-1);
+    DXBLOCK(n, j) = DXBLOCK(n, j-1);
+  }
+  DXHASH(n, i) = hash;
+  DXBLOCK(n, i) = bn;
+  n->h->count++;
+  log_write(n->bp);
+}
+
+// Block number of the leaf of dp that holds hash.
+static uint
+dxleaf(struct inode *dp, struct buf *root, uint hash)
+{
+  struct dxnode n;
+  struct buf *bp;
+  uint bn;
+
+  dxnode(&n, root, 1);
+  bn = DXBLOCK(&n, dxfind(&n, hash));
+  if(n.h->levels == 0)
+    return bn;
+  bp = dxread(dp, bn);
+  dxnode(&n, bp, 0);
+  bn = DXBLOCK(&n, dxfind(&n, hash));
+  brelse(bp);
+  return bn;
+}
+
+// Look for name in hashed directory dp, reading only the
+// leaf its hash selects and that leaf's overflow chain.
+// Releases root.
+static struct inode*
+dxlookup(struct inode *dp, struct buf *root, char *name, uint *poff)
+{
+  struct dirent *de;
+  struct buf *bp;
+  uint bn, next, i, inum;
+
+  // "." and ".." stay at the start of the root.
+  bp = root;
+  bn = 0;
+  for(i = 0; i < 2; i++){
+    de = (struct dirent*)bp->data + i;
+    if(de->inum != 0 && namecmp(name, de->name) == 0)
+      goto found;
+  }
+  bn = dxleaf(dp, root, dxhash(name));
+  brelse(root);
+  for(;;){
+    bp = dxread(dp, bn);
+    next = 0;
+    for(i = 0; i < DPB; i++){
+      de = (struct dirent*)bp->data + i;
+      if(de->inum != 0 && namecmp(name, de->name) == 0)
+        goto found;
+      if(de->inum == 0 && next == 0)
+        next = dxnext(bp, i);
+    }
+    brelse(bp);
+    if(next == 0)
+      return 0;
+    bn = next;
+  }
+
+found:
+  if(poff)
+    *poff = bn*BSIZE + i*sizeof(*de);
+  inum = de->inum;
+  brelse(bp);
+  return iget(dp->dev, inum);
+}
+
+// Look for a free slot in leaf bn and its overflow chain.
+// Returns the locked block holding the slot and sets *slot,
+// or returns the last, full block of the chain and sets *slot
+// to -1. Sets *chained if bn has an overflow chain.
+static struct buf*
+dxfree(struct inode *dp, uint bn, int *slot, int *chained)
+{
+  struct buf *bp;
+  uint next;
+  int i;
+
+  *chained = 0;
+  for(;;){
+    bp = dxread(dp, bn);
+    next = 0;
+    for(i = 0; i < DPB; i++){
+      if(((struct dirent*)bp->data)[i].inum != 0)
+        continue;
+      if((next = dxnext(bp, i)) == 0){
+        *slot = i;
+        return bp;
+      }
+    }
+    if(next == 0){
+      *slot = -1;
+      return bp;
+    }
+    brelse(bp);
+    bn = next;
+    *chained = 1;
+  }
+}
+
+// Make room in hashed directory dp for an entry with hash by
+// splitting the leaf that holds it, which is full and has no
+// overflow chain. If the index has no room for the new leaf,
+// make some first, in which case the caller must try again.
+// Returns 0 on progress, 1 if the leaf's names all hash alike
+// so it cannot split, and -1 if the directory is full.
+static int
+dxsplit(struct inode *dp, struct buf *root, uint hash)
+{
+  struct dxnode r, n, nn, *p;
+  struct buf *bp, *nbp, *ibp;
+  struct dirent *de, *nde;
+  uint hs[DPB], h, nbn;
+  uchar ord[DPB], o;
+  int i, j, m, ri;
+
+  dxnode(&r, root, 1);
+  ri = dxfind(&r, hash);
+  ibp = 0;
+  p = &r;
+  if(r.h->levels == 0 && r.h->count == r.max){
+    // Root full: move its entries to an index block.
+    if((nbn = dxgrow(dp)) == 0)
+      return -1;
+    nbp = dxread(dp, nbn);
+    dxnode(&n, nbp, 0);
+    n.h->magic = DXMAGIC;
+    memmove(n.s, r.s, r.max/2 * sizeof(struct dxslot));
+    n.h->count = r.h->count;
+    log_write(nbp);
+    brelse(nbp);
+    memset(r.s, 0, r.max/2 * sizeof(struct dxslot));
+    r.h->count = 0;
+    r.h->levels = 1;
+    dxinsert(&r, 0, 0, nbn);
+    return 0;
+  }
+  if(r.h->levels > 0){
+    ibp = dxread(dp, DXBLOCK(&r, ri));
+    dxnode(&n, ibp, 0);
+    if(n.h->count == n.max){
+      // Index block full: move its upper half to a new one.
+      if(r.h->count == r.max || (nbn = dxgrow(dp)) == 0){
+        brelse(ibp);
+        return -1;
+      }
+      nbp = dxread(dp, nbn);
+      dxnode(&nn, nbp, 0);
+      nn.h->magic = DXMAGIC;
+      m = n.max / 2;
+      for(i = m; i < n.h->count; i++){
+        DXHASH(&nn, i-m) = DXHASH(&n, i);
+        DXBLOCK(&nn, i-m) = DXBLOCK(&n, i);
+        DXHASH(&n, i) = 0;
+        DXBLOCK(&n, i) = 0;
+      }
+      nn.h->count = n.h->count - m;
+      n.h->count = m;
+      log_write(ibp);
+      log_write(nbp);
+      dxinsert(&r, ri+1, DXHASH(&nn, 0), nbn);
+      brelse(nbp);
+      brelse(ibp);
+      return 0;
+    }
+    p = &n;
+  }
+
+  // Split the leaf, sorting its entries by hash and moving the
+  // upper half to a new leaf. Entries with equal hashes must
+  // stay together, so split at the boundary nearest the middle.
+  i = dxfind(p, hash);
+  bp = dxread(dp, DXBLOCK(p, i));
+  de = (struct dirent*)bp->data;
+  for(j = 0; j < DPB; j++){
+    h = dxhash(de[j].name);
+    for(m = j; m > 0 && hs[m-1] > h; m--){
+      hs[m] = hs[m-1];
+      ord[m] = ord[m-1];
+    }
+    hs[m] = h;
+    ord[m] = j;
+  }
+  for(j = 0; j < DPB/2; j++){
+    if(hs[DPB/2 - j - 1] != hs[DPB/2 - j]){
+      m = DPB/2 - j;
+      break;
+    }
+    if(DPB/2 + j + 1 < DPB && hs[DPB/2 + j] != hs[DPB/2 + j + 1]){
+      m = DPB/2 + j + 1;
+      break;
+    }
+  }
+  if(j == DPB/2 || (nbn = dxgrow(dp)) == 0){
+    brelse(bp);
+    if(ibp)
+      brelse(ibp);
+    return j == DPB/2 ? 1 : -1;
+  }
+  nbp = dxread(dp, nbn);
+  nde = (struct dirent*)nbp->data;
+  for(j = m; j < DPB; j++){
+    o = ord[j];
+    nde[j-m] = de[o];
+    memset(&de[o], 0, sizeof(de[o]));
+  }
+  log_write(bp);
+  log_write(nbp);
+  dxinsert(p, i+1, hs[m], nbn);
+  brelse(nbp);
+  brelse(bp);
+  if(ibp)
+    brelse(ibp);
+  return 0;
+}
+
+// Chain an overflow leaf to bp, the full last leaf of a chain:
+// bp's last entry moves to the new leaf and a link takes its
+// slot. Returns -1 if the directory is full.
+static int
+dxchain(struct inode *dp, struct buf *bp)
+{
+  struct dxlink *l;
+  struct buf *nbp;
+  uint nbn;
+
+  if((nbn = dxgrow(dp)) == 0)
+    return -1;
+  nbp = dxread(dp, nbn);
+  l = (struct dxlink*)bp->data + DPB-1;
+  memmove(nbp->data, l, sizeof(*l));
+  memset(l, 0, sizeof(*l));
+  l->block = nbn;
+  l->magic = DXMAGIC;
+  log_write(nbp);
+  log_write(bp);
+  brelse(nbp);
+  return 0;
+}
+
+// Add (name, inum) to hashed directory dp. Releases root.
+// Returns -1 if the directory is full.
+static int
+dxlink(struct inode *dp, struct buf *root, char *name, uint inum)
+{
+  struct dirent *de;
+  struct buf *bp;
+  uint hash;
+  int i, r, chained;
+
+  hash = dxhash(name);
+  for(;;){
+    bp = dxfree(dp, dxleaf(dp, root, hash), &i, &chained);
+    if(i >= 0){
+      de = (struct dirent*)bp->data + i;
+      strncpy(de->name, name, DIRSIZ);
+      de->inum = inum;
+      log_write(bp);
+      brelse(bp);
+      brelse(root);
+      return 0;
+    }
+    // Split the leaf if it can, else give it (more) overflow.
+    r = 1;
+    if(!chained){
+      brelse(bp);
+      if((r = dxsplit(dp, root, hash)) == 1)
+        bp = dxfree(dp, dxleaf(dp, root, hash), &i, &chained);
+    }
+    if(r == 1){
+      r = dxchain(dp, bp);
+      brelse(bp);
+    }
+    if(r < 0){
+      brelse(root);
+      return -1;
+    }
+  }
+}
+
+// Turn dp, a linear directory whose one block is full, into a
+// hashed directory: all entries but "." and ".." move to a
+// single leaf.
+static void
+dxconvert(struct inode *dp)
+{
+  struct buf *root, *leaf;
+  struct dxnode n;
+  uint bn, skip;
+
+  skip = 2*sizeof(struct dirent);
+  bn = dxgrow(dp);  // Block 1: cannot fail
+  root = dxread(dp, 0);
+  leaf = dxread(dp, bn);
+  memmove(leaf->data, root->data + skip, BSIZE - skip);
+  log_write(leaf);
+  brelse(leaf);
+  memset(root->data + skip, 0, BSIZE - skip);
+  dxnode(&n, root, 1);
+  n.h->magic = DXMAGIC;
+  dxinsert(&n, 0, 0, bn);
+  brelse(root);
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Directories of one block, and ones written by older
+// kernels, are linear; larger ones are hashed.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
   uint off, inum;
   struct dirent de;
+  struct buf *root;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  if((root = dxroot(dp)) != 0)
+    return dxlookup(dp, root, name, poff);
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -549,12 +1237,14 @@ dirlookup(struct inode *dp, char *name, uint *poff)
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// A linear directory whose one block fills up becomes hashed.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
   int off;
   struct dirent de;
   struct inode *ip;
+  struct buf *root;
 
   // Check that name is not present.
   if((ip = dirlookup(dp, name, 0)) != 0){
@@ -562,6 +1252,10 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  dcacheinval(dp, name);
+  if((root = dxroot(dp)) != 0)
+    return dxlink(dp, root, name, inum);
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -570,6 +1264,11 @@ dirlink(struct inode *dp, char *name, uint inum)
       break;
   }
 
+  if(off == BSIZE && dp->size == BSIZE){
+    dxconvert(dp);
+    return dxlink(dp, dxroot(dp), name, inum);
+  }
+
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -633,6 +1332,14 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
+    // A dentry cache hit also shows that ip is a directory.
+    if((!nameiparent || *path != '\0') && dcacheget(ip, name, &next)){
+      iput(ip);
+      if(next == 0)
+        return 0;
+      ip = next;
+      continue;
+    }
     ilock(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
@@ -643,7 +1350,9 @@ namex(char *path, int nameiparent, char *name)
       iunlock(ip);
       return ip;
     }
-    if((next = dirlookup(ip, name, 0)) == 0){
+    next = dirlookup(ip, name, 0);
+    dcacheput(ip, name, next ? next->inum : 0);
+    if(next == 0){
       iunlockput(ip);
       return 0;
     }
@@ -21,9 +21,14 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+// addrs[] holds NDIRECT direct block numbers, then the roots
+// of a single, a double and a triple indirect tree.
+#define NDIRECT 10
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define NTINDIRECT (NDINDIRECT * NINDIRECT)
+#define NADDRS (NDIRECT + 3)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT + NTINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +37,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NADDRS];   // Data block addresses
 };
 
 // Inodes per block.
@@ -55,3 +60,60 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+
+// Directory entries per block.
+#define DPB (BSIZE / sizeof(struct dirent))
+
+// A directory that outgrows one block is hashed. Its block 0
+// holds ".", "..", a dxhead and the root of an index that maps
+// name hashes to the blocks holding the entries (leaves). With
+// levels 1 the root points to index blocks, which begin with a
+// dxhead and point to leaves. Index entries are sorted by hash,
+// each giving the lowest hash of its leaf or index block. The
+// index lives in slots whose inum is 0, so programs that read
+// a directory as an array of dirents skip it.
+#define DXMAGIC 0x78746864
+
+struct dxhead {
+  ushort zero;       // Inum 0: not a directory entry
+  uchar levels;      // Index blocks below the root (0 or 1)
+  uchar pad;
+  uint magic;        // DXMAGIC
+  uint count;        // Number of index entries
+  uint unused;
+};
+
+// Two index entries.
+struct dxslot {
+  ushort zero;       // Inum 0: not a directory entry
+  ushort block[2];   // Block numbers within the directory
+  ushort pad;
+  uint hash[2];      // Lowest hash in each block
+};
+
+// A full leaf whose names all hash alike cannot split, so it
+// chains to an overflow leaf through a link in its last slot;
+// later leaves of the chain may link on in turn.
+struct dxlink {
+  ushort zero;       // Inum 0: not a directory entry
+  ushort block;      // Next leaf of the chain
+  uint magic;        // DXMAGIC
+  uint unused[2];
+};
+
+// Index entries in the root and in an index block.
+#define DXROOT ((BSIZE - 3*sizeof(struct dirent)) / sizeof(struct dxslot) * 2)
+#define DXNODE ((BSIZE - sizeof(struct dxhead)) / sizeof(struct dxslot) * 2)
+
+// Hash of a directory entry name (FNV-1a).
+static inline uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
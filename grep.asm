@@ -0,0 +1,1787 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 e4 f0             	and    $0xfffffff0,%esp
+   9:	83 ec 20             	sub    $0x20,%esp
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+   c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+  10:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(argc <= 1){
+  13:	0f 8e 7e 00 00 00    	jle    97 <main+0x97>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit(0);
+  }
+  pattern = argv[1];
+
+  if(argc <= 2){
+  19:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  pattern = argv[1];
+  1d:	8b 7a 04             	mov    0x4(%edx),%edi
+  if(argc <= 2){
+  20:	0f 84 8f 00 00 00    	je     b5 <main+0xb5>
+  26:	8d 72 08             	lea    0x8(%edx),%esi
+    grep(pattern, 0);
+    exit(0);
+  }
+
+  for(i = 2; i < argc; i++){
+  29:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2e:	eb 25                	jmp    55 <main+0x55>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit(0);
+    }
+    grep(pattern, fd);
+  30:	89 44 24 04          	mov    %eax,0x4(%esp)
+  for(i = 2; i < argc; i++){
+  34:	43                   	inc    %ebx
+  35:	83 c6 04             	add    $0x4,%esi
+    grep(pattern, fd);
+  38:	89 3c 24             	mov    %edi,(%esp)
+  3b:	89 44 24 1c          	mov    %eax,0x1c(%esp)
+  3f:	e8 ac 01 00 00       	call   1f0 <grep>
+    close(fd);
+  44:	8b 44 24 1c          	mov    0x1c(%esp),%eax
+  48:	89 04 24             	mov    %eax,(%esp)
+  4b:	e8 bb 05 00 00       	call   60b <close>
+  for(i = 2; i < argc; i++){
+  50:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  53:	7e 38                	jle    8d <main+0x8d>
+    if((fd = open(argv[i], 0)) < 0){
+  55:	31 c9                	xor    %ecx,%ecx
+  57:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  5b:	8b 06                	mov    (%esi),%eax
+  5d:	89 04 24             	mov    %eax,(%esp)
+  60:	e8 be 05 00 00       	call   623 <open>
+  65:	85 c0                	test   %eax,%eax
+  67:	79 c7                	jns    30 <main+0x30>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  69:	8b 06                	mov    (%esi),%eax
+  6b:	c7 44 24 04 a4 0c 00 	movl   $0xca4,0x4(%esp)
+  72:	00 
+  73:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  7a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  7e:	e8 2d 07 00 00       	call   7b0 <printf>
+      exit(0);
+  83:	31 d2                	xor    %edx,%edx
+  85:	89 14 24             	mov    %edx,(%esp)
+  88:	e8 56 05 00 00       	call   5e3 <exit>
+  }
+  exit(0);
+  8d:	31 c0                	xor    %eax,%eax
+  8f:	89 04 24             	mov    %eax,(%esp)
+  92:	e8 4c 05 00 00       	call   5e3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  97:	c7 44 24 04 84 0c 00 	movl   $0xc84,0x4(%esp)
+  9e:	00 
+    exit(0);
+  9f:	31 ff                	xor    %edi,%edi
+    printf(2, "usage: grep pattern [file ...]\n");
+  a1:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  a8:	e8 03 07 00 00       	call   7b0 <printf>
+    exit(0);
+  ad:	89 3c 24             	mov    %edi,(%esp)
+  b0:	e8 2e 05 00 00       	call   5e3 <exit>
+    grep(pattern, 0);
+  b5:	89 3c 24             	mov    %edi,(%esp)
+  b8:	31 db                	xor    %ebx,%ebx
+    exit(0);
+  ba:	31 f6                	xor    %esi,%esi
+    grep(pattern, 0);
+  bc:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  c0:	e8 2b 01 00 00       	call   1f0 <grep>
+    exit(0);
+  c5:	89 34 24             	mov    %esi,(%esp)
+  c8:	e8 16 05 00 00       	call   5e3 <exit>
+  cd:	66 90                	xchg   %ax,%ax
+  cf:	90                   	nop
+
+000000d0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	56                   	push   %esi
+  d5:	53                   	push   %ebx
+  d6:	83 ec 1c             	sub    $0x1c,%esp
+  d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  df:	0f b6 16             	movzbl (%esi),%edx
+  e2:	84 d2                	test   %dl,%dl
+  e4:	0f 84 96 00 00 00    	je     180 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  ea:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+  ee:	3c 2a                	cmp    $0x2a,%al
+  f0:	74 2f                	je     121 <matchhere+0x51>
+  f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+ 100:	80 fa 24             	cmp    $0x24,%dl
+    return *text == '\0';
+ 103:	0f b6 0b             	movzbl (%ebx),%ecx
+  if(re[0] == '$' && re[1] == '\0')
+ 106:	74 50                	je     158 <matchhere+0x88>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 108:	84 c9                	test   %cl,%cl
+ 10a:	74 68                	je     174 <matchhere+0xa4>
+ 10c:	80 fa 2e             	cmp    $0x2e,%dl
+ 10f:	75 5f                	jne    170 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+ 111:	43                   	inc    %ebx
+ 112:	46                   	inc    %esi
+  if(re[0] == '\0')
+ 113:	84 c0                	test   %al,%al
+ 115:	74 69                	je     180 <matchhere+0xb0>
+ 117:	88 c2                	mov    %al,%dl
+  if(re[1] == '*')
+ 119:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+ 11d:	3c 2a                	cmp    $0x2a,%al
+ 11f:	75 df                	jne    100 <matchhere+0x30>
+    return matchstar(re[0], re+2, text);
+ 121:	83 c6 02             	add    $0x2,%esi
+ 124:	0f be fa             	movsbl %dl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 130:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 134:	89 34 24             	mov    %esi,(%esp)
+ 137:	e8 94 ff ff ff       	call   d0 <matchhere>
+ 13c:	85 c0                	test   %eax,%eax
+ 13e:	75 40                	jne    180 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 140:	0f be 0b             	movsbl (%ebx),%ecx
+ 143:	84 c9                	test   %cl,%cl
+ 145:	74 3e                	je     185 <matchhere+0xb5>
+ 147:	43                   	inc    %ebx
+ 148:	39 f9                	cmp    %edi,%ecx
+ 14a:	74 e4                	je     130 <matchhere+0x60>
+ 14c:	83 ff 2e             	cmp    $0x2e,%edi
+ 14f:	74 df                	je     130 <matchhere+0x60>
+ 151:	eb 32                	jmp    185 <matchhere+0xb5>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+  if(re[0] == '$' && re[1] == '\0')
+ 158:	84 c0                	test   %al,%al
+ 15a:	74 31                	je     18d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 15c:	84 c9                	test   %cl,%cl
+ 15e:	66 90                	xchg   %ax,%ax
+ 160:	74 12                	je     174 <matchhere+0xa4>
+ 162:	80 f9 24             	cmp    $0x24,%cl
+ 165:	75 0d                	jne    174 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 167:	43                   	inc    %ebx
+ 168:	46                   	inc    %esi
+  if(re[0] == '\0')
+ 169:	88 c2                	mov    %al,%dl
+ 16b:	eb ac                	jmp    119 <matchhere+0x49>
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 170:	38 d1                	cmp    %dl,%cl
+ 172:	74 9d                	je     111 <matchhere+0x41>
+}
+ 174:	83 c4 1c             	add    $0x1c,%esp
+  return 0;
+ 177:	31 c0                	xor    %eax,%eax
+}
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5f                   	pop    %edi
+ 17c:	5d                   	pop    %ebp
+ 17d:	c3                   	ret
+ 17e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 180:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 185:	83 c4 1c             	add    $0x1c,%esp
+ 188:	5b                   	pop    %ebx
+ 189:	5e                   	pop    %esi
+ 18a:	5f                   	pop    %edi
+ 18b:	5d                   	pop    %ebp
+ 18c:	c3                   	ret
+    return *text == '\0';
+ 18d:	31 c0                	xor    %eax,%eax
+ 18f:	84 c9                	test   %cl,%cl
+ 191:	0f 94 c0             	sete   %al
+ 194:	eb ef                	jmp    185 <matchhere+0xb5>
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <match>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	56                   	push   %esi
+ 1a4:	53                   	push   %ebx
+ 1a5:	83 ec 10             	sub    $0x10,%esp
+ 1a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 1ae:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 1b1:	75 0c                	jne    1bf <match+0x1f>
+ 1b3:	eb 2b                	jmp    1e0 <match+0x40>
+ 1b5:	8d 76 00             	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1b8:	46                   	inc    %esi
+ 1b9:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1bd:	74 15                	je     1d4 <match+0x34>
+    if(matchhere(re, text))
+ 1bf:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 1c3:	89 1c 24             	mov    %ebx,(%esp)
+ 1c6:	e8 05 ff ff ff       	call   d0 <matchhere>
+ 1cb:	85 c0                	test   %eax,%eax
+ 1cd:	74 e9                	je     1b8 <match+0x18>
+      return 1;
+ 1cf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1d4:	83 c4 10             	add    $0x10,%esp
+ 1d7:	5b                   	pop    %ebx
+ 1d8:	5e                   	pop    %esi
+ 1d9:	5d                   	pop    %ebp
+ 1da:	c3                   	ret
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+    return matchhere(re+1, text);
+ 1e0:	43                   	inc    %ebx
+ 1e1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1e4:	83 c4 10             	add    $0x10,%esp
+ 1e7:	5b                   	pop    %ebx
+ 1e8:	5e                   	pop    %esi
+ 1e9:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1ea:	e9 e1 fe ff ff       	jmp    d0 <matchhere>
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 2c             	sub    $0x2c,%esp
+ 1fb:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ 1fe:	8b 75 08             	mov    0x8(%ebp),%esi
+    return matchhere(re+1, text);
+ 201:	8d 46 01             	lea    0x1(%esi),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	29 d0                	sub    %edx,%eax
+ 21a:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 21e:	8d 82 c0 10 00 00    	lea    0x10c0(%edx),%eax
+ 224:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 228:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22b:	89 04 24             	mov    %eax,(%esp)
+ 22e:	e8 c8 03 00 00       	call   5fb <read>
+ 233:	85 c0                	test   %eax,%eax
+ 235:	0f 8e fa 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 23b:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23e:	bb c0 10 00 00       	mov    $0x10c0,%ebx
+ 243:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    buf[m] = '\0';
+ 246:	c6 82 c0 10 00 00 00 	movb   $0x0,0x10c0(%edx)
+    while((q = strchr(p, '\n')) != 0){
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+ 250:	89 1c 24             	mov    %ebx,(%esp)
+ 253:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 258:	89 54 24 04          	mov    %edx,0x4(%esp)
+ 25c:	e8 0f 02 00 00       	call   470 <strchr>
+ 261:	85 c0                	test   %eax,%eax
+ 263:	89 c1                	mov    %eax,%ecx
+ 265:	0f 84 85 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 26b:	c6 01 00             	movb   $0x0,(%ecx)
+  if(re[0] == '^')
+ 26e:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 271:	74 55                	je     2c8 <grep+0xd8>
+ 273:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 276:	89 cf                	mov    %ecx,%edi
+ 278:	eb 0d                	jmp    287 <grep+0x97>
+ 27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 280:	43                   	inc    %ebx
+ 281:	80 7b ff 00          	cmpb   $0x0,-0x1(%ebx)
+ 285:	74 39                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 287:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 28b:	89 34 24             	mov    %esi,(%esp)
+ 28e:	e8 3d fe ff ff       	call   d0 <matchhere>
+ 293:	85 c0                	test   %eax,%eax
+ 295:	74 e9                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 297:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 29a:	89 f9                	mov    %edi,%ecx
+ 29c:	8d 7f 01             	lea    0x1(%edi),%edi
+        *q = '\n';
+ 29f:	c6 01 0a             	movb   $0xa,(%ecx)
+        write(1, p, q+1 - p);
+ 2a2:	89 f8                	mov    %edi,%eax
+ 2a4:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 2a8:	29 d8                	sub    %ebx,%eax
+ 2aa:	89 fb                	mov    %edi,%ebx
+ 2ac:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 2b0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 2b7:	e8 47 03 00 00       	call   603 <write>
+ 2bc:	eb 92                	jmp    250 <grep+0x60>
+ 2be:	66 90                	xchg   %ax,%ax
+ 2c0:	8d 5f 01             	lea    0x1(%edi),%ebx
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+ 2c8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    return matchhere(re+1, text);
+ 2cb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 2cf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 2d2:	89 04 24             	mov    %eax,(%esp)
+ 2d5:	e8 f6 fd ff ff       	call   d0 <matchhere>
+        write(1, p, q+1 - p);
+ 2da:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 2dd:	8d 79 01             	lea    0x1(%ecx),%edi
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 bb                	jne    29f <grep+0xaf>
+        write(1, p, q+1 - p);
+ 2e4:	89 fb                	mov    %edi,%ebx
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	81 fb c0 10 00 00    	cmp    $0x10c0,%ebx
+ 2f6:	74 31                	je     329 <grep+0x139>
+    if(m > 0){
+ 2f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fb:	85 c0                	test   %eax,%eax
+ 2fd:	0f 8e 0d ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 303:	89 d8                	mov    %ebx,%eax
+ 305:	2d c0 10 00 00       	sub    $0x10c0,%eax
+ 30a:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 30d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+      memmove(buf, p, m);
+ 310:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 314:	c7 04 24 c0 10 00 00 	movl   $0x10c0,(%esp)
+ 31b:	89 7c 24 08          	mov    %edi,0x8(%esp)
+ 31f:	e8 8c 02 00 00       	call   5b0 <memmove>
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	83 c4 2c             	add    $0x2c,%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 1c             	sub    $0x1c,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(matchhere(re, text))
+ 360:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 364:	89 34 24             	mov    %esi,(%esp)
+ 367:	e8 64 fd ff ff       	call   d0 <matchhere>
+ 36c:	85 c0                	test   %eax,%eax
+ 36e:	75 20                	jne    390 <matchstar+0x50>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 370:	0f be 17             	movsbl (%edi),%edx
+ 373:	84 d2                	test   %dl,%dl
+ 375:	74 0a                	je     381 <matchstar+0x41>
+ 377:	47                   	inc    %edi
+ 378:	39 da                	cmp    %ebx,%edx
+ 37a:	74 e4                	je     360 <matchstar+0x20>
+ 37c:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37f:	74 df                	je     360 <matchstar+0x20>
+}
+ 381:	83 c4 1c             	add    $0x1c,%esp
+ 384:	5b                   	pop    %ebx
+ 385:	5e                   	pop    %esi
+ 386:	5f                   	pop    %edi
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 390:	83 c4 1c             	add    $0x1c,%esp
+      return 1;
+ 393:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 398:	5b                   	pop    %ebx
+ 399:	5e                   	pop    %esi
+ 39a:	5f                   	pop    %edi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	40                   	inc    %eax
+ 3b8:	84 d2                	test   %dl,%dl
+ 3ba:	75 f4                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	89 c8                	mov    %ecx,%eax
+ 3bf:	5d                   	pop    %ebp
+ 3c0:	c3                   	ret
+ 3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 15                	jne    3f6 <strcmp+0x26>
+ 3e1:	eb 30                	jmp    413 <strcmp+0x43>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 3ef:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 3f0:	84 c0                	test   %al,%al
+ 3f2:	74 14                	je     408 <strcmp+0x38>
+    p++, q++;
+ 3f4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 3f6:	0f b6 0b             	movzbl (%ebx),%ecx
+ 3f9:	38 c1                	cmp    %al,%cl
+ 3fb:	74 eb                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 3fd:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 3fe:	29 c8                	sub    %ecx,%eax
+}
+ 400:	5d                   	pop    %ebp
+ 401:	c3                   	ret
+ 402:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 408:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 40c:	31 c0                	xor    %eax,%eax
+}
+ 40e:	5b                   	pop    %ebx
+ 40f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 410:	29 c8                	sub    %ecx,%eax
+}
+ 412:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 413:	0f b6 0b             	movzbl (%ebx),%ecx
+ 416:	31 c0                	xor    %eax,%eax
+ 418:	eb e3                	jmp    3fd <strcmp+0x2d>
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 426:	80 3a 00             	cmpb   $0x0,(%edx)
+ 429:	74 15                	je     440 <strlen+0x20>
+ 42b:	31 c0                	xor    %eax,%eax
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+ 430:	40                   	inc    %eax
+ 431:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 435:	89 c1                	mov    %eax,%ecx
+ 437:	75 f7                	jne    430 <strlen+0x10>
+    ;
+  return n;
+}
+ 439:	5d                   	pop    %ebp
+ 43a:	89 c8                	mov    %ecx,%eax
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 441:	31 c9                	xor    %ecx,%ecx
+}
+ 443:	89 c8                	mov    %ecx,%eax
+ 445:	c3                   	ret
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 457:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 45a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 45d:	89 d7                	mov    %edx,%edi
+ 45f:	fc                   	cld
+ 460:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 462:	5f                   	pop    %edi
+ 463:	89 d0                	mov    %edx,%eax
+ 465:	5d                   	pop    %ebp
+ 466:	c3                   	ret
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 47a:	0f b6 10             	movzbl (%eax),%edx
+ 47d:	84 d2                	test   %dl,%dl
+ 47f:	75 10                	jne    491 <strchr+0x21>
+ 481:	eb 1d                	jmp    4a0 <strchr+0x30>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 48c:	40                   	inc    %eax
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	74 0f                	je     4a0 <strchr+0x30>
+    if(*s == c)
+ 491:	38 d1                	cmp    %dl,%cl
+ 493:	75 f3                	jne    488 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 495:	5d                   	pop    %ebp
+ 496:	c3                   	ret
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+ 4a0:	5d                   	pop    %ebp
+  return 0;
+ 4a1:	31 c0                	xor    %eax,%eax
+}
+ 4a3:	c3                   	ret
+ 4a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+
+000004b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 4b5:	31 f6                	xor    %esi,%esi
+{
+ 4b7:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 4b8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 4bb:	83 ec 3c             	sub    $0x3c,%esp
+ 4be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 4c1:	eb 32                	jmp    4f5 <gets+0x45>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+    cc = read(0, &c, 1);
+ 4c8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 4cc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4d5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 4dc:	e8 1a 01 00 00       	call   5fb <read>
+    if(cc < 1)
+ 4e1:	85 c0                	test   %eax,%eax
+ 4e3:	7e 19                	jle    4fe <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 4e5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 4ed:	3c 0a                	cmp    $0xa,%al
+ 4ef:	74 10                	je     501 <gets+0x51>
+ 4f1:	3c 0d                	cmp    $0xd,%al
+ 4f3:	74 0c                	je     501 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 4f5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 4f8:	46                   	inc    %esi
+ 4f9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 4fc:	7c ca                	jl     4c8 <gets+0x18>
+ 4fe:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 501:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 505:	83 c4 3c             	add    $0x3c,%esp
+ 508:	89 d8                	mov    %ebx,%eax
+ 50a:	5b                   	pop    %ebx
+ 50b:	5e                   	pop    %esi
+ 50c:	5f                   	pop    %edi
+ 50d:	5d                   	pop    %ebp
+ 50e:	c3                   	ret
+ 50f:	90                   	nop
+
+00000510 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 510:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 511:	31 c0                	xor    %eax,%eax
+{
+ 513:	89 e5                	mov    %esp,%ebp
+ 515:	83 ec 18             	sub    $0x18,%esp
+ 518:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 51b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 51e:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 522:	8b 45 08             	mov    0x8(%ebp),%eax
+ 525:	89 04 24             	mov    %eax,(%esp)
+ 528:	e8 f6 00 00 00       	call   623 <open>
+  if(fd < 0)
+ 52d:	85 c0                	test   %eax,%eax
+ 52f:	78 2f                	js     560 <stat+0x50>
+ 531:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 533:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 536:	89 1c 24             	mov    %ebx,(%esp)
+ 539:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 53d:	e8 f9 00 00 00       	call   63b <fstat>
+  close(fd);
+ 542:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 545:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 547:	e8 bf 00 00 00       	call   60b <close>
+  return r;
+}
+ 54c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 54f:	89 f0                	mov    %esi,%eax
+ 551:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 554:	89 ec                	mov    %ebp,%esp
+ 556:	5d                   	pop    %ebp
+ 557:	c3                   	ret
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb e5                	jmp    54c <stat+0x3c>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	88 c1                	mov    %al,%cl
+ 57c:	80 e9 30             	sub    $0x30,%cl
+ 57f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 582:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 587:	77 1c                	ja     5a5 <atoi+0x35>
+ 589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 590:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 593:	42                   	inc    %edx
+ 594:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 598:	0f be 02             	movsbl (%edx),%eax
+ 59b:	88 c3                	mov    %al,%bl
+ 59d:	80 eb 30             	sub    $0x30,%bl
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	5b                   	pop    %ebx
+ 5a6:	89 c8                	mov    %ecx,%eax
+ 5a8:	5d                   	pop    %ebp
+ 5a9:	c3                   	ret
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+
+000005db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <exit>:
+SYSCALL(exit)
+ 5e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <wait>:
+SYSCALL(wait)
+ 5eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+ 5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <read>:
+SYSCALL(read)
+ 5fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <write>:
+SYSCALL(write)
+ 603:	b8 10 00 00 00       	mov    $0x10,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <close>:
+SYSCALL(close)
+ 60b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+ 613:	b8 06 00 00 00       	mov    $0x6,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <exec>:
+SYSCALL(exec)
+ 61b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <open>:
+SYSCALL(open)
+ 623:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mknod>:
+SYSCALL(mknod)
+ 62b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <unlink>:
+SYSCALL(unlink)
+ 633:	b8 12 00 00 00       	mov    $0x12,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <fstat>:
+SYSCALL(fstat)
+ 63b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <link>:
+SYSCALL(link)
+ 643:	b8 13 00 00 00       	mov    $0x13,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+ 64b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <chdir>:
+SYSCALL(chdir)
+ 653:	b8 09 00 00 00       	mov    $0x9,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <dup>:
+SYSCALL(dup)
+ 65b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getpid>:
+SYSCALL(getpid)
+ 663:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <sbrk>:
+SYSCALL(sbrk)
+ 66b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+ 673:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <uptime>:
+SYSCALL(uptime)
+ 67b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <detach>:
+SYSCALL(detach)
+ 683:	b8 16 00 00 00       	mov    $0x16,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <policy>:
+SYSCALL(policy)
+ 68b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <priority>:
+SYSCALL(priority)
+ 693:	b8 18 00 00 00       	mov    $0x18,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <wait_stat>:
+SYSCALL(wait_stat)
+ 69b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <lockstat>:
+SYSCALL(lockstat)
+ 6a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <mmap>:
+SYSCALL(mmap)
+ 6ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <munmap>:
+SYSCALL(munmap)
+ 6b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <shmget>:
+SYSCALL(shmget)
+ 6bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <shmat>:
+SYSCALL(shmat)
+ 6c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <shmdt>:
+SYSCALL(shmdt)
+ 6cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <memstat>:
+SYSCALL(memstat)
+ 6d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <getprocs>:
+SYSCALL(getprocs)
+ 6db:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <shmctl>:
+SYSCALL(shmctl)
+ 6e3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+ 6eb:	66 90                	xchg   %ax,%ax
+ 6ed:	66 90                	xchg   %ax,%ax
+ 6ef:	90                   	nop
+
+000006f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	89 cb                	mov    %ecx,%ebx
+ 6f8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6fb:	89 d1                	mov    %edx,%ecx
+{
+ 6fd:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 700:	89 d0                	mov    %edx,%eax
+ 702:	c1 e8 1f             	shr    $0x1f,%eax
+ 705:	84 c0                	test   %al,%al
+ 707:	0f 84 93 00 00 00    	je     7a0 <printint+0xb0>
+ 70d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 711:	0f 84 89 00 00 00    	je     7a0 <printint+0xb0>
+    x = -xx;
+ 717:	f7 d9                	neg    %ecx
+    neg = 1;
+ 719:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 71e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 725:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 728:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 730:	89 c8                	mov    %ecx,%eax
+ 732:	31 d2                	xor    %edx,%edx
+ 734:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 737:	f7 f3                	div    %ebx
+ 739:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 73c:	0f b6 92 1c 0d 00 00 	movzbl 0xd1c(%edx),%edx
+ 743:	8d 47 01             	lea    0x1(%edi),%eax
+ 746:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 749:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 74d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 74f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 752:	39 da                	cmp    %ebx,%edx
+ 754:	73 da                	jae    730 <printint+0x40>
+  if(neg)
+ 756:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 759:	85 c0                	test   %eax,%eax
+ 75b:	74 0a                	je     767 <printint+0x77>
+    buf[i++] = '-';
+ 75d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 760:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 765:	89 c7                	mov    %eax,%edi
+ 767:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 76e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 770:	0f b6 07             	movzbl (%edi),%eax
+ 773:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 776:	b8 01 00 00 00       	mov    $0x1,%eax
+ 77b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 77f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 783:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 786:	89 04 24             	mov    %eax,(%esp)
+ 789:	e8 75 fe ff ff       	call   603 <write>
+  while(--i >= 0)
+ 78e:	89 f8                	mov    %edi,%eax
+ 790:	4f                   	dec    %edi
+ 791:	39 d8                	cmp    %ebx,%eax
+ 793:	75 db                	jne    770 <printint+0x80>
+}
+ 795:	83 c4 4c             	add    $0x4c,%esp
+ 798:	5b                   	pop    %ebx
+ 799:	5e                   	pop    %esi
+ 79a:	5f                   	pop    %edi
+ 79b:	5d                   	pop    %ebp
+ 79c:	c3                   	ret
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 7a0:	31 c0                	xor    %eax,%eax
+ 7a2:	e9 77 ff ff ff       	jmp    71e <printint+0x2e>
+ 7a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	84 db                	test   %bl,%bl
+ 7c4:	74 6f                	je     835 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 7c6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 7c9:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 7cb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 7ce:	88 d9                	mov    %bl,%cl
+ 7d0:	46                   	inc    %esi
+ 7d1:	89 d3                	mov    %edx,%ebx
+ 7d3:	eb 2b                	jmp    800 <printf+0x50>
+ 7d5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 7d8:	83 f8 25             	cmp    $0x25,%eax
+ 7db:	74 4b                	je     828 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 7dd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7e0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7e5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 7e9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ec:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 7f0:	89 3c 24             	mov    %edi,(%esp)
+ 7f3:	e8 0b fe ff ff       	call   603 <write>
+  for(i = 0; fmt[i]; i++){
+ 7f8:	0f b6 0e             	movzbl (%esi),%ecx
+ 7fb:	46                   	inc    %esi
+ 7fc:	84 c9                	test   %cl,%cl
+ 7fe:	74 35                	je     835 <printf+0x85>
+    if(state == 0){
+ 800:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 802:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 805:	74 d1                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 807:	83 fb 25             	cmp    $0x25,%ebx
+ 80a:	75 ec                	jne    7f8 <printf+0x48>
+      if(c == 'd'){
+ 80c:	83 f8 25             	cmp    $0x25,%eax
+ 80f:	0f 84 53 01 00 00    	je     968 <printf+0x1b8>
+ 815:	83 e8 63             	sub    $0x63,%eax
+ 818:	83 f8 15             	cmp    $0x15,%eax
+ 81b:	77 23                	ja     840 <printf+0x90>
+ 81d:	ff 24 85 c4 0c 00 00 	jmp    *0xcc4(,%eax,4)
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 828:	0f b6 0e             	movzbl (%esi),%ecx
+ 82b:	46                   	inc    %esi
+        state = '%';
+ 82c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 831:	84 c9                	test   %cl,%cl
+ 833:	75 cb                	jne    800 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 835:	83 c4 3c             	add    $0x3c,%esp
+ 838:	5b                   	pop    %ebx
+ 839:	5e                   	pop    %esi
+ 83a:	5f                   	pop    %edi
+ 83b:	5d                   	pop    %ebp
+ 83c:	c3                   	ret
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+ 840:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 843:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 846:	b8 01 00 00 00       	mov    $0x1,%eax
+ 84b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 853:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 857:	89 3c 24             	mov    %edi,(%esp)
+ 85a:	e8 a4 fd ff ff       	call   603 <write>
+        putc(fd, c);
+ 85f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 863:	ba 01 00 00 00       	mov    $0x1,%edx
+ 868:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 86b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 86f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 871:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 875:	89 3c 24             	mov    %edi,(%esp)
+ 878:	e8 86 fd ff ff       	call   603 <write>
+ 87d:	e9 76 ff ff ff       	jmp    7f8 <printf+0x48>
+ 882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 888:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 88b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 890:	8b 13                	mov    (%ebx),%edx
+ 892:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 899:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 89c:	89 f8                	mov    %edi,%eax
+ 89e:	e8 4d fe ff ff       	call   6f0 <printint>
+        ap++;
+ 8a3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 8a6:	31 db                	xor    %ebx,%ebx
+ 8a8:	e9 4b ff ff ff       	jmp    7f8 <printf+0x48>
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8b0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 8b3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 8b5:	83 c0 04             	add    $0x4,%eax
+ 8b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 8bb:	85 c9                	test   %ecx,%ecx
+ 8bd:	0f 84 cd 00 00 00    	je     990 <printf+0x1e0>
+        while(*s != 0){
+ 8c3:	0f b6 01             	movzbl (%ecx),%eax
+ 8c6:	84 c0                	test   %al,%al
+ 8c8:	0f 84 ce 00 00 00    	je     99c <printf+0x1ec>
+ 8ce:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 8d1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 8d4:	89 ce                	mov    %ecx,%esi
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 8e0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 8e8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 8e9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 8ed:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 8f1:	89 3c 24             	mov    %edi,(%esp)
+ 8f4:	e8 0a fd ff ff       	call   603 <write>
+        while(*s != 0){
+ 8f9:	0f b6 06             	movzbl (%esi),%eax
+ 8fc:	84 c0                	test   %al,%al
+ 8fe:	75 e0                	jne    8e0 <printf+0x130>
+      state = 0;
+ 900:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 903:	31 db                	xor    %ebx,%ebx
+ 905:	e9 ee fe ff ff       	jmp    7f8 <printf+0x48>
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 910:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 913:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 918:	8b 13                	mov    (%ebx),%edx
+ 91a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 921:	e9 73 ff ff ff       	jmp    899 <printf+0xe9>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 930:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 933:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 938:	8b 10                	mov    (%eax),%edx
+ 93a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 93d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 941:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 944:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 948:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 94b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 94f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 951:	89 3c 24             	mov    %edi,(%esp)
+ 954:	e8 aa fc ff ff       	call   603 <write>
+        ap++;
+ 959:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 95d:	e9 96 fe ff ff       	jmp    7f8 <printf+0x48>
+ 962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 968:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 96b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 96e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 973:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 977:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 979:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 97d:	89 3c 24             	mov    %edi,(%esp)
+ 980:	e8 7e fc ff ff       	call   603 <write>
+ 985:	e9 6e fe ff ff       	jmp    7f8 <printf+0x48>
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 990:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 992:	b9 ba 0c 00 00       	mov    $0xcba,%ecx
+ 997:	e9 32 ff ff ff       	jmp    8ce <printf+0x11e>
+      state = 0;
+ 99c:	31 db                	xor    %ebx,%ebx
+ 99e:	66 90                	xchg   %ax,%ax
+ 9a0:	e9 53 fe ff ff       	jmp    7f8 <printf+0x48>
+ 9a5:	66 90                	xchg   %ax,%ax
+ 9a7:	66 90                	xchg   %ax,%ax
+ 9a9:	66 90                	xchg   %ax,%ax
+ 9ab:	66 90                	xchg   %ax,%ax
+ 9ad:	66 90                	xchg   %ax,%ax
+ 9af:	90                   	nop
+
+000009b0 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	83 ec 18             	sub    $0x18,%esp
+ 9b6:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 9b9:	89 c3                	mov    %eax,%ebx
+ 9bb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 9be:	a1 c4 14 00 00       	mov    0x14c4,%eax
+ 9c3:	8b 15 c0 14 00 00    	mov    0x14c0,%edx
+ 9c9:	29 c2                	sub    %eax,%edx
+ 9cb:	39 da                	cmp    %ebx,%edx
+ 9cd:	72 19                	jb     9e8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 9cf:	01 c3                	add    %eax,%ebx
+ 9d1:	89 1d c4 14 00 00    	mov    %ebx,0x14c4
+  return p;
+}
+ 9d7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 9da:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 9dd:	89 ec                	mov    %ebp,%esp
+ 9df:	5d                   	pop    %ebp
+ 9e0:	c3                   	ret
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 9e8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 9ed:	39 c3                	cmp    %eax,%ebx
+ 9ef:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 9f2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 9f5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 9f7:	e8 6f fc ff ff       	call   66b <sbrk>
+    if(p == (char*)-1)
+ 9fc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 9ff:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ a01:	74 1d                	je     a20 <morecore+0x70>
+    if(p != arenaend)
+ a03:	39 05 c0 14 00 00    	cmp    %eax,0x14c0
+ a09:	74 0d                	je     a18 <morecore+0x68>
+    arenaend = p + grow;
+ a0b:	01 f2                	add    %esi,%edx
+ a0d:	89 15 c0 14 00 00    	mov    %edx,0x14c0
+ a13:	eb ba                	jmp    9cf <morecore+0x1f>
+ a15:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ a18:	a1 c4 14 00 00       	mov    0x14c4,%eax
+ a1d:	eb ec                	jmp    a0b <morecore+0x5b>
+ a1f:	90                   	nop
+      return 0;
+ a20:	31 c0                	xor    %eax,%eax
+ a22:	eb b3                	jmp    9d7 <morecore+0x27>
+ a24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+
+00000a30 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ a3f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ a42:	85 c0                	test   %eax,%eax
+ a44:	74 1e                	je     a64 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ a46:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ a49:	83 fa 08             	cmp    $0x8,%edx
+ a4c:	77 16                	ja     a64 <free+0x34>
+  h = (Header*)ap - 1;
+ a4e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ a51:	74 25                	je     a78 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ a53:	8b 3c 95 e0 14 00 00 	mov    0x14e0(,%edx,4),%edi
+ a5a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ a5d:	89 0c 95 e0 14 00 00 	mov    %ecx,0x14e0(,%edx,4)
+}
+ a64:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ a67:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ a6a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ a6d:	89 ec                	mov    %ebp,%esp
+ a6f:	5d                   	pop    %ebp
+ a70:	c3                   	ret
+ a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ a78:	8b 15 00 15 00 00    	mov    0x1500,%edx
+ a7e:	85 d2                	test   %edx,%edx
+ a80:	74 54                	je     ad6 <free+0xa6>
+ a82:	39 ca                	cmp    %ecx,%edx
+ a84:	73 36                	jae    abc <free+0x8c>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+ a90:	89 d3                	mov    %edx,%ebx
+ a92:	8b 12                	mov    (%edx),%edx
+ a94:	85 d2                	test   %edx,%edx
+ a96:	74 12                	je     aaa <free+0x7a>
+ a98:	39 ca                	cmp    %ecx,%edx
+ a9a:	72 f4                	jb     a90 <free+0x60>
+  if(p && END(h) == p){
+ a9c:	85 d2                	test   %edx,%edx
+ a9e:	74 0a                	je     aaa <free+0x7a>
+ aa0:	8b 70 fc             	mov    -0x4(%eax),%esi
+ aa3:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ aa6:	39 fa                	cmp    %edi,%edx
+ aa8:	74 4b                	je     af5 <free+0xc5>
+  h->s.u.next = p;
+ aaa:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ aad:	8b 53 04             	mov    0x4(%ebx),%edx
+ ab0:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ ab4:	39 f1                	cmp    %esi,%ecx
+ ab6:	74 29                	je     ae1 <free+0xb1>
+    prev->s.u.next = h;
+ ab8:	89 0b                	mov    %ecx,(%ebx)
+ aba:	eb a8                	jmp    a64 <free+0x34>
+  if(p && END(h) == p){
+ abc:	85 d2                	test   %edx,%edx
+ abe:	74 16                	je     ad6 <free+0xa6>
+ ac0:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ ac3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ ac6:	39 f2                	cmp    %esi,%edx
+ ac8:	75 0c                	jne    ad6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ aca:	8b 72 04             	mov    0x4(%edx),%esi
+ acd:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ ad1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ ad4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ ad6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ ad9:	89 0d 00 15 00 00    	mov    %ecx,0x1500
+ adf:	eb 83                	jmp    a64 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ ae1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ ae4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ ae8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ aeb:	8b 40 f8             	mov    -0x8(%eax),%eax
+ aee:	89 03                	mov    %eax,(%ebx)
+ af0:	e9 6f ff ff ff       	jmp    a64 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ af5:	8b 7a 04             	mov    0x4(%edx),%edi
+ af8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ afc:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ aff:	8b 12                	mov    (%edx),%edx
+ b01:	eb a7                	jmp    aaa <free+0x7a>
+ b03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b10 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	83 ec 2c             	sub    $0x2c,%esp
+ b19:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ b1c:	83 f8 10             	cmp    $0x10,%eax
+ b1f:	0f 86 52 01 00 00    	jbe    c77 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ b25:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ b27:	ba 01 00 00 00       	mov    $0x1,%edx
+ b2c:	eb 0d                	jmp    b3b <malloc+0x2b>
+ b2e:	66 90                	xchg   %ax,%ax
+ b30:	83 c1 05             	add    $0x5,%ecx
+ b33:	89 d6                	mov    %edx,%esi
+ b35:	d3 e6                	shl    %cl,%esi
+ b37:	39 c6                	cmp    %eax,%esi
+ b39:	73 55                	jae    b90 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ b3b:	89 d9                	mov    %ebx,%ecx
+ b3d:	43                   	inc    %ebx
+ b3e:	83 fb 08             	cmp    $0x8,%ebx
+ b41:	75 ed                	jne    b30 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ b43:	8d 58 07             	lea    0x7(%eax),%ebx
+ b46:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ b49:	39 c3                	cmp    %eax,%ebx
+ b4b:	0f 82 1f 01 00 00    	jb     c70 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ b51:	a1 00 15 00 00       	mov    0x1500,%eax
+ b56:	85 c0                	test   %eax,%eax
+ b58:	0f 84 ee 00 00 00    	je     c4c <malloc+0x13c>
+ b5e:	b9 00 15 00 00       	mov    $0x1500,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ b63:	8b 50 04             	mov    0x4(%eax),%edx
+ b66:	39 da                	cmp    %ebx,%edx
+ b68:	0f 82 d2 00 00 00    	jb     c40 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ b6e:	29 da                	sub    %ebx,%edx
+ b70:	83 fa 17             	cmp    $0x17,%edx
+ b73:	0f 87 b7 00 00 00    	ja     c30 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ b79:	8b 10                	mov    (%eax),%edx
+ b7b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ b7d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ b83:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ b86:	83 c0 08             	add    $0x8,%eax
+}
+ b89:	5b                   	pop    %ebx
+ b8a:	5e                   	pop    %esi
+ b8b:	5f                   	pop    %edi
+ b8c:	5d                   	pop    %ebp
+ b8d:	c3                   	ret
+ b8e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ b90:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ b92:	8b 04 9d e0 14 00 00 	mov    0x14e0(,%ebx,4),%eax
+ b99:	85 c0                	test   %eax,%eax
+ b9b:	74 23                	je     bc0 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ b9d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ b9f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ ba2:	89 14 9d e0 14 00 00 	mov    %edx,0x14e0(,%ebx,4)
+    h->s.u.cls = cls;
+ ba9:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ bac:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ baf:	83 c4 2c             	add    $0x2c,%esp
+ bb2:	5b                   	pop    %ebx
+ bb3:	5e                   	pop    %esi
+ bb4:	5f                   	pop    %edi
+ bb5:	5d                   	pop    %ebp
+ bb6:	c3                   	ret
+ bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbe:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ bc0:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ bc3:	31 d2                	xor    %edx,%edx
+ bc5:	b8 00 10 00 00       	mov    $0x1000,%eax
+ bca:	f7 f6                	div    %esi
+ bcc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ bcf:	0f af c6             	imul   %esi,%eax
+ bd2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ bd5:	e8 d6 fd ff ff       	call   9b0 <morecore>
+ bda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ bdd:	85 c0                	test   %eax,%eax
+ bdf:	0f 84 8b 00 00 00    	je     c70 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ be5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ be8:	8b 0c 9d e0 14 00 00 	mov    0x14e0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ bef:	31 d2                	xor    %edx,%edx
+ bf1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ bf4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ bf7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ bfa:	eb 06                	jmp    c02 <malloc+0xf2>
+ bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ c00:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ c02:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ c04:	42                   	inc    %edx
+ c05:	89 c1                	mov    %eax,%ecx
+ c07:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ c0a:	39 d7                	cmp    %edx,%edi
+ c0c:	75 f2                	jne    c00 <malloc+0xf0>
+ c0e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ c11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ c14:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ c17:	89 04 9d e0 14 00 00 	mov    %eax,0x14e0(,%ebx,4)
+ c1e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ c21:	29 f0                	sub    %esi,%eax
+ c23:	01 c2                	add    %eax,%edx
+ c25:	89 d0                	mov    %edx,%eax
+ c27:	e9 71 ff ff ff       	jmp    b9d <malloc+0x8d>
+ c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ c30:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ c33:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ c36:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ c38:	89 58 04             	mov    %ebx,0x4(%eax)
+ c3b:	e9 3d ff ff ff       	jmp    b7d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ c40:	89 c1                	mov    %eax,%ecx
+ c42:	8b 00                	mov    (%eax),%eax
+ c44:	85 c0                	test   %eax,%eax
+ c46:	0f 85 17 ff ff ff    	jne    b63 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ c4c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ c4f:	74 1f                	je     c70 <malloc+0x160>
+ c51:	8d 43 08             	lea    0x8(%ebx),%eax
+ c54:	e8 57 fd ff ff       	call   9b0 <morecore>
+ c59:	85 c0                	test   %eax,%eax
+ c5b:	74 13                	je     c70 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ c5d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ c63:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ c66:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ c69:	e9 41 ff ff ff       	jmp    baf <malloc+0x9f>
+ c6e:	66 90                	xchg   %ax,%ax
+      return 0;
+ c70:	31 c0                	xor    %eax,%eax
+ c72:	e9 38 ff ff ff       	jmp    baf <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ c77:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ c7c:	31 db                	xor    %ebx,%ebx
+ c7e:	e9 0f ff ff ff       	jmp    b92 <malloc+0x82>
@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code. Uses the PCI bus-master DMA engine of
+// the IDE controller when there is one, and PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -23,16 +24,63 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Bus-master IDE registers, at offsets from BAR4 of the
+// controller's PCI function (primary channel).
+#define BM_CMD        0x0
+#define BM_STATUS     0x2
+#define BM_PRDT       0x4
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // Device to memory
+#define BM_STATUS_ERR 0x02
+#define BM_STATUS_INT 0x04
+
+#define PCI_COMMAND   0x04
+#define PCI_CMD_IO    0x01
+#define PCI_CMD_MASTER 0x04
+#define PCI_BAR4      0x20
+
+// Physical region descriptor: one contiguous piece of memory
+// for a DMA transfer. Must not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort count;   // Bytes; 0 means 64KB
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // Last entry of the table
+
+// Requests wait on idequeue, sorted by (dev, blockno), and are
+// started in elevator (C-LOOK) order: the next request is the
+// first at or after the last block started, wrapping around to
+// the lowest. A request that has waited IDEDEADLINE ticks goes
+// first, so a stream of requests ahead of the head can't starve
+// one behind it. Queued requests for consecutive blocks in the
+// same direction are merged into one command of up to
+// IDEMAXMERGE blocks; ideactive chains the bufs of the command
+// in progress through qnext.
+// You must hold idelock while manipulating either list.
+
+#define IDEDEADLINE 50
+#define IDEMAXMERGE 16
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *ideactive;
+static int idensect;    // Sectors in the active command
+static int idedone;     // Sectors of it transferred so far
+static uint idelastdev; // Elevator position: the block after
+static uint idelastblk; //   the last one started
 
 static int havedisk1;
-static void idestart(struct buf*);
+static void idestart(void);
+
+// I/O base of the bus-master registers, or 0 to use PIO.
+// The PRD table is aligned to its size so that it can't cross
+// a 64KB boundary.
+static ushort idebm;
+static struct prd prdt[IDEMAXMERGE] __attribute__((aligned(sizeof(struct prd)*IDEMAXMERGE)));
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +95,8 @@ idewait(int checkerr)
   return 0;
 }
 
+static void idedmainit(void);
+
 void
 ideinit(void)
 {
@@ -67,75 +117,203 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Look for a PCI IDE controller with a bus-master DMA engine
+// and turn it on. Leaves idebm 0 if there is none.
 static void
-idestart(struct buf *b)
+idedmainit(void)
+{
+  int tag;
+  uint bar;
+
+  if((tag = pcifind(0x01, 0x01)) < 0)  // Mass storage, IDE
+    return;
+  bar = pciread(tag, PCI_BAR4);
+  if((bar & 1) == 0 || (bar & ~3) == 0)  // Not an I/O BAR
+    return;
+  pciwrite(tag, PCI_COMMAND,
+           pciread(tag, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  idebm = bar & 0xfffc;
+  outb(idebm + BM_CMD, 0);
+  outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INT);
+  cprintf("ide: bus-master DMA at 0x%x\n", idebm);
+}
+
+// Does request a sort before request b?
+static int
+before(struct buf *a, struct buf *b)
 {
-  if(b == 0)
+  return a->dev < b->dev || (a->dev == b->dev && a->blockno < b->blockno);
+}
+
+// Choose the next request to start and take it off idequeue.
+// Caller must hold idelock; idequeue must not be empty.
+static struct buf**
+idechoose(void)
+{
+  struct buf **pp, **oldest;
+
+  oldest = &idequeue;
+  for(pp = &idequeue; *pp; pp = &(*pp)->qnext)
+    if((*pp)->qtime < (*oldest)->qtime)
+      oldest = pp;
+  if(ticks - (*oldest)->qtime >= IDEDEADLINE)
+    return oldest;
+
+  for(pp = &idequeue; *pp; pp = &(*pp)->qnext)
+    if((*pp)->dev > idelastdev ||
+       ((*pp)->dev == idelastdev && (*pp)->blockno >= idelastblk))
+      return pp;
+  return &idequeue;
+}
+
+// Data for sector i of the active command.
+static uchar*
+idesector(int i)
+{
+  int sector_per_block = BSIZE/SECTOR_SIZE;
+  struct buf *b;
+
+  for(b = ideactive; i >= sector_per_block; i -= sector_per_block)
+    b = b->qnext;
+  return b->data + i*SECTOR_SIZE;
+}
+
+// Start the next queued request, merged with the ones for the
+// blocks that follow it. Caller must hold idelock.
+static void
+idestart(void)
+{
+  struct buf **pp, *b, *last;
+  int n;
+
+  if(idequeue == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  pp = idechoose();
+  b = last = *pp;
+  *pp = b->qnext;
+  for(n = 1; n < IDEMAXMERGE && *pp; n++){
+    if((*pp)->dev != b->dev || (*pp)->blockno != last->blockno + 1 ||
+       ((*pp)->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    last->qnext = *pp;
+    last = *pp;
+    *pp = last->qnext;
+  }
+  last->qnext = 0;
+  ideactive = b;
+  idelastdev = b->dev;
+  idelastblk = last->blockno + 1;
+
+  if(last->blockno >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  idensect = n * sector_per_block;
+  idedone = 0;
+  if (idensect > 256) panic("idestart");
+
+  if(idebm){
+    // One descriptor per buf; each data array lies within a page.
+    for(n = 0, last = b; last; last = last->qnext, n++){
+      prdt[n].addr = V2P(last->data);
+      prdt[n].count = BSIZE;
+      prdt[n].flags = last->qnext ? 0 : PRD_EOT;
+    }
+    outl(idebm + BM_PRDT, V2P(prdt));
+    outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INT);
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_CMD_READ);
+  }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, idensect & 0xff);  // number of sectors; 0 means 256
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+  if(idebm){
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_CMD_START);
+  } else if(b->flags & B_DIRTY){
+    outb(0x1f7, IDE_CMD_WRITE);
+    outsl(0x1f0, idesector(0), SECTOR_SIZE/4);
   } else {
-    outb(0x1f7, read_cmd);
+    outb(0x1f7, IDE_CMD_READ);
   }
 }
 
-// Interrupt handler.
+// Interrupt handler. With DMA the disk interrupts once the
+// whole command is done. With PIO it interrupts once per sector:
+// on a read when the next sector is ready, on a write when
+// the last one has been written.
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next;
+  int err;
+  uchar st;
 
-  // First queued buffer is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = ideactive) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idebm){
+    st = inb(idebm + BM_STATUS);
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INT);
+    err = idewait(1) < 0 || (st & BM_STATUS_ERR);
+  } else {
+    // PIO: move one sector.
+    err = idewait(1) < 0;
+    if(!(b->flags & B_DIRTY) && !err)
+      insl(0x1f0, idesector(idedone), SECTOR_SIZE/4);
+    idedone++;
+    if(idedone < idensect && !err){
+      if(b->flags & B_DIRTY)
+        outsl(0x1f0, idesector(idedone), SECTOR_SIZE/4);
+      release(&idelock);
+      return;
+    }
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // The command is done (or failed): complete all its bufs.
+  // Wake the process waiting for each, or release it if
+  // nobody waits.
+  ideactive = 0;
+  for(; b; b = next){
+    next = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      bdone(b);
+    } else
+      wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
+  // Start disk on next request.
   if(idequeue != 0)
-    idestart(idequeue);
+    idestart();
 
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
+// Queue a request to sync buf with disk, without waiting for it.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, b is released with bdone() when the request
+// finishes; otherwise wait for it with idewaitbuf().
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
   struct buf **pp;
 
@@ -148,21 +326,41 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  // Insert b into idequeue, in order.
+  b->qtime = ticks;
+  for(pp=&idequeue; *pp && !before(b, *pp); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(ideactive == 0)
+    idestart();
+
+  release(&idelock);
+}
 
-  // Wait for request to finish.
+// Wait for the request for b, queued with idesubmit(), to finish.
+void
+idewaitbuf(struct buf *b)
+{
+  acquire(&idelock);
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
+  release(&idelock);
+}
 
+// Sync buf with disk, as idesubmit() does, and wait for it
+// unless B_ASYNC is set.
+void
+iderw(struct buf *b)
+{
+  int async;
 
-  release(&idelock);
+  // Once submitted, an async b may be finished and reused.
+  async = b->flags & B_ASYNC;
+  idesubmit(b);
+  if(!async)
+    idewaitbuf(b);
 }
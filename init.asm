@@ -0,0 +1,1441 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   1:	b8 02 00 00 00       	mov    $0x2,%eax
+{
+   6:	89 e5                	mov    %esp,%ebp
+   8:	53                   	push   %ebx
+   9:	83 e4 f0             	and    $0xfffffff0,%esp
+   c:	83 ec 10             	sub    $0x10,%esp
+  if(open("console", O_RDWR) < 0){
+   f:	89 44 24 04          	mov    %eax,0x4(%esp)
+  13:	c7 04 24 14 0a 00 00 	movl   $0xa14,(%esp)
+  1a:	e8 94 03 00 00       	call   3b3 <open>
+  1f:	85 c0                	test   %eax,%eax
+  21:	0f 88 cb 00 00 00    	js     f2 <main+0xf2>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  27:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  2e:	e8 b8 03 00 00       	call   3eb <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 ac 03 00 00       	call   3eb <dup>
+  3f:	90                   	nop
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  40:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  47:	bb 1c 0a 00 00       	mov    $0xa1c,%ebx
+  4c:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  50:	e8 eb 04 00 00       	call   540 <printf>
+    pid = fork();
+  55:	e8 11 03 00 00       	call   36b <fork>
+    if(pid < 0){
+  5a:	85 c0                	test   %eax,%eax
+    pid = fork();
+  5c:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  5e:	78 42                	js     a2 <main+0xa2>
+      printf(1, "init: fork failed\n");
+      exit(0);
+    }
+    if(pid == 0){
+  60:	74 5e                	je     c0 <main+0xc0>
+  62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit(0);
+    }
+    while((wpid=wait(0)) >= 0 && wpid != pid)
+  70:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  77:	e8 ff 02 00 00       	call   37b <wait>
+  7c:	89 c2                	mov    %eax,%edx
+  7e:	f7 d2                	not    %edx
+  80:	c1 ea 1f             	shr    $0x1f,%edx
+  83:	84 d2                	test   %dl,%dl
+  85:	74 b9                	je     40 <main+0x40>
+  87:	39 c3                	cmp    %eax,%ebx
+  89:	74 b5                	je     40 <main+0x40>
+      printf(1, "zombie!\n");
+  8b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  92:	b8 5b 0a 00 00       	mov    $0xa5b,%eax
+  97:	89 44 24 04          	mov    %eax,0x4(%esp)
+  9b:	e8 a0 04 00 00       	call   540 <printf>
+  a0:	eb ce                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  a2:	c7 44 24 04 2f 0a 00 	movl   $0xa2f,0x4(%esp)
+  a9:	00 
+  aa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  b1:	e8 8a 04 00 00       	call   540 <printf>
+      exit(0);
+  b6:	31 c9                	xor    %ecx,%ecx
+  b8:	89 0c 24             	mov    %ecx,(%esp)
+  bb:	e8 b3 02 00 00       	call   373 <exit>
+      exec("sh", argv);
+  c0:	c7 44 24 04 78 0d 00 	movl   $0xd78,0x4(%esp)
+  c7:	00 
+  c8:	c7 04 24 42 0a 00 00 	movl   $0xa42,(%esp)
+  cf:	e8 d7 02 00 00       	call   3ab <exec>
+      printf(1, "init: exec sh failed\n");
+  d4:	c7 44 24 04 45 0a 00 	movl   $0xa45,0x4(%esp)
+  db:	00 
+  dc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  e3:	e8 58 04 00 00       	call   540 <printf>
+      exit(0);
+  e8:	31 d2                	xor    %edx,%edx
+  ea:	89 14 24             	mov    %edx,(%esp)
+  ed:	e8 81 02 00 00       	call   373 <exit>
+    mknod("console", 1, 1);
+  f2:	c7 44 24 08 01 00 00 	movl   $0x1,0x8(%esp)
+  f9:	00 
+  fa:	c7 44 24 04 01 00 00 	movl   $0x1,0x4(%esp)
+ 101:	00 
+ 102:	c7 04 24 14 0a 00 00 	movl   $0xa14,(%esp)
+ 109:	e8 ad 02 00 00       	call   3bb <mknod>
+    open("console", O_RDWR);
+ 10e:	c7 44 24 04 02 00 00 	movl   $0x2,0x4(%esp)
+ 115:	00 
+ 116:	c7 04 24 14 0a 00 00 	movl   $0xa14,(%esp)
+ 11d:	e8 91 02 00 00       	call   3b3 <open>
+ 122:	e9 00 ff ff ff       	jmp    27 <main+0x27>
+ 127:	66 90                	xchg   %ax,%ax
+ 129:	66 90                	xchg   %ax,%ax
+ 12b:	66 90                	xchg   %ax,%ax
+ 12d:	66 90                	xchg   %ax,%ax
+ 12f:	90                   	nop
+
+00000130 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 130:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 131:	31 c0                	xor    %eax,%eax
+{
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	53                   	push   %ebx
+ 136:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 140:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 144:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 147:	40                   	inc    %eax
+ 148:	84 d2                	test   %dl,%dl
+ 14a:	75 f4                	jne    140 <strcpy+0x10>
+    ;
+  return os;
+}
+ 14c:	5b                   	pop    %ebx
+ 14d:	89 c8                	mov    %ecx,%eax
+ 14f:	5d                   	pop    %ebp
+ 150:	c3                   	ret
+ 151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	53                   	push   %ebx
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+ 167:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 16a:	0f b6 02             	movzbl (%edx),%eax
+ 16d:	84 c0                	test   %al,%al
+ 16f:	75 15                	jne    186 <strcmp+0x26>
+ 171:	eb 30                	jmp    1a3 <strcmp+0x43>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 17c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 17f:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 180:	84 c0                	test   %al,%al
+ 182:	74 14                	je     198 <strcmp+0x38>
+    p++, q++;
+ 184:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 186:	0f b6 0b             	movzbl (%ebx),%ecx
+ 189:	38 c1                	cmp    %al,%cl
+ 18b:	74 eb                	je     178 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 18d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 18e:	29 c8                	sub    %ecx,%eax
+}
+ 190:	5d                   	pop    %ebp
+ 191:	c3                   	ret
+ 192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 198:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 19c:	31 c0                	xor    %eax,%eax
+}
+ 19e:	5b                   	pop    %ebx
+ 19f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 1a0:	29 c8                	sub    %ecx,%eax
+}
+ 1a2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1a3:	0f b6 0b             	movzbl (%ebx),%ecx
+ 1a6:	31 c0                	xor    %eax,%eax
+ 1a8:	eb e3                	jmp    18d <strcmp+0x2d>
+ 1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	40                   	inc    %eax
+ 1c1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c5:	89 c1                	mov    %eax,%ecx
+ 1c7:	75 f7                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1c9:	5d                   	pop    %ebp
+ 1ca:	89 c8                	mov    %ecx,%eax
+ 1cc:	c3                   	ret
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 1d1:	31 c9                	xor    %ecx,%ecx
+}
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	5f                   	pop    %edi
+ 1f3:	89 d0                	mov    %edx,%eax
+ 1f5:	5d                   	pop    %ebp
+ 1f6:	c3                   	ret
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 10                	jne    221 <strchr+0x21>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	40                   	inc    %eax
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	74 0f                	je     230 <strchr+0x30>
+    if(*s == c)
+ 221:	38 d1                	cmp    %dl,%cl
+ 223:	75 f3                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 225:	5d                   	pop    %ebp
+ 226:	c3                   	ret
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+ 230:	5d                   	pop    %ebp
+  return 0;
+ 231:	31 c0                	xor    %eax,%eax
+}
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 245:	31 f6                	xor    %esi,%esi
+{
+ 247:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 248:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 24b:	83 ec 3c             	sub    $0x3c,%esp
+ 24e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 251:	eb 32                	jmp    285 <gets+0x45>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+    cc = read(0, &c, 1);
+ 258:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 25c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 261:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 265:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 26c:	e8 1a 01 00 00       	call   38b <read>
+    if(cc < 1)
+ 271:	85 c0                	test   %eax,%eax
+ 273:	7e 19                	jle    28e <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 275:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 279:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 27d:	3c 0a                	cmp    $0xa,%al
+ 27f:	74 10                	je     291 <gets+0x51>
+ 281:	3c 0d                	cmp    $0xd,%al
+ 283:	74 0c                	je     291 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 285:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 288:	46                   	inc    %esi
+ 289:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 28c:	7c ca                	jl     258 <gets+0x18>
+ 28e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 291:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 295:	83 c4 3c             	add    $0x3c,%esp
+ 298:	89 d8                	mov    %ebx,%eax
+ 29a:	5b                   	pop    %ebx
+ 29b:	5e                   	pop    %esi
+ 29c:	5f                   	pop    %edi
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a1:	31 c0                	xor    %eax,%eax
+{
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 18             	sub    $0x18,%esp
+ 2a8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 2ab:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 2ae:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 2b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b5:	89 04 24             	mov    %eax,(%esp)
+ 2b8:	e8 f6 00 00 00       	call   3b3 <open>
+  if(fd < 0)
+ 2bd:	85 c0                	test   %eax,%eax
+ 2bf:	78 2f                	js     2f0 <stat+0x50>
+ 2c1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c6:	89 1c 24             	mov    %ebx,(%esp)
+ 2c9:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 2cd:	e8 f9 00 00 00       	call   3cb <fstat>
+  close(fd);
+ 2d2:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2d5:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2d7:	e8 bf 00 00 00       	call   39b <close>
+  return r;
+}
+ 2dc:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 2df:	89 f0                	mov    %esi,%eax
+ 2e1:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 2e4:	89 ec                	mov    %ebp,%esp
+ 2e6:	5d                   	pop    %ebp
+ 2e7:	c3                   	ret
+ 2e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    return -1;
+ 2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2f5:	eb e5                	jmp    2dc <stat+0x3c>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 307:	0f be 02             	movsbl (%edx),%eax
+ 30a:	88 c1                	mov    %al,%cl
+ 30c:	80 e9 30             	sub    $0x30,%cl
+ 30f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 312:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 317:	77 1c                	ja     335 <atoi+0x35>
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 320:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 323:	42                   	inc    %edx
+ 324:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 328:	0f be 02             	movsbl (%edx),%eax
+ 32b:	88 c3                	mov    %al,%bl
+ 32d:	80 eb 30             	sub    $0x30,%bl
+ 330:	80 fb 09             	cmp    $0x9,%bl
+ 333:	76 eb                	jbe    320 <atoi+0x20>
+  return n;
+}
+ 335:	5b                   	pop    %ebx
+ 336:	89 c8                	mov    %ecx,%eax
+ 338:	5d                   	pop    %ebp
+ 339:	c3                   	ret
+ 33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000340 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	8b 45 10             	mov    0x10(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 34e:	85 c0                	test   %eax,%eax
+ 350:	7e 13                	jle    365 <memmove+0x25>
+ 352:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 354:	89 d7                	mov    %edx,%edi
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 360:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 361:	39 f8                	cmp    %edi,%eax
+ 363:	75 fb                	jne    360 <memmove+0x20>
+  return vdst;
+}
+ 365:	5e                   	pop    %esi
+ 366:	89 d0                	mov    %edx,%eax
+ 368:	5f                   	pop    %edi
+ 369:	5d                   	pop    %ebp
+ 36a:	c3                   	ret
+
+0000036b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 36b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <exit>:
+SYSCALL(exit)
+ 373:	b8 02 00 00 00       	mov    $0x2,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <wait>:
+SYSCALL(wait)
+ 37b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <pipe>:
+SYSCALL(pipe)
+ 383:	b8 04 00 00 00       	mov    $0x4,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <read>:
+SYSCALL(read)
+ 38b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <write>:
+SYSCALL(write)
+ 393:	b8 10 00 00 00       	mov    $0x10,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <close>:
+SYSCALL(close)
+ 39b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <kill>:
+SYSCALL(kill)
+ 3a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <exec>:
+SYSCALL(exec)
+ 3ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <open>:
+SYSCALL(open)
+ 3b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <mknod>:
+SYSCALL(mknod)
+ 3bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <unlink>:
+SYSCALL(unlink)
+ 3c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <fstat>:
+SYSCALL(fstat)
+ 3cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <link>:
+SYSCALL(link)
+ 3d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mkdir>:
+SYSCALL(mkdir)
+ 3db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <chdir>:
+SYSCALL(chdir)
+ 3e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <dup>:
+SYSCALL(dup)
+ 3eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getpid>:
+SYSCALL(getpid)
+ 3f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <sbrk>:
+SYSCALL(sbrk)
+ 3fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <sleep>:
+SYSCALL(sleep)
+ 403:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <uptime>:
+SYSCALL(uptime)
+ 40b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <detach>:
+SYSCALL(detach)
+ 413:	b8 16 00 00 00       	mov    $0x16,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <policy>:
+SYSCALL(policy)
+ 41b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <priority>:
+SYSCALL(priority)
+ 423:	b8 18 00 00 00       	mov    $0x18,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <wait_stat>:
+SYSCALL(wait_stat)
+ 42b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <lockstat>:
+SYSCALL(lockstat)
+ 433:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mmap>:
+SYSCALL(mmap)
+ 43b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <munmap>:
+SYSCALL(munmap)
+ 443:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <shmget>:
+SYSCALL(shmget)
+ 44b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <shmat>:
+SYSCALL(shmat)
+ 453:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <shmdt>:
+SYSCALL(shmdt)
+ 45b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <memstat>:
+SYSCALL(memstat)
+ 463:	b8 20 00 00 00       	mov    $0x20,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <getprocs>:
+SYSCALL(getprocs)
+ 46b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <shmctl>:
+SYSCALL(shmctl)
+ 473:	b8 22 00 00 00       	mov    $0x22,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+ 47b:	66 90                	xchg   %ax,%ax
+ 47d:	66 90                	xchg   %ax,%ax
+ 47f:	90                   	nop
+
+00000480 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	89 cb                	mov    %ecx,%ebx
+ 488:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 48b:	89 d1                	mov    %edx,%ecx
+{
+ 48d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 490:	89 d0                	mov    %edx,%eax
+ 492:	c1 e8 1f             	shr    $0x1f,%eax
+ 495:	84 c0                	test   %al,%al
+ 497:	0f 84 93 00 00 00    	je     530 <printint+0xb0>
+ 49d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4a1:	0f 84 89 00 00 00    	je     530 <printint+0xb0>
+    x = -xx;
+ 4a7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4ae:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 4b5:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 4b8:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 4c0:	89 c8                	mov    %ecx,%eax
+ 4c2:	31 d2                	xor    %edx,%edx
+ 4c4:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 4c7:	f7 f3                	div    %ebx
+ 4c9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 4cc:	0f b6 92 c4 0a 00 00 	movzbl 0xac4(%edx),%edx
+ 4d3:	8d 47 01             	lea    0x1(%edi),%eax
+ 4d6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4d9:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 4dd:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 4df:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 4e2:	39 da                	cmp    %ebx,%edx
+ 4e4:	73 da                	jae    4c0 <printint+0x40>
+  if(neg)
+ 4e6:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 4e9:	85 c0                	test   %eax,%eax
+ 4eb:	74 0a                	je     4f7 <printint+0x77>
+    buf[i++] = '-';
+ 4ed:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4f0:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 4f5:	89 c7                	mov    %eax,%edi
+ 4f7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4fa:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 4fe:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 500:	0f b6 07             	movzbl (%edi),%eax
+ 503:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 506:	b8 01 00 00 00       	mov    $0x1,%eax
+ 50b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 50f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 513:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 516:	89 04 24             	mov    %eax,(%esp)
+ 519:	e8 75 fe ff ff       	call   393 <write>
+  while(--i >= 0)
+ 51e:	89 f8                	mov    %edi,%eax
+ 520:	4f                   	dec    %edi
+ 521:	39 d8                	cmp    %ebx,%eax
+ 523:	75 db                	jne    500 <printint+0x80>
+}
+ 525:	83 c4 4c             	add    $0x4c,%esp
+ 528:	5b                   	pop    %ebx
+ 529:	5e                   	pop    %esi
+ 52a:	5f                   	pop    %edi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 530:	31 c0                	xor    %eax,%eax
+ 532:	e9 77 ff ff ff       	jmp    4ae <printint+0x2e>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 54c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 54f:	0f b6 1e             	movzbl (%esi),%ebx
+ 552:	84 db                	test   %bl,%bl
+ 554:	74 6f                	je     5c5 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 556:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 559:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 55b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 55e:	88 d9                	mov    %bl,%cl
+ 560:	46                   	inc    %esi
+ 561:	89 d3                	mov    %edx,%ebx
+ 563:	eb 2b                	jmp    590 <printf+0x50>
+ 565:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 568:	83 f8 25             	cmp    $0x25,%eax
+ 56b:	74 4b                	je     5b8 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 56d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+ 575:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 579:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 57c:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 580:	89 3c 24             	mov    %edi,(%esp)
+ 583:	e8 0b fe ff ff       	call   393 <write>
+  for(i = 0; fmt[i]; i++){
+ 588:	0f b6 0e             	movzbl (%esi),%ecx
+ 58b:	46                   	inc    %esi
+ 58c:	84 c9                	test   %cl,%cl
+ 58e:	74 35                	je     5c5 <printf+0x85>
+    if(state == 0){
+ 590:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 592:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 595:	74 d1                	je     568 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 597:	83 fb 25             	cmp    $0x25,%ebx
+ 59a:	75 ec                	jne    588 <printf+0x48>
+      if(c == 'd'){
+ 59c:	83 f8 25             	cmp    $0x25,%eax
+ 59f:	0f 84 53 01 00 00    	je     6f8 <printf+0x1b8>
+ 5a5:	83 e8 63             	sub    $0x63,%eax
+ 5a8:	83 f8 15             	cmp    $0x15,%eax
+ 5ab:	77 23                	ja     5d0 <printf+0x90>
+ 5ad:	ff 24 85 6c 0a 00 00 	jmp    *0xa6c(,%eax,4)
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 5b8:	0f b6 0e             	movzbl (%esi),%ecx
+ 5bb:	46                   	inc    %esi
+        state = '%';
+ 5bc:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 5c1:	84 c9                	test   %cl,%cl
+ 5c3:	75 cb                	jne    590 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5c5:	83 c4 3c             	add    $0x3c,%esp
+ 5c8:	5b                   	pop    %ebx
+ 5c9:	5e                   	pop    %esi
+ 5ca:	5f                   	pop    %edi
+ 5cb:	5d                   	pop    %ebp
+ 5cc:	c3                   	ret
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5d0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 5d3:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5d6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5db:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5df:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 5e3:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 5e7:	89 3c 24             	mov    %edi,(%esp)
+ 5ea:	e8 a4 fd ff ff       	call   393 <write>
+        putc(fd, c);
+ 5ef:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 5f3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 5f8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 5fb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 5ff:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 601:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 605:	89 3c 24             	mov    %edi,(%esp)
+ 608:	e8 86 fd ff ff       	call   393 <write>
+ 60d:	e9 76 ff ff ff       	jmp    588 <printf+0x48>
+ 612:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 618:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 61b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 620:	8b 13                	mov    (%ebx),%edx
+ 622:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 629:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 62c:	89 f8                	mov    %edi,%eax
+ 62e:	e8 4d fe ff ff       	call   480 <printint>
+        ap++;
+ 633:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 636:	31 db                	xor    %ebx,%ebx
+ 638:	e9 4b ff ff ff       	jmp    588 <printf+0x48>
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 640:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 643:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 645:	83 c0 04             	add    $0x4,%eax
+ 648:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 64b:	85 c9                	test   %ecx,%ecx
+ 64d:	0f 84 cd 00 00 00    	je     720 <printf+0x1e0>
+        while(*s != 0){
+ 653:	0f b6 01             	movzbl (%ecx),%eax
+ 656:	84 c0                	test   %al,%al
+ 658:	0f 84 ce 00 00 00    	je     72c <printf+0x1ec>
+ 65e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 661:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 664:	89 ce                	mov    %ecx,%esi
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 670:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 673:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 678:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 679:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 67d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 681:	89 3c 24             	mov    %edi,(%esp)
+ 684:	e8 0a fd ff ff       	call   393 <write>
+        while(*s != 0){
+ 689:	0f b6 06             	movzbl (%esi),%eax
+ 68c:	84 c0                	test   %al,%al
+ 68e:	75 e0                	jne    670 <printf+0x130>
+      state = 0;
+ 690:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 693:	31 db                	xor    %ebx,%ebx
+ 695:	e9 ee fe ff ff       	jmp    588 <printf+0x48>
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6a0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 6a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6a8:	8b 13                	mov    (%ebx),%edx
+ 6aa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 6b1:	e9 73 ff ff ff       	jmp    629 <printf+0xe9>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 6c0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 6c3:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 6c8:	8b 10                	mov    (%eax),%edx
+ 6ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 6cd:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 6d1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d4:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 6d8:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 6db:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 6df:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 6e1:	89 3c 24             	mov    %edi,(%esp)
+ 6e4:	e8 aa fc ff ff       	call   393 <write>
+        ap++;
+ 6e9:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 6ed:	e9 96 fe ff ff       	jmp    588 <printf+0x48>
+ 6f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 6f8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6fb:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 6fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 703:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 707:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 709:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 70d:	89 3c 24             	mov    %edi,(%esp)
+ 710:	e8 7e fc ff ff       	call   393 <write>
+ 715:	e9 6e fe ff ff       	jmp    588 <printf+0x48>
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 720:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 722:	b9 64 0a 00 00       	mov    $0xa64,%ecx
+ 727:	e9 32 ff ff ff       	jmp    65e <printf+0x11e>
+      state = 0;
+ 72c:	31 db                	xor    %ebx,%ebx
+ 72e:	66 90                	xchg   %ax,%ax
+ 730:	e9 53 fe ff ff       	jmp    588 <printf+0x48>
+ 735:	66 90                	xchg   %ax,%ax
+ 737:	66 90                	xchg   %ax,%ax
+ 739:	66 90                	xchg   %ax,%ax
+ 73b:	66 90                	xchg   %ax,%ax
+ 73d:	66 90                	xchg   %ax,%ax
+ 73f:	90                   	nop
+
+00000740 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	83 ec 18             	sub    $0x18,%esp
+ 746:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 749:	89 c3                	mov    %eax,%ebx
+ 74b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 74e:	a1 84 0d 00 00       	mov    0xd84,%eax
+ 753:	8b 15 80 0d 00 00    	mov    0xd80,%edx
+ 759:	29 c2                	sub    %eax,%edx
+ 75b:	39 da                	cmp    %ebx,%edx
+ 75d:	72 19                	jb     778 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 75f:	01 c3                	add    %eax,%ebx
+ 761:	89 1d 84 0d 00 00    	mov    %ebx,0xd84
+  return p;
+}
+ 767:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 76a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 76d:	89 ec                	mov    %ebp,%esp
+ 76f:	5d                   	pop    %ebp
+ 770:	c3                   	ret
+ 771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 778:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 77d:	39 c3                	cmp    %eax,%ebx
+ 77f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 782:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 785:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 787:	e8 6f fc ff ff       	call   3fb <sbrk>
+    if(p == (char*)-1)
+ 78c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 78f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 791:	74 1d                	je     7b0 <morecore+0x70>
+    if(p != arenaend)
+ 793:	39 05 80 0d 00 00    	cmp    %eax,0xd80
+ 799:	74 0d                	je     7a8 <morecore+0x68>
+    arenaend = p + grow;
+ 79b:	01 f2                	add    %esi,%edx
+ 79d:	89 15 80 0d 00 00    	mov    %edx,0xd80
+ 7a3:	eb ba                	jmp    75f <morecore+0x1f>
+ 7a5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 7a8:	a1 84 0d 00 00       	mov    0xd84,%eax
+ 7ad:	eb ec                	jmp    79b <morecore+0x5b>
+ 7af:	90                   	nop
+      return 0;
+ 7b0:	31 c0                	xor    %eax,%eax
+ 7b2:	eb b3                	jmp    767 <morecore+0x27>
+ 7b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+
+000007c0 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cc:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 7cf:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 7d2:	85 c0                	test   %eax,%eax
+ 7d4:	74 1e                	je     7f4 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 7d6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 7d9:	83 fa 08             	cmp    $0x8,%edx
+ 7dc:	77 16                	ja     7f4 <free+0x34>
+  h = (Header*)ap - 1;
+ 7de:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 7e1:	74 25                	je     808 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 7e3:	8b 3c 95 a0 0d 00 00 	mov    0xda0(,%edx,4),%edi
+ 7ea:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 7ed:	89 0c 95 a0 0d 00 00 	mov    %ecx,0xda0(,%edx,4)
+}
+ 7f4:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 7f7:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 7fa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 7fd:	89 ec                	mov    %ebp,%esp
+ 7ff:	5d                   	pop    %ebp
+ 800:	c3                   	ret
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 808:	8b 15 c0 0d 00 00    	mov    0xdc0,%edx
+ 80e:	85 d2                	test   %edx,%edx
+ 810:	74 54                	je     866 <free+0xa6>
+ 812:	39 ca                	cmp    %ecx,%edx
+ 814:	73 36                	jae    84c <free+0x8c>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+ 820:	89 d3                	mov    %edx,%ebx
+ 822:	8b 12                	mov    (%edx),%edx
+ 824:	85 d2                	test   %edx,%edx
+ 826:	74 12                	je     83a <free+0x7a>
+ 828:	39 ca                	cmp    %ecx,%edx
+ 82a:	72 f4                	jb     820 <free+0x60>
+  if(p && END(h) == p){
+ 82c:	85 d2                	test   %edx,%edx
+ 82e:	74 0a                	je     83a <free+0x7a>
+ 830:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 833:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 836:	39 fa                	cmp    %edi,%edx
+ 838:	74 4b                	je     885 <free+0xc5>
+  h->s.u.next = p;
+ 83a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 83d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 840:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 844:	39 f1                	cmp    %esi,%ecx
+ 846:	74 29                	je     871 <free+0xb1>
+    prev->s.u.next = h;
+ 848:	89 0b                	mov    %ecx,(%ebx)
+ 84a:	eb a8                	jmp    7f4 <free+0x34>
+  if(p && END(h) == p){
+ 84c:	85 d2                	test   %edx,%edx
+ 84e:	74 16                	je     866 <free+0xa6>
+ 850:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 853:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 856:	39 f2                	cmp    %esi,%edx
+ 858:	75 0c                	jne    866 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 85a:	8b 72 04             	mov    0x4(%edx),%esi
+ 85d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 861:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 864:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 866:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 869:	89 0d c0 0d 00 00    	mov    %ecx,0xdc0
+ 86f:	eb 83                	jmp    7f4 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 871:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 874:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 878:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 87b:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 87e:	89 03                	mov    %eax,(%ebx)
+ 880:	e9 6f ff ff ff       	jmp    7f4 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 885:	8b 7a 04             	mov    0x4(%edx),%edi
+ 888:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 88c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 88f:	8b 12                	mov    (%edx),%edx
+ 891:	eb a7                	jmp    83a <free+0x7a>
+ 893:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008a0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	83 ec 2c             	sub    $0x2c,%esp
+ 8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 8ac:	83 f8 10             	cmp    $0x10,%eax
+ 8af:	0f 86 52 01 00 00    	jbe    a07 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 8b5:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 8b7:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8bc:	eb 0d                	jmp    8cb <malloc+0x2b>
+ 8be:	66 90                	xchg   %ax,%ax
+ 8c0:	83 c1 05             	add    $0x5,%ecx
+ 8c3:	89 d6                	mov    %edx,%esi
+ 8c5:	d3 e6                	shl    %cl,%esi
+ 8c7:	39 c6                	cmp    %eax,%esi
+ 8c9:	73 55                	jae    920 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 8cb:	89 d9                	mov    %ebx,%ecx
+ 8cd:	43                   	inc    %ebx
+ 8ce:	83 fb 08             	cmp    $0x8,%ebx
+ 8d1:	75 ed                	jne    8c0 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 8d3:	8d 58 07             	lea    0x7(%eax),%ebx
+ 8d6:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 8d9:	39 c3                	cmp    %eax,%ebx
+ 8db:	0f 82 1f 01 00 00    	jb     a00 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 8e1:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+ 8e6:	85 c0                	test   %eax,%eax
+ 8e8:	0f 84 ee 00 00 00    	je     9dc <malloc+0x13c>
+ 8ee:	b9 c0 0d 00 00       	mov    $0xdc0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 8f3:	8b 50 04             	mov    0x4(%eax),%edx
+ 8f6:	39 da                	cmp    %ebx,%edx
+ 8f8:	0f 82 d2 00 00 00    	jb     9d0 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 8fe:	29 da                	sub    %ebx,%edx
+ 900:	83 fa 17             	cmp    $0x17,%edx
+ 903:	0f 87 b7 00 00 00    	ja     9c0 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 909:	8b 10                	mov    (%eax),%edx
+ 90b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 90d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 913:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 916:	83 c0 08             	add    $0x8,%eax
+}
+ 919:	5b                   	pop    %ebx
+ 91a:	5e                   	pop    %esi
+ 91b:	5f                   	pop    %edi
+ 91c:	5d                   	pop    %ebp
+ 91d:	c3                   	ret
+ 91e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 920:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 922:	8b 04 9d a0 0d 00 00 	mov    0xda0(,%ebx,4),%eax
+ 929:	85 c0                	test   %eax,%eax
+ 92b:	74 23                	je     950 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 92d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 92f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 932:	89 14 9d a0 0d 00 00 	mov    %edx,0xda0(,%ebx,4)
+    h->s.u.cls = cls;
+ 939:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 93c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 93f:	83 c4 2c             	add    $0x2c,%esp
+ 942:	5b                   	pop    %ebx
+ 943:	5e                   	pop    %esi
+ 944:	5f                   	pop    %edi
+ 945:	5d                   	pop    %ebp
+ 946:	c3                   	ret
+ 947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 950:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 953:	31 d2                	xor    %edx,%edx
+ 955:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 95a:	f7 f6                	div    %esi
+ 95c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 95f:	0f af c6             	imul   %esi,%eax
+ 962:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 965:	e8 d6 fd ff ff       	call   740 <morecore>
+ 96a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 96d:	85 c0                	test   %eax,%eax
+ 96f:	0f 84 8b 00 00 00    	je     a00 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 975:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 978:	8b 0c 9d a0 0d 00 00 	mov    0xda0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 984:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 987:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 98a:	eb 06                	jmp    992 <malloc+0xf2>
+ 98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 990:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 992:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 994:	42                   	inc    %edx
+ 995:	89 c1                	mov    %eax,%ecx
+ 997:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 99a:	39 d7                	cmp    %edx,%edi
+ 99c:	75 f2                	jne    990 <malloc+0xf0>
+ 99e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 9a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 9a4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 9a7:	89 04 9d a0 0d 00 00 	mov    %eax,0xda0(,%ebx,4)
+ 9ae:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 9b1:	29 f0                	sub    %esi,%eax
+ 9b3:	01 c2                	add    %eax,%edx
+ 9b5:	89 d0                	mov    %edx,%eax
+ 9b7:	e9 71 ff ff ff       	jmp    92d <malloc+0x8d>
+ 9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 9c0:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 9c3:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 9c6:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 9c8:	89 58 04             	mov    %ebx,0x4(%eax)
+ 9cb:	e9 3d ff ff ff       	jmp    90d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 9d0:	89 c1                	mov    %eax,%ecx
+ 9d2:	8b 00                	mov    (%eax),%eax
+ 9d4:	85 c0                	test   %eax,%eax
+ 9d6:	0f 85 17 ff ff ff    	jne    8f3 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 9dc:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 9df:	74 1f                	je     a00 <malloc+0x160>
+ 9e1:	8d 43 08             	lea    0x8(%ebx),%eax
+ 9e4:	e8 57 fd ff ff       	call   740 <morecore>
+ 9e9:	85 c0                	test   %eax,%eax
+ 9eb:	74 13                	je     a00 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 9ed:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ 9f3:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ 9f6:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ 9f9:	e9 41 ff ff ff       	jmp    93f <malloc+0x9f>
+ 9fe:	66 90                	xchg   %ax,%ax
+      return 0;
+ a00:	31 c0                	xor    %eax,%eax
+ a02:	e9 38 ff ff ff       	jmp    93f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ a07:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ a0c:	31 db                	xor    %ebx,%ebx
+ a0e:	e9 0f ff ff ff       	jmp    922 <malloc+0x82>
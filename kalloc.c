@@ -1,6 +1,7 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and blocks of
+// 2^order contiguous pages with kalloc_pages().
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +9,36 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "memstat.h"
+
+// Free memory is managed by a buddy allocator: a free block of
+// order k is 2^k physically contiguous pages, aligned to its size,
+// and sits on kmem.free[k]. Allocation splits larger blocks;
+// freeing merges a block with its buddy (the other half of the
+// block of order k+1) whenever the buddy is free too.
+#define MAXORDER  10         // Largest block is 2^MAXORDER pages (4MB)
+#define NPAGES    (PHYSTOP/PGSIZE)
+
+// Each CPU keeps a small magazine of free pages so that most
+// kalloc()/kfree() calls never touch kmem.lock. Magazines are
+// refilled from, and drained to, the buddy allocator MAGBATCH
+// pages at a time.
+#define MAGSIZE   32
+#define MAGBATCH  (MAGSIZE/2)
+
+// Idle CPUs zero free pages ahead of time into a pool of up to
+// ZPOOLSIZE pages, which kzalloc() uses first.
+#define ZPOOLSIZE 128
+#define ZPOOLLOW  8    // what it keeps when free memory is scarce
+
+// Pages to take back from the buffer cache when out of pages.
+#define RECLAIMPAGES 4
+
+// Define KALLOC_JUNK to fill freed pages with junk, to catch
+// dangling references. Off by default: it costs a full page
+// write on every free.
+//#define KALLOC_JUNK
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,14 +46,42 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;  // Only used on the buddy free lists
+};
+
+// Reference counts for physical pages, so that copy-on-write
+// fork can share a page between several page tables. kalloc()
+// sets the count to 1; kfree() only frees the page once the
+// count drops to 0. Updated atomically, without kmem.lock.
+static ushort pgref[NPAGES];
+#define PGREF(v)  pgref[V2P(v)/PGSIZE]
+
+// For each page that starts a free buddy block, the block's
+// order plus one; 0 for every other page. Protected by kmem.lock.
+static uchar pgorder[NPAGES];
+
+struct magazine {
+  struct run *list;
+  int n;
 };
 
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run free[MAXORDER+1]; // Circular lists of free blocks, by order
+  uint nfree;                  // Pages on the free lists
+  uint npages;                 // Pages ever handed to freerange()
+  struct magazine mag[NCPU];   // Only used once use_lock is set.
 } kmem;
 
+// Pages zeroed in advance. The first word of each holds the link
+// to the next and is cleared when the page is handed out.
+struct {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+} kzero;
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -31,8 +90,13 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  int k;
+
   initlock(&kmem.lock, "kmem");
+  initlock(&kzero.lock, "kzero");
   kmem.use_lock = 0;
+  for(k = 0; k <= MAXORDER; k++)
+    kmem.free[k].next = kmem.free[k].prev = &kmem.free[k];
   freerange(vstart, vend);
 }
 
@@ -48,9 +112,116 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kmem.npages++;
     kfree(p);
+  }
+}
+
+static void
+listremove(struct run *r)
+{
+  r->prev->next = r->next;
+  r->next->prev = r->prev;
+}
+
+static void
+listpush(struct run *head, struct run *r)
+{
+  r->next = head->next;
+  r->prev = head;
+  head->next->prev = r;
+  head->next = r;
+}
+
+// Return the block of 2^order pages at v to the free lists,
+// merging it with its buddies as far as possible.
+// Caller must hold kmem.lock (or be single-threaded at boot).
+static void
+buddyfree(char *v, int order)
+{
+  uint pn, bn;
+
+  pn = V2P(v) / PGSIZE;
+  kmem.nfree += 1 << order;
+  while(order < MAXORDER){
+    bn = pn ^ (1 << order);
+    if(bn >= NPAGES || pgorder[bn] != order + 1)
+      break;
+    listremove((struct run*)P2V(bn * PGSIZE));
+    pgorder[bn] = 0;
+    pn &= ~(1 << order);
+    order++;
+  }
+  pgorder[pn] = order + 1;
+  listpush(&kmem.free[order], (struct run*)P2V(pn * PGSIZE));
+}
+
+// Take a block of 2^order pages off the free lists, splitting
+// a larger block if needed. Returns 0 if there is none.
+// Caller must hold kmem.lock (or be single-threaded at boot).
+static char*
+buddyalloc(int order)
+{
+  struct run *r;
+  uint pn;
+  int k;
+
+  for(k = order; k <= MAXORDER; k++)
+    if(kmem.free[k].next != &kmem.free[k])
+      break;
+  if(k > MAXORDER)
+    return 0;
+
+  r = kmem.free[k].next;
+  listremove(r);
+  kmem.nfree -= 1 << order;
+  pn = V2P(r) / PGSIZE;
+  pgorder[pn] = 0;
+  // Give back the upper halves we don't need.
+  while(k > order){
+    k--;
+    pgorder[pn + (1 << k)] = k + 1;
+    listpush(&kmem.free[k], (struct run*)P2V((pn + (1 << k)) * PGSIZE));
+  }
+  return (char*)r;
 }
+
+// Move MAGBATCH pages from magazine m to the buddy allocator.
+// Must be called with interrupts off, on m's own CPU.
+static void
+magdrain(struct magazine *m)
+{
+  struct run *r;
+  int i;
+
+  acquire(&kmem.lock);
+  for(i = 0; i < MAGBATCH; i++){
+    r = m->list;
+    m->list = r->next;
+    buddyfree((char*)r, 0);
+  }
+  release(&kmem.lock);
+  m->n -= MAGBATCH;
+}
+
+// Move up to MAGBATCH pages from the buddy allocator to
+// magazine m, which must be empty.
+// Must be called with interrupts off, on m's own CPU.
+static void
+magfill(struct magazine *m)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(m->n < MAGBATCH && (r = (struct run*)buddyalloc(0)) != 0){
+    r->next = m->list;
+    m->list = r;
+    m->n++;
+  }
+  release(&kmem.lock);
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -60,20 +231,57 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct magazine *m;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  // Pages handed to freerange() at boot have no references.
+  if(PGREF(v) != 0 && __sync_sub_and_fetch(&PGREF(v), 1) != 0)
+    return;
+
+#ifdef KALLOC_JUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    // Single-threaded boot: mycpu() isn't usable yet.
+    buddyfree(v, 0);
+    return;
+  }
+
+  pushcli();
+  m = &kmem.mag[cpuid()];
+  if(m->n == MAGSIZE)
+    magdrain(m);
+  r->next = m->list;
+  m->list = r;
+  m->n++;
+  popcli();
+}
+
+// Take a free page from this CPU's magazine, refilling it from
+// the buddy lists. Doesn't touch the zeroed pool or reclaim.
+// Returns 0 if there is none.
+static struct run*
+kget(void)
+{
+  struct run *r;
+  struct magazine *m;
+
+  pushcli();
+  m = &kmem.mag[cpuid()];
+  if(m->n == 0)
+    magfill(m);
+  r = m->list;
+  if(r){
+    m->list = r->next;
+    m->n--;
+  }
+  popcli();
+  return r;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,14 +291,168 @@ char*
 kalloc(void)
 {
   struct run *r;
+  int nolocks;
+
+retry:
+  if(!kmem.use_lock){
+    r = (struct run*)buddyalloc(0);
+    if(r)
+      PGREF(r) = 1;
+    return (char*)r;
+  }
+
+  r = kget();
+  if(r == 0){
+    // Out of free pages; the zeroed pool is still free memory.
+    acquire(&kzero.lock);
+    if((r = kzero.list) != 0){
+      kzero.list = r->next;
+      kzero.n--;
+    }
+    release(&kzero.lock);
+  }
+  if(r == 0){
+    // Out of memory entirely: take some back from the buffer
+    // cache. Only when no spinlocks are held, since bshrink()
+    // takes bio.c's; this also keeps it from recursing.
+    pushcli();
+    nolocks = mycpu()->ncli == 1;
+    popcli();
+    if(nolocks && bshrink(RECLAIMPAGES) > 0)
+      goto retry;
+  }
+  if(r)
+    PGREF(r) = 1;
+  return (char*)r;
+}
 
+// Allocate one zero-filled page, preferably one that an idle
+// CPU has already zeroed (see kzeroidle).
+// Returns 0 if the memory cannot be allocated.
+char*
+kzalloc(void)
+{
+  struct run *r;
+
+  r = 0;
+  if(kmem.use_lock && kzero.n > 0){  // unlocked peek
+    acquire(&kzero.lock);
+    if((r = kzero.list) != 0){
+      kzero.list = r->next;
+      kzero.n--;
+    }
+    release(&kzero.lock);
+  }
+  if(r){
+    r->next = 0;
+    PGREF(r) = 1;
+    return (char*)r;
+  }
+  if((r = (struct run*)kalloc()) != 0)
+    memset(r, 0, PGSIZE);
+  return (char*)r;
+}
+
+// Called by the scheduler when it has nothing to run: zero one
+// free page into the zeroed pool, unless the pool is full.
+// Called with interrupts enabled, so zeroing can be interrupted.
+void
+kzeroidle(void)
+{
+  struct run *r;
+
+  if(!kmem.use_lock || kzero.n >= ZPOOLSIZE)  // unlocked peek
+    return;
+  // When free memory is scarce keep only a few pages zeroed,
+  // rather than tie up what is left.
+  if(kzero.n >= ZPOOLLOW && kmem.nfree < kmem.npages / 16)
+    return;
+  if((r = kget()) == 0)
+    return;
+  PGREF(r) = 0;
+  memset(r, 0, PGSIZE);
+  acquire(&kzero.lock);
+  r->next = kzero.list;
+  kzero.list = r;
+  kzero.n++;
+  release(&kzero.lock);
+}
+
+// Allocate 2^order physically contiguous pages, aligned to
+// their size. kalloc_pages(0) is kalloc(). Blocks of more than
+// one page are not reference counted; free them with
+// kfree_pages() and the same order.
+// Returns 0 if no such block is free.
+char*
+kalloc_pages(int order)
+{
+  char *v;
+
+  if(order == 0)
+    return kalloc();
+  if(order < 0 || order > MAXORDER)
+    return 0;
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  v = buddyalloc(order);
   if(kmem.use_lock)
     release(&kmem.lock);
-  return (char*)r;
+  return v;
 }
 
+// Free a block returned by kalloc_pages(order).
+void
+kfree_pages(char *v, int order)
+{
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > MAXORDER || V2P(v) % (PGSIZE << order) ||
+     v < end || V2P(v) + (PGSIZE << order) > PHYSTOP)
+    panic("kfree_pages");
+
+#ifdef KALLOC_JUNK
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE << order);
+#endif
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  buddyfree(v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Add a reference to the allocated page v.
+void
+kincref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kincref");
+  __sync_fetch_and_add(&PGREF(v), 1);
+}
+
+// Return the number of references to page v.
+int
+krefcount(char *v)
+{
+  return PGREF(v);
+}
+
+
+// Fill in the page allocator's part of *ms. The counts are read
+// without locks, so they are only a snapshot.
+void
+kmemstat(struct memstat *ms)
+{
+  uint nfree;
+  int i;
+
+  nfree = kmem.nfree;
+  for(i = 0; i < NCPU; i++)
+    nfree += kmem.mag[i].n;
+  ms->total = kmem.npages;
+  ms->zeroed = kzero.n;
+  ms->free = nfree + ms->zeroed;
+}
@@ -0,0 +1,1383 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	bb 01 00 00 00       	mov    $0x1,%ebx
+   b:	83 e4 f0             	and    $0xfffffff0,%esp
+   e:	83 ec 10             	sub    $0x10,%esp
+  11:	8b 75 08             	mov    0x8(%ebp),%esi
+  14:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  if(argc < 2){
+  17:	83 fe 01             	cmp    $0x1,%esi
+  1a:	7e 28                	jle    44 <main+0x44>
+  1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(2, "usage: kill pid...\n");
+    exit(0);
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  20:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  for(i=1; i<argc; i++)
+  23:	43                   	inc    %ebx
+    kill(atoi(argv[i]));
+  24:	89 04 24             	mov    %eax,(%esp)
+  27:	e8 14 02 00 00       	call   240 <atoi>
+  2c:	89 04 24             	mov    %eax,(%esp)
+  2f:	e8 af 02 00 00       	call   2e3 <kill>
+  for(i=1; i<argc; i++)
+  34:	39 de                	cmp    %ebx,%esi
+  36:	75 e8                	jne    20 <main+0x20>
+  exit(0);
+  38:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3f:	e8 6f 02 00 00       	call   2b3 <exit>
+    printf(2, "usage: kill pid...\n");
+  44:	c7 44 24 04 54 09 00 	movl   $0x954,0x4(%esp)
+  4b:	00 
+  4c:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  53:	e8 28 04 00 00       	call   480 <printf>
+    exit(0);
+  58:	31 c0                	xor    %eax,%eax
+  5a:	89 04 24             	mov    %eax,(%esp)
+  5d:	e8 51 02 00 00       	call   2b3 <exit>
+  62:	66 90                	xchg   %ax,%ax
+  64:	66 90                	xchg   %ax,%ax
+  66:	66 90                	xchg   %ax,%ax
+  68:	66 90                	xchg   %ax,%ax
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	40                   	inc    %eax
+  88:	84 d2                	test   %dl,%dl
+  8a:	75 f4                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8c:	5b                   	pop    %ebx
+  8d:	89 c8                	mov    %ecx,%eax
+  8f:	5d                   	pop    %ebp
+  90:	c3                   	ret
+  91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9f:	90                   	nop
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 15                	jne    c6 <strcmp+0x26>
+  b1:	eb 30                	jmp    e3 <strcmp+0x43>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  bf:	42                   	inc    %edx
+  while(*p && *p == *q)
+  c0:	84 c0                	test   %al,%al
+  c2:	74 14                	je     d8 <strcmp+0x38>
+    p++, q++;
+  c4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+  c6:	0f b6 0b             	movzbl (%ebx),%ecx
+  c9:	38 c1                	cmp    %al,%cl
+  cb:	74 eb                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+  cd:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+  ce:	29 c8                	sub    %ecx,%eax
+}
+  d0:	5d                   	pop    %ebp
+  d1:	c3                   	ret
+  d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+  dc:	31 c0                	xor    %eax,%eax
+}
+  de:	5b                   	pop    %ebx
+  df:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+  e0:	29 c8                	sub    %ecx,%eax
+}
+  e2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  e3:	0f b6 0b             	movzbl (%ebx),%ecx
+  e6:	31 c0                	xor    %eax,%eax
+  e8:	eb e3                	jmp    cd <strcmp+0x2d>
+  ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	40                   	inc    %eax
+ 101:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 105:	89 c1                	mov    %eax,%ecx
+ 107:	75 f7                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 109:	5d                   	pop    %ebp
+ 10a:	89 c8                	mov    %ecx,%eax
+ 10c:	c3                   	ret
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 111:	31 c9                	xor    %ecx,%ecx
+}
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	5f                   	pop    %edi
+ 133:	89 d0                	mov    %edx,%eax
+ 135:	5d                   	pop    %ebp
+ 136:	c3                   	ret
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 10                	jne    161 <strchr+0x21>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	40                   	inc    %eax
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	74 0f                	je     170 <strchr+0x30>
+    if(*s == c)
+ 161:	38 d1                	cmp    %dl,%cl
+ 163:	75 f3                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+ 167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16e:	66 90                	xchg   %ax,%ax
+ 170:	5d                   	pop    %ebp
+  return 0;
+ 171:	31 c0                	xor    %eax,%eax
+}
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 185:	31 f6                	xor    %esi,%esi
+{
+ 187:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 188:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 18b:	83 ec 3c             	sub    $0x3c,%esp
+ 18e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 191:	eb 32                	jmp    1c5 <gets+0x45>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+    cc = read(0, &c, 1);
+ 198:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 19c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1a1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 1a5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 1ac:	e8 1a 01 00 00       	call   2cb <read>
+    if(cc < 1)
+ 1b1:	85 c0                	test   %eax,%eax
+ 1b3:	7e 19                	jle    1ce <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 1b5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1bd:	3c 0a                	cmp    $0xa,%al
+ 1bf:	74 10                	je     1d1 <gets+0x51>
+ 1c1:	3c 0d                	cmp    $0xd,%al
+ 1c3:	74 0c                	je     1d1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 1c5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 1c8:	46                   	inc    %esi
+ 1c9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 1cc:	7c ca                	jl     198 <gets+0x18>
+ 1ce:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1d1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 1d5:	83 c4 3c             	add    $0x3c,%esp
+ 1d8:	89 d8                	mov    %ebx,%eax
+ 1da:	5b                   	pop    %ebx
+ 1db:	5e                   	pop    %esi
+ 1dc:	5f                   	pop    %edi
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+ 1df:	90                   	nop
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e1:	31 c0                	xor    %eax,%eax
+{
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	83 ec 18             	sub    $0x18,%esp
+ 1e8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 1eb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 1ee:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 1f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f5:	89 04 24             	mov    %eax,(%esp)
+ 1f8:	e8 f6 00 00 00       	call   2f3 <open>
+  if(fd < 0)
+ 1fd:	85 c0                	test   %eax,%eax
+ 1ff:	78 2f                	js     230 <stat+0x50>
+ 201:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 203:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 206:	89 1c 24             	mov    %ebx,(%esp)
+ 209:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 20d:	e8 f9 00 00 00       	call   30b <fstat>
+  close(fd);
+ 212:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 215:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 217:	e8 bf 00 00 00       	call   2db <close>
+  return r;
+}
+ 21c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 21f:	89 f0                	mov    %esi,%eax
+ 221:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 224:	89 ec                	mov    %ebp,%esp
+ 226:	5d                   	pop    %ebp
+ 227:	c3                   	ret
+ 228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb e5                	jmp    21c <stat+0x3c>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	88 c1                	mov    %al,%cl
+ 24c:	80 e9 30             	sub    $0x30,%cl
+ 24f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 252:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 257:	77 1c                	ja     275 <atoi+0x35>
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 260:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 263:	42                   	inc    %edx
+ 264:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 268:	0f be 02             	movsbl (%edx),%eax
+ 26b:	88 c3                	mov    %al,%bl
+ 26d:	80 eb 30             	sub    $0x30,%bl
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	5b                   	pop    %ebx
+ 276:	89 c8                	mov    %ecx,%eax
+ 278:	5d                   	pop    %ebp
+ 279:	c3                   	ret
+ 27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+
+000002ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <exit>:
+SYSCALL(exit)
+ 2b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <wait>:
+SYSCALL(wait)
+ 2bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <pipe>:
+SYSCALL(pipe)
+ 2c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <read>:
+SYSCALL(read)
+ 2cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <write>:
+SYSCALL(write)
+ 2d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <close>:
+SYSCALL(close)
+ 2db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <kill>:
+SYSCALL(kill)
+ 2e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <exec>:
+SYSCALL(exec)
+ 2eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <open>:
+SYSCALL(open)
+ 2f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <mknod>:
+SYSCALL(mknod)
+ 2fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <unlink>:
+SYSCALL(unlink)
+ 303:	b8 12 00 00 00       	mov    $0x12,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <fstat>:
+SYSCALL(fstat)
+ 30b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <link>:
+SYSCALL(link)
+ 313:	b8 13 00 00 00       	mov    $0x13,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mkdir>:
+SYSCALL(mkdir)
+ 31b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <chdir>:
+SYSCALL(chdir)
+ 323:	b8 09 00 00 00       	mov    $0x9,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <dup>:
+SYSCALL(dup)
+ 32b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getpid>:
+SYSCALL(getpid)
+ 333:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <sbrk>:
+SYSCALL(sbrk)
+ 33b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <sleep>:
+SYSCALL(sleep)
+ 343:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <uptime>:
+SYSCALL(uptime)
+ 34b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <detach>:
+SYSCALL(detach)
+ 353:	b8 16 00 00 00       	mov    $0x16,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <policy>:
+SYSCALL(policy)
+ 35b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <priority>:
+SYSCALL(priority)
+ 363:	b8 18 00 00 00       	mov    $0x18,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait_stat>:
+SYSCALL(wait_stat)
+ 36b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <lockstat>:
+SYSCALL(lockstat)
+ 373:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <mmap>:
+SYSCALL(mmap)
+ 37b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <munmap>:
+SYSCALL(munmap)
+ 383:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <shmget>:
+SYSCALL(shmget)
+ 38b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <shmat>:
+SYSCALL(shmat)
+ 393:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <shmdt>:
+SYSCALL(shmdt)
+ 39b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <memstat>:
+SYSCALL(memstat)
+ 3a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getprocs>:
+SYSCALL(getprocs)
+ 3ab:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <shmctl>:
+SYSCALL(shmctl)
+ 3b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+ 3bb:	66 90                	xchg   %ax,%ax
+ 3bd:	66 90                	xchg   %ax,%ax
+ 3bf:	90                   	nop
+
+000003c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	89 cb                	mov    %ecx,%ebx
+ 3c8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3cb:	89 d1                	mov    %edx,%ecx
+{
+ 3cd:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 3d0:	89 d0                	mov    %edx,%eax
+ 3d2:	c1 e8 1f             	shr    $0x1f,%eax
+ 3d5:	84 c0                	test   %al,%al
+ 3d7:	0f 84 93 00 00 00    	je     470 <printint+0xb0>
+ 3dd:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3e1:	0f 84 89 00 00 00    	je     470 <printint+0xb0>
+    x = -xx;
+ 3e7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3ee:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 3f5:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 3f8:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 400:	89 c8                	mov    %ecx,%eax
+ 402:	31 d2                	xor    %edx,%edx
+ 404:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 407:	f7 f3                	div    %ebx
+ 409:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 40c:	0f b6 92 c8 09 00 00 	movzbl 0x9c8(%edx),%edx
+ 413:	8d 47 01             	lea    0x1(%edi),%eax
+ 416:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 419:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 41d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 41f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 422:	39 da                	cmp    %ebx,%edx
+ 424:	73 da                	jae    400 <printint+0x40>
+  if(neg)
+ 426:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 429:	85 c0                	test   %eax,%eax
+ 42b:	74 0a                	je     437 <printint+0x77>
+    buf[i++] = '-';
+ 42d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 430:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 435:	89 c7                	mov    %eax,%edi
+ 437:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 43a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 43e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 440:	0f b6 07             	movzbl (%edi),%eax
+ 443:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 446:	b8 01 00 00 00       	mov    $0x1,%eax
+ 44b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 44f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 453:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 456:	89 04 24             	mov    %eax,(%esp)
+ 459:	e8 75 fe ff ff       	call   2d3 <write>
+  while(--i >= 0)
+ 45e:	89 f8                	mov    %edi,%eax
+ 460:	4f                   	dec    %edi
+ 461:	39 d8                	cmp    %ebx,%eax
+ 463:	75 db                	jne    440 <printint+0x80>
+}
+ 465:	83 c4 4c             	add    $0x4c,%esp
+ 468:	5b                   	pop    %ebx
+ 469:	5e                   	pop    %esi
+ 46a:	5f                   	pop    %edi
+ 46b:	5d                   	pop    %ebp
+ 46c:	c3                   	ret
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 470:	31 c0                	xor    %eax,%eax
+ 472:	e9 77 ff ff ff       	jmp    3ee <printint+0x2e>
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 489:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 48c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 48f:	0f b6 1e             	movzbl (%esi),%ebx
+ 492:	84 db                	test   %bl,%bl
+ 494:	74 6f                	je     505 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 496:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 499:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 49b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 49e:	88 d9                	mov    %bl,%cl
+ 4a0:	46                   	inc    %esi
+ 4a1:	89 d3                	mov    %edx,%ebx
+ 4a3:	eb 2b                	jmp    4d0 <printf+0x50>
+ 4a5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 4a8:	83 f8 25             	cmp    $0x25,%eax
+ 4ab:	74 4b                	je     4f8 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4ad:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4b0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4b9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4bc:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 4c0:	89 3c 24             	mov    %edi,(%esp)
+ 4c3:	e8 0b fe ff ff       	call   2d3 <write>
+  for(i = 0; fmt[i]; i++){
+ 4c8:	0f b6 0e             	movzbl (%esi),%ecx
+ 4cb:	46                   	inc    %esi
+ 4cc:	84 c9                	test   %cl,%cl
+ 4ce:	74 35                	je     505 <printf+0x85>
+    if(state == 0){
+ 4d0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 4d2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 4d5:	74 d1                	je     4a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4d7:	83 fb 25             	cmp    $0x25,%ebx
+ 4da:	75 ec                	jne    4c8 <printf+0x48>
+      if(c == 'd'){
+ 4dc:	83 f8 25             	cmp    $0x25,%eax
+ 4df:	0f 84 53 01 00 00    	je     638 <printf+0x1b8>
+ 4e5:	83 e8 63             	sub    $0x63,%eax
+ 4e8:	83 f8 15             	cmp    $0x15,%eax
+ 4eb:	77 23                	ja     510 <printf+0x90>
+ 4ed:	ff 24 85 70 09 00 00 	jmp    *0x970(,%eax,4)
+ 4f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 4f8:	0f b6 0e             	movzbl (%esi),%ecx
+ 4fb:	46                   	inc    %esi
+        state = '%';
+ 4fc:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 501:	84 c9                	test   %cl,%cl
+ 503:	75 cb                	jne    4d0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 505:	83 c4 3c             	add    $0x3c,%esp
+ 508:	5b                   	pop    %ebx
+ 509:	5e                   	pop    %esi
+ 50a:	5f                   	pop    %edi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+ 510:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 513:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 516:	b8 01 00 00 00       	mov    $0x1,%eax
+ 51b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 51f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 523:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 527:	89 3c 24             	mov    %edi,(%esp)
+ 52a:	e8 a4 fd ff ff       	call   2d3 <write>
+        putc(fd, c);
+ 52f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 533:	ba 01 00 00 00       	mov    $0x1,%edx
+ 538:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 53b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 53f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 541:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 545:	89 3c 24             	mov    %edi,(%esp)
+ 548:	e8 86 fd ff ff       	call   2d3 <write>
+ 54d:	e9 76 ff ff ff       	jmp    4c8 <printf+0x48>
+ 552:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 558:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 55b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 560:	8b 13                	mov    (%ebx),%edx
+ 562:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 569:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 56c:	89 f8                	mov    %edi,%eax
+ 56e:	e8 4d fe ff ff       	call   3c0 <printint>
+        ap++;
+ 573:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 576:	31 db                	xor    %ebx,%ebx
+ 578:	e9 4b ff ff ff       	jmp    4c8 <printf+0x48>
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 580:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 583:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 585:	83 c0 04             	add    $0x4,%eax
+ 588:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 58b:	85 c9                	test   %ecx,%ecx
+ 58d:	0f 84 cd 00 00 00    	je     660 <printf+0x1e0>
+        while(*s != 0){
+ 593:	0f b6 01             	movzbl (%ecx),%eax
+ 596:	84 c0                	test   %al,%al
+ 598:	0f 84 ce 00 00 00    	je     66c <printf+0x1ec>
+ 59e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5a1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5a4:	89 ce                	mov    %ecx,%esi
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 5b0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5b3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 5b8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 5b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 5bd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 5c1:	89 3c 24             	mov    %edi,(%esp)
+ 5c4:	e8 0a fd ff ff       	call   2d3 <write>
+        while(*s != 0){
+ 5c9:	0f b6 06             	movzbl (%esi),%eax
+ 5cc:	84 c0                	test   %al,%al
+ 5ce:	75 e0                	jne    5b0 <printf+0x130>
+      state = 0;
+ 5d0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5d3:	31 db                	xor    %ebx,%ebx
+ 5d5:	e9 ee fe ff ff       	jmp    4c8 <printf+0x48>
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5e0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 5e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5e8:	8b 13                	mov    (%ebx),%edx
+ 5ea:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 5f1:	e9 73 ff ff ff       	jmp    569 <printf+0xe9>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 600:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 603:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 608:	8b 10                	mov    (%eax),%edx
+ 60a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 60d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 611:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 614:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 618:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 61b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 61f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 621:	89 3c 24             	mov    %edi,(%esp)
+ 624:	e8 aa fc ff ff       	call   2d3 <write>
+        ap++;
+ 629:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 62d:	e9 96 fe ff ff       	jmp    4c8 <printf+0x48>
+ 632:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 638:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 63b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 63e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 643:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 647:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 649:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 64d:	89 3c 24             	mov    %edi,(%esp)
+ 650:	e8 7e fc ff ff       	call   2d3 <write>
+ 655:	e9 6e fe ff ff       	jmp    4c8 <printf+0x48>
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 660:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 662:	b9 68 09 00 00       	mov    $0x968,%ecx
+ 667:	e9 32 ff ff ff       	jmp    59e <printf+0x11e>
+      state = 0;
+ 66c:	31 db                	xor    %ebx,%ebx
+ 66e:	66 90                	xchg   %ax,%ax
+ 670:	e9 53 fe ff ff       	jmp    4c8 <printf+0x48>
+ 675:	66 90                	xchg   %ax,%ax
+ 677:	66 90                	xchg   %ax,%ax
+ 679:	66 90                	xchg   %ax,%ax
+ 67b:	66 90                	xchg   %ax,%ax
+ 67d:	66 90                	xchg   %ax,%ax
+ 67f:	90                   	nop
+
+00000680 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	83 ec 18             	sub    $0x18,%esp
+ 686:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 689:	89 c3                	mov    %eax,%ebx
+ 68b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 68e:	a1 84 0c 00 00       	mov    0xc84,%eax
+ 693:	8b 15 80 0c 00 00    	mov    0xc80,%edx
+ 699:	29 c2                	sub    %eax,%edx
+ 69b:	39 da                	cmp    %ebx,%edx
+ 69d:	72 19                	jb     6b8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 69f:	01 c3                	add    %eax,%ebx
+ 6a1:	89 1d 84 0c 00 00    	mov    %ebx,0xc84
+  return p;
+}
+ 6a7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 6aa:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 6ad:	89 ec                	mov    %ebp,%esp
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 6b8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 6bd:	39 c3                	cmp    %eax,%ebx
+ 6bf:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 6c2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 6c5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 6c7:	e8 6f fc ff ff       	call   33b <sbrk>
+    if(p == (char*)-1)
+ 6cc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 6cf:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 6d1:	74 1d                	je     6f0 <morecore+0x70>
+    if(p != arenaend)
+ 6d3:	39 05 80 0c 00 00    	cmp    %eax,0xc80
+ 6d9:	74 0d                	je     6e8 <morecore+0x68>
+    arenaend = p + grow;
+ 6db:	01 f2                	add    %esi,%edx
+ 6dd:	89 15 80 0c 00 00    	mov    %edx,0xc80
+ 6e3:	eb ba                	jmp    69f <morecore+0x1f>
+ 6e5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 6e8:	a1 84 0c 00 00       	mov    0xc84,%eax
+ 6ed:	eb ec                	jmp    6db <morecore+0x5b>
+ 6ef:	90                   	nop
+      return 0;
+ 6f0:	31 c0                	xor    %eax,%eax
+ 6f2:	eb b3                	jmp    6a7 <morecore+0x27>
+ 6f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+
+00000700 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 709:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 70f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 712:	85 c0                	test   %eax,%eax
+ 714:	74 1e                	je     734 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 716:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 719:	83 fa 08             	cmp    $0x8,%edx
+ 71c:	77 16                	ja     734 <free+0x34>
+  h = (Header*)ap - 1;
+ 71e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 721:	74 25                	je     748 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 723:	8b 3c 95 a0 0c 00 00 	mov    0xca0(,%edx,4),%edi
+ 72a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 72d:	89 0c 95 a0 0c 00 00 	mov    %ecx,0xca0(,%edx,4)
+}
+ 734:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 737:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 73a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 73d:	89 ec                	mov    %ebp,%esp
+ 73f:	5d                   	pop    %ebp
+ 740:	c3                   	ret
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 748:	8b 15 c0 0c 00 00    	mov    0xcc0,%edx
+ 74e:	85 d2                	test   %edx,%edx
+ 750:	74 54                	je     7a6 <free+0xa6>
+ 752:	39 ca                	cmp    %ecx,%edx
+ 754:	73 36                	jae    78c <free+0x8c>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+ 760:	89 d3                	mov    %edx,%ebx
+ 762:	8b 12                	mov    (%edx),%edx
+ 764:	85 d2                	test   %edx,%edx
+ 766:	74 12                	je     77a <free+0x7a>
+ 768:	39 ca                	cmp    %ecx,%edx
+ 76a:	72 f4                	jb     760 <free+0x60>
+  if(p && END(h) == p){
+ 76c:	85 d2                	test   %edx,%edx
+ 76e:	74 0a                	je     77a <free+0x7a>
+ 770:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 773:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 776:	39 fa                	cmp    %edi,%edx
+ 778:	74 4b                	je     7c5 <free+0xc5>
+  h->s.u.next = p;
+ 77a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 77d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 780:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 784:	39 f1                	cmp    %esi,%ecx
+ 786:	74 29                	je     7b1 <free+0xb1>
+    prev->s.u.next = h;
+ 788:	89 0b                	mov    %ecx,(%ebx)
+ 78a:	eb a8                	jmp    734 <free+0x34>
+  if(p && END(h) == p){
+ 78c:	85 d2                	test   %edx,%edx
+ 78e:	74 16                	je     7a6 <free+0xa6>
+ 790:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 793:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 796:	39 f2                	cmp    %esi,%edx
+ 798:	75 0c                	jne    7a6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 79a:	8b 72 04             	mov    0x4(%edx),%esi
+ 79d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 7a1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 7a4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 7a6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 7a9:	89 0d c0 0c 00 00    	mov    %ecx,0xcc0
+ 7af:	eb 83                	jmp    734 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 7b1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 7b4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 7b8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 7bb:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 7be:	89 03                	mov    %eax,(%ebx)
+ 7c0:	e9 6f ff ff ff       	jmp    734 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 7c5:	8b 7a 04             	mov    0x4(%edx),%edi
+ 7c8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 7cc:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 7cf:	8b 12                	mov    (%edx),%edx
+ 7d1:	eb a7                	jmp    77a <free+0x7a>
+ 7d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	53                   	push   %ebx
+ 7e6:	83 ec 2c             	sub    $0x2c,%esp
+ 7e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 7ec:	83 f8 10             	cmp    $0x10,%eax
+ 7ef:	0f 86 52 01 00 00    	jbe    947 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 7f5:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 7f7:	ba 01 00 00 00       	mov    $0x1,%edx
+ 7fc:	eb 0d                	jmp    80b <malloc+0x2b>
+ 7fe:	66 90                	xchg   %ax,%ax
+ 800:	83 c1 05             	add    $0x5,%ecx
+ 803:	89 d6                	mov    %edx,%esi
+ 805:	d3 e6                	shl    %cl,%esi
+ 807:	39 c6                	cmp    %eax,%esi
+ 809:	73 55                	jae    860 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 80b:	89 d9                	mov    %ebx,%ecx
+ 80d:	43                   	inc    %ebx
+ 80e:	83 fb 08             	cmp    $0x8,%ebx
+ 811:	75 ed                	jne    800 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 813:	8d 58 07             	lea    0x7(%eax),%ebx
+ 816:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 819:	39 c3                	cmp    %eax,%ebx
+ 81b:	0f 82 1f 01 00 00    	jb     940 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 821:	a1 c0 0c 00 00       	mov    0xcc0,%eax
+ 826:	85 c0                	test   %eax,%eax
+ 828:	0f 84 ee 00 00 00    	je     91c <malloc+0x13c>
+ 82e:	b9 c0 0c 00 00       	mov    $0xcc0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 833:	8b 50 04             	mov    0x4(%eax),%edx
+ 836:	39 da                	cmp    %ebx,%edx
+ 838:	0f 82 d2 00 00 00    	jb     910 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 83e:	29 da                	sub    %ebx,%edx
+ 840:	83 fa 17             	cmp    $0x17,%edx
+ 843:	0f 87 b7 00 00 00    	ja     900 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 849:	8b 10                	mov    (%eax),%edx
+ 84b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 84d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 853:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 856:	83 c0 08             	add    $0x8,%eax
+}
+ 859:	5b                   	pop    %ebx
+ 85a:	5e                   	pop    %esi
+ 85b:	5f                   	pop    %edi
+ 85c:	5d                   	pop    %ebp
+ 85d:	c3                   	ret
+ 85e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 860:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 862:	8b 04 9d a0 0c 00 00 	mov    0xca0(,%ebx,4),%eax
+ 869:	85 c0                	test   %eax,%eax
+ 86b:	74 23                	je     890 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 86d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 86f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 872:	89 14 9d a0 0c 00 00 	mov    %edx,0xca0(,%ebx,4)
+    h->s.u.cls = cls;
+ 879:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 87c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 87f:	83 c4 2c             	add    $0x2c,%esp
+ 882:	5b                   	pop    %ebx
+ 883:	5e                   	pop    %esi
+ 884:	5f                   	pop    %edi
+ 885:	5d                   	pop    %ebp
+ 886:	c3                   	ret
+ 887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 890:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 893:	31 d2                	xor    %edx,%edx
+ 895:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 89a:	f7 f6                	div    %esi
+ 89c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 89f:	0f af c6             	imul   %esi,%eax
+ 8a2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 8a5:	e8 d6 fd ff ff       	call   680 <morecore>
+ 8aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 8ad:	85 c0                	test   %eax,%eax
+ 8af:	0f 84 8b 00 00 00    	je     940 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 8b5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 8b8:	8b 0c 9d a0 0c 00 00 	mov    0xca0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 8bf:	31 d2                	xor    %edx,%edx
+ 8c1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 8c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 8ca:	eb 06                	jmp    8d2 <malloc+0xf2>
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 8d0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 8d2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 8d4:	42                   	inc    %edx
+ 8d5:	89 c1                	mov    %eax,%ecx
+ 8d7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 8da:	39 d7                	cmp    %edx,%edi
+ 8dc:	75 f2                	jne    8d0 <malloc+0xf0>
+ 8de:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 8e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 8e4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 8e7:	89 04 9d a0 0c 00 00 	mov    %eax,0xca0(,%ebx,4)
+ 8ee:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 8f1:	29 f0                	sub    %esi,%eax
+ 8f3:	01 c2                	add    %eax,%edx
+ 8f5:	89 d0                	mov    %edx,%eax
+ 8f7:	e9 71 ff ff ff       	jmp    86d <malloc+0x8d>
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 900:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 903:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 906:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 908:	89 58 04             	mov    %ebx,0x4(%eax)
+ 90b:	e9 3d ff ff ff       	jmp    84d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 910:	89 c1                	mov    %eax,%ecx
+ 912:	8b 00                	mov    (%eax),%eax
+ 914:	85 c0                	test   %eax,%eax
+ 916:	0f 85 17 ff ff ff    	jne    833 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 91c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 91f:	74 1f                	je     940 <malloc+0x160>
+ 921:	8d 43 08             	lea    0x8(%ebx),%eax
+ 924:	e8 57 fd ff ff       	call   680 <morecore>
+ 929:	85 c0                	test   %eax,%eax
+ 92b:	74 13                	je     940 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 92d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ 933:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ 936:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ 939:	e9 41 ff ff ff       	jmp    87f <malloc+0x9f>
+ 93e:	66 90                	xchg   %ax,%ax
+      return 0;
+ 940:	31 c0                	xor    %eax,%eax
+ 942:	e9 38 ff ff ff       	jmp    87f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 947:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ 94c:	31 db                	xor    %ebx,%ebx
+ 94e:	e9 0f ff ff ff       	jmp    862 <malloc+0x82>
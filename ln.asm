@@ -0,0 +1,1382 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	83 ec 10             	sub    $0x10,%esp
+  if(argc != 3){
+   a:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+{
+   e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(argc != 3){
+  11:	74 1e                	je     31 <main+0x31>
+    printf(2, "Usage: ln old new\n");
+  13:	c7 44 24 04 64 09 00 	movl   $0x964,0x4(%esp)
+  1a:	00 
+  1b:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  22:	e8 69 04 00 00       	call   490 <printf>
+    exit(0);
+  27:	31 d2                	xor    %edx,%edx
+  29:	89 14 24             	mov    %edx,(%esp)
+  2c:	e8 92 02 00 00       	call   2c3 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  31:	8b 43 08             	mov    0x8(%ebx),%eax
+  34:	89 44 24 04          	mov    %eax,0x4(%esp)
+  38:	8b 43 04             	mov    0x4(%ebx),%eax
+  3b:	89 04 24             	mov    %eax,(%esp)
+  3e:	e8 e0 02 00 00       	call   323 <link>
+  43:	85 c0                	test   %eax,%eax
+  45:	78 0a                	js     51 <main+0x51>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit(0);
+  47:	31 c0                	xor    %eax,%eax
+  49:	89 04 24             	mov    %eax,(%esp)
+  4c:	e8 72 02 00 00       	call   2c3 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  51:	8b 43 08             	mov    0x8(%ebx),%eax
+  54:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  58:	8b 43 04             	mov    0x4(%ebx),%eax
+  5b:	c7 44 24 04 77 09 00 	movl   $0x977,0x4(%esp)
+  62:	00 
+  63:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  6a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  6e:	e8 1d 04 00 00       	call   490 <printf>
+  73:	eb d2                	jmp    47 <main+0x47>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	40                   	inc    %eax
+  98:	84 d2                	test   %dl,%dl
+  9a:	75 f4                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9c:	5b                   	pop    %ebx
+  9d:	89 c8                	mov    %ecx,%eax
+  9f:	5d                   	pop    %ebp
+  a0:	c3                   	ret
+  a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  af:	90                   	nop
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 15                	jne    d6 <strcmp+0x26>
+  c1:	eb 30                	jmp    f3 <strcmp+0x43>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  cf:	42                   	inc    %edx
+  while(*p && *p == *q)
+  d0:	84 c0                	test   %al,%al
+  d2:	74 14                	je     e8 <strcmp+0x38>
+    p++, q++;
+  d4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+  d6:	0f b6 0b             	movzbl (%ebx),%ecx
+  d9:	38 c1                	cmp    %al,%cl
+  db:	74 eb                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+  dd:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+  de:	29 c8                	sub    %ecx,%eax
+}
+  e0:	5d                   	pop    %ebp
+  e1:	c3                   	ret
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+  ec:	31 c0                	xor    %eax,%eax
+}
+  ee:	5b                   	pop    %ebx
+  ef:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+  f0:	29 c8                	sub    %ecx,%eax
+}
+  f2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  f3:	0f b6 0b             	movzbl (%ebx),%ecx
+  f6:	31 c0                	xor    %eax,%eax
+  f8:	eb e3                	jmp    dd <strcmp+0x2d>
+  fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	40                   	inc    %eax
+ 111:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 115:	89 c1                	mov    %eax,%ecx
+ 117:	75 f7                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 119:	5d                   	pop    %ebp
+ 11a:	89 c8                	mov    %ecx,%eax
+ 11c:	c3                   	ret
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 121:	31 c9                	xor    %ecx,%ecx
+}
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	5f                   	pop    %edi
+ 143:	89 d0                	mov    %edx,%eax
+ 145:	5d                   	pop    %ebp
+ 146:	c3                   	ret
+ 147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14e:	66 90                	xchg   %ax,%ax
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 10                	jne    171 <strchr+0x21>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	40                   	inc    %eax
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	74 0f                	je     180 <strchr+0x30>
+    if(*s == c)
+ 171:	38 d1                	cmp    %dl,%cl
+ 173:	75 f3                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 175:	5d                   	pop    %ebp
+ 176:	c3                   	ret
+ 177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17e:	66 90                	xchg   %ax,%ax
+ 180:	5d                   	pop    %ebp
+  return 0;
+ 181:	31 c0                	xor    %eax,%eax
+}
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 195:	31 f6                	xor    %esi,%esi
+{
+ 197:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 198:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 19b:	83 ec 3c             	sub    $0x3c,%esp
+ 19e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 1a1:	eb 32                	jmp    1d5 <gets+0x45>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+    cc = read(0, &c, 1);
+ 1a8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 1ac:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1b1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 1b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 1bc:	e8 1a 01 00 00       	call   2db <read>
+    if(cc < 1)
+ 1c1:	85 c0                	test   %eax,%eax
+ 1c3:	7e 19                	jle    1de <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 1c5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1cd:	3c 0a                	cmp    $0xa,%al
+ 1cf:	74 10                	je     1e1 <gets+0x51>
+ 1d1:	3c 0d                	cmp    $0xd,%al
+ 1d3:	74 0c                	je     1e1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 1d5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 1d8:	46                   	inc    %esi
+ 1d9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 1dc:	7c ca                	jl     1a8 <gets+0x18>
+ 1de:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1e1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 1e5:	83 c4 3c             	add    $0x3c,%esp
+ 1e8:	89 d8                	mov    %ebx,%eax
+ 1ea:	5b                   	pop    %ebx
+ 1eb:	5e                   	pop    %esi
+ 1ec:	5f                   	pop    %edi
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+ 1ef:	90                   	nop
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	83 ec 18             	sub    $0x18,%esp
+ 1f8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 1fb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 1fe:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 202:	8b 45 08             	mov    0x8(%ebp),%eax
+ 205:	89 04 24             	mov    %eax,(%esp)
+ 208:	e8 f6 00 00 00       	call   303 <open>
+  if(fd < 0)
+ 20d:	85 c0                	test   %eax,%eax
+ 20f:	78 2f                	js     240 <stat+0x50>
+ 211:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 213:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 216:	89 1c 24             	mov    %ebx,(%esp)
+ 219:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 21d:	e8 f9 00 00 00       	call   31b <fstat>
+  close(fd);
+ 222:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 225:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 227:	e8 bf 00 00 00       	call   2eb <close>
+  return r;
+}
+ 22c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 22f:	89 f0                	mov    %esi,%eax
+ 231:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 234:	89 ec                	mov    %ebp,%esp
+ 236:	5d                   	pop    %ebp
+ 237:	c3                   	ret
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb e5                	jmp    22c <stat+0x3c>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	88 c1                	mov    %al,%cl
+ 25c:	80 e9 30             	sub    $0x30,%cl
+ 25f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 262:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 267:	77 1c                	ja     285 <atoi+0x35>
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 270:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 273:	42                   	inc    %edx
+ 274:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 278:	0f be 02             	movsbl (%edx),%eax
+ 27b:	88 c3                	mov    %al,%bl
+ 27d:	80 eb 30             	sub    $0x30,%bl
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	5b                   	pop    %ebx
+ 286:	89 c8                	mov    %ecx,%eax
+ 288:	5d                   	pop    %ebp
+ 289:	c3                   	ret
+ 28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+
+000002bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <exit>:
+SYSCALL(exit)
+ 2c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <wait>:
+SYSCALL(wait)
+ 2cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <pipe>:
+SYSCALL(pipe)
+ 2d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <read>:
+SYSCALL(read)
+ 2db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <write>:
+SYSCALL(write)
+ 2e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <close>:
+SYSCALL(close)
+ 2eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <kill>:
+SYSCALL(kill)
+ 2f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <exec>:
+SYSCALL(exec)
+ 2fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <open>:
+SYSCALL(open)
+ 303:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mknod>:
+SYSCALL(mknod)
+ 30b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <unlink>:
+SYSCALL(unlink)
+ 313:	b8 12 00 00 00       	mov    $0x12,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <fstat>:
+SYSCALL(fstat)
+ 31b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <link>:
+SYSCALL(link)
+ 323:	b8 13 00 00 00       	mov    $0x13,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mkdir>:
+SYSCALL(mkdir)
+ 32b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <chdir>:
+SYSCALL(chdir)
+ 333:	b8 09 00 00 00       	mov    $0x9,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <dup>:
+SYSCALL(dup)
+ 33b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <getpid>:
+SYSCALL(getpid)
+ 343:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <sbrk>:
+SYSCALL(sbrk)
+ 34b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <sleep>:
+SYSCALL(sleep)
+ 353:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <uptime>:
+SYSCALL(uptime)
+ 35b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <detach>:
+SYSCALL(detach)
+ 363:	b8 16 00 00 00       	mov    $0x16,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <policy>:
+SYSCALL(policy)
+ 36b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <priority>:
+SYSCALL(priority)
+ 373:	b8 18 00 00 00       	mov    $0x18,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <wait_stat>:
+SYSCALL(wait_stat)
+ 37b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <lockstat>:
+SYSCALL(lockstat)
+ 383:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mmap>:
+SYSCALL(mmap)
+ 38b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <munmap>:
+SYSCALL(munmap)
+ 393:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <shmget>:
+SYSCALL(shmget)
+ 39b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <shmat>:
+SYSCALL(shmat)
+ 3a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <shmdt>:
+SYSCALL(shmdt)
+ 3ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <memstat>:
+SYSCALL(memstat)
+ 3b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getprocs>:
+SYSCALL(getprocs)
+ 3bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <shmctl>:
+SYSCALL(shmctl)
+ 3c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+ 3cb:	66 90                	xchg   %ax,%ax
+ 3cd:	66 90                	xchg   %ax,%ax
+ 3cf:	90                   	nop
+
+000003d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	89 cb                	mov    %ecx,%ebx
+ 3d8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3db:	89 d1                	mov    %edx,%ecx
+{
+ 3dd:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 3e0:	89 d0                	mov    %edx,%eax
+ 3e2:	c1 e8 1f             	shr    $0x1f,%eax
+ 3e5:	84 c0                	test   %al,%al
+ 3e7:	0f 84 93 00 00 00    	je     480 <printint+0xb0>
+ 3ed:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3f1:	0f 84 89 00 00 00    	je     480 <printint+0xb0>
+    x = -xx;
+ 3f7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3fe:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 405:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 408:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 410:	89 c8                	mov    %ecx,%eax
+ 412:	31 d2                	xor    %edx,%edx
+ 414:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 417:	f7 f3                	div    %ebx
+ 419:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 41c:	0f b6 92 ec 09 00 00 	movzbl 0x9ec(%edx),%edx
+ 423:	8d 47 01             	lea    0x1(%edi),%eax
+ 426:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 429:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 42d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 42f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 432:	39 da                	cmp    %ebx,%edx
+ 434:	73 da                	jae    410 <printint+0x40>
+  if(neg)
+ 436:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 439:	85 c0                	test   %eax,%eax
+ 43b:	74 0a                	je     447 <printint+0x77>
+    buf[i++] = '-';
+ 43d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 440:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 445:	89 c7                	mov    %eax,%edi
+ 447:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 44a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 44e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 450:	0f b6 07             	movzbl (%edi),%eax
+ 453:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 456:	b8 01 00 00 00       	mov    $0x1,%eax
+ 45b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 45f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 463:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 466:	89 04 24             	mov    %eax,(%esp)
+ 469:	e8 75 fe ff ff       	call   2e3 <write>
+  while(--i >= 0)
+ 46e:	89 f8                	mov    %edi,%eax
+ 470:	4f                   	dec    %edi
+ 471:	39 d8                	cmp    %ebx,%eax
+ 473:	75 db                	jne    450 <printint+0x80>
+}
+ 475:	83 c4 4c             	add    $0x4c,%esp
+ 478:	5b                   	pop    %ebx
+ 479:	5e                   	pop    %esi
+ 47a:	5f                   	pop    %edi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 480:	31 c0                	xor    %eax,%eax
+ 482:	e9 77 ff ff ff       	jmp    3fe <printint+0x2e>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 499:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 49c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 49f:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a2:	84 db                	test   %bl,%bl
+ 4a4:	74 6f                	je     515 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 4a6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 4a9:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 4ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 4ae:	88 d9                	mov    %bl,%cl
+ 4b0:	46                   	inc    %esi
+ 4b1:	89 d3                	mov    %edx,%ebx
+ 4b3:	eb 2b                	jmp    4e0 <printf+0x50>
+ 4b5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 4b8:	83 f8 25             	cmp    $0x25,%eax
+ 4bb:	74 4b                	je     508 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4bd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4c9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4cc:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 4d0:	89 3c 24             	mov    %edi,(%esp)
+ 4d3:	e8 0b fe ff ff       	call   2e3 <write>
+  for(i = 0; fmt[i]; i++){
+ 4d8:	0f b6 0e             	movzbl (%esi),%ecx
+ 4db:	46                   	inc    %esi
+ 4dc:	84 c9                	test   %cl,%cl
+ 4de:	74 35                	je     515 <printf+0x85>
+    if(state == 0){
+ 4e0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 4e2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 4e5:	74 d1                	je     4b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4e7:	83 fb 25             	cmp    $0x25,%ebx
+ 4ea:	75 ec                	jne    4d8 <printf+0x48>
+      if(c == 'd'){
+ 4ec:	83 f8 25             	cmp    $0x25,%eax
+ 4ef:	0f 84 53 01 00 00    	je     648 <printf+0x1b8>
+ 4f5:	83 e8 63             	sub    $0x63,%eax
+ 4f8:	83 f8 15             	cmp    $0x15,%eax
+ 4fb:	77 23                	ja     520 <printf+0x90>
+ 4fd:	ff 24 85 94 09 00 00 	jmp    *0x994(,%eax,4)
+ 504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 508:	0f b6 0e             	movzbl (%esi),%ecx
+ 50b:	46                   	inc    %esi
+        state = '%';
+ 50c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 511:	84 c9                	test   %cl,%cl
+ 513:	75 cb                	jne    4e0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 515:	83 c4 3c             	add    $0x3c,%esp
+ 518:	5b                   	pop    %ebx
+ 519:	5e                   	pop    %esi
+ 51a:	5f                   	pop    %edi
+ 51b:	5d                   	pop    %ebp
+ 51c:	c3                   	ret
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+ 520:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 523:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 526:	b8 01 00 00 00       	mov    $0x1,%eax
+ 52b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 52f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 533:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 537:	89 3c 24             	mov    %edi,(%esp)
+ 53a:	e8 a4 fd ff ff       	call   2e3 <write>
+        putc(fd, c);
+ 53f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 543:	ba 01 00 00 00       	mov    $0x1,%edx
+ 548:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 54b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 54f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 551:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 555:	89 3c 24             	mov    %edi,(%esp)
+ 558:	e8 86 fd ff ff       	call   2e3 <write>
+ 55d:	e9 76 ff ff ff       	jmp    4d8 <printf+0x48>
+ 562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 568:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 56b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 570:	8b 13                	mov    (%ebx),%edx
+ 572:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 579:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 57c:	89 f8                	mov    %edi,%eax
+ 57e:	e8 4d fe ff ff       	call   3d0 <printint>
+        ap++;
+ 583:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 586:	31 db                	xor    %ebx,%ebx
+ 588:	e9 4b ff ff ff       	jmp    4d8 <printf+0x48>
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 590:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 593:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 595:	83 c0 04             	add    $0x4,%eax
+ 598:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 59b:	85 c9                	test   %ecx,%ecx
+ 59d:	0f 84 cd 00 00 00    	je     670 <printf+0x1e0>
+        while(*s != 0){
+ 5a3:	0f b6 01             	movzbl (%ecx),%eax
+ 5a6:	84 c0                	test   %al,%al
+ 5a8:	0f 84 ce 00 00 00    	je     67c <printf+0x1ec>
+ 5ae:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5b1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5b4:	89 ce                	mov    %ecx,%esi
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 5c0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 5c8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 5c9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 5cd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 5d1:	89 3c 24             	mov    %edi,(%esp)
+ 5d4:	e8 0a fd ff ff       	call   2e3 <write>
+        while(*s != 0){
+ 5d9:	0f b6 06             	movzbl (%esi),%eax
+ 5dc:	84 c0                	test   %al,%al
+ 5de:	75 e0                	jne    5c0 <printf+0x130>
+      state = 0;
+ 5e0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5e3:	31 db                	xor    %ebx,%ebx
+ 5e5:	e9 ee fe ff ff       	jmp    4d8 <printf+0x48>
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5f0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 5f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5f8:	8b 13                	mov    (%ebx),%edx
+ 5fa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 601:	e9 73 ff ff ff       	jmp    579 <printf+0xe9>
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 610:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 613:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 618:	8b 10                	mov    (%eax),%edx
+ 61a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 61d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 621:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 624:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 628:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 62b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 62f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 631:	89 3c 24             	mov    %edi,(%esp)
+ 634:	e8 aa fc ff ff       	call   2e3 <write>
+        ap++;
+ 639:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 63d:	e9 96 fe ff ff       	jmp    4d8 <printf+0x48>
+ 642:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 648:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 64b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 64e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 653:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 657:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 659:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 65d:	89 3c 24             	mov    %edi,(%esp)
+ 660:	e8 7e fc ff ff       	call   2e3 <write>
+ 665:	e9 6e fe ff ff       	jmp    4d8 <printf+0x48>
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 670:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 672:	b9 8b 09 00 00       	mov    $0x98b,%ecx
+ 677:	e9 32 ff ff ff       	jmp    5ae <printf+0x11e>
+      state = 0;
+ 67c:	31 db                	xor    %ebx,%ebx
+ 67e:	66 90                	xchg   %ax,%ax
+ 680:	e9 53 fe ff ff       	jmp    4d8 <printf+0x48>
+ 685:	66 90                	xchg   %ax,%ax
+ 687:	66 90                	xchg   %ax,%ax
+ 689:	66 90                	xchg   %ax,%ax
+ 68b:	66 90                	xchg   %ax,%ax
+ 68d:	66 90                	xchg   %ax,%ax
+ 68f:	90                   	nop
+
+00000690 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	83 ec 18             	sub    $0x18,%esp
+ 696:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 699:	89 c3                	mov    %eax,%ebx
+ 69b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 69e:	a1 a4 0c 00 00       	mov    0xca4,%eax
+ 6a3:	8b 15 a0 0c 00 00    	mov    0xca0,%edx
+ 6a9:	29 c2                	sub    %eax,%edx
+ 6ab:	39 da                	cmp    %ebx,%edx
+ 6ad:	72 19                	jb     6c8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 6af:	01 c3                	add    %eax,%ebx
+ 6b1:	89 1d a4 0c 00 00    	mov    %ebx,0xca4
+  return p;
+}
+ 6b7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 6ba:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 6bd:	89 ec                	mov    %ebp,%esp
+ 6bf:	5d                   	pop    %ebp
+ 6c0:	c3                   	ret
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 6c8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 6cd:	39 c3                	cmp    %eax,%ebx
+ 6cf:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 6d2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 6d5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 6d7:	e8 6f fc ff ff       	call   34b <sbrk>
+    if(p == (char*)-1)
+ 6dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 6df:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 6e1:	74 1d                	je     700 <morecore+0x70>
+    if(p != arenaend)
+ 6e3:	39 05 a0 0c 00 00    	cmp    %eax,0xca0
+ 6e9:	74 0d                	je     6f8 <morecore+0x68>
+    arenaend = p + grow;
+ 6eb:	01 f2                	add    %esi,%edx
+ 6ed:	89 15 a0 0c 00 00    	mov    %edx,0xca0
+ 6f3:	eb ba                	jmp    6af <morecore+0x1f>
+ 6f5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 6f8:	a1 a4 0c 00 00       	mov    0xca4,%eax
+ 6fd:	eb ec                	jmp    6eb <morecore+0x5b>
+ 6ff:	90                   	nop
+      return 0;
+ 700:	31 c0                	xor    %eax,%eax
+ 702:	eb b3                	jmp    6b7 <morecore+0x27>
+ 704:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+
+00000710 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 719:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 71f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 722:	85 c0                	test   %eax,%eax
+ 724:	74 1e                	je     744 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 726:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 729:	83 fa 08             	cmp    $0x8,%edx
+ 72c:	77 16                	ja     744 <free+0x34>
+  h = (Header*)ap - 1;
+ 72e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 731:	74 25                	je     758 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 733:	8b 3c 95 c0 0c 00 00 	mov    0xcc0(,%edx,4),%edi
+ 73a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 73d:	89 0c 95 c0 0c 00 00 	mov    %ecx,0xcc0(,%edx,4)
+}
+ 744:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 747:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 74a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 74d:	89 ec                	mov    %ebp,%esp
+ 74f:	5d                   	pop    %ebp
+ 750:	c3                   	ret
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 758:	8b 15 e0 0c 00 00    	mov    0xce0,%edx
+ 75e:	85 d2                	test   %edx,%edx
+ 760:	74 54                	je     7b6 <free+0xa6>
+ 762:	39 ca                	cmp    %ecx,%edx
+ 764:	73 36                	jae    79c <free+0x8c>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+ 770:	89 d3                	mov    %edx,%ebx
+ 772:	8b 12                	mov    (%edx),%edx
+ 774:	85 d2                	test   %edx,%edx
+ 776:	74 12                	je     78a <free+0x7a>
+ 778:	39 ca                	cmp    %ecx,%edx
+ 77a:	72 f4                	jb     770 <free+0x60>
+  if(p && END(h) == p){
+ 77c:	85 d2                	test   %edx,%edx
+ 77e:	74 0a                	je     78a <free+0x7a>
+ 780:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 783:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 786:	39 fa                	cmp    %edi,%edx
+ 788:	74 4b                	je     7d5 <free+0xc5>
+  h->s.u.next = p;
+ 78a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 78d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 790:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 794:	39 f1                	cmp    %esi,%ecx
+ 796:	74 29                	je     7c1 <free+0xb1>
+    prev->s.u.next = h;
+ 798:	89 0b                	mov    %ecx,(%ebx)
+ 79a:	eb a8                	jmp    744 <free+0x34>
+  if(p && END(h) == p){
+ 79c:	85 d2                	test   %edx,%edx
+ 79e:	74 16                	je     7b6 <free+0xa6>
+ 7a0:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 7a3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 7a6:	39 f2                	cmp    %esi,%edx
+ 7a8:	75 0c                	jne    7b6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 7aa:	8b 72 04             	mov    0x4(%edx),%esi
+ 7ad:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 7b1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 7b4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 7b6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 7b9:	89 0d e0 0c 00 00    	mov    %ecx,0xce0
+ 7bf:	eb 83                	jmp    744 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 7c1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 7c4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 7c8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 7cb:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 7ce:	89 03                	mov    %eax,(%ebx)
+ 7d0:	e9 6f ff ff ff       	jmp    744 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 7d5:	8b 7a 04             	mov    0x4(%edx),%edi
+ 7d8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 7dc:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 7df:	8b 12                	mov    (%edx),%edx
+ 7e1:	eb a7                	jmp    78a <free+0x7a>
+ 7e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 2c             	sub    $0x2c,%esp
+ 7f9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 7fc:	83 f8 10             	cmp    $0x10,%eax
+ 7ff:	0f 86 52 01 00 00    	jbe    957 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 805:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 807:	ba 01 00 00 00       	mov    $0x1,%edx
+ 80c:	eb 0d                	jmp    81b <malloc+0x2b>
+ 80e:	66 90                	xchg   %ax,%ax
+ 810:	83 c1 05             	add    $0x5,%ecx
+ 813:	89 d6                	mov    %edx,%esi
+ 815:	d3 e6                	shl    %cl,%esi
+ 817:	39 c6                	cmp    %eax,%esi
+ 819:	73 55                	jae    870 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 81b:	89 d9                	mov    %ebx,%ecx
+ 81d:	43                   	inc    %ebx
+ 81e:	83 fb 08             	cmp    $0x8,%ebx
+ 821:	75 ed                	jne    810 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 823:	8d 58 07             	lea    0x7(%eax),%ebx
+ 826:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 829:	39 c3                	cmp    %eax,%ebx
+ 82b:	0f 82 1f 01 00 00    	jb     950 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 831:	a1 e0 0c 00 00       	mov    0xce0,%eax
+ 836:	85 c0                	test   %eax,%eax
+ 838:	0f 84 ee 00 00 00    	je     92c <malloc+0x13c>
+ 83e:	b9 e0 0c 00 00       	mov    $0xce0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 843:	8b 50 04             	mov    0x4(%eax),%edx
+ 846:	39 da                	cmp    %ebx,%edx
+ 848:	0f 82 d2 00 00 00    	jb     920 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 84e:	29 da                	sub    %ebx,%edx
+ 850:	83 fa 17             	cmp    $0x17,%edx
+ 853:	0f 87 b7 00 00 00    	ja     910 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 859:	8b 10                	mov    (%eax),%edx
+ 85b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 85d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 863:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 866:	83 c0 08             	add    $0x8,%eax
+}
+ 869:	5b                   	pop    %ebx
+ 86a:	5e                   	pop    %esi
+ 86b:	5f                   	pop    %edi
+ 86c:	5d                   	pop    %ebp
+ 86d:	c3                   	ret
+ 86e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 870:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 872:	8b 04 9d c0 0c 00 00 	mov    0xcc0(,%ebx,4),%eax
+ 879:	85 c0                	test   %eax,%eax
+ 87b:	74 23                	je     8a0 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 87d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 87f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 882:	89 14 9d c0 0c 00 00 	mov    %edx,0xcc0(,%ebx,4)
+    h->s.u.cls = cls;
+ 889:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 88c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 88f:	83 c4 2c             	add    $0x2c,%esp
+ 892:	5b                   	pop    %ebx
+ 893:	5e                   	pop    %esi
+ 894:	5f                   	pop    %edi
+ 895:	5d                   	pop    %ebp
+ 896:	c3                   	ret
+ 897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 8a0:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 8a3:	31 d2                	xor    %edx,%edx
+ 8a5:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 8aa:	f7 f6                	div    %esi
+ 8ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 8af:	0f af c6             	imul   %esi,%eax
+ 8b2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 8b5:	e8 d6 fd ff ff       	call   690 <morecore>
+ 8ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 8bd:	85 c0                	test   %eax,%eax
+ 8bf:	0f 84 8b 00 00 00    	je     950 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 8c5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 8c8:	8b 0c 9d c0 0c 00 00 	mov    0xcc0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 8d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8d7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 8da:	eb 06                	jmp    8e2 <malloc+0xf2>
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 8e0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 8e2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 8e4:	42                   	inc    %edx
+ 8e5:	89 c1                	mov    %eax,%ecx
+ 8e7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 8ea:	39 d7                	cmp    %edx,%edi
+ 8ec:	75 f2                	jne    8e0 <malloc+0xf0>
+ 8ee:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 8f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 8f4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 8f7:	89 04 9d c0 0c 00 00 	mov    %eax,0xcc0(,%ebx,4)
+ 8fe:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 901:	29 f0                	sub    %esi,%eax
+ 903:	01 c2                	add    %eax,%edx
+ 905:	89 d0                	mov    %edx,%eax
+ 907:	e9 71 ff ff ff       	jmp    87d <malloc+0x8d>
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 910:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 913:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 916:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 918:	89 58 04             	mov    %ebx,0x4(%eax)
+ 91b:	e9 3d ff ff ff       	jmp    85d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 920:	89 c1                	mov    %eax,%ecx
+ 922:	8b 00                	mov    (%eax),%eax
+ 924:	85 c0                	test   %eax,%eax
+ 926:	0f 85 17 ff ff ff    	jne    843 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 92c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 92f:	74 1f                	je     950 <malloc+0x160>
+ 931:	8d 43 08             	lea    0x8(%ebx),%eax
+ 934:	e8 57 fd ff ff       	call   690 <morecore>
+ 939:	85 c0                	test   %eax,%eax
+ 93b:	74 13                	je     950 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 93d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ 943:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ 946:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ 949:	e9 41 ff ff ff       	jmp    88f <malloc+0x9f>
+ 94e:	66 90                	xchg   %ax,%ax
+      return 0;
+ 950:	31 c0                	xor    %eax,%eax
+ 952:	e9 38 ff ff ff       	jmp    88f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 957:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ 95c:	31 db                	xor    %ebx,%ebx
+ 95e:	e9 0f ff ff ff       	jmp    872 <malloc+0x82>
@@ -0,0 +1,18 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Print per-lock contention statistics to the console.
+// With -r, clear the counters after printing them.
+int
+main(int argc, char *argv[])
+{
+  int reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if(lockstat(reset) < 0){
+    printf(2, "lockstat: failed\n");
+    exit(1);
+  }
+  exit(0);
+}
@@ -5,6 +5,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "mmu.h"
+#include "proc.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -19,6 +21,12 @@
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
 // sleeps until the last outstanding end_op() commits.
+// begin_op() reserves log space for the worst case,
+// MAXOPBLOCKS; a call that knows it writes fewer blocks
+// reserves just those with begin_opn().
+//
+// The size of the log is set by mkfs in the superblock, up to
+// LOGSIZE data blocks (what the header block can describe).
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -27,7 +35,32 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Log appends are synchronous, but the blocks of a commit are
+// handed to the disk LOGBATCH at a time, so they can be merged.
+//
+// Committed transactions are appended to the log one after the
+// other, and the header covers all of them. Their blocks stay
+// pinned in the buffer cache and are only installed at their
+// home locations (a checkpoint) when the log is nearly full, so
+// a commit costs just the log blocks and one header write.
+// There are no kernel threads to checkpoint in the background:
+// the end_op() whose commit finds the log nearly full installs
+// the whole log itself, up to LOGSIZE blocks, while begin_op()
+// waits.
+// The cache never shrinks below NBUF buffers, more than the
+// log can pin, so pinned blocks cannot starve bget().
+// A block is absorbed only into the open transaction's part of
+// the log; if a committed transaction also has it, recovery
+// installs the log in order and the later copy wins.
+//
+// While a commit writes the log, the next transaction can
+// already start: commit() first copies the transaction's blocks
+// aside (with no FS system calls active), then reopens
+// begin_op() before doing the disk writes. Commits themselves
+// still go one at a time.
+
+#define LOGBATCH 8
+#define NSNAP    ((LOGSIZE*BSIZE + PGSIZE-1) / PGSIZE)
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -40,20 +73,27 @@ struct log {
   struct spinlock lock;
   int start;
   int size;
+  int cap;         // data blocks in the log, at most LOGSIZE.
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // log blocks they have reserved.
   int committing;  // in commit(), please wait.
+  int flushing;    // a commit is writing the log.
+  int txstart;     // lh.block[txstart..lh.n) is the open transaction.
   int dev;
   struct logheader lh;
 };
 struct log log;
 
+// Copy of the transaction being written to the log, in pages.
+static char *snap[NSNAP];
+
 static void recover_from_log(void);
 static void commit();
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
+  if (sizeof(struct logheader) > BSIZE)
     panic("initlog: too big logheader");
 
   struct superblock sb;
@@ -61,23 +101,41 @@ initlog(int dev)
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
+  log.cap = log.size - 1 < LOGSIZE ? log.size - 1 : LOGSIZE;
+  if (log.cap < MAXOPBLOCKS)
+    panic("initlog: log too small");
   log.dev = dev;
   recover_from_log();
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location.
+// If not recovering, the buffer cache already holds the
+// committed contents. A block logged more than once is
+// only written from its last copy.
 static void
-install_trans(void)
+install_trans(int recovering)
 {
-  int tail;
+  struct buf *dbufs[LOGBATCH];
+  int tail, i, n;
 
+  n = 0;
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+    for (i = tail+1; i < log.lh.n; i++)
+      if (log.lh.block[i] == log.lh.block[tail])
+        break;
+    if (i == log.lh.n) {
+      struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+      if (recovering) {
+        struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+        memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+        brelse(lbuf);
+      }
+      dbufs[n++] = dbuf;
+    }
+    if(n == LOGBATCH || (n > 0 && tail == log.lh.n - 1)){
+      bwritev(dbufs, n);  // write dsts to disk
+      n = 0;
+    }
   }
 }
 
@@ -95,17 +153,17 @@ read_head(void)
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
+// Write the first n entries of the in-memory log header to disk.
 // This is the true point at which the
-// current transaction commits.
+// transactions they cover commit.
 static void
-write_head(void)
+write_head(int n)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
+  hb->n = n;
+  for (i = 0; i < n; i++) {
     hb->block[i] = log.lh.block[i];
   }
   bwrite(buf);
@@ -116,30 +174,44 @@ static void
 recover_from_log(void)
 {
   read_head();
-  install_trans(); // if committed, copy from log to disk
+  install_trans(1); // if committed, copy from log to disk
   log.lh.n = 0;
-  write_head(); // clear the log
+  log.txstart = 0;
+  write_head(0); // clear the log
 }
 
-// called at the start of each FS system call.
+// called at the start of each FS system call that writes
+// at most n blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n < 1 || n > MAXOPBLOCKS)
+    panic("begin_opn");
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.reserved + n > log.cap){
       // this op might exhaust log space; wait for commit.
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
+      myproc()->logres = n;
+      myproc()->logused = 0;
       release(&log.lock);
       break;
     }
   }
 }
 
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
 // called at the end of each FS system call.
 // commits if this was the last outstanding operation.
 void
@@ -149,9 +221,16 @@ end_op(void)
 
   acquire(&log.lock);
   log.outstanding -= 1;
+  log.reserved -= myproc()->logres;
+  myproc()->logres = 0;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
+  // Only one commit at a time: wait for the one in flight.
+  // New operations may start meanwhile, and the last of
+  // them to end commits instead.
+  while(log.outstanding == 0 && log.flushing)
+    sleep(&log, &log.lock);
+  if(log.outstanding == 0 && !log.committing){
     do_commit = 1;
     log.committing = 1;
   } else {
@@ -166,39 +245,107 @@ end_op(void)
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Copy the blocks lh.block[start..end) from the cache to the log.
+// If copied is set, take their contents from snap instead.
 static void
-write_log(void)
+write_log(int start, int end, int copied)
 {
-  int tail;
+  struct buf *tos[LOGBATCH];
+  int tail, n, off;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+  n = 0;
+  for (tail = start; tail < end; tail++) {
+    struct buf *to = bclaim(log.dev, log.start+tail+1); // log block
+    if (copied) {
+      off = (tail - start) * BSIZE;
+      memmove(to->data, snap[off / PGSIZE] + off % PGSIZE, BSIZE);
+    } else {
+      struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+      memmove(to->data, from->data, BSIZE);
+      brelse(from);
+    }
+    tos[n++] = to;
+    if(n == LOGBATCH || tail == end - 1){
+      bwritev(tos, n);  // write the log
+      n = 0;
+    }
+  }
+}
+
+// Copy the blocks lh.block[start..end) from the cache to snap.
+// Returns 0 if there isn't the memory to.
+static int
+snapshot(int start, int end)
+{
+  int tail, off, i;
+
+  for (tail = start; tail < end; tail++) {
+    off = (tail - start) * BSIZE;
+    if (off % PGSIZE == 0 && (snap[off / PGSIZE] = kalloc()) == 0) {
+      for (i = 0; i < off / PGSIZE; i++)
+        kfree(snap[i]);
+      return 0;
+    }
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    memmove(snap[off / PGSIZE] + off % PGSIZE, from->data, BSIZE);
     brelse(from);
-    brelse(to);
   }
+  return 1;
 }
 
+// Commit the open transaction. Called with log.committing set,
+// no FS system calls active and no other commit in flight.
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int start, end, i;
+
+  start = log.txstart;
+  end = log.lh.n;
+  if (end + MAXOPBLOCKS > log.cap || !snapshot(start, end)) {
+    // The log is nearly full (or memory is short): commit and
+    // checkpoint here, in the caller's end_op(), with begin_op()
+    // held off so that the cache holds exactly the committed
+    // contents.
+    if (end > start) {
+      write_log(start, end, 0); // Write modified blocks from cache to log
+      write_head(end);          // Write header to disk -- the real commit
+    }
+    if (end > 0) {
+      install_trans(0);         // Now install writes to home locations
+      log.lh.n = 0;
+      write_head(0);            // Erase the transactions from the log
+    }
+    acquire(&log.lock);
+    log.txstart = 0;
+    log.committing = 0;
+    wakeup(&log);
+    release(&log.lock);
+    return;
+  }
+
+  // Let the next transaction start while this one is written.
+  acquire(&log.lock);
+  log.txstart = end;
+  log.committing = 0;
+  log.flushing = 1;
+  wakeup(&log);
+  release(&log.lock);
+
+  if (end > start) {
+    write_log(start, end, 1); // Write the copied blocks to the log
+    write_head(end);          // Write header to disk -- the real commit
+    for (i = 0; i < (end - start) * BSIZE; i += PGSIZE)
+      kfree(snap[i / PGSIZE]);
   }
+
+  acquire(&log.lock);
+  log.flushing = 0;
+  wakeup(&log);
+  release(&log.lock);
 }
 
 // Caller has modified b->data and is done with the buffer.
@@ -215,19 +362,21 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.cap)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
+  for (i = log.txstart; i < log.lh.n; i++) {
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
     log.lh.n++;
+    myproc()->logused++;
+  }
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
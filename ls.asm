@@ -0,0 +1,1631 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	bb 01 00 00 00       	mov    $0x1,%ebx
+   b:	83 e4 f0             	and    $0xfffffff0,%esp
+   e:	83 ec 10             	sub    $0x10,%esp
+  11:	8b 75 08             	mov    0x8(%ebp),%esi
+  14:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  if(argc < 2){
+  17:	83 fe 01             	cmp    $0x1,%esi
+  1a:	7e 20                	jle    3c <main+0x3c>
+  1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ls(".");
+    exit(0);
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  20:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  for(i=1; i<argc; i++)
+  23:	43                   	inc    %ebx
+    ls(argv[i]);
+  24:	89 04 24             	mov    %eax,(%esp)
+  27:	e8 d4 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  2c:	39 de                	cmp    %ebx,%esi
+  2e:	75 f0                	jne    20 <main+0x20>
+  exit(0);
+  30:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  37:	e8 87 05 00 00       	call   5c3 <exit>
+    ls(".");
+  3c:	c7 04 24 ac 0c 00 00 	movl   $0xcac,(%esp)
+  43:	e8 b8 00 00 00       	call   100 <ls>
+    exit(0);
+  48:	31 c0                	xor    %eax,%eax
+  4a:	89 04 24             	mov    %eax,(%esp)
+  4d:	e8 71 05 00 00       	call   5c3 <exit>
+  52:	66 90                	xchg   %ax,%ax
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	83 ec 10             	sub    $0x10,%esp
+  68:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  6b:	89 34 24             	mov    %esi,(%esp)
+  6e:	e8 8d 03 00 00       	call   400 <strlen>
+  73:	01 f0                	add    %esi,%eax
+  75:	89 c3                	mov    %eax,%ebx
+  77:	73 10                	jae    89 <fmtname+0x29>
+  79:	eb 13                	jmp    8e <fmtname+0x2e>
+  7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  7f:	90                   	nop
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 08                	jb     8f <fmtname+0x2f>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	43                   	inc    %ebx
+  if(strlen(p) >= DIRSIZ)
+  8f:	89 1c 24             	mov    %ebx,(%esp)
+  92:	e8 69 03 00 00       	call   400 <strlen>
+  97:	83 f8 0d             	cmp    $0xd,%eax
+  9a:	77 54                	ja     f0 <fmtname+0x90>
+  memmove(buf, p, strlen(p));
+  9c:	89 1c 24             	mov    %ebx,(%esp)
+  9f:	e8 5c 03 00 00       	call   400 <strlen>
+  a4:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  a8:	c7 04 24 40 10 00 00 	movl   $0x1040,(%esp)
+  af:	89 44 24 08          	mov    %eax,0x8(%esp)
+  b3:	e8 d8 04 00 00       	call   590 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  b8:	89 1c 24             	mov    %ebx,(%esp)
+  bb:	e8 40 03 00 00       	call   400 <strlen>
+  c0:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c3:	bb 40 10 00 00       	mov    $0x1040,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  c8:	89 c6                	mov    %eax,%esi
+  ca:	e8 31 03 00 00       	call   400 <strlen>
+  cf:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d4:	29 f2                	sub    %esi,%edx
+  d6:	89 54 24 08          	mov    %edx,0x8(%esp)
+  da:	ba 20 00 00 00       	mov    $0x20,%edx
+  df:	89 54 24 04          	mov    %edx,0x4(%esp)
+  e3:	05 40 10 00 00       	add    $0x1040,%eax
+  e8:	89 04 24             	mov    %eax,(%esp)
+  eb:	e8 40 03 00 00       	call   430 <memset>
+}
+  f0:	83 c4 10             	add    $0x10,%esp
+  f3:	89 d8                	mov    %ebx,%eax
+  f5:	5b                   	pop    %ebx
+  f6:	5e                   	pop    %esi
+  f7:	5d                   	pop    %ebp
+  f8:	c3                   	ret
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+  if((fd = open(path, 0)) < 0){
+ 101:	31 c0                	xor    %eax,%eax
+{
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	57                   	push   %edi
+ 106:	56                   	push   %esi
+ 107:	53                   	push   %ebx
+ 108:	81 ec 7c 02 00 00    	sub    $0x27c,%esp
+ 10e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 111:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 115:	89 3c 24             	mov    %edi,(%esp)
+ 118:	e8 e6 04 00 00       	call   603 <open>
+ 11d:	85 c0                	test   %eax,%eax
+ 11f:	0f 88 bb 01 00 00    	js     2e0 <ls+0x1e0>
+  if(fstat(fd, &st) < 0){
+ 125:	89 04 24             	mov    %eax,(%esp)
+ 128:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12e:	89 c3                	mov    %eax,%ebx
+ 130:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 134:	e8 e2 04 00 00       	call   61b <fstat>
+ 139:	85 c0                	test   %eax,%eax
+ 13b:	0f 88 e7 01 00 00    	js     328 <ls+0x228>
+  switch(st.type){
+ 141:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 148:	83 f8 01             	cmp    $0x1,%eax
+ 14b:	74 6b                	je     1b8 <ls+0xb8>
+ 14d:	83 f8 02             	cmp    $0x2,%eax
+ 150:	74 16                	je     168 <ls+0x68>
+  close(fd);
+ 152:	89 1c 24             	mov    %ebx,(%esp)
+ 155:	e8 91 04 00 00       	call   5eb <close>
+}
+ 15a:	81 c4 7c 02 00 00    	add    $0x27c,%esp
+ 160:	5b                   	pop    %ebx
+ 161:	5e                   	pop    %esi
+ 162:	5f                   	pop    %edi
+ 163:	5d                   	pop    %ebp
+ 164:	c3                   	ret
+ 165:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 168:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 16e:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 174:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 17a:	89 3c 24             	mov    %edi,(%esp)
+ 17d:	e8 de fe ff ff       	call   60 <fmtname>
+ 182:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 188:	b9 8c 0c 00 00       	mov    $0xc8c,%ecx
+ 18d:	89 74 24 10          	mov    %esi,0x10(%esp)
+ 191:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+ 195:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 19c:	89 54 24 14          	mov    %edx,0x14(%esp)
+ 1a0:	ba 02 00 00 00       	mov    $0x2,%edx
+ 1a5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+ 1a9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 1ad:	e8 de 05 00 00       	call   790 <printf>
+    break;
+ 1b2:	eb 9e                	jmp    152 <ls+0x52>
+ 1b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b8:	89 3c 24             	mov    %edi,(%esp)
+ 1bb:	e8 40 02 00 00       	call   400 <strlen>
+ 1c0:	83 c0 10             	add    $0x10,%eax
+ 1c3:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c8:	0f 87 3a 01 00 00    	ja     308 <ls+0x208>
+    strcpy(buf, path);
+ 1ce:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 1d2:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d8:	89 3c 24             	mov    %edi,(%esp)
+ 1db:	e8 a0 01 00 00       	call   380 <strcpy>
+    p = buf+strlen(buf);
+ 1e0:	89 3c 24             	mov    %edi,(%esp)
+ 1e3:	e8 18 02 00 00       	call   400 <strlen>
+ 1e8:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+ 1eb:	89 8d a8 fd ff ff    	mov    %ecx,-0x258(%ebp)
+    *p++ = '/';
+ 1f1:	8d 44 07 01          	lea    0x1(%edi,%eax,1),%eax
+ 1f5:	89 85 a4 fd ff ff    	mov    %eax,-0x25c(%ebp)
+ 1fb:	c6 01 2f             	movb   $0x2f,(%ecx)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1fe:	66 90                	xchg   %ax,%ax
+ 200:	89 1c 24             	mov    %ebx,(%esp)
+ 203:	b8 10 00 00 00       	mov    $0x10,%eax
+ 208:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 20c:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 212:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 216:	e8 c0 03 00 00       	call   5db <read>
+ 21b:	83 f8 10             	cmp    $0x10,%eax
+ 21e:	0f 85 2e ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 224:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 22b:	00 
+ 22c:	74 d2                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 22e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 233:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 237:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 23d:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 241:	8b 85 a4 fd ff ff    	mov    -0x25c(%ebp),%eax
+ 247:	89 04 24             	mov    %eax,(%esp)
+ 24a:	e8 41 03 00 00       	call   590 <memmove>
+      p[DIRSIZ] = 0;
+ 24f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 255:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 259:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 25d:	89 3c 24             	mov    %edi,(%esp)
+ 260:	e8 8b 02 00 00       	call   4f0 <stat>
+ 265:	85 c0                	test   %eax,%eax
+ 267:	0f 88 eb 00 00 00    	js     358 <ls+0x258>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 26d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 273:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 279:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 280:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 286:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 28c:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 292:	89 3c 24             	mov    %edi,(%esp)
+ 295:	e8 c6 fd ff ff       	call   60 <fmtname>
+ 29a:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 2a0:	89 4c 24 14          	mov    %ecx,0x14(%esp)
+ 2a4:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 2aa:	89 54 24 10          	mov    %edx,0x10(%esp)
+ 2ae:	ba 8c 0c 00 00       	mov    $0xc8c,%edx
+ 2b3:	8b 8d b4 fd ff ff    	mov    -0x24c(%ebp),%ecx
+ 2b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 2bd:	89 54 24 04          	mov    %edx,0x4(%esp)
+ 2c1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 2c8:	89 4c 24 0c          	mov    %ecx,0xc(%esp)
+ 2cc:	e8 bf 04 00 00       	call   790 <printf>
+ 2d1:	e9 2a ff ff ff       	jmp    200 <ls+0x100>
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2e0:	89 7c 24 08          	mov    %edi,0x8(%esp)
+ 2e4:	bf 64 0c 00 00       	mov    $0xc64,%edi
+ 2e9:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 2ed:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+ 2f4:	e8 97 04 00 00       	call   790 <printf>
+}
+ 2f9:	81 c4 7c 02 00 00    	add    $0x27c,%esp
+ 2ff:	5b                   	pop    %ebx
+ 300:	5e                   	pop    %esi
+ 301:	5f                   	pop    %edi
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "ls: path too long\n");
+ 308:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 30f:	b8 99 0c 00 00       	mov    $0xc99,%eax
+ 314:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 318:	e8 73 04 00 00       	call   790 <printf>
+      break;
+ 31d:	e9 30 fe ff ff       	jmp    152 <ls+0x52>
+ 322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot stat %s\n", path);
+ 328:	89 7c 24 08          	mov    %edi,0x8(%esp)
+ 32c:	be 78 0c 00 00       	mov    $0xc78,%esi
+ 331:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 335:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+ 33c:	e8 4f 04 00 00       	call   790 <printf>
+    close(fd);
+ 341:	89 1c 24             	mov    %ebx,(%esp)
+ 344:	e8 a2 02 00 00       	call   5eb <close>
+}
+ 349:	81 c4 7c 02 00 00    	add    $0x27c,%esp
+ 34f:	5b                   	pop    %ebx
+ 350:	5e                   	pop    %esi
+ 351:	5f                   	pop    %edi
+ 352:	5d                   	pop    %ebp
+ 353:	c3                   	ret
+ 354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "ls: cannot stat %s\n", buf);
+ 358:	89 7c 24 08          	mov    %edi,0x8(%esp)
+ 35c:	b9 78 0c 00 00       	mov    $0xc78,%ecx
+ 361:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+ 365:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 36c:	e8 1f 04 00 00       	call   790 <printf>
+        continue;
+ 371:	e9 8a fe ff ff       	jmp    200 <ls+0x100>
+ 376:	66 90                	xchg   %ax,%ax
+ 378:	66 90                	xchg   %ax,%ax
+ 37a:	66 90                	xchg   %ax,%ax
+ 37c:	66 90                	xchg   %ax,%ax
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 380:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 381:	31 c0                	xor    %eax,%eax
+{
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	53                   	push   %ebx
+ 386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 389:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 390:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 394:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 397:	40                   	inc    %eax
+ 398:	84 d2                	test   %dl,%dl
+ 39a:	75 f4                	jne    390 <strcpy+0x10>
+    ;
+  return os;
+}
+ 39c:	5b                   	pop    %ebx
+ 39d:	89 c8                	mov    %ecx,%eax
+ 39f:	5d                   	pop    %ebp
+ 3a0:	c3                   	ret
+ 3a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 3ba:	0f b6 02             	movzbl (%edx),%eax
+ 3bd:	84 c0                	test   %al,%al
+ 3bf:	75 15                	jne    3d6 <strcmp+0x26>
+ 3c1:	eb 30                	jmp    3f3 <strcmp+0x43>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3cc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 3cf:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 3d0:	84 c0                	test   %al,%al
+ 3d2:	74 14                	je     3e8 <strcmp+0x38>
+    p++, q++;
+ 3d4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 3d6:	0f b6 0b             	movzbl (%ebx),%ecx
+ 3d9:	38 c1                	cmp    %al,%cl
+ 3db:	74 eb                	je     3c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 3dd:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 3de:	29 c8                	sub    %ecx,%eax
+}
+ 3e0:	5d                   	pop    %ebp
+ 3e1:	c3                   	ret
+ 3e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3e8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 3ec:	31 c0                	xor    %eax,%eax
+}
+ 3ee:	5b                   	pop    %ebx
+ 3ef:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 3f0:	29 c8                	sub    %ecx,%eax
+}
+ 3f2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3f3:	0f b6 0b             	movzbl (%ebx),%ecx
+ 3f6:	31 c0                	xor    %eax,%eax
+ 3f8:	eb e3                	jmp    3dd <strcmp+0x2d>
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 406:	80 3a 00             	cmpb   $0x0,(%edx)
+ 409:	74 15                	je     420 <strlen+0x20>
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	40                   	inc    %eax
+ 411:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 415:	89 c1                	mov    %eax,%ecx
+ 417:	75 f7                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+ 419:	5d                   	pop    %ebp
+ 41a:	89 c8                	mov    %ecx,%eax
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+ 420:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 421:	31 c9                	xor    %ecx,%ecx
+}
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43d:	89 d7                	mov    %edx,%edi
+ 43f:	fc                   	cld
+ 440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 442:	5f                   	pop    %edi
+ 443:	89 d0                	mov    %edx,%eax
+ 445:	5d                   	pop    %ebp
+ 446:	c3                   	ret
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 45a:	0f b6 10             	movzbl (%eax),%edx
+ 45d:	84 d2                	test   %dl,%dl
+ 45f:	75 10                	jne    471 <strchr+0x21>
+ 461:	eb 1d                	jmp    480 <strchr+0x30>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 46c:	40                   	inc    %eax
+ 46d:	84 d2                	test   %dl,%dl
+ 46f:	74 0f                	je     480 <strchr+0x30>
+    if(*s == c)
+ 471:	38 d1                	cmp    %dl,%cl
+ 473:	75 f3                	jne    468 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 475:	5d                   	pop    %ebp
+ 476:	c3                   	ret
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+ 480:	5d                   	pop    %ebp
+  return 0;
+ 481:	31 c0                	xor    %eax,%eax
+}
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 495:	31 f6                	xor    %esi,%esi
+{
+ 497:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 498:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 49b:	83 ec 3c             	sub    $0x3c,%esp
+ 49e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 4a1:	eb 32                	jmp    4d5 <gets+0x45>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+    cc = read(0, &c, 1);
+ 4a8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 4ac:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 4bc:	e8 1a 01 00 00       	call   5db <read>
+    if(cc < 1)
+ 4c1:	85 c0                	test   %eax,%eax
+ 4c3:	7e 19                	jle    4de <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 4c5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4c9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 4cd:	3c 0a                	cmp    $0xa,%al
+ 4cf:	74 10                	je     4e1 <gets+0x51>
+ 4d1:	3c 0d                	cmp    $0xd,%al
+ 4d3:	74 0c                	je     4e1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 4d5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 4d8:	46                   	inc    %esi
+ 4d9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 4dc:	7c ca                	jl     4a8 <gets+0x18>
+ 4de:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 4e1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 4e5:	83 c4 3c             	add    $0x3c,%esp
+ 4e8:	89 d8                	mov    %ebx,%eax
+ 4ea:	5b                   	pop    %ebx
+ 4eb:	5e                   	pop    %esi
+ 4ec:	5f                   	pop    %edi
+ 4ed:	5d                   	pop    %ebp
+ 4ee:	c3                   	ret
+ 4ef:	90                   	nop
+
+000004f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4f0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4f1:	31 c0                	xor    %eax,%eax
+{
+ 4f3:	89 e5                	mov    %esp,%ebp
+ 4f5:	83 ec 18             	sub    $0x18,%esp
+ 4f8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 4fb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 4fe:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 502:	8b 45 08             	mov    0x8(%ebp),%eax
+ 505:	89 04 24             	mov    %eax,(%esp)
+ 508:	e8 f6 00 00 00       	call   603 <open>
+  if(fd < 0)
+ 50d:	85 c0                	test   %eax,%eax
+ 50f:	78 2f                	js     540 <stat+0x50>
+ 511:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 513:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 516:	89 1c 24             	mov    %ebx,(%esp)
+ 519:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 51d:	e8 f9 00 00 00       	call   61b <fstat>
+  close(fd);
+ 522:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 525:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 527:	e8 bf 00 00 00       	call   5eb <close>
+  return r;
+}
+ 52c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 52f:	89 f0                	mov    %esi,%eax
+ 531:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 534:	89 ec                	mov    %ebp,%esp
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+    return -1;
+ 540:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 545:	eb e5                	jmp    52c <stat+0x3c>
+ 547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	53                   	push   %ebx
+ 554:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 557:	0f be 02             	movsbl (%edx),%eax
+ 55a:	88 c1                	mov    %al,%cl
+ 55c:	80 e9 30             	sub    $0x30,%cl
+ 55f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 562:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 567:	77 1c                	ja     585 <atoi+0x35>
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 570:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 573:	42                   	inc    %edx
+ 574:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 578:	0f be 02             	movsbl (%edx),%eax
+ 57b:	88 c3                	mov    %al,%bl
+ 57d:	80 eb 30             	sub    $0x30,%bl
+ 580:	80 fb 09             	cmp    $0x9,%bl
+ 583:	76 eb                	jbe    570 <atoi+0x20>
+  return n;
+}
+ 585:	5b                   	pop    %ebx
+ 586:	89 c8                	mov    %ecx,%eax
+ 588:	5d                   	pop    %ebp
+ 589:	c3                   	ret
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	8b 45 10             	mov    0x10(%ebp),%eax
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 59e:	85 c0                	test   %eax,%eax
+ 5a0:	7e 13                	jle    5b5 <memmove+0x25>
+ 5a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5a4:	89 d7                	mov    %edx,%edi
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5b1:	39 f8                	cmp    %edi,%eax
+ 5b3:	75 fb                	jne    5b0 <memmove+0x20>
+  return vdst;
+}
+ 5b5:	5e                   	pop    %esi
+ 5b6:	89 d0                	mov    %edx,%eax
+ 5b8:	5f                   	pop    %edi
+ 5b9:	5d                   	pop    %ebp
+ 5ba:	c3                   	ret
+
+000005bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <exit>:
+SYSCALL(exit)
+ 5c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <wait>:
+SYSCALL(wait)
+ 5cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <pipe>:
+SYSCALL(pipe)
+ 5d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <read>:
+SYSCALL(read)
+ 5db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <write>:
+SYSCALL(write)
+ 5e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <close>:
+SYSCALL(close)
+ 5eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <kill>:
+SYSCALL(kill)
+ 5f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <exec>:
+SYSCALL(exec)
+ 5fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <open>:
+SYSCALL(open)
+ 603:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <mknod>:
+SYSCALL(mknod)
+ 60b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <unlink>:
+SYSCALL(unlink)
+ 613:	b8 12 00 00 00       	mov    $0x12,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <fstat>:
+SYSCALL(fstat)
+ 61b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <link>:
+SYSCALL(link)
+ 623:	b8 13 00 00 00       	mov    $0x13,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mkdir>:
+SYSCALL(mkdir)
+ 62b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <chdir>:
+SYSCALL(chdir)
+ 633:	b8 09 00 00 00       	mov    $0x9,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <dup>:
+SYSCALL(dup)
+ 63b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getpid>:
+SYSCALL(getpid)
+ 643:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <sbrk>:
+SYSCALL(sbrk)
+ 64b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <sleep>:
+SYSCALL(sleep)
+ 653:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <uptime>:
+SYSCALL(uptime)
+ 65b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <detach>:
+SYSCALL(detach)
+ 663:	b8 16 00 00 00       	mov    $0x16,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <policy>:
+SYSCALL(policy)
+ 66b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <priority>:
+SYSCALL(priority)
+ 673:	b8 18 00 00 00       	mov    $0x18,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <wait_stat>:
+SYSCALL(wait_stat)
+ 67b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <lockstat>:
+SYSCALL(lockstat)
+ 683:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mmap>:
+SYSCALL(mmap)
+ 68b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <munmap>:
+SYSCALL(munmap)
+ 693:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <shmget>:
+SYSCALL(shmget)
+ 69b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <shmat>:
+SYSCALL(shmat)
+ 6a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <shmdt>:
+SYSCALL(shmdt)
+ 6ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <memstat>:
+SYSCALL(memstat)
+ 6b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <getprocs>:
+SYSCALL(getprocs)
+ 6bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <shmctl>:
+SYSCALL(shmctl)
+ 6c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+ 6d8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6db:	89 d1                	mov    %edx,%ecx
+{
+ 6dd:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	89 d0                	mov    %edx,%eax
+ 6e2:	c1 e8 1f             	shr    $0x1f,%eax
+ 6e5:	84 c0                	test   %al,%al
+ 6e7:	0f 84 93 00 00 00    	je     780 <printint+0xb0>
+ 6ed:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6f1:	0f 84 89 00 00 00    	je     780 <printint+0xb0>
+    x = -xx;
+ 6f7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6fe:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 705:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 708:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 710:	89 c8                	mov    %ecx,%eax
+ 712:	31 d2                	xor    %edx,%edx
+ 714:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 717:	f7 f3                	div    %ebx
+ 719:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 71c:	0f b6 92 10 0d 00 00 	movzbl 0xd10(%edx),%edx
+ 723:	8d 47 01             	lea    0x1(%edi),%eax
+ 726:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 729:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 72d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 72f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 732:	39 da                	cmp    %ebx,%edx
+ 734:	73 da                	jae    710 <printint+0x40>
+  if(neg)
+ 736:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 739:	85 c0                	test   %eax,%eax
+ 73b:	74 0a                	je     747 <printint+0x77>
+    buf[i++] = '-';
+ 73d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 740:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 745:	89 c7                	mov    %eax,%edi
+ 747:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 74a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 74e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 750:	0f b6 07             	movzbl (%edi),%eax
+ 753:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 756:	b8 01 00 00 00       	mov    $0x1,%eax
+ 75b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 75f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 763:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 766:	89 04 24             	mov    %eax,(%esp)
+ 769:	e8 75 fe ff ff       	call   5e3 <write>
+  while(--i >= 0)
+ 76e:	89 f8                	mov    %edi,%eax
+ 770:	4f                   	dec    %edi
+ 771:	39 d8                	cmp    %ebx,%eax
+ 773:	75 db                	jne    750 <printint+0x80>
+}
+ 775:	83 c4 4c             	add    $0x4c,%esp
+ 778:	5b                   	pop    %ebx
+ 779:	5e                   	pop    %esi
+ 77a:	5f                   	pop    %edi
+ 77b:	5d                   	pop    %ebp
+ 77c:	c3                   	ret
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 780:	31 c0                	xor    %eax,%eax
+ 782:	e9 77 ff ff ff       	jmp    6fe <printint+0x2e>
+ 787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78e:	66 90                	xchg   %ax,%ax
+
+00000790 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 799:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 79c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 79f:	0f b6 1e             	movzbl (%esi),%ebx
+ 7a2:	84 db                	test   %bl,%bl
+ 7a4:	74 6f                	je     815 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 7a6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 7a9:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 7ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 7ae:	88 d9                	mov    %bl,%cl
+ 7b0:	46                   	inc    %esi
+ 7b1:	89 d3                	mov    %edx,%ebx
+ 7b3:	eb 2b                	jmp    7e0 <printf+0x50>
+ 7b5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 7b8:	83 f8 25             	cmp    $0x25,%eax
+ 7bb:	74 4b                	je     808 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 7bd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7c5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 7c9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7cc:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 7d0:	89 3c 24             	mov    %edi,(%esp)
+ 7d3:	e8 0b fe ff ff       	call   5e3 <write>
+  for(i = 0; fmt[i]; i++){
+ 7d8:	0f b6 0e             	movzbl (%esi),%ecx
+ 7db:	46                   	inc    %esi
+ 7dc:	84 c9                	test   %cl,%cl
+ 7de:	74 35                	je     815 <printf+0x85>
+    if(state == 0){
+ 7e0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 7e2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 7e5:	74 d1                	je     7b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7e7:	83 fb 25             	cmp    $0x25,%ebx
+ 7ea:	75 ec                	jne    7d8 <printf+0x48>
+      if(c == 'd'){
+ 7ec:	83 f8 25             	cmp    $0x25,%eax
+ 7ef:	0f 84 53 01 00 00    	je     948 <printf+0x1b8>
+ 7f5:	83 e8 63             	sub    $0x63,%eax
+ 7f8:	83 f8 15             	cmp    $0x15,%eax
+ 7fb:	77 23                	ja     820 <printf+0x90>
+ 7fd:	ff 24 85 b8 0c 00 00 	jmp    *0xcb8(,%eax,4)
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 808:	0f b6 0e             	movzbl (%esi),%ecx
+ 80b:	46                   	inc    %esi
+        state = '%';
+ 80c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 811:	84 c9                	test   %cl,%cl
+ 813:	75 cb                	jne    7e0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 815:	83 c4 3c             	add    $0x3c,%esp
+ 818:	5b                   	pop    %ebx
+ 819:	5e                   	pop    %esi
+ 81a:	5f                   	pop    %edi
+ 81b:	5d                   	pop    %ebp
+ 81c:	c3                   	ret
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+ 820:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 823:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 826:	b8 01 00 00 00       	mov    $0x1,%eax
+ 82b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 82f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 833:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 837:	89 3c 24             	mov    %edi,(%esp)
+ 83a:	e8 a4 fd ff ff       	call   5e3 <write>
+        putc(fd, c);
+ 83f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 843:	ba 01 00 00 00       	mov    $0x1,%edx
+ 848:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 84b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 84f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 851:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 855:	89 3c 24             	mov    %edi,(%esp)
+ 858:	e8 86 fd ff ff       	call   5e3 <write>
+ 85d:	e9 76 ff ff ff       	jmp    7d8 <printf+0x48>
+ 862:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 868:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 86b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 870:	8b 13                	mov    (%ebx),%edx
+ 872:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 879:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 87c:	89 f8                	mov    %edi,%eax
+ 87e:	e8 4d fe ff ff       	call   6d0 <printint>
+        ap++;
+ 883:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 886:	31 db                	xor    %ebx,%ebx
+ 888:	e9 4b ff ff ff       	jmp    7d8 <printf+0x48>
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 890:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 893:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 895:	83 c0 04             	add    $0x4,%eax
+ 898:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 89b:	85 c9                	test   %ecx,%ecx
+ 89d:	0f 84 cd 00 00 00    	je     970 <printf+0x1e0>
+        while(*s != 0){
+ 8a3:	0f b6 01             	movzbl (%ecx),%eax
+ 8a6:	84 c0                	test   %al,%al
+ 8a8:	0f 84 ce 00 00 00    	je     97c <printf+0x1ec>
+ 8ae:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 8b1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 8b4:	89 ce                	mov    %ecx,%esi
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 8c0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 8c8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 8c9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 8cd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 8d1:	89 3c 24             	mov    %edi,(%esp)
+ 8d4:	e8 0a fd ff ff       	call   5e3 <write>
+        while(*s != 0){
+ 8d9:	0f b6 06             	movzbl (%esi),%eax
+ 8dc:	84 c0                	test   %al,%al
+ 8de:	75 e0                	jne    8c0 <printf+0x130>
+      state = 0;
+ 8e0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 8e3:	31 db                	xor    %ebx,%ebx
+ 8e5:	e9 ee fe ff ff       	jmp    7d8 <printf+0x48>
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8f0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 8f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8f8:	8b 13                	mov    (%ebx),%edx
+ 8fa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 901:	e9 73 ff ff ff       	jmp    879 <printf+0xe9>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 910:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 913:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 918:	8b 10                	mov    (%eax),%edx
+ 91a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 91d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 921:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 924:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 928:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 92b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 92f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 931:	89 3c 24             	mov    %edi,(%esp)
+ 934:	e8 aa fc ff ff       	call   5e3 <write>
+        ap++;
+ 939:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 93d:	e9 96 fe ff ff       	jmp    7d8 <printf+0x48>
+ 942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 948:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 94b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 94e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 953:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 957:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 959:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 95d:	89 3c 24             	mov    %edi,(%esp)
+ 960:	e8 7e fc ff ff       	call   5e3 <write>
+ 965:	e9 6e fe ff ff       	jmp    7d8 <printf+0x48>
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 970:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 972:	b9 ae 0c 00 00       	mov    $0xcae,%ecx
+ 977:	e9 32 ff ff ff       	jmp    8ae <printf+0x11e>
+      state = 0;
+ 97c:	31 db                	xor    %ebx,%ebx
+ 97e:	66 90                	xchg   %ax,%ax
+ 980:	e9 53 fe ff ff       	jmp    7d8 <printf+0x48>
+ 985:	66 90                	xchg   %ax,%ax
+ 987:	66 90                	xchg   %ax,%ax
+ 989:	66 90                	xchg   %ax,%ax
+ 98b:	66 90                	xchg   %ax,%ax
+ 98d:	66 90                	xchg   %ax,%ax
+ 98f:	90                   	nop
+
+00000990 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	83 ec 18             	sub    $0x18,%esp
+ 996:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 999:	89 c3                	mov    %eax,%ebx
+ 99b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 99e:	a1 64 10 00 00       	mov    0x1064,%eax
+ 9a3:	8b 15 60 10 00 00    	mov    0x1060,%edx
+ 9a9:	29 c2                	sub    %eax,%edx
+ 9ab:	39 da                	cmp    %ebx,%edx
+ 9ad:	72 19                	jb     9c8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 9af:	01 c3                	add    %eax,%ebx
+ 9b1:	89 1d 64 10 00 00    	mov    %ebx,0x1064
+  return p;
+}
+ 9b7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 9ba:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 9bd:	89 ec                	mov    %ebp,%esp
+ 9bf:	5d                   	pop    %ebp
+ 9c0:	c3                   	ret
+ 9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 9c8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 9cd:	39 c3                	cmp    %eax,%ebx
+ 9cf:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 9d2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 9d5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 9d7:	e8 6f fc ff ff       	call   64b <sbrk>
+    if(p == (char*)-1)
+ 9dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 9df:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 9e1:	74 1d                	je     a00 <morecore+0x70>
+    if(p != arenaend)
+ 9e3:	39 05 60 10 00 00    	cmp    %eax,0x1060
+ 9e9:	74 0d                	je     9f8 <morecore+0x68>
+    arenaend = p + grow;
+ 9eb:	01 f2                	add    %esi,%edx
+ 9ed:	89 15 60 10 00 00    	mov    %edx,0x1060
+ 9f3:	eb ba                	jmp    9af <morecore+0x1f>
+ 9f5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 9f8:	a1 64 10 00 00       	mov    0x1064,%eax
+ 9fd:	eb ec                	jmp    9eb <morecore+0x5b>
+ 9ff:	90                   	nop
+      return 0;
+ a00:	31 c0                	xor    %eax,%eax
+ a02:	eb b3                	jmp    9b7 <morecore+0x27>
+ a04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+
+00000a10 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ a19:	8b 45 08             	mov    0x8(%ebp),%eax
+ a1c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ a1f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ a22:	85 c0                	test   %eax,%eax
+ a24:	74 1e                	je     a44 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ a26:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ a29:	83 fa 08             	cmp    $0x8,%edx
+ a2c:	77 16                	ja     a44 <free+0x34>
+  h = (Header*)ap - 1;
+ a2e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ a31:	74 25                	je     a58 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ a33:	8b 3c 95 80 10 00 00 	mov    0x1080(,%edx,4),%edi
+ a3a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ a3d:	89 0c 95 80 10 00 00 	mov    %ecx,0x1080(,%edx,4)
+}
+ a44:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ a47:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ a4a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ a4d:	89 ec                	mov    %ebp,%esp
+ a4f:	5d                   	pop    %ebp
+ a50:	c3                   	ret
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ a58:	8b 15 a0 10 00 00    	mov    0x10a0,%edx
+ a5e:	85 d2                	test   %edx,%edx
+ a60:	74 54                	je     ab6 <free+0xa6>
+ a62:	39 ca                	cmp    %ecx,%edx
+ a64:	73 36                	jae    a9c <free+0x8c>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+ a70:	89 d3                	mov    %edx,%ebx
+ a72:	8b 12                	mov    (%edx),%edx
+ a74:	85 d2                	test   %edx,%edx
+ a76:	74 12                	je     a8a <free+0x7a>
+ a78:	39 ca                	cmp    %ecx,%edx
+ a7a:	72 f4                	jb     a70 <free+0x60>
+  if(p && END(h) == p){
+ a7c:	85 d2                	test   %edx,%edx
+ a7e:	74 0a                	je     a8a <free+0x7a>
+ a80:	8b 70 fc             	mov    -0x4(%eax),%esi
+ a83:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ a86:	39 fa                	cmp    %edi,%edx
+ a88:	74 4b                	je     ad5 <free+0xc5>
+  h->s.u.next = p;
+ a8a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ a8d:	8b 53 04             	mov    0x4(%ebx),%edx
+ a90:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ a94:	39 f1                	cmp    %esi,%ecx
+ a96:	74 29                	je     ac1 <free+0xb1>
+    prev->s.u.next = h;
+ a98:	89 0b                	mov    %ecx,(%ebx)
+ a9a:	eb a8                	jmp    a44 <free+0x34>
+  if(p && END(h) == p){
+ a9c:	85 d2                	test   %edx,%edx
+ a9e:	74 16                	je     ab6 <free+0xa6>
+ aa0:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ aa3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ aa6:	39 f2                	cmp    %esi,%edx
+ aa8:	75 0c                	jne    ab6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ aaa:	8b 72 04             	mov    0x4(%edx),%esi
+ aad:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ ab1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ ab4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ ab6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ ab9:	89 0d a0 10 00 00    	mov    %ecx,0x10a0
+ abf:	eb 83                	jmp    a44 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ ac1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ ac4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ ac8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ acb:	8b 40 f8             	mov    -0x8(%eax),%eax
+ ace:	89 03                	mov    %eax,(%ebx)
+ ad0:	e9 6f ff ff ff       	jmp    a44 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ ad5:	8b 7a 04             	mov    0x4(%edx),%edi
+ ad8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ adc:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ adf:	8b 12                	mov    (%edx),%edx
+ ae1:	eb a7                	jmp    a8a <free+0x7a>
+ ae3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000af0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 2c             	sub    $0x2c,%esp
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ afc:	83 f8 10             	cmp    $0x10,%eax
+ aff:	0f 86 52 01 00 00    	jbe    c57 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ b05:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ b07:	ba 01 00 00 00       	mov    $0x1,%edx
+ b0c:	eb 0d                	jmp    b1b <malloc+0x2b>
+ b0e:	66 90                	xchg   %ax,%ax
+ b10:	83 c1 05             	add    $0x5,%ecx
+ b13:	89 d6                	mov    %edx,%esi
+ b15:	d3 e6                	shl    %cl,%esi
+ b17:	39 c6                	cmp    %eax,%esi
+ b19:	73 55                	jae    b70 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ b1b:	89 d9                	mov    %ebx,%ecx
+ b1d:	43                   	inc    %ebx
+ b1e:	83 fb 08             	cmp    $0x8,%ebx
+ b21:	75 ed                	jne    b10 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ b23:	8d 58 07             	lea    0x7(%eax),%ebx
+ b26:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ b29:	39 c3                	cmp    %eax,%ebx
+ b2b:	0f 82 1f 01 00 00    	jb     c50 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ b31:	a1 a0 10 00 00       	mov    0x10a0,%eax
+ b36:	85 c0                	test   %eax,%eax
+ b38:	0f 84 ee 00 00 00    	je     c2c <malloc+0x13c>
+ b3e:	b9 a0 10 00 00       	mov    $0x10a0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ b43:	8b 50 04             	mov    0x4(%eax),%edx
+ b46:	39 da                	cmp    %ebx,%edx
+ b48:	0f 82 d2 00 00 00    	jb     c20 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ b4e:	29 da                	sub    %ebx,%edx
+ b50:	83 fa 17             	cmp    $0x17,%edx
+ b53:	0f 87 b7 00 00 00    	ja     c10 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ b59:	8b 10                	mov    (%eax),%edx
+ b5b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ b5d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ b63:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ b66:	83 c0 08             	add    $0x8,%eax
+}
+ b69:	5b                   	pop    %ebx
+ b6a:	5e                   	pop    %esi
+ b6b:	5f                   	pop    %edi
+ b6c:	5d                   	pop    %ebp
+ b6d:	c3                   	ret
+ b6e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ b70:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ b72:	8b 04 9d 80 10 00 00 	mov    0x1080(,%ebx,4),%eax
+ b79:	85 c0                	test   %eax,%eax
+ b7b:	74 23                	je     ba0 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ b7d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ b7f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ b82:	89 14 9d 80 10 00 00 	mov    %edx,0x1080(,%ebx,4)
+    h->s.u.cls = cls;
+ b89:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ b8c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ b8f:	83 c4 2c             	add    $0x2c,%esp
+ b92:	5b                   	pop    %ebx
+ b93:	5e                   	pop    %esi
+ b94:	5f                   	pop    %edi
+ b95:	5d                   	pop    %ebp
+ b96:	c3                   	ret
+ b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ ba0:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ ba3:	31 d2                	xor    %edx,%edx
+ ba5:	b8 00 10 00 00       	mov    $0x1000,%eax
+ baa:	f7 f6                	div    %esi
+ bac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ baf:	0f af c6             	imul   %esi,%eax
+ bb2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ bb5:	e8 d6 fd ff ff       	call   990 <morecore>
+ bba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ bbd:	85 c0                	test   %eax,%eax
+ bbf:	0f 84 8b 00 00 00    	je     c50 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ bc5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ bc8:	8b 0c 9d 80 10 00 00 	mov    0x1080(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ bcf:	31 d2                	xor    %edx,%edx
+ bd1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ bd4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ bd7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ bda:	eb 06                	jmp    be2 <malloc+0xf2>
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ be0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ be2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ be4:	42                   	inc    %edx
+ be5:	89 c1                	mov    %eax,%ecx
+ be7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ bea:	39 d7                	cmp    %edx,%edi
+ bec:	75 f2                	jne    be0 <malloc+0xf0>
+ bee:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ bf1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ bf4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ bf7:	89 04 9d 80 10 00 00 	mov    %eax,0x1080(,%ebx,4)
+ bfe:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ c01:	29 f0                	sub    %esi,%eax
+ c03:	01 c2                	add    %eax,%edx
+ c05:	89 d0                	mov    %edx,%eax
+ c07:	e9 71 ff ff ff       	jmp    b7d <malloc+0x8d>
+ c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ c10:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ c13:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ c16:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ c18:	89 58 04             	mov    %ebx,0x4(%eax)
+ c1b:	e9 3d ff ff ff       	jmp    b5d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ c20:	89 c1                	mov    %eax,%ecx
+ c22:	8b 00                	mov    (%eax),%eax
+ c24:	85 c0                	test   %eax,%eax
+ c26:	0f 85 17 ff ff ff    	jne    b43 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ c2c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ c2f:	74 1f                	je     c50 <malloc+0x160>
+ c31:	8d 43 08             	lea    0x8(%ebx),%eax
+ c34:	e8 57 fd ff ff       	call   990 <morecore>
+ c39:	85 c0                	test   %eax,%eax
+ c3b:	74 13                	je     c50 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ c3d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ c43:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ c46:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ c49:	e9 41 ff ff ff       	jmp    b8f <malloc+0x9f>
+ c4e:	66 90                	xchg   %ax,%ax
+      return 0;
+ c50:	31 c0                	xor    %eax,%eax
+ c52:	e9 38 ff ff ff       	jmp    b8f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ c57:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ c5c:	31 db                	xor    %ebx,%ebx
+ c5e:	e9 0f ff ff ff       	jmp    b72 <malloc+0x82>
@@ -31,8 +31,11 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
+  slabinit();      // kernel object caches
   binit();         // buffer cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
+  shminit();       // shared memory segments
   ideinit();       // disk
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
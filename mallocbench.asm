@@ -0,0 +1,1602 @@
+
+_mallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s: %d ops, %d ticks\n", name, ops, uptime() - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 e4 f0             	and    $0xfffffff0,%esp
+   9:	83 ec 20             	sub    $0x20,%esp
+  int rounds, i, j, t0;
+  uint n;
+
+  rounds = 20000;
+  if(argc > 1)
+   c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  10:	0f 8f f3 00 00 00    	jg     109 <main+0x109>
+    rounds = atoi(argv[1]);
+
+  // Same small size, allocated and freed back to back.
+  t0 = uptime();
+  16:	e8 40 05 00 00       	call   55b <uptime>
+  rounds = 20000;
+  1b:	be 20 4e 00 00       	mov    $0x4e20,%esi
+  t0 = uptime();
+  20:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < rounds; i++)
+  22:	31 db                	xor    %ebx,%ebx
+  24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    free(malloc(32));
+  30:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+  for(i = 0; i < rounds; i++)
+  37:	43                   	inc    %ebx
+    free(malloc(32));
+  38:	e8 b3 09 00 00       	call   9f0 <malloc>
+  3d:	89 04 24             	mov    %eax,(%esp)
+  40:	e8 cb 08 00 00       	call   910 <free>
+  for(i = 0; i < rounds; i++)
+  45:	39 de                	cmp    %ebx,%esi
+  47:	7f e7                	jg     30 <main+0x30>
+  report("pairs", rounds, t0);
+  49:	89 f9                	mov    %edi,%ecx
+  4b:	89 f2                	mov    %esi,%edx
+  4d:	b8 7a 0b 00 00       	mov    $0xb7a,%eax
+
+  // Random small sizes, with a window of live blocks.
+  t0 = uptime();
+  for(i = 0; i < rounds; i++){
+  52:	31 db                	xor    %ebx,%ebx
+  report("pairs", rounds, t0);
+  54:	e8 e7 01 00 00       	call   240 <report>
+  t0 = uptime();
+  59:	e8 fd 04 00 00       	call   55b <uptime>
+  5e:	89 44 24 18          	mov    %eax,0x18(%esp)
+  for(i = 0; i < rounds; i++){
+  62:	eb 1f                	jmp    83 <main+0x83>
+  64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    n = 1 + rand() % 512;
+    if((slot[j] = malloc(n)) == 0){
+      printf(2, "mallocbench: out of memory\n");
+      exit(1);
+    }
+    memset(slot[j], 0, n);
+  68:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  6c:	31 c9                	xor    %ecx,%ecx
+  for(i = 0; i < rounds; i++){
+  6e:	43                   	inc    %ebx
+    memset(slot[j], 0, n);
+  6f:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  73:	89 04 24             	mov    %eax,(%esp)
+  76:	e8 b5 02 00 00       	call   330 <memset>
+  for(i = 0; i < rounds; i++){
+  7b:	39 de                	cmp    %ebx,%esi
+  7d:	0f 84 bc 00 00 00    	je     13f <main+0x13f>
+  seed = seed * 1103515245 + 12345;
+  83:	69 15 f0 0e 00 00 6d 	imul   $0x41c64e6d,0xef0,%edx
+  8a:	4e c6 41 
+  8d:	81 c2 39 30 00 00    	add    $0x3039,%edx
+  93:	89 15 f0 0e 00 00    	mov    %edx,0xef0
+  return (seed >> 16) & 0x7fff;
+  99:	c1 ea 10             	shr    $0x10,%edx
+    j = rand() % NSLOT;
+  9c:	0f b6 d2             	movzbl %dl,%edx
+    free(slot[j]);
+  9f:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  a3:	8b 04 95 00 0f 00 00 	mov    0xf00(,%edx,4),%eax
+  aa:	89 04 24             	mov    %eax,(%esp)
+  ad:	e8 5e 08 00 00       	call   910 <free>
+  seed = seed * 1103515245 + 12345;
+  b2:	69 05 f0 0e 00 00 6d 	imul   $0x41c64e6d,0xef0,%eax
+  b9:	4e c6 41 
+  bc:	05 39 30 00 00       	add    $0x3039,%eax
+  c1:	a3 f0 0e 00 00       	mov    %eax,0xef0
+  return (seed >> 16) & 0x7fff;
+  c6:	c1 e8 10             	shr    $0x10,%eax
+    n = 1 + rand() % 512;
+  c9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  ce:	8d 78 01             	lea    0x1(%eax),%edi
+    if((slot[j] = malloc(n)) == 0){
+  d1:	89 3c 24             	mov    %edi,(%esp)
+  d4:	e8 17 09 00 00       	call   9f0 <malloc>
+  d9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  dd:	89 04 95 00 0f 00 00 	mov    %eax,0xf00(,%edx,4)
+  e4:	85 c0                	test   %eax,%eax
+  e6:	75 80                	jne    68 <main+0x68>
+      printf(2, "mallocbench: out of memory\n");
+  e8:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  ef:	bb 80 0b 00 00       	mov    $0xb80,%ebx
+  f4:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  f8:	e8 93 05 00 00       	call   690 <printf>
+      exit(1);
+  fd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 104:	e8 ba 03 00 00       	call   4c3 <exit>
+    rounds = atoi(argv[1]);
+ 109:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10c:	8b 40 04             	mov    0x4(%eax),%eax
+ 10f:	89 04 24             	mov    %eax,(%esp)
+ 112:	e8 39 03 00 00       	call   450 <atoi>
+ 117:	89 c6                	mov    %eax,%esi
+  t0 = uptime();
+ 119:	e8 3d 04 00 00       	call   55b <uptime>
+  for(i = 0; i < rounds; i++)
+ 11e:	85 f6                	test   %esi,%esi
+  t0 = uptime();
+ 120:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < rounds; i++)
+ 122:	0f 8f fa fe ff ff    	jg     22 <main+0x22>
+  report("pairs", rounds, t0);
+ 128:	89 c1                	mov    %eax,%ecx
+ 12a:	89 f2                	mov    %esi,%edx
+ 12c:	b8 7a 0b 00 00       	mov    $0xb7a,%eax
+ 131:	e8 0a 01 00 00       	call   240 <report>
+  t0 = uptime();
+ 136:	e8 20 04 00 00       	call   55b <uptime>
+ 13b:	89 44 24 18          	mov    %eax,0x18(%esp)
+  }
+  report("random", rounds, t0);
+ 13f:	8b 4c 24 18          	mov    0x18(%esp),%ecx
+ 143:	89 f2                	mov    %esi,%edx
+ 145:	b8 9c 0b 00 00       	mov    $0xb9c,%eax
+  for(j = 0; j < NSLOT; j++){
+ 14a:	31 db                	xor    %ebx,%ebx
+  report("random", rounds, t0);
+ 14c:	e8 ef 00 00 00       	call   240 <report>
+  for(j = 0; j < NSLOT; j++){
+ 151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+    free(slot[j]);
+ 160:	8b 04 9d 00 0f 00 00 	mov    0xf00(,%ebx,4),%eax
+ 167:	89 04 24             	mov    %eax,(%esp)
+ 16a:	e8 a1 07 00 00       	call   910 <free>
+    slot[j] = 0;
+ 16f:	31 d2                	xor    %edx,%edx
+ 171:	89 14 9d 00 0f 00 00 	mov    %edx,0xf00(,%ebx,4)
+  for(j = 0; j < NSLOT; j++){
+ 178:	43                   	inc    %ebx
+ 179:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+ 17f:	75 df                	jne    160 <main+0x160>
+  }
+
+  // Large blocks.
+  t0 = uptime();
+ 181:	e8 d5 03 00 00       	call   55b <uptime>
+  for(i = 0; i < rounds / 10; i++){
+ 186:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  t0 = uptime();
+ 18b:	89 44 24 1c          	mov    %eax,0x1c(%esp)
+  for(i = 0; i < rounds / 10; i++){
+ 18f:	89 f0                	mov    %esi,%eax
+ 191:	99                   	cltd
+ 192:	f7 f9                	idiv   %ecx
+ 194:	83 fe 09             	cmp    $0x9,%esi
+ 197:	89 c3                	mov    %eax,%ebx
+ 199:	7e 6e                	jle    209 <main+0x209>
+ 19b:	31 ff                	xor    %edi,%edi
+ 19d:	eb 06                	jmp    1a5 <main+0x1a5>
+ 19f:	90                   	nop
+ 1a0:	47                   	inc    %edi
+ 1a1:	39 df                	cmp    %ebx,%edi
+ 1a3:	7d 64                	jge    209 <main+0x209>
+  seed = seed * 1103515245 + 12345;
+ 1a5:	69 35 f0 0e 00 00 6d 	imul   $0x41c64e6d,0xef0,%esi
+ 1ac:	4e c6 41 
+ 1af:	81 c6 39 30 00 00    	add    $0x3039,%esi
+ 1b5:	89 35 f0 0e 00 00    	mov    %esi,0xef0
+  return (seed >> 16) & 0x7fff;
+ 1bb:	c1 ee 10             	shr    $0x10,%esi
+    j = rand() % 16;
+ 1be:	83 e6 0f             	and    $0xf,%esi
+    free(slot[j]);
+ 1c1:	8b 04 b5 00 0f 00 00 	mov    0xf00(,%esi,4),%eax
+ 1c8:	89 04 24             	mov    %eax,(%esp)
+ 1cb:	e8 40 07 00 00       	call   910 <free>
+  seed = seed * 1103515245 + 12345;
+ 1d0:	69 05 f0 0e 00 00 6d 	imul   $0x41c64e6d,0xef0,%eax
+ 1d7:	4e c6 41 
+ 1da:	05 39 30 00 00       	add    $0x3039,%eax
+ 1df:	a3 f0 0e 00 00       	mov    %eax,0xef0
+  return (seed >> 16) & 0x7fff;
+ 1e4:	c1 e8 10             	shr    $0x10,%eax
+    if((slot[j] = malloc(4096 + rand() % 16384)) == 0){
+ 1e7:	25 ff 3f 00 00       	and    $0x3fff,%eax
+ 1ec:	05 00 10 00 00       	add    $0x1000,%eax
+ 1f1:	89 04 24             	mov    %eax,(%esp)
+ 1f4:	e8 f7 07 00 00       	call   9f0 <malloc>
+ 1f9:	89 04 b5 00 0f 00 00 	mov    %eax,0xf00(,%esi,4)
+ 200:	85 c0                	test   %eax,%eax
+ 202:	75 9c                	jne    1a0 <main+0x1a0>
+ 204:	e9 df fe ff ff       	jmp    e8 <main+0xe8>
+      printf(2, "mallocbench: out of memory\n");
+      exit(1);
+    }
+  }
+  report("large", rounds / 10, t0);
+ 209:	8b 4c 24 1c          	mov    0x1c(%esp),%ecx
+ 20d:	89 da                	mov    %ebx,%edx
+ 20f:	b8 a3 0b 00 00       	mov    $0xba3,%eax
+  for(j = 0; j < 16; j++)
+ 214:	31 db                	xor    %ebx,%ebx
+  report("large", rounds / 10, t0);
+ 216:	e8 25 00 00 00       	call   240 <report>
+  for(j = 0; j < 16; j++)
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+    free(slot[j]);
+ 220:	8b 04 9d 00 0f 00 00 	mov    0xf00(,%ebx,4),%eax
+  for(j = 0; j < 16; j++)
+ 227:	43                   	inc    %ebx
+    free(slot[j]);
+ 228:	89 04 24             	mov    %eax,(%esp)
+ 22b:	e8 e0 06 00 00       	call   910 <free>
+  for(j = 0; j < 16; j++)
+ 230:	83 fb 10             	cmp    $0x10,%ebx
+ 233:	75 eb                	jne    220 <main+0x220>
+
+  exit(0);
+ 235:	31 c0                	xor    %eax,%eax
+ 237:	89 04 24             	mov    %eax,(%esp)
+ 23a:	e8 84 02 00 00       	call   4c3 <exit>
+ 23f:	90                   	nop
+
+00000240 <report>:
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	89 cf                	mov    %ecx,%edi
+ 246:	56                   	push   %esi
+ 247:	89 d6                	mov    %edx,%esi
+ 249:	53                   	push   %ebx
+ 24a:	89 c3                	mov    %eax,%ebx
+ 24c:	83 ec 2c             	sub    $0x2c,%esp
+  printf(1, "%s: %d ops, %d ticks\n", name, ops, uptime() - t0);
+ 24f:	e8 07 03 00 00       	call   55b <uptime>
+ 254:	89 74 24 0c          	mov    %esi,0xc(%esp)
+ 258:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 25c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 263:	29 f8                	sub    %edi,%eax
+ 265:	89 44 24 10          	mov    %eax,0x10(%esp)
+ 269:	b8 64 0b 00 00       	mov    $0xb64,%eax
+ 26e:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 272:	e8 19 04 00 00       	call   690 <printf>
+}
+ 277:	83 c4 2c             	add    $0x2c,%esp
+ 27a:	5b                   	pop    %ebx
+ 27b:	5e                   	pop    %esi
+ 27c:	5f                   	pop    %edi
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+
+00000280 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	40                   	inc    %eax
+ 298:	84 d2                	test   %dl,%dl
+ 29a:	75 f4                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29c:	5b                   	pop    %ebx
+ 29d:	89 c8                	mov    %ecx,%eax
+ 29f:	5d                   	pop    %ebp
+ 2a0:	c3                   	ret
+ 2a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 15                	jne    2d6 <strcmp+0x26>
+ 2c1:	eb 30                	jmp    2f3 <strcmp+0x43>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 2cf:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 2d0:	84 c0                	test   %al,%al
+ 2d2:	74 14                	je     2e8 <strcmp+0x38>
+    p++, q++;
+ 2d4:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 2d6:	0f b6 0b             	movzbl (%ebx),%ecx
+ 2d9:	38 c1                	cmp    %al,%cl
+ 2db:	74 eb                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 2dd:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 2de:	29 c8                	sub    %ecx,%eax
+}
+ 2e0:	5d                   	pop    %ebp
+ 2e1:	c3                   	ret
+ 2e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2e8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 2ec:	31 c0                	xor    %eax,%eax
+}
+ 2ee:	5b                   	pop    %ebx
+ 2ef:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 2f0:	29 c8                	sub    %ecx,%eax
+}
+ 2f2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2f3:	0f b6 0b             	movzbl (%ebx),%ecx
+ 2f6:	31 c0                	xor    %eax,%eax
+ 2f8:	eb e3                	jmp    2dd <strcmp+0x2d>
+ 2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000300 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 306:	80 3a 00             	cmpb   $0x0,(%edx)
+ 309:	74 15                	je     320 <strlen+0x20>
+ 30b:	31 c0                	xor    %eax,%eax
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+ 310:	40                   	inc    %eax
+ 311:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 315:	89 c1                	mov    %eax,%ecx
+ 317:	75 f7                	jne    310 <strlen+0x10>
+    ;
+  return n;
+}
+ 319:	5d                   	pop    %ebp
+ 31a:	89 c8                	mov    %ecx,%eax
+ 31c:	c3                   	ret
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 321:	31 c9                	xor    %ecx,%ecx
+}
+ 323:	89 c8                	mov    %ecx,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 33a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33d:	89 d7                	mov    %edx,%edi
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 342:	5f                   	pop    %edi
+ 343:	89 d0                	mov    %edx,%eax
+ 345:	5d                   	pop    %ebp
+ 346:	c3                   	ret
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 35a:	0f b6 10             	movzbl (%eax),%edx
+ 35d:	84 d2                	test   %dl,%dl
+ 35f:	75 10                	jne    371 <strchr+0x21>
+ 361:	eb 1d                	jmp    380 <strchr+0x30>
+ 363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 367:	90                   	nop
+ 368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 36c:	40                   	inc    %eax
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	74 0f                	je     380 <strchr+0x30>
+    if(*s == c)
+ 371:	38 d1                	cmp    %dl,%cl
+ 373:	75 f3                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 375:	5d                   	pop    %ebp
+ 376:	c3                   	ret
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+ 380:	5d                   	pop    %ebp
+  return 0;
+ 381:	31 c0                	xor    %eax,%eax
+}
+ 383:	c3                   	ret
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 395:	31 f6                	xor    %esi,%esi
+{
+ 397:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 398:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 39b:	83 ec 3c             	sub    $0x3c,%esp
+ 39e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 3a1:	eb 32                	jmp    3d5 <gets+0x45>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+    cc = read(0, &c, 1);
+ 3a8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 3ac:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 3b5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 3bc:	e8 1a 01 00 00       	call   4db <read>
+    if(cc < 1)
+ 3c1:	85 c0                	test   %eax,%eax
+ 3c3:	7e 19                	jle    3de <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 3c5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 3cd:	3c 0a                	cmp    $0xa,%al
+ 3cf:	74 10                	je     3e1 <gets+0x51>
+ 3d1:	3c 0d                	cmp    $0xd,%al
+ 3d3:	74 0c                	je     3e1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 3d5:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 3d8:	46                   	inc    %esi
+ 3d9:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 3dc:	7c ca                	jl     3a8 <gets+0x18>
+ 3de:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 3e1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 3e5:	83 c4 3c             	add    $0x3c,%esp
+ 3e8:	89 d8                	mov    %ebx,%eax
+ 3ea:	5b                   	pop    %ebx
+ 3eb:	5e                   	pop    %esi
+ 3ec:	5f                   	pop    %edi
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+
+000003f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3f0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3f1:	31 c0                	xor    %eax,%eax
+{
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	83 ec 18             	sub    $0x18,%esp
+ 3f8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 3fb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 3fe:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 402:	8b 45 08             	mov    0x8(%ebp),%eax
+ 405:	89 04 24             	mov    %eax,(%esp)
+ 408:	e8 f6 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 40d:	85 c0                	test   %eax,%eax
+ 40f:	78 2f                	js     440 <stat+0x50>
+ 411:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 413:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 416:	89 1c 24             	mov    %ebx,(%esp)
+ 419:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 41d:	e8 f9 00 00 00       	call   51b <fstat>
+  close(fd);
+ 422:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 425:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 427:	e8 bf 00 00 00       	call   4eb <close>
+  return r;
+}
+ 42c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 42f:	89 f0                	mov    %esi,%eax
+ 431:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 434:	89 ec                	mov    %ebp,%esp
+ 436:	5d                   	pop    %ebp
+ 437:	c3                   	ret
+ 438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb e5                	jmp    42c <stat+0x3c>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	88 c1                	mov    %al,%cl
+ 45c:	80 e9 30             	sub    $0x30,%cl
+ 45f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 462:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 467:	77 1c                	ja     485 <atoi+0x35>
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 470:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 473:	42                   	inc    %edx
+ 474:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 478:	0f be 02             	movsbl (%edx),%eax
+ 47b:	88 c3                	mov    %al,%bl
+ 47d:	80 eb 30             	sub    $0x30,%bl
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	5b                   	pop    %ebx
+ 486:	89 c8                	mov    %ecx,%eax
+ 488:	5d                   	pop    %ebp
+ 489:	c3                   	ret
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <exit>:
+SYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <exec>:
+SYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <detach>:
+SYSCALL(detach)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <policy>:
+SYSCALL(policy)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <priority>:
+SYSCALL(priority)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <wait_stat>:
+SYSCALL(wait_stat)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <lockstat>:
+SYSCALL(lockstat)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <mmap>:
+SYSCALL(mmap)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <munmap>:
+SYSCALL(munmap)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <shmget>:
+SYSCALL(shmget)
+ 59b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <shmat>:
+SYSCALL(shmat)
+ 5a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <shmdt>:
+SYSCALL(shmdt)
+ 5ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <memstat>:
+SYSCALL(memstat)
+ 5b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getprocs>:
+SYSCALL(getprocs)
+ 5bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <shmctl>:
+SYSCALL(shmctl)
+ 5c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+ 5cb:	66 90                	xchg   %ax,%ax
+ 5cd:	66 90                	xchg   %ax,%ax
+ 5cf:	90                   	nop
+
+000005d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	89 cb                	mov    %ecx,%ebx
+ 5d8:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5db:	89 d1                	mov    %edx,%ecx
+{
+ 5dd:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 5e0:	89 d0                	mov    %edx,%eax
+ 5e2:	c1 e8 1f             	shr    $0x1f,%eax
+ 5e5:	84 c0                	test   %al,%al
+ 5e7:	0f 84 93 00 00 00    	je     680 <printint+0xb0>
+ 5ed:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5f1:	0f 84 89 00 00 00    	je     680 <printint+0xb0>
+    x = -xx;
+ 5f7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5fe:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 605:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 608:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 610:	89 c8                	mov    %ecx,%eax
+ 612:	31 d2                	xor    %edx,%edx
+ 614:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 617:	f7 f3                	div    %ebx
+ 619:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 61c:	0f b6 92 08 0c 00 00 	movzbl 0xc08(%edx),%edx
+ 623:	8d 47 01             	lea    0x1(%edi),%eax
+ 626:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 629:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 62d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 62f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 632:	39 da                	cmp    %ebx,%edx
+ 634:	73 da                	jae    610 <printint+0x40>
+  if(neg)
+ 636:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 639:	85 c0                	test   %eax,%eax
+ 63b:	74 0a                	je     647 <printint+0x77>
+    buf[i++] = '-';
+ 63d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 640:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 645:	89 c7                	mov    %eax,%edi
+ 647:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 64a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 64e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 650:	0f b6 07             	movzbl (%edi),%eax
+ 653:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 656:	b8 01 00 00 00       	mov    $0x1,%eax
+ 65b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 65f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 663:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 666:	89 04 24             	mov    %eax,(%esp)
+ 669:	e8 75 fe ff ff       	call   4e3 <write>
+  while(--i >= 0)
+ 66e:	89 f8                	mov    %edi,%eax
+ 670:	4f                   	dec    %edi
+ 671:	39 d8                	cmp    %ebx,%eax
+ 673:	75 db                	jne    650 <printint+0x80>
+}
+ 675:	83 c4 4c             	add    $0x4c,%esp
+ 678:	5b                   	pop    %ebx
+ 679:	5e                   	pop    %esi
+ 67a:	5f                   	pop    %edi
+ 67b:	5d                   	pop    %ebp
+ 67c:	c3                   	ret
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 680:	31 c0                	xor    %eax,%eax
+ 682:	e9 77 ff ff ff       	jmp    5fe <printint+0x2e>
+ 687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 699:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 69c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 69f:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a2:	84 db                	test   %bl,%bl
+ 6a4:	74 6f                	je     715 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 6a6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 6a9:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 6ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 6ae:	88 d9                	mov    %bl,%cl
+ 6b0:	46                   	inc    %esi
+ 6b1:	89 d3                	mov    %edx,%ebx
+ 6b3:	eb 2b                	jmp    6e0 <printf+0x50>
+ 6b5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 6b8:	83 f8 25             	cmp    $0x25,%eax
+ 6bb:	74 4b                	je     708 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 6bd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 6c9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6cc:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 6d0:	89 3c 24             	mov    %edi,(%esp)
+ 6d3:	e8 0b fe ff ff       	call   4e3 <write>
+  for(i = 0; fmt[i]; i++){
+ 6d8:	0f b6 0e             	movzbl (%esi),%ecx
+ 6db:	46                   	inc    %esi
+ 6dc:	84 c9                	test   %cl,%cl
+ 6de:	74 35                	je     715 <printf+0x85>
+    if(state == 0){
+ 6e0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 6e2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 6e5:	74 d1                	je     6b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6e7:	83 fb 25             	cmp    $0x25,%ebx
+ 6ea:	75 ec                	jne    6d8 <printf+0x48>
+      if(c == 'd'){
+ 6ec:	83 f8 25             	cmp    $0x25,%eax
+ 6ef:	0f 84 53 01 00 00    	je     848 <printf+0x1b8>
+ 6f5:	83 e8 63             	sub    $0x63,%eax
+ 6f8:	83 f8 15             	cmp    $0x15,%eax
+ 6fb:	77 23                	ja     720 <printf+0x90>
+ 6fd:	ff 24 85 b0 0b 00 00 	jmp    *0xbb0(,%eax,4)
+ 704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 708:	0f b6 0e             	movzbl (%esi),%ecx
+ 70b:	46                   	inc    %esi
+        state = '%';
+ 70c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 711:	84 c9                	test   %cl,%cl
+ 713:	75 cb                	jne    6e0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 715:	83 c4 3c             	add    $0x3c,%esp
+ 718:	5b                   	pop    %ebx
+ 719:	5e                   	pop    %esi
+ 71a:	5f                   	pop    %edi
+ 71b:	5d                   	pop    %ebp
+ 71c:	c3                   	ret
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+ 720:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 723:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 726:	b8 01 00 00 00       	mov    $0x1,%eax
+ 72b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 72f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 733:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 737:	89 3c 24             	mov    %edi,(%esp)
+ 73a:	e8 a4 fd ff ff       	call   4e3 <write>
+        putc(fd, c);
+ 73f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 743:	ba 01 00 00 00       	mov    $0x1,%edx
+ 748:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 74b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 74f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 751:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 755:	89 3c 24             	mov    %edi,(%esp)
+ 758:	e8 86 fd ff ff       	call   4e3 <write>
+ 75d:	e9 76 ff ff ff       	jmp    6d8 <printf+0x48>
+ 762:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 768:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 76b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 770:	8b 13                	mov    (%ebx),%edx
+ 772:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 779:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 77c:	89 f8                	mov    %edi,%eax
+ 77e:	e8 4d fe ff ff       	call   5d0 <printint>
+        ap++;
+ 783:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 786:	31 db                	xor    %ebx,%ebx
+ 788:	e9 4b ff ff ff       	jmp    6d8 <printf+0x48>
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 790:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 793:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 795:	83 c0 04             	add    $0x4,%eax
+ 798:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 79b:	85 c9                	test   %ecx,%ecx
+ 79d:	0f 84 cd 00 00 00    	je     870 <printf+0x1e0>
+        while(*s != 0){
+ 7a3:	0f b6 01             	movzbl (%ecx),%eax
+ 7a6:	84 c0                	test   %al,%al
+ 7a8:	0f 84 ce 00 00 00    	je     87c <printf+0x1ec>
+ 7ae:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 7b1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 7b4:	89 ce                	mov    %ecx,%esi
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 7c0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 7c8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 7c9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 7cd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 7d1:	89 3c 24             	mov    %edi,(%esp)
+ 7d4:	e8 0a fd ff ff       	call   4e3 <write>
+        while(*s != 0){
+ 7d9:	0f b6 06             	movzbl (%esi),%eax
+ 7dc:	84 c0                	test   %al,%al
+ 7de:	75 e0                	jne    7c0 <printf+0x130>
+      state = 0;
+ 7e0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 7e3:	31 db                	xor    %ebx,%ebx
+ 7e5:	e9 ee fe ff ff       	jmp    6d8 <printf+0x48>
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7f0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 7f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7f8:	8b 13                	mov    (%ebx),%edx
+ 7fa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 801:	e9 73 ff ff ff       	jmp    779 <printf+0xe9>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 810:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 813:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 818:	8b 10                	mov    (%eax),%edx
+ 81a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 81d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 821:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 824:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 828:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 82b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 82f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 831:	89 3c 24             	mov    %edi,(%esp)
+ 834:	e8 aa fc ff ff       	call   4e3 <write>
+        ap++;
+ 839:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 83d:	e9 96 fe ff ff       	jmp    6d8 <printf+0x48>
+ 842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 848:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 84b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 84e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 853:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 857:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 859:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 85d:	89 3c 24             	mov    %edi,(%esp)
+ 860:	e8 7e fc ff ff       	call   4e3 <write>
+ 865:	e9 6e fe ff ff       	jmp    6d8 <printf+0x48>
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 870:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 872:	b9 a9 0b 00 00       	mov    $0xba9,%ecx
+ 877:	e9 32 ff ff ff       	jmp    7ae <printf+0x11e>
+      state = 0;
+ 87c:	31 db                	xor    %ebx,%ebx
+ 87e:	66 90                	xchg   %ax,%ax
+ 880:	e9 53 fe ff ff       	jmp    6d8 <printf+0x48>
+ 885:	66 90                	xchg   %ax,%ax
+ 887:	66 90                	xchg   %ax,%ax
+ 889:	66 90                	xchg   %ax,%ax
+ 88b:	66 90                	xchg   %ax,%ax
+ 88d:	66 90                	xchg   %ax,%ax
+ 88f:	90                   	nop
+
+00000890 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	83 ec 18             	sub    $0x18,%esp
+ 896:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 899:	89 c3                	mov    %eax,%ebx
+ 89b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 89e:	a1 04 13 00 00       	mov    0x1304,%eax
+ 8a3:	8b 15 00 13 00 00    	mov    0x1300,%edx
+ 8a9:	29 c2                	sub    %eax,%edx
+ 8ab:	39 da                	cmp    %ebx,%edx
+ 8ad:	72 19                	jb     8c8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 8af:	01 c3                	add    %eax,%ebx
+ 8b1:	89 1d 04 13 00 00    	mov    %ebx,0x1304
+  return p;
+}
+ 8b7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 8ba:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 8bd:	89 ec                	mov    %ebp,%esp
+ 8bf:	5d                   	pop    %ebp
+ 8c0:	c3                   	ret
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 8c8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 8cd:	39 c3                	cmp    %eax,%ebx
+ 8cf:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 8d2:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 8d5:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 8d7:	e8 6f fc ff ff       	call   54b <sbrk>
+    if(p == (char*)-1)
+ 8dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 8df:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 8e1:	74 1d                	je     900 <morecore+0x70>
+    if(p != arenaend)
+ 8e3:	39 05 00 13 00 00    	cmp    %eax,0x1300
+ 8e9:	74 0d                	je     8f8 <morecore+0x68>
+    arenaend = p + grow;
+ 8eb:	01 f2                	add    %esi,%edx
+ 8ed:	89 15 00 13 00 00    	mov    %edx,0x1300
+ 8f3:	eb ba                	jmp    8af <morecore+0x1f>
+ 8f5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 8f8:	a1 04 13 00 00       	mov    0x1304,%eax
+ 8fd:	eb ec                	jmp    8eb <morecore+0x5b>
+ 8ff:	90                   	nop
+      return 0;
+ 900:	31 c0                	xor    %eax,%eax
+ 902:	eb b3                	jmp    8b7 <morecore+0x27>
+ 904:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+
+00000910 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 919:	8b 45 08             	mov    0x8(%ebp),%eax
+ 91c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 91f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 922:	85 c0                	test   %eax,%eax
+ 924:	74 1e                	je     944 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 926:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 929:	83 fa 08             	cmp    $0x8,%edx
+ 92c:	77 16                	ja     944 <free+0x34>
+  h = (Header*)ap - 1;
+ 92e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 931:	74 25                	je     958 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 933:	8b 3c 95 20 13 00 00 	mov    0x1320(,%edx,4),%edi
+ 93a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 93d:	89 0c 95 20 13 00 00 	mov    %ecx,0x1320(,%edx,4)
+}
+ 944:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 947:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 94a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 94d:	89 ec                	mov    %ebp,%esp
+ 94f:	5d                   	pop    %ebp
+ 950:	c3                   	ret
+ 951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 958:	8b 15 40 13 00 00    	mov    0x1340,%edx
+ 95e:	85 d2                	test   %edx,%edx
+ 960:	74 54                	je     9b6 <free+0xa6>
+ 962:	39 ca                	cmp    %ecx,%edx
+ 964:	73 36                	jae    99c <free+0x8c>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+ 970:	89 d3                	mov    %edx,%ebx
+ 972:	8b 12                	mov    (%edx),%edx
+ 974:	85 d2                	test   %edx,%edx
+ 976:	74 12                	je     98a <free+0x7a>
+ 978:	39 ca                	cmp    %ecx,%edx
+ 97a:	72 f4                	jb     970 <free+0x60>
+  if(p && END(h) == p){
+ 97c:	85 d2                	test   %edx,%edx
+ 97e:	74 0a                	je     98a <free+0x7a>
+ 980:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 983:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 986:	39 fa                	cmp    %edi,%edx
+ 988:	74 4b                	je     9d5 <free+0xc5>
+  h->s.u.next = p;
+ 98a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 98d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 990:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 994:	39 f1                	cmp    %esi,%ecx
+ 996:	74 29                	je     9c1 <free+0xb1>
+    prev->s.u.next = h;
+ 998:	89 0b                	mov    %ecx,(%ebx)
+ 99a:	eb a8                	jmp    944 <free+0x34>
+  if(p && END(h) == p){
+ 99c:	85 d2                	test   %edx,%edx
+ 99e:	74 16                	je     9b6 <free+0xa6>
+ 9a0:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 9a3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 9a6:	39 f2                	cmp    %esi,%edx
+ 9a8:	75 0c                	jne    9b6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 9aa:	8b 72 04             	mov    0x4(%edx),%esi
+ 9ad:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 9b1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 9b4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 9b6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 9b9:	89 0d 40 13 00 00    	mov    %ecx,0x1340
+ 9bf:	eb 83                	jmp    944 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 9c1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 9c4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 9c8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 9cb:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 9ce:	89 03                	mov    %eax,(%ebx)
+ 9d0:	e9 6f ff ff ff       	jmp    944 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 9d5:	8b 7a 04             	mov    0x4(%edx),%edi
+ 9d8:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 9dc:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 9df:	8b 12                	mov    (%edx),%edx
+ 9e1:	eb a7                	jmp    98a <free+0x7a>
+ 9e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 2c             	sub    $0x2c,%esp
+ 9f9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 9fc:	83 f8 10             	cmp    $0x10,%eax
+ 9ff:	0f 86 52 01 00 00    	jbe    b57 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ a05:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ a07:	ba 01 00 00 00       	mov    $0x1,%edx
+ a0c:	eb 0d                	jmp    a1b <malloc+0x2b>
+ a0e:	66 90                	xchg   %ax,%ax
+ a10:	83 c1 05             	add    $0x5,%ecx
+ a13:	89 d6                	mov    %edx,%esi
+ a15:	d3 e6                	shl    %cl,%esi
+ a17:	39 c6                	cmp    %eax,%esi
+ a19:	73 55                	jae    a70 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ a1b:	89 d9                	mov    %ebx,%ecx
+ a1d:	43                   	inc    %ebx
+ a1e:	83 fb 08             	cmp    $0x8,%ebx
+ a21:	75 ed                	jne    a10 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ a23:	8d 58 07             	lea    0x7(%eax),%ebx
+ a26:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ a29:	39 c3                	cmp    %eax,%ebx
+ a2b:	0f 82 1f 01 00 00    	jb     b50 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ a31:	a1 40 13 00 00       	mov    0x1340,%eax
+ a36:	85 c0                	test   %eax,%eax
+ a38:	0f 84 ee 00 00 00    	je     b2c <malloc+0x13c>
+ a3e:	b9 40 13 00 00       	mov    $0x1340,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ a43:	8b 50 04             	mov    0x4(%eax),%edx
+ a46:	39 da                	cmp    %ebx,%edx
+ a48:	0f 82 d2 00 00 00    	jb     b20 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ a4e:	29 da                	sub    %ebx,%edx
+ a50:	83 fa 17             	cmp    $0x17,%edx
+ a53:	0f 87 b7 00 00 00    	ja     b10 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ a59:	8b 10                	mov    (%eax),%edx
+ a5b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ a5d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ a63:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ a66:	83 c0 08             	add    $0x8,%eax
+}
+ a69:	5b                   	pop    %ebx
+ a6a:	5e                   	pop    %esi
+ a6b:	5f                   	pop    %edi
+ a6c:	5d                   	pop    %ebp
+ a6d:	c3                   	ret
+ a6e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ a70:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ a72:	8b 04 9d 20 13 00 00 	mov    0x1320(,%ebx,4),%eax
+ a79:	85 c0                	test   %eax,%eax
+ a7b:	74 23                	je     aa0 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ a7d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ a7f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ a82:	89 14 9d 20 13 00 00 	mov    %edx,0x1320(,%ebx,4)
+    h->s.u.cls = cls;
+ a89:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ a8c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ a8f:	83 c4 2c             	add    $0x2c,%esp
+ a92:	5b                   	pop    %ebx
+ a93:	5e                   	pop    %esi
+ a94:	5f                   	pop    %edi
+ a95:	5d                   	pop    %ebp
+ a96:	c3                   	ret
+ a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ aa0:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ aa3:	31 d2                	xor    %edx,%edx
+ aa5:	b8 00 10 00 00       	mov    $0x1000,%eax
+ aaa:	f7 f6                	div    %esi
+ aac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ aaf:	0f af c6             	imul   %esi,%eax
+ ab2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ ab5:	e8 d6 fd ff ff       	call   890 <morecore>
+ aba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ abd:	85 c0                	test   %eax,%eax
+ abf:	0f 84 8b 00 00 00    	je     b50 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ ac5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ ac8:	8b 0c 9d 20 13 00 00 	mov    0x1320(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ acf:	31 d2                	xor    %edx,%edx
+ ad1:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ ad4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ad7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ ada:	eb 06                	jmp    ae2 <malloc+0xf2>
+ adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ ae0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ ae2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ ae4:	42                   	inc    %edx
+ ae5:	89 c1                	mov    %eax,%ecx
+ ae7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ aea:	39 d7                	cmp    %edx,%edi
+ aec:	75 f2                	jne    ae0 <malloc+0xf0>
+ aee:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ af1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ af4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ af7:	89 04 9d 20 13 00 00 	mov    %eax,0x1320(,%ebx,4)
+ afe:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ b01:	29 f0                	sub    %esi,%eax
+ b03:	01 c2                	add    %eax,%edx
+ b05:	89 d0                	mov    %edx,%eax
+ b07:	e9 71 ff ff ff       	jmp    a7d <malloc+0x8d>
+ b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ b10:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ b13:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ b16:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ b18:	89 58 04             	mov    %ebx,0x4(%eax)
+ b1b:	e9 3d ff ff ff       	jmp    a5d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ b20:	89 c1                	mov    %eax,%ecx
+ b22:	8b 00                	mov    (%eax),%eax
+ b24:	85 c0                	test   %eax,%eax
+ b26:	0f 85 17 ff ff ff    	jne    a43 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ b2c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ b2f:	74 1f                	je     b50 <malloc+0x160>
+ b31:	8d 43 08             	lea    0x8(%ebx),%eax
+ b34:	e8 57 fd ff ff       	call   890 <morecore>
+ b39:	85 c0                	test   %eax,%eax
+ b3b:	74 13                	je     b50 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ b3d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ b43:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ b46:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ b49:	e9 41 ff ff ff       	jmp    a8f <malloc+0x9f>
+ b4e:	66 90                	xchg   %ax,%ax
+      return 0;
+ b50:	31 c0                	xor    %eax,%eax
+ b52:	e9 38 ff ff ff       	jmp    a8f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ b57:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ b5c:	31 db                	xor    %ebx,%ebx
+ b5e:	e9 0f ff ff ff       	jmp    a72 <malloc+0x82>
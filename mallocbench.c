@@ -0,0 +1,76 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Time malloc()/free() under a few allocation patterns.
+// usage: mallocbench [rounds]
+
+#define NSLOT 256
+
+static uint seed = 1;
+
+static uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+static void* slot[NSLOT];
+
+static void
+report(char *name, int ops, int t0)
+{
+  printf(1, "%s: %d ops, %d ticks\n", name, ops, uptime() - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int rounds, i, j, t0;
+  uint n;
+
+  rounds = 20000;
+  if(argc > 1)
+    rounds = atoi(argv[1]);
+
+  // Same small size, allocated and freed back to back.
+  t0 = uptime();
+  for(i = 0; i < rounds; i++)
+    free(malloc(32));
+  report("pairs", rounds, t0);
+
+  // Random small sizes, with a window of live blocks.
+  t0 = uptime();
+  for(i = 0; i < rounds; i++){
+    j = rand() % NSLOT;
+    free(slot[j]);
+    n = 1 + rand() % 512;
+    if((slot[j] = malloc(n)) == 0){
+      printf(2, "mallocbench: out of memory\n");
+      exit(1);
+    }
+    memset(slot[j], 0, n);
+  }
+  report("random", rounds, t0);
+  for(j = 0; j < NSLOT; j++){
+    free(slot[j]);
+    slot[j] = 0;
+  }
+
+  // Large blocks.
+  t0 = uptime();
+  for(i = 0; i < rounds / 10; i++){
+    j = rand() % 16;
+    free(slot[j]);
+    if((slot[j] = malloc(4096 + rand() % 16384)) == 0){
+      printf(2, "mallocbench: out of memory\n");
+      exit(1);
+    }
+  }
+  report("large", rounds / 10, t0);
+  for(j = 0; j < 16; j++)
+    free(slot[j]);
+
+  exit(0);
+}
@@ -35,6 +35,7 @@ ideintr(void)
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// The copy is synchronous, so a B_ASYNC buf is released at once.
 void
 iderw(struct buf *b)
 {
@@ -57,4 +58,19 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    bdone(b);
+  }
+}
+
+void
+idesubmit(struct buf *b)
+{
+  iderw(b);
+}
+
+void
+idewaitbuf(struct buf *b)
+{
 }
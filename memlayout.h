@@ -4,7 +4,7 @@
 #define PHYSTOP 0xE000000           // Top physical memory
 #define DEVSPACE 0xFE000000         // Other devices are at high addresses
 
-// Key addresses for address space layout (see kmap in vm.c for layout)
+// Key addresses for address space layout (see kvminit in vm.c for layout)
 #define KERNBASE 0x80000000         // First kernel virtual address
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
 
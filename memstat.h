@@ -0,0 +1,19 @@
+// Memory usage, as reported by memstat() and getprocs().
+// Sizes are in pages.
+
+struct memstat {
+  uint total;     // Pages managed by the page allocator
+  uint free;      // Pages free, including the zeroed pool
+  uint zeroed;    // Free pages already zeroed
+  uint ptpages;   // Page directory and page table pages
+};
+
+struct procinfo {
+  int pid;
+  int ppid;
+  int state;      // enum procstate
+  uint sz;        // Size of the heap, in bytes
+  uint rss;       // Resident user pages
+  uint ptpages;   // Page directory and page table pages
+  char name[16];
+};
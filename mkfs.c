@@ -22,7 +22,7 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog = LOGSIZE+1;  // Header and data blocks; see -l
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -40,6 +40,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void wdir(uint inum, struct dirent *de, int n);
 
 // convert to intel byte order
 ushort
@@ -67,17 +68,28 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  int i, cc, fd, first;
+  uint rootino, inum;
+  struct dirent de[NINODES];
   char buf[BSIZE];
-  struct dinode din;
+  int nde;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs fs.img [-l nlog] files...\n");
+    exit(1);
+  }
+
+  first = 2;
+  if(argc > 3 && strcmp(argv[2], "-l") == 0){
+    nlog = atoi(argv[3]);
+    first = 4;
+  }
+  if(nlog - 1 < MAXOPBLOCKS || nlog - 1 > LOGSIZE){
+    fprintf(stderr, "mkfs: nlog must be between %d and %d\n",
+            MAXOPBLOCKS + 1, LOGSIZE + 1);
     exit(1);
   }
 
@@ -117,17 +129,14 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  bzero(de, sizeof(de));
+  de[0].inum = xshort(rootino);
+  strcpy(de[0].name, ".");
+  de[1].inum = xshort(rootino);
+  strcpy(de[1].name, "..");
+  nde = 2;
 
-  for(i = 2; i < argc; i++){
+  for(i = first; i < argc; i++){
     assert(index(argv[i], '/') == 0);
 
     if((fd = open(argv[i], 0)) < 0){
@@ -144,10 +153,10 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    assert(nde < NINODES);
+    de[nde].inum = xshort(inum);
+    strncpy(de[nde].name, argv[i], DIRSIZ);
+    nde++;
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +164,7 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  wdir(rootino, de, nde);
 
   balloc(freeblock);
 
@@ -252,6 +256,38 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the block number of block fbn of din,
+// allocating it and any indirect blocks on the way.
+uint
+bmap(struct dinode *din, uint fbn)
+{
+  uint indirect[NINDIRECT];
+  uint addr, level, span, div, i;
+
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0)
+      din->addrs[fbn] = xint(freeblock++);
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+  for(level = 1, span = NINDIRECT; fbn >= span; level++, span *= NINDIRECT)
+    fbn -= span;
+  assert(level <= 3);
+  if(xint(din->addrs[NDIRECT+level-1]) == 0)
+    din->addrs[NDIRECT+level-1] = xint(freeblock++);
+  addr = xint(din->addrs[NDIRECT+level-1]);
+  for(div = span / NINDIRECT; div > 0; div /= NINDIRECT){
+    rsect(addr, (char*)indirect);
+    i = fbn / div % NINDIRECT;
+    if(indirect[i] == 0){
+      indirect[i] = xint(freeblock++);
+      wsect(addr, (char*)indirect);
+    }
+    addr = xint(indirect[i]);
+  }
+  return addr;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +295,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -268,22 +303,7 @@ iappend(uint inum, void *xp, int n)
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    x = bmap(&din, fbn);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -295,3 +315,90 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+int
+dxcmp(const void *a, const void *b)
+{
+  uint x, y;
+
+  x = dxhash(((struct dirent*)a)->name);
+  y = dxhash(((struct dirent*)b)->name);
+  return x < y ? -1 : x > y;
+}
+
+// Set index entry i of the node whose head is h, and make it
+// the last one.
+void
+dxset(struct dxhead *h, int i, uint hash, uint bn)
+{
+  struct dxslot *s;
+
+  s = (struct dxslot*)(h + 1) + i/2;
+  s->hash[i%2] = xint(hash);
+  s->block[i%2] = xshort(bn);
+  h->count = xint(i + 1);
+}
+
+// Write the n entries de[], "." and ".." first, to the empty
+// directory inum in the format the kernel expects: linear if
+// they fit in one block, hashed otherwise.
+void
+wdir(uint inum, struct dirent *de, int n)
+{
+  char buf[BSIZE];
+  struct dxhead *h;
+  int i, j, k, nleaf, nnode, per;
+  int start[NINODES+1];
+
+  bzero(buf, sizeof(buf));
+  if(n <= DPB){
+    bcopy(de, buf, n * sizeof(*de));
+    iappend(inum, buf, sizeof(buf));
+    return;
+  }
+
+  // Fill leaves 3/4 full, so that later links rarely split
+  // them, keeping names with equal hashes in the same leaf.
+  qsort(de + 2, n - 2, sizeof(*de), dxcmp);
+  nleaf = 0;
+  for(i = 2; i < n; i = j){
+    start[nleaf++] = i;
+    for(j = i + 1; j < n; j++)
+      if(j - i >= DPB*3/4 && dxhash(de[j-1].name) != dxhash(de[j].name))
+        break;
+    assert(j - i <= DPB);
+  }
+  start[nleaf] = n;
+  per = DXNODE*3/4;
+  nnode = nleaf <= DXROOT ? 0 : (nleaf + per - 1) / per;
+  assert(nnode <= DXROOT);
+
+  // Block 0 is the root, leaves follow, then index blocks.
+  bcopy(de, buf, 2 * sizeof(*de));
+  h = (struct dxhead*)(buf + 2 * sizeof(*de));
+  h->magic = xint(DXMAGIC);
+  h->levels = nnode > 0;
+  if(nnode == 0){
+    for(i = 0; i < nleaf; i++)
+      dxset(h, i, i ? dxhash(de[start[i]].name) : 0, 1 + i);
+  } else {
+    for(k = 0; k < nnode; k++)
+      dxset(h, k, k ? dxhash(de[start[k*per]].name) : 0, 1 + nleaf + k);
+  }
+  iappend(inum, buf, sizeof(buf));
+
+  for(i = 0; i < nleaf; i++){
+    bzero(buf, sizeof(buf));
+    bcopy(de + start[i], buf, (start[i+1] - start[i]) * sizeof(*de));
+    iappend(inum, buf, sizeof(buf));
+  }
+
+  for(k = 0; k < nnode; k++){
+    bzero(buf, sizeof(buf));
+    h = (struct dxhead*)buf;
+    h->magic = xint(DXMAGIC);
+    for(i = k*per; i < nleaf && i < (k+1)*per; i++)
+      dxset(h, i - k*per, i ? dxhash(de[start[i]].name) : 0, 1 + i);
+    iappend(inum, buf, sizeof(buf));
+  }
+}
@@ -0,0 +1,16 @@
+// Protection and flags for mmap().
+#define PROT_READ      0x1   // Pages may be read
+#define PROT_WRITE     0x2   // Pages may be written
+#define PROT_EXEC      0x4   // Pages may be executed (implied by PROT_READ)
+
+#define MAP_SHARED     0x01  // Writes go back to the file, and are shared with children
+#define MAP_PRIVATE    0x02  // Writes stay private to the process
+#define MAP_ANONYMOUS  0x20  // Zero-filled memory with no file behind it
+
+#define MAP_FAILED     ((void*)-1)
+
+// Key for shmget() that always creates a new segment.
+#define IPC_PRIVATE    0
+
+// shmctl() command that removes a segment.
+#define IPC_RMID       0
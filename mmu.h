@@ -10,6 +10,7 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PGE         0x00000080      // Page global enable
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -82,6 +83,7 @@ struct segdesc {
 // Page directory and page table constants.
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
+#define SUPERPGSIZE     (PGSIZE*NPTENTRIES) // bytes mapped by a PTE_PS directory entry
 #define PGSIZE          4096    // bytes mapped by a page
 
 #define PTXSHIFT        12      // offset of PTX in a linear address
@@ -94,7 +96,15 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global: not flushed by a %cr3 load
+#define PTE_COW         0x200   // Copy-on-write (available to software)
+
+// Page fault error code bits
+#define FEC_P           0x001   // Fault on a present page (protection)
+#define FEC_WR          0x002   // Fault was caused by a write
+#define FEC_U           0x004   // Fault happened in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -6,11 +6,18 @@
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
+#define NDENTRY     128  // entries in the directory entry cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define NSHM         16  // maximum number of shared memory segments
+#define SHMMAXPAGES  64  // maximum pages in a shared memory segment
+#define NVMA         16  // mapped memory ranges (exec segments, mmap) per process
+#define MAXOPBLOCKS  12  // max # of blocks any FS op writes
+#define IPUTBLOCKS   3  // max # of blocks an FS op that only drops inodes writes
+#define LOGSIZE      127  // max data blocks in on-disk log (fills the header block)
+#define NBUF         (LOGSIZE+MAXOPBLOCKS*3)  // initial and minimum size of disk block cache
+#define BCACHEPCT    25  // max % of memory the disk block cache may grow to
+#define RAWINDOW     8  // blocks read ahead of a sequential reader
+#define FSSIZE       2000  // size of file system in blocks
 
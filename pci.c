@@ -0,0 +1,55 @@
+// PCI configuration space access, through configuration
+// mechanism #1 (I/O ports 0xCF8 and 0xCFC). Just enough to find
+// a device by class and set it up; xv6 doesn't enumerate bridges,
+// so only bus 0 is searched.
+//
+// A device function is named by a tag: its bus, device and
+// function numbers in the layout of CONFIG_ADDRESS.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_CONFIG_ADDR  0xCF8
+#define PCI_CONFIG_DATA  0xCFC
+
+#define PCI_ID           0x00  // Vendor ID (low), device ID (high)
+#define PCI_CLASS        0x08  // Revision, prog IF, subclass, class
+
+#define PCITAG(bus, dev, func)  (((bus) << 16) | ((dev) << 11) | ((func) << 8))
+
+// Read the 32-bit configuration register at offset off.
+uint
+pciread(int tag, int off)
+{
+  outl(PCI_CONFIG_ADDR, 0x80000000 | tag | (off & 0xfc));
+  return inl(PCI_CONFIG_DATA);
+}
+
+void
+pciwrite(int tag, int off, uint v)
+{
+  outl(PCI_CONFIG_ADDR, 0x80000000 | tag | (off & 0xfc));
+  outl(PCI_CONFIG_DATA, v);
+}
+
+// Return the tag of the first function on bus 0 with the given
+// class and subclass, or -1 if there is none.
+int
+pcifind(uint class, uint subclass)
+{
+  int dev, func, tag;
+  uint c;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      tag = PCITAG(0, dev, func);
+      if((pciread(tag, PCI_ID) & 0xffff) == 0xffff)
+        continue;
+      c = pciread(tag, PCI_CLASS);
+      if((c >> 24) == class && ((c >> 16) & 0xff) == subclass)
+        return tag;
+    }
+  }
+  return -1;
+}
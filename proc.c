@@ -7,6 +7,7 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "memstat.h"
 
 extern PriorityQueue pq;
 extern RoundRobinQueue rrq;
@@ -75,11 +76,29 @@ boolean (*isQEmptyArr [3])(void) = {
 	[2] isEmptyPQ
 };
 
+// Locking protocol. There is no lock over the whole table:
+//  * p->lock protects p->state, p->chan, p->killed, p->pid and the
+//    per-process time accounting. It is held across swtch() into and
+//    out of the scheduler.
+//  * runq.lock protects the scheduling structures in ass1ds.cpp
+//    (pq, rrq, rpholder), the policy function pointers,
+//    time_quantum_counter, p->priority and p->accumulator.
+//  * wait_lock protects p->parent of every process, and makes exit()
+//    waking its parent atomic with respect to wait() going to sleep.
+// Locks are acquired in the order wait_lock, p->lock, runq.lock.
+// sleep() holds p->lock before it releases the caller's lock and
+// wakeup() takes p->lock before changing p->state, so no wakeup
+// can be lost between the two.
 struct {
-  struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+struct {
+  struct spinlock lock;
+} runq;
+
+struct spinlock wait_lock;
+
 static struct proc *initproc;
 static struct proc *lastProc = 0;
 
@@ -87,8 +106,6 @@ int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void policy(int toPolicy) {
 
 	if(toPolicy < 0 || toPolicy > 2){
@@ -100,14 +117,14 @@ void policy(int toPolicy) {
 		//cprintf("Allready in this policy, doing nothing...\n");
 		return;
 	}
-	acquire(&ptable.lock);
+	acquire(&runq.lock);
 	switchFromPolicy(toPolicy);
 	pol = toPolicy;
 	switchFromPolicy = switchFromPolicyArr[toPolicy];
 	signToQ = signToQArr[toPolicy];
 	getProc = getProcArr[toPolicy];
 	isQEmpty = isQEmptyArr[toPolicy];
-	release(&ptable.lock);
+	release(&runq.lock);
 }
 
 boolean isEmptyRRQ(){
@@ -255,12 +272,14 @@ struct proc * getExtPQProc(){
 
 			 }
 			 if(nextProc == null){
-				 panic("no runnable proc to choose");
+				 nextProc = p;
 			 }
 			 if(p!=nextProc){
 				 pq.put(p);
+				 // nextProc's state was read without its lock, so it may
+				 // not be queued yet (or any more); fall back to the minimum.
 				 if(!pq.extractProc(nextProc)){
-					 panic("RUNNABLE proc not in queue");
+					 nextProc = pq.extractMin();
 				 }
 			 }
 		}
@@ -281,7 +300,12 @@ pinit(void)
 	signToQ = signToQArr[pol];
 	getProc = getProcArr[pol];
 	isQEmpty = isQEmptyArr[pol];
-  initlock(&ptable.lock, "ptable");
+  struct proc *p;
+
+  initlock(&runq.lock, "runq");
+  initlock(&wait_lock, "wait");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    initlock(&p->lock, "proc");
 }
 
 // Must be called with interrupts disabled
@@ -333,23 +357,28 @@ allocproc(void)
 {
   struct proc *p;
   char *sp;
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state != UNUSED)  // unlocked peek; checked again below
+      continue;
+    acquire(&p->lock);
     if(p->state == UNUSED)
       goto found;
-
-  release(&ptable.lock);
+    release(&p->lock);
+  }
   return 0;
 
 found:
   p->state = EMBRYO;
-  p->pid = nextpid++;
+  p->pid = __sync_fetch_and_add(&nextpid, 1);
 
-  release(&ptable.lock);
+  release(&p->lock);
 	p->priority = DEFAULT_PRIORITY;
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
+    acquire(&p->lock);
     p->state = UNUSED;
+    release(&p->lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -382,6 +411,41 @@ found:
   return p;
 }
 
+// Free a process slot and the kernel stack and memory it holds.
+// The caller must hold p->lock, and p must not be running.
+static void
+freeproc(struct proc *p)
+{
+  if(p->kstack)
+    kfree(p->kstack);
+  p->kstack = 0;
+  if(p->pgdir)
+    freevm(p->pgdir);
+  p->pgdir = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+  p->bedTime = MAX_LONG;
+  p->rutime = 0;
+  p->retime = 0;
+  p->stime = 0;
+  p->ttime = 0;
+  p->ctime = 0;
+}
+
+// Mark p RUNNABLE and put it on the queue of the current policy.
+// The caller must hold p->lock.
+static void
+makerunnable(struct proc *p, int isNew)
+{
+  p->state = RUNNABLE;
+  acquire(&runq.lock);
+  signToQ(p, isNew);
+  release(&runq.lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -413,32 +477,39 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
-
-  p->state = RUNNABLE;
-
-	signToQ(p, NEW_PROCESS);
-  release(&ptable.lock);
+  acquire(&p->lock);
+  makerunnable(p, NEW_PROCESS);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
+// Growing only moves sz; the pages are allocated and
+// zeroed by pagefault() when first touched.
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
 {
   uint sz;
+  int i;
   struct proc *curproc = myproc();
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n < sz || sz + n >= KERNBASE)
       return -1;
+    // Don't grow into mmap()ed memory.
+    for(i = 0; i < NVMA; i++)
+      if(curproc->vma[i].end && !(curproc->vma[i].flags & VMA_EXEC) &&
+         sz + n > curproc->vma[i].start)
+        return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   }
   curproc->sz = sz;
-  switchuvm(curproc);
+  if(n < 0)
+    lcr3(V2P(curproc->pgdir));  // flush the TLB of the freed pages
   return 0;
 }
 
@@ -458,14 +529,13 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz, curproc->vma)) == 0){
+    acquire(&np->lock);
+    freeproc(np);
+    release(&np->lock);
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -475,18 +545,25 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  for(i = 0; i < NVMA; i++){
+    np->vma[i] = curproc->vma[i];
+    if(np->vma[i].ip)
+      idup(np->vma[i].ip);
+    if(np->vma[i].end && (np->vma[i].flags & VMA_SHM))
+      shmdup(np->vma[i].off);
+  }
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
-
-  np->state = RUNNABLE;
-
-	signToQ(np,NEW_PROCESS);
+  acquire(&wait_lock);
+  np->parent = curproc;
+  release(&wait_lock);
 
-  release(&ptable.lock);
+  acquire(&np->lock);
+  makerunnable(np, NEW_PROCESS);
+  release(&np->lock);
 
   return pid;
 }
@@ -499,6 +576,7 @@ exit(int status)
 {
   struct proc *curproc = myproc();
   struct proc *p;
+  struct vma *v;
   int fd;
 
   if(curproc == initproc)
@@ -512,32 +590,40 @@ exit(int status)
     }
   }
 
+  // Write back shared file mappings.
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    vmasync(curproc->pgdir, v);
+
   begin_op();
   iput(curproc->cwd);
+  vmaclear(curproc->vma, NVMA);
   end_op();
   curproc->cwd = 0;
 
-  acquire(&ptable.lock);
-	curproc->exit_status = status;
-
+  acquire(&wait_lock);
 
   // Parent might be sleeping in wait(0).
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
-  // Pass abandoned children to init.
+  // Pass abandoned children to init. A child only becomes a
+  // ZOMBIE while holding wait_lock, so its state is stable here.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
+
+  acquire(&curproc->lock);
+	curproc->exit_status = status;
 	uint curtick;
 	getTicks(&curtick);
 	curproc->ttime = curtick;
 	curproc->rutime += (curtick - curproc->startRunningTime);
   // Jump into the scheduler, never to return.
   curproc->state = ZOMBIE;
+  release(&wait_lock);
 	sched();
   panic("zombie exit");
 }
@@ -548,10 +634,10 @@ int
 wait(int * status)
 {
 	struct proc *p;
-  int havekids, pid;
+  int havekids, pid, xstatus;
   struct proc *curproc = myproc();
 
-  acquire(&ptable.lock);
+  acquire(&wait_lock);
   for(;;){
     // Scan through table looking for exited children.
     havekids = 0;
@@ -559,37 +645,33 @@ wait(int * status)
       if(p->parent != curproc)
         continue;
       havekids = 1;
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-				p->bedTime = MAX_LONG;
+        xstatus = p->exit_status;
+        freeproc(p);
+        release(&p->lock);
+        release(&wait_lock);
 
 				// discard the status if it's null
 				if(status != null){
-					*status = p->exit_status;
+					*status = xstatus;
 				}
-        release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
     if(!havekids || curproc->killed){
-      release(&ptable.lock);
+      release(&wait_lock);
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in exit.)
 
-    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+    sleep(curproc, &wait_lock);  //DOC: wait-sleep
 
   }
 }
@@ -598,26 +680,28 @@ wait(int * status)
 int detach(int pid){
 	struct proc *p;
 	struct proc *curproc = myproc();
-	acquire(&ptable.lock);
+	acquire(&wait_lock);
 	for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
 		if (pid!= p->pid || curproc!= p->parent)
 			continue;
 
 		p->parent = initproc;
-		release(&ptable.lock);
+		if(p->state == ZOMBIE)
+			wakeup(initproc);
+		release(&wait_lock);
 		return 0;
 
 	}
-	release(&ptable.lock);
+	release(&wait_lock);
 	//cprintf("Detach failed, no child proccess with pid %d \n", pid);
 	return -1;
 }
 void priority(int priority){
 
 	if(priority >= min_priority && priority <= max_priority){
-		acquire(&ptable.lock);
+		acquire(&runq.lock);
 	 	myproc()->priority = priority;
-		release(&ptable.lock);
+		release(&runq.lock);
  	}
  	//else panic("Priorety is not in allowed range");
 
@@ -625,10 +709,11 @@ void priority(int priority){
 
 int wait_stat(int *status, struct perf *performance) {
 	struct proc *p;
-	int havekids, pid;
+	int havekids, pid, xstatus;
+	struct perf perf;
 	struct proc *curproc = myproc();
 
-	acquire(&ptable.lock);
+	acquire(&wait_lock);
 	for(;;){
 		// Scan through table looking for exited children.
 		havekids = 0;
@@ -636,47 +721,39 @@ int wait_stat(int *status, struct perf *performance) {
 			if(p->parent != curproc)
 				continue;
 			havekids = 1;
+			acquire(&p->lock);
 			if(p->state == ZOMBIE){
-				performance->ctime = p->ctime;
-				performance->ttime = p->ttime;
-				performance->stime = p->stime;
-				performance->retime = p->retime;
-				performance->rutime = p->rutime;
+				perf.ctime = p->ctime;
+				perf.ttime = p->ttime;
+				perf.stime = p->stime;
+				perf.retime = p->retime;
+				perf.rutime = p->rutime;
 				// Found one.
 				pid = p->pid;
-				kfree(p->kstack);
-				p->kstack = 0;
-				freevm(p->pgdir);
-				p->pid = 0;
-				p->parent = 0;
-				p->name[0] = 0;
-				p->killed = 0;
-				p->state = UNUSED;
-				p->bedTime = MAX_LONG;
-				p->rutime = 0;
-				p->retime = 0;
-				p->stime = 0;
-				p->ttime = 0;
-				p->ctime = 0;
+				xstatus = p->exit_status;
+				freeproc(p);
+				release(&p->lock);
+				release(&wait_lock);
 
+				*performance = perf;
 				// discard the status if it's null
 				if(status != null){
-					*status = p->exit_status;
+					*status = xstatus;
 				}
-				release(&ptable.lock);
 				return pid;
 			}
+			release(&p->lock);
 		}
 
 		// No point waiting if we don't have any children.
 		if(!havekids || curproc->killed){
-			release(&ptable.lock);
+			release(&wait_lock);
 			return -1;
 		}
 
-		// Wait for children to exit.  (See wakeup1 call in proc_exit.)
+		// Wait for children to exit.  (See wakeup call in exit.)
 
-		sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+		sleep(curproc, &wait_lock);  //DOC: wait-sleep
 
 	}
 }
@@ -723,13 +800,33 @@ scheduler(void){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
+    // Unlocked peek, so idle CPUs don't hammer runq.lock.
+    if(isQEmpty()){
+      // Don't idle on a process's page table: freevm() waits
+      // for every CPU to stop using it.
+      if(c->pgdir){
+        switchkvm();
+        c->pgdir = 0;
+      }
+      kzeroidle();
+      continue;
+    }
+
+    acquire(&runq.lock);
+    if(isQEmpty()){
+      release(&runq.lock);
+      continue;
+    }
+    p = getProc();
+    release(&runq.lock);
+
+    // Only the CPU that dequeued p may change its state, but the
+    // CPU p last ran on may still be switching away from it;
+    // acquiring p->lock waits for that swtch() to finish.
+    acquire(&p->lock);
 
-		if (!isQEmpty()){
-			p = getProc();
       // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
+      // to release p->lock and then reacquire it
       // before jumping back to us.
       c->proc = p;
       switchuvm(p);
@@ -737,21 +834,29 @@ scheduler(void){
 			p->retime += curtick - p->readyStartTime;
       p->state = RUNNING;
 			p->startRunningTime = curtick;
+			acquire(&runq.lock);
 			rpholder.add(p);
+			release(&runq.lock);
       swtch(&(c->scheduler), p->context);
+			acquire(&runq.lock);
 			rpholder.remove(p);
 			p->bedTime = time_quantum_counter;
-			switchkvm();
+			release(&runq.lock);
+			// Keep p's page table loaded in case p runs here next;
+			// the scheduler itself only uses kernel mappings.
+			// A ZOMBIE's page table is about to be freed, though.
+			if(p->state == ZOMBIE){
+				switchkvm();
+				c->pgdir = 0;
+			}
 			c->proc = 0;
 			 // Process is done running for now.
       // It should have changed its p->state before coming back.
 
-    }
-    release(&ptable.lock);
-
+    release(&p->lock);
   }
 }
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -764,8 +869,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -782,11 +887,10 @@ void
 yield(void)
 {
 	struct proc * p = myproc();
-  acquire(&ptable.lock);  //DOC: yieldlock
-  p->state = RUNNABLE;
-	signToQ(p, OLD_PROCESS);
+  acquire(&p->lock);  //DOC: yieldlock
+  makerunnable(p, OLD_PROCESS);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -795,8 +899,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -828,16 +932,16 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Once we hold p->lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup locks p->lock before changing p->state),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  // chan and state are set before lk is released so that
+  // wakeup()'s unlocked peek, made while holding lk, sees them.
+  acquire(&p->lock);  //DOC: sleeplock1
+
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
@@ -846,6 +950,7 @@ sleep(void *chan, struct spinlock *lk)
 	p->rutime += (currtick - p->startRunningTime);
 	p->bedTime = currtick;
 	int beforTick = currtick;
+  release(lk);
 	sched();
 	getTicks(&currtick);
 	int afterTick = currtick;
@@ -855,34 +960,29 @@ sleep(void *chan, struct spinlock *lk)
   p->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);  //DOC: sleeplock2
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
-{
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan){
-      p->state = RUNNABLE;
-			signToQ(p,NEW_PROCESS);
-		}
-}
-
-// Wake up all processes sleeping on chan.
+// The caller should hold the lock the sleepers passed to sleep().
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    // Unlocked peek to skip most of the table. A sleeper sets chan
+    // and state before releasing the lock our caller holds, so it
+    // cannot be missed here.
+    if(p->state != SLEEPING || p->chan != chan)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan)
+      makerunnable(p, NEW_PROCESS);
+    release(&p->lock);
+  }
 }
 
 // Kill the process with the given pid.
@@ -893,23 +993,56 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
-      if(p->state == SLEEPING){
-        p->state = RUNNABLE;
-				signToQ(p,NEW_PROCESS);
-			}
-      release(&ptable.lock);
+      if(p->state == SLEEPING)
+        makerunnable(p, NEW_PROCESS);
+      release(&p->lock);
       return 0;
     }
+    release(&p->lock);
   }
-  release(&ptable.lock);
   return -1;
 }
 
+// Copy a summary of up to n live processes, including their
+// memory use, to pi. Returns the number of entries filled in.
+int
+getprocs(struct procinfo *pi, int n)
+{
+  struct procinfo info;
+  struct proc *p;
+  int i;
+
+  i = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+    acquire(&wait_lock);
+    acquire(&p->lock);
+    if(p->state == UNUSED){
+      release(&p->lock);
+      release(&wait_lock);
+      continue;
+    }
+    info.pid = p->pid;
+    info.ppid = p->parent ? p->parent->pid : 0;
+    info.state = p->state;
+    info.sz = p->sz;
+    safestrcpy(info.name, p->name, sizeof(info.name));
+    if(p->pgdir)
+      uvmstat(p->pgdir, &info.rss, &info.ptpages);
+    else
+      info.rss = info.ptpages = 0;
+    release(&p->lock);
+    release(&wait_lock);
+    // Write to user memory with no locks held.
+    pi[i++] = info;
+  }
+  return i;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "spinlock.h"
+
 // Per-CPU state
 struct cpu {
   uchar apicid;                // Local APIC ID
@@ -10,6 +12,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  pde_t *volatile pgdir;       // Process page table in %cr3, or 0 for kpgdir
 };
 
 extern struct cpu cpus[NCPU];
@@ -37,19 +40,40 @@ struct context {
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
+// A range of user memory whose pages are read from a file, or
+// zero-filled, the first time they are touched (see pagefault()
+// in vm.c). Created by exec() for ELF segments and by mmap().
+struct vma {
+  uint start;                    // First address; page-aligned
+  uint end;                      // One past the last address; 0 if the slot is free
+  struct inode *ip;              // Backing file, or 0 for anonymous memory
+  uint off;                      // File offset of start, or segment id for VMA_SHM
+  uint filesz;                   // Bytes read from the file; the rest is zero
+  int perm;                      // PTE permissions of the pages
+  int flags;                     // MAP_SHARED or MAP_PRIVATE, and VMA_EXEC
+};
+
+#define VMA_EXEC  0x1000         // ELF segment mapped by exec(), not by mmap()
+#define VMA_SHM   0x2000         // Shared memory segment attached by shmat()
+
 struct proc {
+  struct spinlock lock;          // Protects state, chan, killed, pid (see proc.c)
   uint sz;                       // Size of process memory (bytes)
   pde_t* pgdir;                  // Page table
   char *kstack;                  // Bottom of kernel stack for this process
   enum procstate volatile state; // Process state
   int pid;                       // Process ID
-  struct proc *parent;           // Parent process
+  struct proc *parent;           // Parent process, protected by wait_lock
   struct trapframe *tf;          // Trap frame for current syscall
   struct context *context;       // swtch() here to run process
   void *chan;                    // If non-zero, sleeping on chan
   int killed;                    // If non-zero, have been killed
   struct file *ofile[NOFILE];    // Open files
   struct inode *cwd;             // Current directory
+  int logres;                    // Log blocks reserved by begin_opn()
+  int logused;                   // Of those, blocks log_write() has added
+  struct vma vma[NVMA];          // Lazily loaded file-backed memory
+  struct cpu *lastcpu;           // CPU that last ran the process (see switchuvm)
   char name[16];                 // Process name (debugging)
   int exit_status;               // procs exit code assigned to exit call
   long long accumulator;         // accumulator of priority
@@ -0,0 +1,1420 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static struct procinfo procs[NPROC];
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+  int i, n;
+  struct procinfo *p;
+  char *state;
+
+  if((n = getprocs(procs, NPROC)) < 0){
+   1:	b9 40 00 00 00       	mov    $0x40,%ecx
+{
+   6:	89 e5                	mov    %esp,%ebp
+   8:	57                   	push   %edi
+   9:	56                   	push   %esi
+   a:	53                   	push   %ebx
+   b:	83 e4 f0             	and    $0xfffffff0,%esp
+   e:	83 ec 30             	sub    $0x30,%esp
+  if((n = getprocs(procs, NPROC)) < 0){
+  11:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  15:	c7 04 24 60 0d 00 00 	movl   $0xd60,(%esp)
+  1c:	e8 fa 03 00 00       	call   41b <getprocs>
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 96 00 00 00    	js     bf <main+0xbf>
+    printf(2, "ps: failed\n");
+    exit(1);
+  }
+  printf(1, "PID\tPPID\tSTATE\tSZ\tRSS\tPT\tNAME\n");
+  29:	c7 44 24 04 10 0a 00 	movl   $0xa10,0x4(%esp)
+  30:	00 
+  31:	89 c6                	mov    %eax,%esi
+  33:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  3a:	e8 b1 04 00 00       	call   4f0 <printf>
+  for(i = 0; i < n; i++){
+  3f:	85 f6                	test   %esi,%esi
+  41:	74 72                	je     b5 <main+0xb5>
+  43:	bb 78 0d 00 00       	mov    $0xd78,%ebx
+  48:	31 ff                	xor    %edi,%edi
+  4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    p = &procs[i];
+    state = "???";
+    if(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]))
+  50:	8b 43 f0             	mov    -0x10(%ebx),%eax
+    state = "???";
+  53:	ba c4 09 00 00       	mov    $0x9c4,%edx
+    if(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]))
+  58:	83 f8 05             	cmp    $0x5,%eax
+  5b:	77 07                	ja     64 <main+0x64>
+      state = states[p->state];
+  5d:	8b 14 85 30 0a 00 00 	mov    0xa30(,%eax,4),%edx
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%s\n", p->pid, p->ppid, state,
+  64:	89 54 24 10          	mov    %edx,0x10(%esp)
+  68:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  6b:	ba d4 09 00 00       	mov    $0x9d4,%edx
+  70:	89 5c 24 20          	mov    %ebx,0x20(%esp)
+  for(i = 0; i < n; i++){
+  74:	47                   	inc    %edi
+  75:	83 c3 28             	add    $0x28,%ebx
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%s\n", p->pid, p->ppid, state,
+  78:	89 54 24 04          	mov    %edx,0x4(%esp)
+  7c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  83:	c1 e0 02             	shl    $0x2,%eax
+  86:	89 44 24 1c          	mov    %eax,0x1c(%esp)
+  8a:	8b 43 d0             	mov    -0x30(%ebx),%eax
+  8d:	c1 e0 02             	shl    $0x2,%eax
+  90:	89 44 24 18          	mov    %eax,0x18(%esp)
+  94:	8b 43 cc             	mov    -0x34(%ebx),%eax
+  97:	c1 e8 0a             	shr    $0xa,%eax
+  9a:	89 44 24 14          	mov    %eax,0x14(%esp)
+  9e:	8b 43 c4             	mov    -0x3c(%ebx),%eax
+  a1:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  a5:	8b 43 c0             	mov    -0x40(%ebx),%eax
+  a8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  ac:	e8 3f 04 00 00       	call   4f0 <printf>
+  for(i = 0; i < n; i++){
+  b1:	39 fe                	cmp    %edi,%esi
+  b3:	75 9b                	jne    50 <main+0x50>
+           p->sz / 1024, p->rss * 4, p->ptpages * 4, p->name);
+  }
+  exit(0);
+  b5:	31 c0                	xor    %eax,%eax
+  b7:	89 04 24             	mov    %eax,(%esp)
+  ba:	e8 64 02 00 00       	call   323 <exit>
+    printf(2, "ps: failed\n");
+  bf:	c7 44 24 04 c8 09 00 	movl   $0x9c8,0x4(%esp)
+  c6:	00 
+  c7:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  ce:	e8 1d 04 00 00       	call   4f0 <printf>
+    exit(1);
+  d3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  da:	e8 44 02 00 00       	call   323 <exit>
+  df:	90                   	nop
+
+000000e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	40                   	inc    %eax
+  f8:	84 d2                	test   %dl,%dl
+  fa:	75 f4                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fc:	5b                   	pop    %ebx
+  fd:	89 c8                	mov    %ecx,%eax
+  ff:	5d                   	pop    %ebp
+ 100:	c3                   	ret
+ 101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 15                	jne    136 <strcmp+0x26>
+ 121:	eb 30                	jmp    153 <strcmp+0x43>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 12f:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 130:	84 c0                	test   %al,%al
+ 132:	74 14                	je     148 <strcmp+0x38>
+    p++, q++;
+ 134:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 136:	0f b6 0b             	movzbl (%ebx),%ecx
+ 139:	38 c1                	cmp    %al,%cl
+ 13b:	74 eb                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 13d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 13e:	29 c8                	sub    %ecx,%eax
+}
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+ 142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 148:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 14c:	31 c0                	xor    %eax,%eax
+}
+ 14e:	5b                   	pop    %ebx
+ 14f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 150:	29 c8                	sub    %ecx,%eax
+}
+ 152:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 153:	0f b6 0b             	movzbl (%ebx),%ecx
+ 156:	31 c0                	xor    %eax,%eax
+ 158:	eb e3                	jmp    13d <strcmp+0x2d>
+ 15a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000160 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 166:	80 3a 00             	cmpb   $0x0,(%edx)
+ 169:	74 15                	je     180 <strlen+0x20>
+ 16b:	31 c0                	xor    %eax,%eax
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+ 170:	40                   	inc    %eax
+ 171:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 175:	89 c1                	mov    %eax,%ecx
+ 177:	75 f7                	jne    170 <strlen+0x10>
+    ;
+  return n;
+}
+ 179:	5d                   	pop    %ebp
+ 17a:	89 c8                	mov    %ecx,%eax
+ 17c:	c3                   	ret
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 181:	31 c9                	xor    %ecx,%ecx
+}
+ 183:	89 c8                	mov    %ecx,%eax
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000190 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 197:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 19a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19d:	89 d7                	mov    %edx,%edi
+ 19f:	fc                   	cld
+ 1a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1a2:	5f                   	pop    %edi
+ 1a3:	89 d0                	mov    %edx,%eax
+ 1a5:	5d                   	pop    %ebp
+ 1a6:	c3                   	ret
+ 1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ba:	0f b6 10             	movzbl (%eax),%edx
+ 1bd:	84 d2                	test   %dl,%dl
+ 1bf:	75 10                	jne    1d1 <strchr+0x21>
+ 1c1:	eb 1d                	jmp    1e0 <strchr+0x30>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1cc:	40                   	inc    %eax
+ 1cd:	84 d2                	test   %dl,%dl
+ 1cf:	74 0f                	je     1e0 <strchr+0x30>
+    if(*s == c)
+ 1d1:	38 d1                	cmp    %dl,%cl
+ 1d3:	75 f3                	jne    1c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1d5:	5d                   	pop    %ebp
+ 1d6:	c3                   	ret
+ 1d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1de:	66 90                	xchg   %ax,%ax
+ 1e0:	5d                   	pop    %ebp
+  return 0;
+ 1e1:	31 c0                	xor    %eax,%eax
+}
+ 1e3:	c3                   	ret
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1f5:	31 f6                	xor    %esi,%esi
+{
+ 1f7:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 1f8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 1fb:	83 ec 3c             	sub    $0x3c,%esp
+ 1fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 201:	eb 32                	jmp    235 <gets+0x45>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+    cc = read(0, &c, 1);
+ 208:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 20c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 211:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 215:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 21c:	e8 1a 01 00 00       	call   33b <read>
+    if(cc < 1)
+ 221:	85 c0                	test   %eax,%eax
+ 223:	7e 19                	jle    23e <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 225:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 229:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 22d:	3c 0a                	cmp    $0xa,%al
+ 22f:	74 10                	je     241 <gets+0x51>
+ 231:	3c 0d                	cmp    $0xd,%al
+ 233:	74 0c                	je     241 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 235:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 238:	46                   	inc    %esi
+ 239:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 23c:	7c ca                	jl     208 <gets+0x18>
+ 23e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 241:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 245:	83 c4 3c             	add    $0x3c,%esp
+ 248:	89 d8                	mov    %ebx,%eax
+ 24a:	5b                   	pop    %ebx
+ 24b:	5e                   	pop    %esi
+ 24c:	5f                   	pop    %edi
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+
+00000250 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 250:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	83 ec 18             	sub    $0x18,%esp
+ 258:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 25b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 25e:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 262:	8b 45 08             	mov    0x8(%ebp),%eax
+ 265:	89 04 24             	mov    %eax,(%esp)
+ 268:	e8 f6 00 00 00       	call   363 <open>
+  if(fd < 0)
+ 26d:	85 c0                	test   %eax,%eax
+ 26f:	78 2f                	js     2a0 <stat+0x50>
+ 271:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 273:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 276:	89 1c 24             	mov    %ebx,(%esp)
+ 279:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 27d:	e8 f9 00 00 00       	call   37b <fstat>
+  close(fd);
+ 282:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 285:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 287:	e8 bf 00 00 00       	call   34b <close>
+  return r;
+}
+ 28c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 28f:	89 f0                	mov    %esi,%eax
+ 291:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 294:	89 ec                	mov    %ebp,%esp
+ 296:	5d                   	pop    %ebp
+ 297:	c3                   	ret
+ 298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb e5                	jmp    28c <stat+0x3c>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2b7:	0f be 02             	movsbl (%edx),%eax
+ 2ba:	88 c1                	mov    %al,%cl
+ 2bc:	80 e9 30             	sub    $0x30,%cl
+ 2bf:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2c7:	77 1c                	ja     2e5 <atoi+0x35>
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 2d0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d3:	42                   	inc    %edx
+ 2d4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2d8:	0f be 02             	movsbl (%edx),%eax
+ 2db:	88 c3                	mov    %al,%bl
+ 2dd:	80 eb 30             	sub    $0x30,%bl
+ 2e0:	80 fb 09             	cmp    $0x9,%bl
+ 2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+  return n;
+}
+ 2e5:	5b                   	pop    %ebx
+ 2e6:	89 c8                	mov    %ecx,%eax
+ 2e8:	5d                   	pop    %ebp
+ 2e9:	c3                   	ret
+ 2ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+
+0000031b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 31b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <exit>:
+SYSCALL(exit)
+ 323:	b8 02 00 00 00       	mov    $0x2,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <wait>:
+SYSCALL(wait)
+ 32b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <pipe>:
+SYSCALL(pipe)
+ 333:	b8 04 00 00 00       	mov    $0x4,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <read>:
+SYSCALL(read)
+ 33b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <write>:
+SYSCALL(write)
+ 343:	b8 10 00 00 00       	mov    $0x10,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <close>:
+SYSCALL(close)
+ 34b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <kill>:
+SYSCALL(kill)
+ 353:	b8 06 00 00 00       	mov    $0x6,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <exec>:
+SYSCALL(exec)
+ 35b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <open>:
+SYSCALL(open)
+ 363:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mknod>:
+SYSCALL(mknod)
+ 36b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <unlink>:
+SYSCALL(unlink)
+ 373:	b8 12 00 00 00       	mov    $0x12,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <fstat>:
+SYSCALL(fstat)
+ 37b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <link>:
+SYSCALL(link)
+ 383:	b8 13 00 00 00       	mov    $0x13,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mkdir>:
+SYSCALL(mkdir)
+ 38b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <chdir>:
+SYSCALL(chdir)
+ 393:	b8 09 00 00 00       	mov    $0x9,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <dup>:
+SYSCALL(dup)
+ 39b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getpid>:
+SYSCALL(getpid)
+ 3a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <sbrk>:
+SYSCALL(sbrk)
+ 3ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <sleep>:
+SYSCALL(sleep)
+ 3b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <uptime>:
+SYSCALL(uptime)
+ 3bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <detach>:
+SYSCALL(detach)
+ 3c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <policy>:
+SYSCALL(policy)
+ 3cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <priority>:
+SYSCALL(priority)
+ 3d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wait_stat>:
+SYSCALL(wait_stat)
+ 3db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <lockstat>:
+SYSCALL(lockstat)
+ 3e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mmap>:
+SYSCALL(mmap)
+ 3eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <munmap>:
+SYSCALL(munmap)
+ 3f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <shmget>:
+SYSCALL(shmget)
+ 3fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <shmat>:
+SYSCALL(shmat)
+ 403:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <shmdt>:
+SYSCALL(shmdt)
+ 40b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <memstat>:
+SYSCALL(memstat)
+ 413:	b8 20 00 00 00       	mov    $0x20,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <getprocs>:
+SYSCALL(getprocs)
+ 41b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <shmctl>:
+SYSCALL(shmctl)
+ 423:	b8 22 00 00 00       	mov    $0x22,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+ 42b:	66 90                	xchg   %ax,%ax
+ 42d:	66 90                	xchg   %ax,%ax
+ 42f:	90                   	nop
+
+00000430 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	89 cb                	mov    %ecx,%ebx
+ 438:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 43b:	89 d1                	mov    %edx,%ecx
+{
+ 43d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 440:	89 d0                	mov    %edx,%eax
+ 442:	c1 e8 1f             	shr    $0x1f,%eax
+ 445:	84 c0                	test   %al,%al
+ 447:	0f 84 93 00 00 00    	je     4e0 <printint+0xb0>
+ 44d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 451:	0f 84 89 00 00 00    	je     4e0 <printint+0xb0>
+    x = -xx;
+ 457:	f7 d9                	neg    %ecx
+    neg = 1;
+ 459:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 45e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 465:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 468:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 470:	89 c8                	mov    %ecx,%eax
+ 472:	31 d2                	xor    %edx,%edx
+ 474:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 477:	f7 f3                	div    %ebx
+ 479:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 47c:	0f b6 92 a8 0a 00 00 	movzbl 0xaa8(%edx),%edx
+ 483:	8d 47 01             	lea    0x1(%edi),%eax
+ 486:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 489:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 48d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 48f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 492:	39 da                	cmp    %ebx,%edx
+ 494:	73 da                	jae    470 <printint+0x40>
+  if(neg)
+ 496:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 499:	85 c0                	test   %eax,%eax
+ 49b:	74 0a                	je     4a7 <printint+0x77>
+    buf[i++] = '-';
+ 49d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4a0:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 4a5:	89 c7                	mov    %eax,%edi
+ 4a7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4aa:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4b0:	0f b6 07             	movzbl (%edi),%eax
+ 4b3:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4b6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4bb:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4bf:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 4c3:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 4c6:	89 04 24             	mov    %eax,(%esp)
+ 4c9:	e8 75 fe ff ff       	call   343 <write>
+  while(--i >= 0)
+ 4ce:	89 f8                	mov    %edi,%eax
+ 4d0:	4f                   	dec    %edi
+ 4d1:	39 d8                	cmp    %ebx,%eax
+ 4d3:	75 db                	jne    4b0 <printint+0x80>
+}
+ 4d5:	83 c4 4c             	add    $0x4c,%esp
+ 4d8:	5b                   	pop    %ebx
+ 4d9:	5e                   	pop    %esi
+ 4da:	5f                   	pop    %edi
+ 4db:	5d                   	pop    %ebp
+ 4dc:	c3                   	ret
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 4e0:	31 c0                	xor    %eax,%eax
+ 4e2:	e9 77 ff ff ff       	jmp    45e <printint+0x2e>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 502:	84 db                	test   %bl,%bl
+ 504:	74 6f                	je     575 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 506:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 509:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 50b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 50e:	88 d9                	mov    %bl,%cl
+ 510:	46                   	inc    %esi
+ 511:	89 d3                	mov    %edx,%ebx
+ 513:	eb 2b                	jmp    540 <printf+0x50>
+ 515:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 518:	83 f8 25             	cmp    $0x25,%eax
+ 51b:	74 4b                	je     568 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 51d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 520:	b8 01 00 00 00       	mov    $0x1,%eax
+ 525:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 529:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 52c:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 530:	89 3c 24             	mov    %edi,(%esp)
+ 533:	e8 0b fe ff ff       	call   343 <write>
+  for(i = 0; fmt[i]; i++){
+ 538:	0f b6 0e             	movzbl (%esi),%ecx
+ 53b:	46                   	inc    %esi
+ 53c:	84 c9                	test   %cl,%cl
+ 53e:	74 35                	je     575 <printf+0x85>
+    if(state == 0){
+ 540:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 542:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 545:	74 d1                	je     518 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 547:	83 fb 25             	cmp    $0x25,%ebx
+ 54a:	75 ec                	jne    538 <printf+0x48>
+      if(c == 'd'){
+ 54c:	83 f8 25             	cmp    $0x25,%eax
+ 54f:	0f 84 53 01 00 00    	je     6a8 <printf+0x1b8>
+ 555:	83 e8 63             	sub    $0x63,%eax
+ 558:	83 f8 15             	cmp    $0x15,%eax
+ 55b:	77 23                	ja     580 <printf+0x90>
+ 55d:	ff 24 85 50 0a 00 00 	jmp    *0xa50(,%eax,4)
+ 564:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 568:	0f b6 0e             	movzbl (%esi),%ecx
+ 56b:	46                   	inc    %esi
+        state = '%';
+ 56c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 571:	84 c9                	test   %cl,%cl
+ 573:	75 cb                	jne    540 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 575:	83 c4 3c             	add    $0x3c,%esp
+ 578:	5b                   	pop    %ebx
+ 579:	5e                   	pop    %esi
+ 57a:	5f                   	pop    %edi
+ 57b:	5d                   	pop    %ebp
+ 57c:	c3                   	ret
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+ 580:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 583:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 586:	b8 01 00 00 00       	mov    $0x1,%eax
+ 58b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 58f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 593:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 597:	89 3c 24             	mov    %edi,(%esp)
+ 59a:	e8 a4 fd ff ff       	call   343 <write>
+        putc(fd, c);
+ 59f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 5a3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 5a8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 5ab:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 5af:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 5b1:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 5b5:	89 3c 24             	mov    %edi,(%esp)
+ 5b8:	e8 86 fd ff ff       	call   343 <write>
+ 5bd:	e9 76 ff ff ff       	jmp    538 <printf+0x48>
+ 5c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 5c8:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 5cb:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5d0:	8b 13                	mov    (%ebx),%edx
+ 5d2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 5d9:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5dc:	89 f8                	mov    %edi,%eax
+ 5de:	e8 4d fe ff ff       	call   430 <printint>
+        ap++;
+ 5e3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 5e6:	31 db                	xor    %ebx,%ebx
+ 5e8:	e9 4b ff ff ff       	jmp    538 <printf+0x48>
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5f0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 5f3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 5f5:	83 c0 04             	add    $0x4,%eax
+ 5f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 5fb:	85 c9                	test   %ecx,%ecx
+ 5fd:	0f 84 cd 00 00 00    	je     6d0 <printf+0x1e0>
+        while(*s != 0){
+ 603:	0f b6 01             	movzbl (%ecx),%eax
+ 606:	84 c0                	test   %al,%al
+ 608:	0f 84 ce 00 00 00    	je     6dc <printf+0x1ec>
+ 60e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 611:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 614:	89 ce                	mov    %ecx,%esi
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 620:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 623:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 628:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 629:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 62d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 631:	89 3c 24             	mov    %edi,(%esp)
+ 634:	e8 0a fd ff ff       	call   343 <write>
+        while(*s != 0){
+ 639:	0f b6 06             	movzbl (%esi),%eax
+ 63c:	84 c0                	test   %al,%al
+ 63e:	75 e0                	jne    620 <printf+0x130>
+      state = 0;
+ 640:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 643:	31 db                	xor    %ebx,%ebx
+ 645:	e9 ee fe ff ff       	jmp    538 <printf+0x48>
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 650:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 653:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 658:	8b 13                	mov    (%ebx),%edx
+ 65a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 661:	e9 73 ff ff ff       	jmp    5d9 <printf+0xe9>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 670:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 673:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 678:	8b 10                	mov    (%eax),%edx
+ 67a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 67d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 681:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 684:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 688:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 68b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 68f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 691:	89 3c 24             	mov    %edi,(%esp)
+ 694:	e8 aa fc ff ff       	call   343 <write>
+        ap++;
+ 699:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 69d:	e9 96 fe ff ff       	jmp    538 <printf+0x48>
+ 6a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 6a8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6ab:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 6ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 6b3:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 6b7:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 6b9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 6bd:	89 3c 24             	mov    %edi,(%esp)
+ 6c0:	e8 7e fc ff ff       	call   343 <write>
+ 6c5:	e9 6e fe ff ff       	jmp    538 <printf+0x48>
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 6d0:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 6d2:	b9 48 0a 00 00       	mov    $0xa48,%ecx
+ 6d7:	e9 32 ff ff ff       	jmp    60e <printf+0x11e>
+      state = 0;
+ 6dc:	31 db                	xor    %ebx,%ebx
+ 6de:	66 90                	xchg   %ax,%ax
+ 6e0:	e9 53 fe ff ff       	jmp    538 <printf+0x48>
+ 6e5:	66 90                	xchg   %ax,%ax
+ 6e7:	66 90                	xchg   %ax,%ax
+ 6e9:	66 90                	xchg   %ax,%ax
+ 6eb:	66 90                	xchg   %ax,%ax
+ 6ed:	66 90                	xchg   %ax,%ax
+ 6ef:	90                   	nop
+
+000006f0 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	83 ec 18             	sub    $0x18,%esp
+ 6f6:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 6f9:	89 c3                	mov    %eax,%ebx
+ 6fb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 6fe:	a1 64 17 00 00       	mov    0x1764,%eax
+ 703:	8b 15 60 17 00 00    	mov    0x1760,%edx
+ 709:	29 c2                	sub    %eax,%edx
+ 70b:	39 da                	cmp    %ebx,%edx
+ 70d:	72 19                	jb     728 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 70f:	01 c3                	add    %eax,%ebx
+ 711:	89 1d 64 17 00 00    	mov    %ebx,0x1764
+  return p;
+}
+ 717:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 71a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 71d:	89 ec                	mov    %ebp,%esp
+ 71f:	5d                   	pop    %ebp
+ 720:	c3                   	ret
+ 721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 728:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 72d:	39 c3                	cmp    %eax,%ebx
+ 72f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 732:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 735:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 737:	e8 6f fc ff ff       	call   3ab <sbrk>
+    if(p == (char*)-1)
+ 73c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 73f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 741:	74 1d                	je     760 <morecore+0x70>
+    if(p != arenaend)
+ 743:	39 05 60 17 00 00    	cmp    %eax,0x1760
+ 749:	74 0d                	je     758 <morecore+0x68>
+    arenaend = p + grow;
+ 74b:	01 f2                	add    %esi,%edx
+ 74d:	89 15 60 17 00 00    	mov    %edx,0x1760
+ 753:	eb ba                	jmp    70f <morecore+0x1f>
+ 755:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 758:	a1 64 17 00 00       	mov    0x1764,%eax
+ 75d:	eb ec                	jmp    74b <morecore+0x5b>
+ 75f:	90                   	nop
+      return 0;
+ 760:	31 c0                	xor    %eax,%eax
+ 762:	eb b3                	jmp    717 <morecore+0x27>
+ 764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+
+00000770 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 779:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 77f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 782:	85 c0                	test   %eax,%eax
+ 784:	74 1e                	je     7a4 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 786:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 789:	83 fa 08             	cmp    $0x8,%edx
+ 78c:	77 16                	ja     7a4 <free+0x34>
+  h = (Header*)ap - 1;
+ 78e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 791:	74 25                	je     7b8 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 793:	8b 3c 95 80 17 00 00 	mov    0x1780(,%edx,4),%edi
+ 79a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 79d:	89 0c 95 80 17 00 00 	mov    %ecx,0x1780(,%edx,4)
+}
+ 7a4:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 7a7:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 7aa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 7ad:	89 ec                	mov    %ebp,%esp
+ 7af:	5d                   	pop    %ebp
+ 7b0:	c3                   	ret
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 7b8:	8b 15 a0 17 00 00    	mov    0x17a0,%edx
+ 7be:	85 d2                	test   %edx,%edx
+ 7c0:	74 54                	je     816 <free+0xa6>
+ 7c2:	39 ca                	cmp    %ecx,%edx
+ 7c4:	73 36                	jae    7fc <free+0x8c>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 7d0:	89 d3                	mov    %edx,%ebx
+ 7d2:	8b 12                	mov    (%edx),%edx
+ 7d4:	85 d2                	test   %edx,%edx
+ 7d6:	74 12                	je     7ea <free+0x7a>
+ 7d8:	39 ca                	cmp    %ecx,%edx
+ 7da:	72 f4                	jb     7d0 <free+0x60>
+  if(p && END(h) == p){
+ 7dc:	85 d2                	test   %edx,%edx
+ 7de:	74 0a                	je     7ea <free+0x7a>
+ 7e0:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 7e3:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 7e6:	39 fa                	cmp    %edi,%edx
+ 7e8:	74 4b                	je     835 <free+0xc5>
+  h->s.u.next = p;
+ 7ea:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 7ed:	8b 53 04             	mov    0x4(%ebx),%edx
+ 7f0:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 7f4:	39 f1                	cmp    %esi,%ecx
+ 7f6:	74 29                	je     821 <free+0xb1>
+    prev->s.u.next = h;
+ 7f8:	89 0b                	mov    %ecx,(%ebx)
+ 7fa:	eb a8                	jmp    7a4 <free+0x34>
+  if(p && END(h) == p){
+ 7fc:	85 d2                	test   %edx,%edx
+ 7fe:	74 16                	je     816 <free+0xa6>
+ 800:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 803:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 806:	39 f2                	cmp    %esi,%edx
+ 808:	75 0c                	jne    816 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 80a:	8b 72 04             	mov    0x4(%edx),%esi
+ 80d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 811:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 814:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 816:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 819:	89 0d a0 17 00 00    	mov    %ecx,0x17a0
+ 81f:	eb 83                	jmp    7a4 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 821:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 824:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 828:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 82b:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 82e:	89 03                	mov    %eax,(%ebx)
+ 830:	e9 6f ff ff ff       	jmp    7a4 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 835:	8b 7a 04             	mov    0x4(%edx),%edi
+ 838:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 83c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 83f:	8b 12                	mov    (%edx),%edx
+ 841:	eb a7                	jmp    7ea <free+0x7a>
+ 843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000850 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 2c             	sub    $0x2c,%esp
+ 859:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 85c:	83 f8 10             	cmp    $0x10,%eax
+ 85f:	0f 86 52 01 00 00    	jbe    9b7 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 865:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 867:	ba 01 00 00 00       	mov    $0x1,%edx
+ 86c:	eb 0d                	jmp    87b <malloc+0x2b>
+ 86e:	66 90                	xchg   %ax,%ax
+ 870:	83 c1 05             	add    $0x5,%ecx
+ 873:	89 d6                	mov    %edx,%esi
+ 875:	d3 e6                	shl    %cl,%esi
+ 877:	39 c6                	cmp    %eax,%esi
+ 879:	73 55                	jae    8d0 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 87b:	89 d9                	mov    %ebx,%ecx
+ 87d:	43                   	inc    %ebx
+ 87e:	83 fb 08             	cmp    $0x8,%ebx
+ 881:	75 ed                	jne    870 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 883:	8d 58 07             	lea    0x7(%eax),%ebx
+ 886:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 889:	39 c3                	cmp    %eax,%ebx
+ 88b:	0f 82 1f 01 00 00    	jb     9b0 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 891:	a1 a0 17 00 00       	mov    0x17a0,%eax
+ 896:	85 c0                	test   %eax,%eax
+ 898:	0f 84 ee 00 00 00    	je     98c <malloc+0x13c>
+ 89e:	b9 a0 17 00 00       	mov    $0x17a0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 8a3:	8b 50 04             	mov    0x4(%eax),%edx
+ 8a6:	39 da                	cmp    %ebx,%edx
+ 8a8:	0f 82 d2 00 00 00    	jb     980 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 8ae:	29 da                	sub    %ebx,%edx
+ 8b0:	83 fa 17             	cmp    $0x17,%edx
+ 8b3:	0f 87 b7 00 00 00    	ja     970 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 8b9:	8b 10                	mov    (%eax),%edx
+ 8bb:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 8bd:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 8c3:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 8c6:	83 c0 08             	add    $0x8,%eax
+}
+ 8c9:	5b                   	pop    %ebx
+ 8ca:	5e                   	pop    %esi
+ 8cb:	5f                   	pop    %edi
+ 8cc:	5d                   	pop    %ebp
+ 8cd:	c3                   	ret
+ 8ce:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 8d0:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 8d2:	8b 04 9d 80 17 00 00 	mov    0x1780(,%ebx,4),%eax
+ 8d9:	85 c0                	test   %eax,%eax
+ 8db:	74 23                	je     900 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 8dd:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 8df:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 8e2:	89 14 9d 80 17 00 00 	mov    %edx,0x1780(,%ebx,4)
+    h->s.u.cls = cls;
+ 8e9:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 8ec:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 8ef:	83 c4 2c             	add    $0x2c,%esp
+ 8f2:	5b                   	pop    %ebx
+ 8f3:	5e                   	pop    %esi
+ 8f4:	5f                   	pop    %edi
+ 8f5:	5d                   	pop    %ebp
+ 8f6:	c3                   	ret
+ 8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fe:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 900:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 903:	31 d2                	xor    %edx,%edx
+ 905:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 90a:	f7 f6                	div    %esi
+ 90c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 90f:	0f af c6             	imul   %esi,%eax
+ 912:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 915:	e8 d6 fd ff ff       	call   6f0 <morecore>
+ 91a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 91d:	85 c0                	test   %eax,%eax
+ 91f:	0f 84 8b 00 00 00    	je     9b0 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 925:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 928:	8b 0c 9d 80 17 00 00 	mov    0x1780(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 934:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 937:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 93a:	eb 06                	jmp    942 <malloc+0xf2>
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 940:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 942:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 944:	42                   	inc    %edx
+ 945:	89 c1                	mov    %eax,%ecx
+ 947:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 94a:	39 d7                	cmp    %edx,%edi
+ 94c:	75 f2                	jne    940 <malloc+0xf0>
+ 94e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 951:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 954:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 957:	89 04 9d 80 17 00 00 	mov    %eax,0x1780(,%ebx,4)
+ 95e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 961:	29 f0                	sub    %esi,%eax
+ 963:	01 c2                	add    %eax,%edx
+ 965:	89 d0                	mov    %edx,%eax
+ 967:	e9 71 ff ff ff       	jmp    8dd <malloc+0x8d>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 970:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 973:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 976:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 978:	89 58 04             	mov    %ebx,0x4(%eax)
+ 97b:	e9 3d ff ff ff       	jmp    8bd <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 980:	89 c1                	mov    %eax,%ecx
+ 982:	8b 00                	mov    (%eax),%eax
+ 984:	85 c0                	test   %eax,%eax
+ 986:	0f 85 17 ff ff ff    	jne    8a3 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 98c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 98f:	74 1f                	je     9b0 <malloc+0x160>
+ 991:	8d 43 08             	lea    0x8(%ebx),%eax
+ 994:	e8 57 fd ff ff       	call   6f0 <morecore>
+ 999:	85 c0                	test   %eax,%eax
+ 99b:	74 13                	je     9b0 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 99d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ 9a3:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ 9a6:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ 9a9:	e9 41 ff ff ff       	jmp    8ef <malloc+0x9f>
+ 9ae:	66 90                	xchg   %ax,%ax
+      return 0;
+ 9b0:	31 c0                	xor    %eax,%eax
+ 9b2:	e9 38 ff ff ff       	jmp    8ef <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 9b7:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ 9bc:	31 db                	xor    %ebx,%ebx
+ 9be:	e9 0f ff ff ff       	jmp    8d2 <malloc+0x82>
@@ -0,0 +1,36 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "memstat.h"
+
+// List processes with their memory use, in KB.
+
+static char *states[] = {
+  "unused", "embryo", "sleep", "runble", "run", "zombie"
+};
+
+static struct procinfo procs[NPROC];
+
+int
+main(void)
+{
+  int i, n;
+  struct procinfo *p;
+  char *state;
+
+  if((n = getprocs(procs, NPROC)) < 0){
+    printf(2, "ps: failed\n");
+    exit(1);
+  }
+  printf(1, "PID\tPPID\tSTATE\tSZ\tRSS\tPT\tNAME\n");
+  for(i = 0; i < n; i++){
+    p = &procs[i];
+    state = "???";
+    if(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]))
+      state = states[p->state];
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%s\n", p->pid, p->ppid, state,
+           p->sz / 1024, p->rss * 4, p->ptpages * 4, p->name);
+  }
+  exit(0);
+}
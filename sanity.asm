@@ -0,0 +1,2068 @@
+
+_sanity:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    fail++;
+    printf(1,"%s\n",fail_msg);
+  }
+
+}
+int main(void){
+   0:	55                   	push   %ebp
+  
+
+    make_test(test_exit_wait_success, 1, "test_exit_wait_success failed\n");
+   1:	ba 01 00 00 00       	mov    $0x1,%edx
+int main(void){
+   6:	89 e5                	mov    %esp,%ebp
+   8:	83 e4 f0             	and    $0xfffffff0,%esp
+   b:	83 ec 10             	sub    $0x10,%esp
+    make_test(test_exit_wait_success, 1, "test_exit_wait_success failed\n");
+   e:	b8 80 10 00 00       	mov    $0x1080,%eax
+  13:	89 54 24 04          	mov    %edx,0x4(%esp)
+  17:	89 44 24 08          	mov    %eax,0x8(%esp)
+  1b:	c7 04 24 20 01 00 00 	movl   $0x120,(%esp)
+  22:	e8 79 06 00 00       	call   6a0 <make_test>
+    make_test(test_exit_wait_fail, -1 , "test_exit_wait_fail failed\n");
+  27:	b9 77 11 00 00       	mov    $0x1177,%ecx
+  2c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  31:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  35:	89 44 24 04          	mov    %eax,0x4(%esp)
+  39:	c7 04 24 50 01 00 00 	movl   $0x150,(%esp)
+  40:	e8 5b 06 00 00       	call   6a0 <make_test>
+    // make_test(test_detach_success,0,"test_detach_success failed\n");
+ 
+    make_test(test_detach_fail,-1,"test_detach_fail failed\n");
+  45:	b8 93 11 00 00       	mov    $0x1193,%eax
+  4a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  4e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  53:	89 44 24 04          	mov    %eax,0x4(%esp)
+  57:	c7 04 24 80 01 00 00 	movl   $0x180,(%esp)
+  5e:	e8 3d 06 00 00       	call   6a0 <make_test>
+    make_test(test_detach_wrong_parent,-1,"test_detach_wrong_parent failed\n");
+  63:	b8 a0 10 00 00       	mov    $0x10a0,%eax
+  68:	89 44 24 08          	mov    %eax,0x8(%esp)
+  6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  71:	89 44 24 04          	mov    %eax,0x4(%esp)
+  75:	c7 04 24 d0 01 00 00 	movl   $0x1d0,(%esp)
+  7c:	e8 1f 06 00 00       	call   6a0 <make_test>
+    ans =0;
+    make_test(round_robin_sanity,0,"test_round_robin_sanity faild, ho no !\n");
+  81:	b9 c4 10 00 00       	mov    $0x10c4,%ecx
+  86:	31 c0                	xor    %eax,%eax
+  88:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+    ans =0;
+  8c:	31 d2                	xor    %edx,%edx
+    make_test(round_robin_sanity,0,"test_round_robin_sanity faild, ho no !\n");
+  8e:	89 44 24 04          	mov    %eax,0x4(%esp)
+  92:	c7 04 24 30 04 00 00 	movl   $0x430,(%esp)
+    ans =0;
+  99:	89 15 6c 16 00 00    	mov    %edx,0x166c
+    make_test(round_robin_sanity,0,"test_round_robin_sanity faild, ho no !\n");
+  9f:	e8 fc 05 00 00       	call   6a0 <make_test>
+    ans =0;
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	a3 6c 16 00 00       	mov    %eax,0x166c
+    make_test(priority_policy_sanity,0,"priority_policy_sanity faild, ho no !\n");
+  ab:	b8 ec 10 00 00       	mov    $0x10ec,%eax
+  b0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  b4:	31 c0                	xor    %eax,%eax
+  b6:	89 44 24 04          	mov    %eax,0x4(%esp)
+  ba:	c7 04 24 d0 04 00 00 	movl   $0x4d0,(%esp)
+  c1:	e8 da 05 00 00       	call   6a0 <make_test>
+    ans = 0;
+    make_test(extpriority_policy_sanity,0,"extpriority_policy_sanity faild, ho no!\n ");
+  c6:	ba 14 11 00 00       	mov    $0x1114,%edx
+  cb:	31 c9                	xor    %ecx,%ecx
+  cd:	89 54 24 08          	mov    %edx,0x8(%esp)
+    ans = 0;
+  d1:	31 c0                	xor    %eax,%eax
+    make_test(extpriority_policy_sanity,0,"extpriority_policy_sanity faild, ho no!\n ");
+  d3:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  d7:	c7 04 24 c0 05 00 00 	movl   $0x5c0,(%esp)
+    ans = 0;
+  de:	a3 6c 16 00 00       	mov    %eax,0x166c
+    make_test(extpriority_policy_sanity,0,"extpriority_policy_sanity faild, ho no!\n ");
+  e3:	e8 b8 05 00 00       	call   6a0 <make_test>
+
+    printf(1,"num of success:%d num of failures: %d\n",success,fail );
+  e8:	a1 80 16 00 00       	mov    0x1680,%eax
+  ed:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  f4:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  f8:	a1 84 16 00 00       	mov    0x1684,%eax
+  fd:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 101:	b8 40 11 00 00       	mov    $0x1140,%eax
+ 106:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 10a:	e8 01 0a 00 00       	call   b10 <printf>
+
+    exit(0);
+ 10f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 116:	e8 28 08 00 00       	call   943 <exit>
+ 11b:	66 90                	xchg   %ax,%ax
+ 11d:	66 90                	xchg   %ax,%ax
+ 11f:	90                   	nop
+
+00000120 <test_exit_wait_success>:
+void test_exit_wait_success(){
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	83 ec 18             	sub    $0x18,%esp
+    int pid = fork();
+ 126:	e8 10 08 00 00       	call   93b <fork>
+    if(pid!=0){
+ 12b:	85 c0                	test   %eax,%eax
+ 12d:	74 10                	je     13f <test_exit_wait_success+0x1f>
+      wait(&ans);
+ 12f:	c7 04 24 6c 16 00 00 	movl   $0x166c,(%esp)
+ 136:	e8 10 08 00 00       	call   94b <wait>
+}
+ 13b:	89 ec                	mov    %ebp,%esp
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+      exit(1);}
+ 13f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 146:	e8 f8 07 00 00       	call   943 <exit>
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <test_exit_wait_fail>:
+void test_exit_wait_fail(){
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	83 ec 18             	sub    $0x18,%esp
+  int pid = fork();
+ 156:	e8 e0 07 00 00       	call   93b <fork>
+  if(pid>0){
+ 15b:	85 c0                	test   %eax,%eax
+ 15d:	7e 10                	jle    16f <test_exit_wait_fail+0x1f>
+    wait(&ans);
+ 15f:	c7 04 24 6c 16 00 00 	movl   $0x166c,(%esp)
+ 166:	e8 e0 07 00 00       	call   94b <wait>
+}
+ 16b:	89 ec                	mov    %ebp,%esp
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+  else exit(-1);
+ 16f:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 176:	e8 c8 07 00 00       	call   943 <exit>
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <test_detach_fail>:
+void test_detach_fail(){
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	83 ec 18             	sub    $0x18,%esp
+ 186:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  pid = fork();
+ 189:	e8 ad 07 00 00       	call   93b <fork>
+  if(pid > 0) {
+ 18e:	85 c0                	test   %eax,%eax
+ 190:	7e 25                	jle    1b7 <test_detach_fail+0x37>
+    wait(0);
+ 192:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 199:	89 c3                	mov    %eax,%ebx
+ 19b:	e8 ab 07 00 00       	call   94b <wait>
+   ans = detach(pid+9); // status = -1
+ 1a0:	83 c3 09             	add    $0x9,%ebx
+ 1a3:	89 1c 24             	mov    %ebx,(%esp)
+ 1a6:	e8 38 08 00 00       	call   9e3 <detach>
+ 1ab:	a3 6c 16 00 00       	mov    %eax,0x166c
+}
+ 1b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b3:	89 ec                	mov    %ebp,%esp
+ 1b5:	5d                   	pop    %ebp
+ 1b6:	c3                   	ret
+    exit(0);
+ 1b7:	31 c0                	xor    %eax,%eax
+ 1b9:	89 04 24             	mov    %eax,(%esp)
+ 1bc:	e8 82 07 00 00       	call   943 <exit>
+ 1c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <test_detach_wrong_parent>:
+void test_detach_wrong_parent(){
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	83 ec 18             	sub    $0x18,%esp
+  pid = fork();
+ 1d6:	e8 60 07 00 00       	call   93b <fork>
+      ans = detach(pid); // status = -1
+ 1db:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  if(pid == 0) {
+ 1e2:	85 c0                	test   %eax,%eax
+ 1e4:	74 09                	je     1ef <test_detach_wrong_parent+0x1f>
+  else wait(0);
+ 1e6:	e8 60 07 00 00       	call   94b <wait>
+}
+ 1eb:	89 ec                	mov    %ebp,%esp
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+      ans = detach(pid); // status = -1
+ 1ef:	90                   	nop
+ 1f0:	e8 ee 07 00 00       	call   9e3 <detach>
+ 1f5:	a3 6c 16 00 00       	mov    %eax,0x166c
+      exit(0);
+ 1fa:	31 c0                	xor    %eax,%eax
+ 1fc:	89 04 24             	mov    %eax,(%esp)
+ 1ff:	e8 3f 07 00 00       	call   943 <exit>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <test_detach_success>:
+void test_detach_success(){
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	83 ec 18             	sub    $0x18,%esp
+  pid = fork();
+ 216:	e8 20 07 00 00       	call   93b <fork>
+  if(pid > 0) {
+ 21b:	85 c0                	test   %eax,%eax
+ 21d:	7e 17                	jle    236 <test_detach_success+0x26>
+   ans = detach(pid);
+ 21f:	89 04 24             	mov    %eax,(%esp)
+ 222:	e8 bc 07 00 00       	call   9e3 <detach>
+   exit(0);
+ 227:	31 d2                	xor    %edx,%edx
+ 229:	89 14 24             	mov    %edx,(%esp)
+   ans = detach(pid);
+ 22c:	a3 6c 16 00 00       	mov    %eax,0x166c
+   exit(0);
+ 231:	e8 0d 07 00 00       	call   943 <exit>
+    sleep(10);
+ 236:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+ 23d:	e8 91 07 00 00       	call   9d3 <sleep>
+    exit(0);
+ 242:	31 c0                	xor    %eax,%eax
+ 244:	89 04 24             	mov    %eax,(%esp)
+ 247:	e8 f7 06 00 00       	call   943 <exit>
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <fib>:
+int fib(uint num){
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	53                   	push   %ebx
+ 256:	83 ec 5c             	sub    $0x5c,%esp
+ 259:	8b 45 08             	mov    0x8(%ebp),%eax
+    if (num == 0)
+ 25c:	85 c0                	test   %eax,%eax
+ 25e:	0f 84 ae 01 00 00    	je     412 <fib+0x1c2>
+    if(num == 1)
+ 264:	83 f8 01             	cmp    $0x1,%eax
+ 267:	0f 84 b1 01 00 00    	je     41e <fib+0x1ce>
+ 26d:	8d 50 fe             	lea    -0x2(%eax),%edx
+ 270:	31 f6                	xor    %esi,%esi
+ 272:	89 d3                	mov    %edx,%ebx
+    return fib(num-1) + fib(num-2);
+ 274:	8d 4b 01             	lea    0x1(%ebx),%ecx
+    if(num == 1)
+ 277:	85 db                	test   %ebx,%ebx
+ 279:	0f 84 76 01 00 00    	je     3f5 <fib+0x1a5>
+ 27f:	89 75 c8             	mov    %esi,-0x38(%ebp)
+ 282:	31 c0                	xor    %eax,%eax
+ 284:	89 ce                	mov    %ecx,%esi
+    return fib(num-1) + fib(num-2);
+ 286:	8d 56 ff             	lea    -0x1(%esi),%edx
+    if(num == 1)
+ 289:	83 fe 02             	cmp    $0x2,%esi
+ 28c:	0f 84 49 01 00 00    	je     3db <fib+0x18b>
+ 292:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ 295:	31 ff                	xor    %edi,%edi
+ 297:	89 d3                	mov    %edx,%ebx
+ 299:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    return fib(num-1) + fib(num-2);
+ 29c:	8d 4b ff             	lea    -0x1(%ebx),%ecx
+    if(num == 1)
+ 29f:	83 fb 02             	cmp    $0x2,%ebx
+ 2a2:	0f 84 1d 01 00 00    	je     3c5 <fib+0x175>
+ 2a8:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+ 2ab:	31 c0                	xor    %eax,%eax
+ 2ad:	89 cb                	mov    %ecx,%ebx
+ 2af:	89 75 b8             	mov    %esi,-0x48(%ebp)
+    return fib(num-1) + fib(num-2);
+ 2b2:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    if(num == 1)
+ 2b5:	83 fb 02             	cmp    $0x2,%ebx
+ 2b8:	0f 84 f1 00 00 00    	je     3af <fib+0x15f>
+ 2be:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+ 2c1:	31 f6                	xor    %esi,%esi
+ 2c3:	89 5d b0             	mov    %ebx,-0x50(%ebp)
+ 2c6:	89 f7                	mov    %esi,%edi
+ 2c8:	89 d3                	mov    %edx,%ebx
+ 2ca:	89 45 ac             	mov    %eax,-0x54(%ebp)
+    return fib(num-1) + fib(num-2);
+ 2cd:	8d 73 ff             	lea    -0x1(%ebx),%esi
+    if(num == 1)
+ 2d0:	83 fb 02             	cmp    $0x2,%ebx
+ 2d3:	0f 84 bb 00 00 00    	je     394 <fib+0x144>
+ 2d9:	31 c9                	xor    %ecx,%ecx
+ 2db:	89 da                	mov    %ebx,%edx
+ 2dd:	89 cb                	mov    %ecx,%ebx
+    return fib(num-1) + fib(num-2);
+ 2df:	8d 46 ff             	lea    -0x1(%esi),%eax
+    if(num == 1)
+ 2e2:	83 fe 02             	cmp    $0x2,%esi
+ 2e5:	0f 84 95 00 00 00    	je     380 <fib+0x130>
+ 2eb:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 2ee:	31 c9                	xor    %ecx,%ecx
+ 2f0:	89 d6                	mov    %edx,%esi
+ 2f2:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+ 2f5:	89 ca                	mov    %ecx,%edx
+ 2f7:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    return fib(num-1) + fib(num-2);
+ 2fa:	8d 58 ff             	lea    -0x1(%eax),%ebx
+    if(num == 1)
+ 2fd:	83 f8 02             	cmp    $0x2,%eax
+ 300:	74 61                	je     363 <fib+0x113>
+ 302:	89 55 d8             	mov    %edx,-0x28(%ebp)
+ 305:	31 ff                	xor    %edi,%edi
+ 307:	89 f1                	mov    %esi,%ecx
+ 309:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 30c:	89 fa                	mov    %edi,%edx
+ 30e:	89 de                	mov    %ebx,%esi
+    return fib(num-1) + fib(num-2);
+ 310:	8d 5e ff             	lea    -0x1(%esi),%ebx
+    if(num == 1)
+ 313:	83 fe 02             	cmp    $0x2,%esi
+ 316:	74 35                	je     34d <fib+0xfd>
+ 318:	31 ff                	xor    %edi,%edi
+ 31a:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+    return fib(num-1) + fib(num-2);
+ 31d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+ 320:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 323:	89 04 24             	mov    %eax,(%esp)
+ 326:	e8 25 ff ff ff       	call   250 <fib>
+    if (num == 0)
+ 32b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 32e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+ 331:	01 c7                	add    %eax,%edi
+ 333:	83 eb 02             	sub    $0x2,%ebx
+ 336:	0f 84 cc 00 00 00    	je     408 <fib+0x1b8>
+    if(num == 1)
+ 33c:	83 fb 01             	cmp    $0x1,%ebx
+ 33f:	75 d9                	jne    31a <fib+0xca>
+ 341:	8d 54 17 01          	lea    0x1(%edi,%edx,1),%edx
+    return fib(num-1) + fib(num-2);
+ 345:	83 ee 02             	sub    $0x2,%esi
+    if(num == 1)
+ 348:	83 fe 01             	cmp    $0x1,%esi
+ 34b:	75 c3                	jne    310 <fib+0xc0>
+    return fib(num-1) + fib(num-2);
+ 34d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 350:	89 d7                	mov    %edx,%edi
+ 352:	89 ce                	mov    %ecx,%esi
+ 354:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 357:	83 e8 02             	sub    $0x2,%eax
+ 35a:	8d 54 17 01          	lea    0x1(%edi,%edx,1),%edx
+    if(num == 1)
+ 35e:	83 f8 01             	cmp    $0x1,%eax
+ 361:	75 97                	jne    2fa <fib+0xaa>
+    return fib(num-1) + fib(num-2);
+ 363:	89 d1                	mov    %edx,%ecx
+ 365:	89 f2                	mov    %esi,%edx
+ 367:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 36a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ 36d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+ 370:	83 ee 02             	sub    $0x2,%esi
+ 373:	8d 5c 19 01          	lea    0x1(%ecx,%ebx,1),%ebx
+    if(num == 1)
+ 377:	83 fe 01             	cmp    $0x1,%esi
+ 37a:	0f 85 5f ff ff ff    	jne    2df <fib+0x8f>
+    return fib(num-1) + fib(num-2);
+ 380:	89 d9                	mov    %ebx,%ecx
+ 382:	89 d3                	mov    %edx,%ebx
+    if (num == 0)
+ 384:	8d 7c 39 01          	lea    0x1(%ecx,%edi,1),%edi
+    return fib(num-1) + fib(num-2);
+ 388:	83 eb 02             	sub    $0x2,%ebx
+    if(num == 1)
+ 38b:	83 fb 01             	cmp    $0x1,%ebx
+ 38e:	0f 85 39 ff ff ff    	jne    2cd <fib+0x7d>
+    return fib(num-1) + fib(num-2);
+ 394:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+ 397:	89 fe                	mov    %edi,%esi
+ 399:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 39c:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+ 39f:	83 eb 02             	sub    $0x2,%ebx
+ 3a2:	8d 44 30 01          	lea    0x1(%eax,%esi,1),%eax
+    if(num == 1)
+ 3a6:	83 fb 01             	cmp    $0x1,%ebx
+ 3a9:	0f 85 03 ff ff ff    	jne    2b2 <fib+0x62>
+    return fib(num-1) + fib(num-2);
+ 3af:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+ 3b2:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+ 3b6:	8b 75 b8             	mov    -0x48(%ebp),%esi
+ 3b9:	83 eb 02             	sub    $0x2,%ebx
+    if(num == 1)
+ 3bc:	83 fb 01             	cmp    $0x1,%ebx
+ 3bf:	0f 85 d7 fe ff ff    	jne    29c <fib+0x4c>
+    return fib(num-1) + fib(num-2);
+ 3c5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 3c8:	83 ee 02             	sub    $0x2,%esi
+    if(num == 1)
+ 3cb:	83 fe 01             	cmp    $0x1,%esi
+    return fib(num-1) + fib(num-2);
+ 3ce:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+    if (num == 0)
+ 3d1:	8d 44 38 01          	lea    0x1(%eax,%edi,1),%eax
+    if(num == 1)
+ 3d5:	0f 85 ab fe ff ff    	jne    286 <fib+0x36>
+ 3db:	8b 75 c8             	mov    -0x38(%ebp),%esi
+    if (num == 0)
+ 3de:	8d 74 30 01          	lea    0x1(%eax,%esi,1),%esi
+    if(num == 1)
+ 3e2:	8d 43 fe             	lea    -0x2(%ebx),%eax
+ 3e5:	4b                   	dec    %ebx
+ 3e6:	74 0d                	je     3f5 <fib+0x1a5>
+ 3e8:	89 c3                	mov    %eax,%ebx
+    return fib(num-1) + fib(num-2);
+ 3ea:	8d 4b 01             	lea    0x1(%ebx),%ecx
+    if(num == 1)
+ 3ed:	85 db                	test   %ebx,%ebx
+ 3ef:	0f 85 8a fe ff ff    	jne    27f <fib+0x2f>
+ 3f5:	89 f3                	mov    %esi,%ebx
+ 3f7:	43                   	inc    %ebx
+}
+ 3f8:	83 c4 5c             	add    $0x5c,%esp
+ 3fb:	89 d8                	mov    %ebx,%eax
+ 3fd:	5b                   	pop    %ebx
+ 3fe:	5e                   	pop    %esi
+ 3ff:	5f                   	pop    %edi
+ 400:	5d                   	pop    %ebp
+ 401:	c3                   	ret
+ 402:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return fib(num-1) + fib(num-2);
+ 408:	83 ee 02             	sub    $0x2,%esi
+ 40b:	01 fa                	add    %edi,%edx
+    if (num == 0)
+ 40d:	e9 36 ff ff ff       	jmp    348 <fib+0xf8>
+}
+ 412:	83 c4 5c             	add    $0x5c,%esp
+    if (num == 0)
+ 415:	31 db                	xor    %ebx,%ebx
+}
+ 417:	89 d8                	mov    %ebx,%eax
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5f                   	pop    %edi
+ 41c:	5d                   	pop    %ebp
+ 41d:	c3                   	ret
+    if(num == 1)
+ 41e:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 423:	eb d3                	jmp    3f8 <fib+0x1a8>
+ 425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <round_robin_sanity>:
+void round_robin_sanity(){
+ 430:	55                   	push   %ebp
+    printf(1,"\n=====Started round_robin_sanity test======\n");
+ 431:	ba e4 0f 00 00       	mov    $0xfe4,%edx
+void round_robin_sanity(){
+ 436:	89 e5                	mov    %esp,%ebp
+ 438:	56                   	push   %esi
+ 439:	53                   	push   %ebx
+    for (int i=0;i<50;i++){
+ 43a:	31 db                	xor    %ebx,%ebx
+void round_robin_sanity(){
+ 43c:	83 ec 20             	sub    $0x20,%esp
+    printf(1,"\n=====Started round_robin_sanity test======\n");
+ 43f:	89 54 24 04          	mov    %edx,0x4(%esp)
+ 443:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 44a:	e8 c1 06 00 00       	call   b10 <printf>
+    for (int i=0;i<50;i++){
+ 44f:	90                   	nop
+        pid  = fork();
+ 450:	e8 e6 04 00 00       	call   93b <fork>
+        if(pid == 0 ){
+ 455:	85 c0                	test   %eax,%eax
+ 457:	74 32                	je     48b <round_robin_sanity+0x5b>
+    for (int i=0;i<50;i++){
+ 459:	43                   	inc    %ebx
+ 45a:	83 fb 32             	cmp    $0x32,%ebx
+ 45d:	75 f1                	jne    450 <round_robin_sanity+0x20>
+ 45f:	8d 75 f4             	lea    -0xc(%ebp),%esi
+ 462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        wait(&ret);
+ 470:	89 34 24             	mov    %esi,(%esp)
+ 473:	e8 d3 04 00 00       	call   94b <wait>
+        ans += ret;
+ 478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47b:	01 05 6c 16 00 00    	add    %eax,0x166c
+    for(int j=0; j<50 ; j++){
+ 481:	4b                   	dec    %ebx
+ 482:	75 ec                	jne    470 <round_robin_sanity+0x40>
+}
+ 484:	83 c4 20             	add    $0x20,%esp
+ 487:	5b                   	pop    %ebx
+ 488:	5e                   	pop    %esi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+            sleep(50-i);
+ 48b:	b8 32 00 00 00       	mov    $0x32,%eax
+ 490:	29 d8                	sub    %ebx,%eax
+ 492:	89 04 24             	mov    %eax,(%esp)
+ 495:	e8 39 05 00 00       	call   9d3 <sleep>
+             fib(fibNum);
+ 49a:	a1 68 16 00 00       	mov    0x1668,%eax
+ 49f:	89 04 24             	mov    %eax,(%esp)
+ 4a2:	e8 a9 fd ff ff       	call   250 <fib>
+            printf(1,"chiled %d \n",i);
+ 4a7:	b8 67 11 00 00       	mov    $0x1167,%eax
+ 4ac:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 4b0:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 4b4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 4bb:	e8 50 06 00 00       	call   b10 <printf>
+            exit(0);
+ 4c0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 4c7:	e8 77 04 00 00       	call   943 <exit>
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <priority_policy_sanity>:
+void priority_policy_sanity(){
+ 4d0:	55                   	push   %ebp
+    printf(1,"\n=======Started priority_policy_sanity test======\n");
+ 4d1:	ba 14 10 00 00       	mov    $0x1014,%edx
+void priority_policy_sanity(){
+ 4d6:	89 e5                	mov    %esp,%ebp
+ 4d8:	56                   	push   %esi
+ 4d9:	53                   	push   %ebx
+    for (int i = 0; i < 40; ++i) {
+ 4da:	31 db                	xor    %ebx,%ebx
+void priority_policy_sanity(){
+ 4dc:	83 ec 20             	sub    $0x20,%esp
+    printf(1,"\n=======Started priority_policy_sanity test======\n");
+ 4df:	89 54 24 04          	mov    %edx,0x4(%esp)
+ 4e3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 4ea:	e8 21 06 00 00       	call   b10 <printf>
+    policy(2);
+ 4ef:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+ 4f6:	e8 f0 04 00 00       	call   9eb <policy>
+    for (int i = 0; i < 40; ++i) {
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+        pid = fork();
+ 500:	e8 36 04 00 00       	call   93b <fork>
+        if (pid == 0) {
+ 505:	85 c0                	test   %eax,%eax
+ 507:	74 3e                	je     547 <priority_policy_sanity+0x77>
+    for (int i = 0; i < 40; ++i) {
+ 509:	43                   	inc    %ebx
+ 50a:	83 fb 28             	cmp    $0x28,%ebx
+ 50d:	75 f1                	jne    500 <priority_policy_sanity+0x30>
+ 50f:	8d 75 f4             	lea    -0xc(%ebp),%esi
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        wait(&status);
+ 520:	89 34 24             	mov    %esi,(%esp)
+ 523:	e8 23 04 00 00       	call   94b <wait>
+        ans +=status;
+ 528:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 52b:	01 05 6c 16 00 00    	add    %eax,0x166c
+    for (int j = 0; j < 40; ++j) {
+ 531:	4b                   	dec    %ebx
+ 532:	75 ec                	jne    520 <priority_policy_sanity+0x50>
+    policy(1);
+ 534:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 53b:	e8 ab 04 00 00       	call   9eb <policy>
+}
+ 540:	83 c4 20             	add    $0x20,%esp
+ 543:	5b                   	pop    %ebx
+ 544:	5e                   	pop    %esi
+ 545:	5d                   	pop    %ebp
+ 546:	c3                   	ret
+             sleep(40-i);
+ 547:	b8 28 00 00 00       	mov    $0x28,%eax
+ 54c:	29 d8                	sub    %ebx,%eax
+ 54e:	89 04 24             	mov    %eax,(%esp)
+ 551:	e8 7d 04 00 00       	call   9d3 <sleep>
+            if ((i % 10) == 0) {
+ 556:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 55b:	f7 e3                	mul    %ebx
+ 55d:	89 d0                	mov    %edx,%eax
+ 55f:	c1 e8 03             	shr    $0x3,%eax
+ 562:	8d 14 80             	lea    (%eax,%eax,4),%edx
+ 565:	89 d8                	mov    %ebx,%eax
+ 567:	01 d2                	add    %edx,%edx
+ 569:	29 d0                	sub    %edx,%eax
+ 56b:	75 3e                	jne    5ab <priority_policy_sanity+0xdb>
+                priority(1);
+ 56d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 574:	e8 7a 04 00 00       	call   9f3 <priority>
+            fib(fibNum);
+ 579:	a1 68 16 00 00       	mov    0x1668,%eax
+ 57e:	89 04 24             	mov    %eax,(%esp)
+ 581:	e8 ca fc ff ff       	call   250 <fib>
+            printf(1,"chiled %d \n",i);
+ 586:	b8 67 11 00 00       	mov    $0x1167,%eax
+ 58b:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 58f:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 593:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 59a:	e8 71 05 00 00       	call   b10 <printf>
+            exit(0);
+ 59f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 5a6:	e8 98 03 00 00       	call   943 <exit>
+                priority(i % 10);
+ 5ab:	89 04 24             	mov    %eax,(%esp)
+ 5ae:	e8 40 04 00 00       	call   9f3 <priority>
+ 5b3:	eb c4                	jmp    579 <priority_policy_sanity+0xa9>
+ 5b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <extpriority_policy_sanity>:
+void extpriority_policy_sanity(){
+ 5c0:	55                   	push   %ebp
+        printf(1,"\n=======Started extpriority_policy_sanity test======\n");
+ 5c1:	ba 48 10 00 00       	mov    $0x1048,%edx
+void extpriority_policy_sanity(){
+ 5c6:	89 e5                	mov    %esp,%ebp
+ 5c8:	56                   	push   %esi
+ 5c9:	53                   	push   %ebx
+    for (int i = 0; i < 40; ++i) {
+ 5ca:	31 db                	xor    %ebx,%ebx
+void extpriority_policy_sanity(){
+ 5cc:	83 ec 20             	sub    $0x20,%esp
+        printf(1,"\n=======Started extpriority_policy_sanity test======\n");
+ 5cf:	89 54 24 04          	mov    %edx,0x4(%esp)
+ 5d3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 5da:	e8 31 05 00 00       	call   b10 <printf>
+    policy(3);
+ 5df:	c7 04 24 03 00 00 00 	movl   $0x3,(%esp)
+ 5e6:	e8 00 04 00 00       	call   9eb <policy>
+    for (int i = 0; i < 40; ++i) {
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+        pid = fork();
+ 5f0:	e8 46 03 00 00       	call   93b <fork>
+        if (pid == 0) {
+ 5f5:	85 c0                	test   %eax,%eax
+ 5f7:	74 3e                	je     637 <extpriority_policy_sanity+0x77>
+    for (int i = 0; i < 40; ++i) {
+ 5f9:	43                   	inc    %ebx
+ 5fa:	83 fb 28             	cmp    $0x28,%ebx
+ 5fd:	75 f1                	jne    5f0 <extpriority_policy_sanity+0x30>
+ 5ff:	8d 75 f4             	lea    -0xc(%ebp),%esi
+ 602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        wait(&status);
+ 610:	89 34 24             	mov    %esi,(%esp)
+ 613:	e8 33 03 00 00       	call   94b <wait>
+        ans +=status;
+ 618:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 61b:	01 05 6c 16 00 00    	add    %eax,0x166c
+    for (int j = 0; j < 40; ++j) {
+ 621:	4b                   	dec    %ebx
+ 622:	75 ec                	jne    610 <extpriority_policy_sanity+0x50>
+    policy(1);
+ 624:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 62b:	e8 bb 03 00 00       	call   9eb <policy>
+}
+ 630:	83 c4 20             	add    $0x20,%esp
+ 633:	5b                   	pop    %ebx
+ 634:	5e                   	pop    %esi
+ 635:	5d                   	pop    %ebp
+ 636:	c3                   	ret
+          sleep(40-i);
+ 637:	b8 28 00 00 00       	mov    $0x28,%eax
+ 63c:	29 d8                	sub    %ebx,%eax
+ 63e:	89 04 24             	mov    %eax,(%esp)
+ 641:	e8 8d 03 00 00       	call   9d3 <sleep>
+            priority(i % 10);
+ 646:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 64b:	f7 e3                	mul    %ebx
+ 64d:	89 d0                	mov    %edx,%eax
+ 64f:	89 da                	mov    %ebx,%edx
+ 651:	c1 e8 03             	shr    $0x3,%eax
+ 654:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 657:	01 c0                	add    %eax,%eax
+ 659:	29 c2                	sub    %eax,%edx
+ 65b:	89 14 24             	mov    %edx,(%esp)
+ 65e:	e8 90 03 00 00       	call   9f3 <priority>
+            fib(fibNum);
+ 663:	a1 68 16 00 00       	mov    0x1668,%eax
+ 668:	89 04 24             	mov    %eax,(%esp)
+ 66b:	e8 e0 fb ff ff       	call   250 <fib>
+            printf(1,"chiled %d \n",i);
+ 670:	b8 67 11 00 00       	mov    $0x1167,%eax
+ 675:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 679:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 67d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 684:	e8 87 04 00 00       	call   b10 <printf>
+            exit(0);
+ 689:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 690:	e8 ae 02 00 00       	call   943 <exit>
+ 695:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <make_test>:
+void make_test(void (*f)(void) , int expected ,char * fail_msg){
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 08             	sub    $0x8,%esp
+ 6a6:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 6a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 6ac:	89 75 fc             	mov    %esi,-0x4(%ebp)
+ 6af:	8b 75 10             	mov    0x10(%ebp),%esi
+  f();
+ 6b2:	ff 55 08             	call   *0x8(%ebp)
+  if(ans == expected)
+ 6b5:	39 1d 6c 16 00 00    	cmp    %ebx,0x166c
+ 6bb:	75 13                	jne    6d0 <make_test+0x30>
+    success++;
+ 6bd:	ff 05 84 16 00 00    	incl   0x1684
+}
+ 6c3:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 6c6:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 6c9:	89 ec                	mov    %ebp,%esp
+ 6cb:	5d                   	pop    %ebp
+ 6cc:	c3                   	ret
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+    fail++;
+ 6d0:	ff 05 80 16 00 00    	incl   0x1680
+    printf(1,"%s\n",fail_msg);
+ 6d6:	89 75 10             	mov    %esi,0x10(%ebp)
+ 6d9:	c7 45 0c 73 11 00 00 	movl   $0x1173,0xc(%ebp)
+}
+ 6e0:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+    printf(1,"%s\n",fail_msg);
+ 6e3:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 6ea:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 6ed:	89 ec                	mov    %ebp,%esp
+ 6ef:	5d                   	pop    %ebp
+    printf(1,"%s\n",fail_msg);
+ 6f0:	e9 1b 04 00 00       	jmp    b10 <printf>
+ 6f5:	66 90                	xchg   %ax,%ax
+ 6f7:	66 90                	xchg   %ax,%ax
+ 6f9:	66 90                	xchg   %ax,%ax
+ 6fb:	66 90                	xchg   %ax,%ax
+ 6fd:	66 90                	xchg   %ax,%ax
+ 6ff:	90                   	nop
+
+00000700 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 700:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 701:	31 c0                	xor    %eax,%eax
+{
+ 703:	89 e5                	mov    %esp,%ebp
+ 705:	53                   	push   %ebx
+ 706:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 709:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 710:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 714:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 717:	40                   	inc    %eax
+ 718:	84 d2                	test   %dl,%dl
+ 71a:	75 f4                	jne    710 <strcpy+0x10>
+    ;
+  return os;
+}
+ 71c:	5b                   	pop    %ebx
+ 71d:	89 c8                	mov    %ecx,%eax
+ 71f:	5d                   	pop    %ebp
+ 720:	c3                   	ret
+ 721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+
+00000730 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	53                   	push   %ebx
+ 734:	8b 55 08             	mov    0x8(%ebp),%edx
+ 737:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 73a:	0f b6 02             	movzbl (%edx),%eax
+ 73d:	84 c0                	test   %al,%al
+ 73f:	75 15                	jne    756 <strcmp+0x26>
+ 741:	eb 30                	jmp    773 <strcmp+0x43>
+ 743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 747:	90                   	nop
+ 748:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 74c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 74f:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 750:	84 c0                	test   %al,%al
+ 752:	74 14                	je     768 <strcmp+0x38>
+    p++, q++;
+ 754:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 756:	0f b6 0b             	movzbl (%ebx),%ecx
+ 759:	38 c1                	cmp    %al,%cl
+ 75b:	74 eb                	je     748 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 75d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 75e:	29 c8                	sub    %ecx,%eax
+}
+ 760:	5d                   	pop    %ebp
+ 761:	c3                   	ret
+ 762:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 768:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 76c:	31 c0                	xor    %eax,%eax
+}
+ 76e:	5b                   	pop    %ebx
+ 76f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 770:	29 c8                	sub    %ecx,%eax
+}
+ 772:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 773:	0f b6 0b             	movzbl (%ebx),%ecx
+ 776:	31 c0                	xor    %eax,%eax
+ 778:	eb e3                	jmp    75d <strcmp+0x2d>
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000780 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 786:	80 3a 00             	cmpb   $0x0,(%edx)
+ 789:	74 15                	je     7a0 <strlen+0x20>
+ 78b:	31 c0                	xor    %eax,%eax
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+ 790:	40                   	inc    %eax
+ 791:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 795:	89 c1                	mov    %eax,%ecx
+ 797:	75 f7                	jne    790 <strlen+0x10>
+    ;
+  return n;
+}
+ 799:	5d                   	pop    %ebp
+ 79a:	89 c8                	mov    %ecx,%eax
+ 79c:	c3                   	ret
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+ 7a0:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 7a1:	31 c9                	xor    %ecx,%ecx
+}
+ 7a3:	89 c8                	mov    %ecx,%eax
+ 7a5:	c3                   	ret
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 7b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7bd:	89 d7                	mov    %edx,%edi
+ 7bf:	fc                   	cld
+ 7c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 7c2:	5f                   	pop    %edi
+ 7c3:	89 d0                	mov    %edx,%eax
+ 7c5:	5d                   	pop    %ebp
+ 7c6:	c3                   	ret
+ 7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 7da:	0f b6 10             	movzbl (%eax),%edx
+ 7dd:	84 d2                	test   %dl,%dl
+ 7df:	75 10                	jne    7f1 <strchr+0x21>
+ 7e1:	eb 1d                	jmp    800 <strchr+0x30>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 7ec:	40                   	inc    %eax
+ 7ed:	84 d2                	test   %dl,%dl
+ 7ef:	74 0f                	je     800 <strchr+0x30>
+    if(*s == c)
+ 7f1:	38 d1                	cmp    %dl,%cl
+ 7f3:	75 f3                	jne    7e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 7f5:	5d                   	pop    %ebp
+ 7f6:	c3                   	ret
+ 7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fe:	66 90                	xchg   %ax,%ax
+ 800:	5d                   	pop    %ebp
+  return 0;
+ 801:	31 c0                	xor    %eax,%eax
+}
+ 803:	c3                   	ret
+ 804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+
+00000810 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 815:	31 f6                	xor    %esi,%esi
+{
+ 817:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 818:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 81b:	83 ec 3c             	sub    $0x3c,%esp
+ 81e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 821:	eb 32                	jmp    855 <gets+0x45>
+ 823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 827:	90                   	nop
+    cc = read(0, &c, 1);
+ 828:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 82c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 831:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 835:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 83c:	e8 1a 01 00 00       	call   95b <read>
+    if(cc < 1)
+ 841:	85 c0                	test   %eax,%eax
+ 843:	7e 19                	jle    85e <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 845:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 849:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 84d:	3c 0a                	cmp    $0xa,%al
+ 84f:	74 10                	je     861 <gets+0x51>
+ 851:	3c 0d                	cmp    $0xd,%al
+ 853:	74 0c                	je     861 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 855:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 858:	46                   	inc    %esi
+ 859:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 85c:	7c ca                	jl     828 <gets+0x18>
+ 85e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 861:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 865:	83 c4 3c             	add    $0x3c,%esp
+ 868:	89 d8                	mov    %ebx,%eax
+ 86a:	5b                   	pop    %ebx
+ 86b:	5e                   	pop    %esi
+ 86c:	5f                   	pop    %edi
+ 86d:	5d                   	pop    %ebp
+ 86e:	c3                   	ret
+ 86f:	90                   	nop
+
+00000870 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 870:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 871:	31 c0                	xor    %eax,%eax
+{
+ 873:	89 e5                	mov    %esp,%ebp
+ 875:	83 ec 18             	sub    $0x18,%esp
+ 878:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 87b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 87e:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 882:	8b 45 08             	mov    0x8(%ebp),%eax
+ 885:	89 04 24             	mov    %eax,(%esp)
+ 888:	e8 f6 00 00 00       	call   983 <open>
+  if(fd < 0)
+ 88d:	85 c0                	test   %eax,%eax
+ 88f:	78 2f                	js     8c0 <stat+0x50>
+ 891:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 893:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 896:	89 1c 24             	mov    %ebx,(%esp)
+ 899:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 89d:	e8 f9 00 00 00       	call   99b <fstat>
+  close(fd);
+ 8a2:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 8a5:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 8a7:	e8 bf 00 00 00       	call   96b <close>
+  return r;
+}
+ 8ac:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 8af:	89 f0                	mov    %esi,%eax
+ 8b1:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 8b4:	89 ec                	mov    %ebp,%esp
+ 8b6:	5d                   	pop    %ebp
+ 8b7:	c3                   	ret
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+    return -1;
+ 8c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 8c5:	eb e5                	jmp    8ac <stat+0x3c>
+ 8c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ce:	66 90                	xchg   %ax,%ax
+
+000008d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	53                   	push   %ebx
+ 8d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 8d7:	0f be 02             	movsbl (%edx),%eax
+ 8da:	88 c1                	mov    %al,%cl
+ 8dc:	80 e9 30             	sub    $0x30,%cl
+ 8df:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 8e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 8e7:	77 1c                	ja     905 <atoi+0x35>
+ 8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 8f0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 8f3:	42                   	inc    %edx
+ 8f4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 8f8:	0f be 02             	movsbl (%edx),%eax
+ 8fb:	88 c3                	mov    %al,%bl
+ 8fd:	80 eb 30             	sub    $0x30,%bl
+ 900:	80 fb 09             	cmp    $0x9,%bl
+ 903:	76 eb                	jbe    8f0 <atoi+0x20>
+  return n;
+}
+ 905:	5b                   	pop    %ebx
+ 906:	89 c8                	mov    %ecx,%eax
+ 908:	5d                   	pop    %ebp
+ 909:	c3                   	ret
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000910 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	8b 45 10             	mov    0x10(%ebp),%eax
+ 918:	8b 55 08             	mov    0x8(%ebp),%edx
+ 91b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 91e:	85 c0                	test   %eax,%eax
+ 920:	7e 13                	jle    935 <memmove+0x25>
+ 922:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 924:	89 d7                	mov    %edx,%edi
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 930:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 931:	39 f8                	cmp    %edi,%eax
+ 933:	75 fb                	jne    930 <memmove+0x20>
+  return vdst;
+}
+ 935:	5e                   	pop    %esi
+ 936:	89 d0                	mov    %edx,%eax
+ 938:	5f                   	pop    %edi
+ 939:	5d                   	pop    %ebp
+ 93a:	c3                   	ret
+
+0000093b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 93b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <exit>:
+SYSCALL(exit)
+ 943:	b8 02 00 00 00       	mov    $0x2,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <wait>:
+SYSCALL(wait)
+ 94b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <pipe>:
+SYSCALL(pipe)
+ 953:	b8 04 00 00 00       	mov    $0x4,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <read>:
+SYSCALL(read)
+ 95b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <write>:
+SYSCALL(write)
+ 963:	b8 10 00 00 00       	mov    $0x10,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <close>:
+SYSCALL(close)
+ 96b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <kill>:
+SYSCALL(kill)
+ 973:	b8 06 00 00 00       	mov    $0x6,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+
+0000097b <exec>:
+SYSCALL(exec)
+ 97b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+00000983 <open>:
+SYSCALL(open)
+ 983:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+0000098b <mknod>:
+SYSCALL(mknod)
+ 98b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 990:	cd 40                	int    $0x40
+ 992:	c3                   	ret
+
+00000993 <unlink>:
+SYSCALL(unlink)
+ 993:	b8 12 00 00 00       	mov    $0x12,%eax
+ 998:	cd 40                	int    $0x40
+ 99a:	c3                   	ret
+
+0000099b <fstat>:
+SYSCALL(fstat)
+ 99b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+000009a3 <link>:
+SYSCALL(link)
+ 9a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <mkdir>:
+SYSCALL(mkdir)
+ 9ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9b0:	cd 40                	int    $0x40
+ 9b2:	c3                   	ret
+
+000009b3 <chdir>:
+SYSCALL(chdir)
+ 9b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9b8:	cd 40                	int    $0x40
+ 9ba:	c3                   	ret
+
+000009bb <dup>:
+SYSCALL(dup)
+ 9bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9c0:	cd 40                	int    $0x40
+ 9c2:	c3                   	ret
+
+000009c3 <getpid>:
+SYSCALL(getpid)
+ 9c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9c8:	cd 40                	int    $0x40
+ 9ca:	c3                   	ret
+
+000009cb <sbrk>:
+SYSCALL(sbrk)
+ 9cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9d0:	cd 40                	int    $0x40
+ 9d2:	c3                   	ret
+
+000009d3 <sleep>:
+SYSCALL(sleep)
+ 9d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9d8:	cd 40                	int    $0x40
+ 9da:	c3                   	ret
+
+000009db <uptime>:
+SYSCALL(uptime)
+ 9db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9e0:	cd 40                	int    $0x40
+ 9e2:	c3                   	ret
+
+000009e3 <detach>:
+SYSCALL(detach)
+ 9e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9e8:	cd 40                	int    $0x40
+ 9ea:	c3                   	ret
+
+000009eb <policy>:
+SYSCALL(policy)
+ 9eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9f0:	cd 40                	int    $0x40
+ 9f2:	c3                   	ret
+
+000009f3 <priority>:
+SYSCALL(priority)
+ 9f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9f8:	cd 40                	int    $0x40
+ 9fa:	c3                   	ret
+
+000009fb <wait_stat>:
+SYSCALL(wait_stat)
+ 9fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ a00:	cd 40                	int    $0x40
+ a02:	c3                   	ret
+
+00000a03 <lockstat>:
+SYSCALL(lockstat)
+ a03:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a08:	cd 40                	int    $0x40
+ a0a:	c3                   	ret
+
+00000a0b <mmap>:
+SYSCALL(mmap)
+ a0b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a10:	cd 40                	int    $0x40
+ a12:	c3                   	ret
+
+00000a13 <munmap>:
+SYSCALL(munmap)
+ a13:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a18:	cd 40                	int    $0x40
+ a1a:	c3                   	ret
+
+00000a1b <shmget>:
+SYSCALL(shmget)
+ a1b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a20:	cd 40                	int    $0x40
+ a22:	c3                   	ret
+
+00000a23 <shmat>:
+SYSCALL(shmat)
+ a23:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a28:	cd 40                	int    $0x40
+ a2a:	c3                   	ret
+
+00000a2b <shmdt>:
+SYSCALL(shmdt)
+ a2b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a30:	cd 40                	int    $0x40
+ a32:	c3                   	ret
+
+00000a33 <memstat>:
+SYSCALL(memstat)
+ a33:	b8 20 00 00 00       	mov    $0x20,%eax
+ a38:	cd 40                	int    $0x40
+ a3a:	c3                   	ret
+
+00000a3b <getprocs>:
+SYSCALL(getprocs)
+ a3b:	b8 21 00 00 00       	mov    $0x21,%eax
+ a40:	cd 40                	int    $0x40
+ a42:	c3                   	ret
+
+00000a43 <shmctl>:
+SYSCALL(shmctl)
+ a43:	b8 22 00 00 00       	mov    $0x22,%eax
+ a48:	cd 40                	int    $0x40
+ a4a:	c3                   	ret
+ a4b:	66 90                	xchg   %ax,%ax
+ a4d:	66 90                	xchg   %ax,%ax
+ a4f:	90                   	nop
+
+00000a50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	89 cb                	mov    %ecx,%ebx
+ a58:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a5b:	89 d1                	mov    %edx,%ecx
+{
+ a5d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ a60:	89 d0                	mov    %edx,%eax
+ a62:	c1 e8 1f             	shr    $0x1f,%eax
+ a65:	84 c0                	test   %al,%al
+ a67:	0f 84 93 00 00 00    	je     b00 <printint+0xb0>
+ a6d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a71:	0f 84 89 00 00 00    	je     b00 <printint+0xb0>
+    x = -xx;
+ a77:	f7 d9                	neg    %ecx
+    neg = 1;
+ a79:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a7e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ a85:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ a88:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ a90:	89 c8                	mov    %ecx,%eax
+ a92:	31 d2                	xor    %edx,%edx
+ a94:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ a97:	f7 f3                	div    %ebx
+ a99:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ a9c:	0f b6 92 0c 12 00 00 	movzbl 0x120c(%edx),%edx
+ aa3:	8d 47 01             	lea    0x1(%edi),%eax
+ aa6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ aa9:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ aad:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ aaf:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ ab2:	39 da                	cmp    %ebx,%edx
+ ab4:	73 da                	jae    a90 <printint+0x40>
+  if(neg)
+ ab6:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ ab9:	85 c0                	test   %eax,%eax
+ abb:	74 0a                	je     ac7 <printint+0x77>
+    buf[i++] = '-';
+ abd:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ac0:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ ac5:	89 c7                	mov    %eax,%edi
+ ac7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ aca:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ ace:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ad0:	0f b6 07             	movzbl (%edi),%eax
+ ad3:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ ad6:	b8 01 00 00 00       	mov    $0x1,%eax
+ adb:	89 44 24 08          	mov    %eax,0x8(%esp)
+ adf:	89 74 24 04          	mov    %esi,0x4(%esp)
+ ae3:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ ae6:	89 04 24             	mov    %eax,(%esp)
+ ae9:	e8 75 fe ff ff       	call   963 <write>
+  while(--i >= 0)
+ aee:	89 f8                	mov    %edi,%eax
+ af0:	4f                   	dec    %edi
+ af1:	39 d8                	cmp    %ebx,%eax
+ af3:	75 db                	jne    ad0 <printint+0x80>
+}
+ af5:	83 c4 4c             	add    $0x4c,%esp
+ af8:	5b                   	pop    %ebx
+ af9:	5e                   	pop    %esi
+ afa:	5f                   	pop    %edi
+ afb:	5d                   	pop    %ebp
+ afc:	c3                   	ret
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ b00:	31 c0                	xor    %eax,%eax
+ b02:	e9 77 ff ff ff       	jmp    a7e <printint+0x2e>
+ b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0e:	66 90                	xchg   %ax,%ax
+
+00000b10 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b19:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b1f:	0f b6 1e             	movzbl (%esi),%ebx
+ b22:	84 db                	test   %bl,%bl
+ b24:	74 6f                	je     b95 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ b26:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ b29:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ b2b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ b2e:	88 d9                	mov    %bl,%cl
+ b30:	46                   	inc    %esi
+ b31:	89 d3                	mov    %edx,%ebx
+ b33:	eb 2b                	jmp    b60 <printf+0x50>
+ b35:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ b38:	83 f8 25             	cmp    $0x25,%eax
+ b3b:	74 4b                	je     b88 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ b3d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ b40:	b8 01 00 00 00       	mov    $0x1,%eax
+ b45:	89 44 24 08          	mov    %eax,0x8(%esp)
+ b49:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b4c:	89 44 24 04          	mov    %eax,0x4(%esp)
+ b50:	89 3c 24             	mov    %edi,(%esp)
+ b53:	e8 0b fe ff ff       	call   963 <write>
+  for(i = 0; fmt[i]; i++){
+ b58:	0f b6 0e             	movzbl (%esi),%ecx
+ b5b:	46                   	inc    %esi
+ b5c:	84 c9                	test   %cl,%cl
+ b5e:	74 35                	je     b95 <printf+0x85>
+    if(state == 0){
+ b60:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ b62:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ b65:	74 d1                	je     b38 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b67:	83 fb 25             	cmp    $0x25,%ebx
+ b6a:	75 ec                	jne    b58 <printf+0x48>
+      if(c == 'd'){
+ b6c:	83 f8 25             	cmp    $0x25,%eax
+ b6f:	0f 84 53 01 00 00    	je     cc8 <printf+0x1b8>
+ b75:	83 e8 63             	sub    $0x63,%eax
+ b78:	83 f8 15             	cmp    $0x15,%eax
+ b7b:	77 23                	ja     ba0 <printf+0x90>
+ b7d:	ff 24 85 b4 11 00 00 	jmp    *0x11b4(,%eax,4)
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ b88:	0f b6 0e             	movzbl (%esi),%ecx
+ b8b:	46                   	inc    %esi
+        state = '%';
+ b8c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ b91:	84 c9                	test   %cl,%cl
+ b93:	75 cb                	jne    b60 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b95:	83 c4 3c             	add    $0x3c,%esp
+ b98:	5b                   	pop    %ebx
+ b99:	5e                   	pop    %esi
+ b9a:	5f                   	pop    %edi
+ b9b:	5d                   	pop    %ebp
+ b9c:	c3                   	ret
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+ ba0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ ba3:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ ba6:	b8 01 00 00 00       	mov    $0x1,%eax
+ bab:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ baf:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ bb3:	89 44 24 08          	mov    %eax,0x8(%esp)
+ bb7:	89 3c 24             	mov    %edi,(%esp)
+ bba:	e8 a4 fd ff ff       	call   963 <write>
+        putc(fd, c);
+ bbf:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ bc3:	ba 01 00 00 00       	mov    $0x1,%edx
+ bc8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ bcb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ bcf:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ bd1:	89 54 24 08          	mov    %edx,0x8(%esp)
+ bd5:	89 3c 24             	mov    %edi,(%esp)
+ bd8:	e8 86 fd ff ff       	call   963 <write>
+ bdd:	e9 76 ff ff ff       	jmp    b58 <printf+0x48>
+ be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ be8:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ beb:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bf0:	8b 13                	mov    (%ebx),%edx
+ bf2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ bf9:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ bfc:	89 f8                	mov    %edi,%eax
+ bfe:	e8 4d fe ff ff       	call   a50 <printint>
+        ap++;
+ c03:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ c06:	31 db                	xor    %ebx,%ebx
+ c08:	e9 4b ff ff ff       	jmp    b58 <printf+0x48>
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ c10:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ c13:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ c15:	83 c0 04             	add    $0x4,%eax
+ c18:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ c1b:	85 c9                	test   %ecx,%ecx
+ c1d:	0f 84 cd 00 00 00    	je     cf0 <printf+0x1e0>
+        while(*s != 0){
+ c23:	0f b6 01             	movzbl (%ecx),%eax
+ c26:	84 c0                	test   %al,%al
+ c28:	0f 84 ce 00 00 00    	je     cfc <printf+0x1ec>
+ c2e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ c31:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ c34:	89 ce                	mov    %ecx,%esi
+ c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ c40:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c43:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ c48:	46                   	inc    %esi
+  write(fd, &c, 1);
+ c49:	89 44 24 08          	mov    %eax,0x8(%esp)
+ c4d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ c51:	89 3c 24             	mov    %edi,(%esp)
+ c54:	e8 0a fd ff ff       	call   963 <write>
+        while(*s != 0){
+ c59:	0f b6 06             	movzbl (%esi),%eax
+ c5c:	84 c0                	test   %al,%al
+ c5e:	75 e0                	jne    c40 <printf+0x130>
+      state = 0;
+ c60:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ c63:	31 db                	xor    %ebx,%ebx
+ c65:	e9 ee fe ff ff       	jmp    b58 <printf+0x48>
+ c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c70:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ c73:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c78:	8b 13                	mov    (%ebx),%edx
+ c7a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ c81:	e9 73 ff ff ff       	jmp    bf9 <printf+0xe9>
+ c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ c90:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ c93:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ c98:	8b 10                	mov    (%eax),%edx
+ c9a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ c9d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ ca1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ca4:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ ca8:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ cab:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ caf:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ cb1:	89 3c 24             	mov    %edi,(%esp)
+ cb4:	e8 aa fc ff ff       	call   963 <write>
+        ap++;
+ cb9:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ cbd:	e9 96 fe ff ff       	jmp    b58 <printf+0x48>
+ cc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ cc8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ ccb:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ cce:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cd3:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ cd7:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ cd9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ cdd:	89 3c 24             	mov    %edi,(%esp)
+ ce0:	e8 7e fc ff ff       	call   963 <write>
+ ce5:	e9 6e fe ff ff       	jmp    b58 <printf+0x48>
+ cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ cf0:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ cf2:	b9 ac 11 00 00       	mov    $0x11ac,%ecx
+ cf7:	e9 32 ff ff ff       	jmp    c2e <printf+0x11e>
+      state = 0;
+ cfc:	31 db                	xor    %ebx,%ebx
+ cfe:	66 90                	xchg   %ax,%ax
+ d00:	e9 53 fe ff ff       	jmp    b58 <printf+0x48>
+ d05:	66 90                	xchg   %ax,%ax
+ d07:	66 90                	xchg   %ax,%ax
+ d09:	66 90                	xchg   %ax,%ax
+ d0b:	66 90                	xchg   %ax,%ax
+ d0d:	66 90                	xchg   %ax,%ax
+ d0f:	90                   	nop
+
+00000d10 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	83 ec 18             	sub    $0x18,%esp
+ d16:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ d19:	89 c3                	mov    %eax,%ebx
+ d1b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ d1e:	a1 a4 16 00 00       	mov    0x16a4,%eax
+ d23:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+ d29:	29 c2                	sub    %eax,%edx
+ d2b:	39 da                	cmp    %ebx,%edx
+ d2d:	72 19                	jb     d48 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ d2f:	01 c3                	add    %eax,%ebx
+ d31:	89 1d a4 16 00 00    	mov    %ebx,0x16a4
+  return p;
+}
+ d37:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ d3a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ d3d:	89 ec                	mov    %ebp,%esp
+ d3f:	5d                   	pop    %ebp
+ d40:	c3                   	ret
+ d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ d48:	b8 00 00 01 00       	mov    $0x10000,%eax
+ d4d:	39 c3                	cmp    %eax,%ebx
+ d4f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ d52:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ d55:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ d57:	e8 6f fc ff ff       	call   9cb <sbrk>
+    if(p == (char*)-1)
+ d5c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ d5f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ d61:	74 1d                	je     d80 <morecore+0x70>
+    if(p != arenaend)
+ d63:	39 05 a0 16 00 00    	cmp    %eax,0x16a0
+ d69:	74 0d                	je     d78 <morecore+0x68>
+    arenaend = p + grow;
+ d6b:	01 f2                	add    %esi,%edx
+ d6d:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+ d73:	eb ba                	jmp    d2f <morecore+0x1f>
+ d75:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ d78:	a1 a4 16 00 00       	mov    0x16a4,%eax
+ d7d:	eb ec                	jmp    d6b <morecore+0x5b>
+ d7f:	90                   	nop
+      return 0;
+ d80:	31 c0                	xor    %eax,%eax
+ d82:	eb b3                	jmp    d37 <morecore+0x27>
+ d84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+
+00000d90 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	83 ec 0c             	sub    $0xc,%esp
+ d96:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ d99:	8b 45 08             	mov    0x8(%ebp),%eax
+ d9c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ d9f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ da2:	85 c0                	test   %eax,%eax
+ da4:	74 1e                	je     dc4 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ da6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ da9:	83 fa 08             	cmp    $0x8,%edx
+ dac:	77 16                	ja     dc4 <free+0x34>
+  h = (Header*)ap - 1;
+ dae:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ db1:	74 25                	je     dd8 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ db3:	8b 3c 95 c0 16 00 00 	mov    0x16c0(,%edx,4),%edi
+ dba:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ dbd:	89 0c 95 c0 16 00 00 	mov    %ecx,0x16c0(,%edx,4)
+}
+ dc4:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ dc7:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ dca:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ dcd:	89 ec                	mov    %ebp,%esp
+ dcf:	5d                   	pop    %ebp
+ dd0:	c3                   	ret
+ dd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ dd8:	8b 15 e0 16 00 00    	mov    0x16e0,%edx
+ dde:	85 d2                	test   %edx,%edx
+ de0:	74 54                	je     e36 <free+0xa6>
+ de2:	39 ca                	cmp    %ecx,%edx
+ de4:	73 36                	jae    e1c <free+0x8c>
+ de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+ df0:	89 d3                	mov    %edx,%ebx
+ df2:	8b 12                	mov    (%edx),%edx
+ df4:	85 d2                	test   %edx,%edx
+ df6:	74 12                	je     e0a <free+0x7a>
+ df8:	39 ca                	cmp    %ecx,%edx
+ dfa:	72 f4                	jb     df0 <free+0x60>
+  if(p && END(h) == p){
+ dfc:	85 d2                	test   %edx,%edx
+ dfe:	74 0a                	je     e0a <free+0x7a>
+ e00:	8b 70 fc             	mov    -0x4(%eax),%esi
+ e03:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ e06:	39 fa                	cmp    %edi,%edx
+ e08:	74 4b                	je     e55 <free+0xc5>
+  h->s.u.next = p;
+ e0a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ e0d:	8b 53 04             	mov    0x4(%ebx),%edx
+ e10:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ e14:	39 f1                	cmp    %esi,%ecx
+ e16:	74 29                	je     e41 <free+0xb1>
+    prev->s.u.next = h;
+ e18:	89 0b                	mov    %ecx,(%ebx)
+ e1a:	eb a8                	jmp    dc4 <free+0x34>
+  if(p && END(h) == p){
+ e1c:	85 d2                	test   %edx,%edx
+ e1e:	74 16                	je     e36 <free+0xa6>
+ e20:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ e23:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ e26:	39 f2                	cmp    %esi,%edx
+ e28:	75 0c                	jne    e36 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ e2a:	8b 72 04             	mov    0x4(%edx),%esi
+ e2d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ e31:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ e34:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ e36:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ e39:	89 0d e0 16 00 00    	mov    %ecx,0x16e0
+ e3f:	eb 83                	jmp    dc4 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ e41:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ e44:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ e48:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ e4b:	8b 40 f8             	mov    -0x8(%eax),%eax
+ e4e:	89 03                	mov    %eax,(%ebx)
+ e50:	e9 6f ff ff ff       	jmp    dc4 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ e55:	8b 7a 04             	mov    0x4(%edx),%edi
+ e58:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ e5c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ e5f:	8b 12                	mov    (%edx),%edx
+ e61:	eb a7                	jmp    e0a <free+0x7a>
+ e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e70:	55                   	push   %ebp
+ e71:	89 e5                	mov    %esp,%ebp
+ e73:	57                   	push   %edi
+ e74:	56                   	push   %esi
+ e75:	53                   	push   %ebx
+ e76:	83 ec 2c             	sub    $0x2c,%esp
+ e79:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ e7c:	83 f8 10             	cmp    $0x10,%eax
+ e7f:	0f 86 52 01 00 00    	jbe    fd7 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ e85:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ e87:	ba 01 00 00 00       	mov    $0x1,%edx
+ e8c:	eb 0d                	jmp    e9b <malloc+0x2b>
+ e8e:	66 90                	xchg   %ax,%ax
+ e90:	83 c1 05             	add    $0x5,%ecx
+ e93:	89 d6                	mov    %edx,%esi
+ e95:	d3 e6                	shl    %cl,%esi
+ e97:	39 c6                	cmp    %eax,%esi
+ e99:	73 55                	jae    ef0 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ e9b:	89 d9                	mov    %ebx,%ecx
+ e9d:	43                   	inc    %ebx
+ e9e:	83 fb 08             	cmp    $0x8,%ebx
+ ea1:	75 ed                	jne    e90 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ ea3:	8d 58 07             	lea    0x7(%eax),%ebx
+ ea6:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ ea9:	39 c3                	cmp    %eax,%ebx
+ eab:	0f 82 1f 01 00 00    	jb     fd0 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ eb1:	a1 e0 16 00 00       	mov    0x16e0,%eax
+ eb6:	85 c0                	test   %eax,%eax
+ eb8:	0f 84 ee 00 00 00    	je     fac <malloc+0x13c>
+ ebe:	b9 e0 16 00 00       	mov    $0x16e0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ ec3:	8b 50 04             	mov    0x4(%eax),%edx
+ ec6:	39 da                	cmp    %ebx,%edx
+ ec8:	0f 82 d2 00 00 00    	jb     fa0 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ ece:	29 da                	sub    %ebx,%edx
+ ed0:	83 fa 17             	cmp    $0x17,%edx
+ ed3:	0f 87 b7 00 00 00    	ja     f90 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ ed9:	8b 10                	mov    (%eax),%edx
+ edb:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ edd:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ ee3:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ ee6:	83 c0 08             	add    $0x8,%eax
+}
+ ee9:	5b                   	pop    %ebx
+ eea:	5e                   	pop    %esi
+ eeb:	5f                   	pop    %edi
+ eec:	5d                   	pop    %ebp
+ eed:	c3                   	ret
+ eee:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ ef0:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ ef2:	8b 04 9d c0 16 00 00 	mov    0x16c0(,%ebx,4),%eax
+ ef9:	85 c0                	test   %eax,%eax
+ efb:	74 23                	je     f20 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ efd:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ eff:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ f02:	89 14 9d c0 16 00 00 	mov    %edx,0x16c0(,%ebx,4)
+    h->s.u.cls = cls;
+ f09:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ f0c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ f0f:	83 c4 2c             	add    $0x2c,%esp
+ f12:	5b                   	pop    %ebx
+ f13:	5e                   	pop    %esi
+ f14:	5f                   	pop    %edi
+ f15:	5d                   	pop    %ebp
+ f16:	c3                   	ret
+ f17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f1e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ f20:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ f23:	31 d2                	xor    %edx,%edx
+ f25:	b8 00 10 00 00       	mov    $0x1000,%eax
+ f2a:	f7 f6                	div    %esi
+ f2c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ f2f:	0f af c6             	imul   %esi,%eax
+ f32:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ f35:	e8 d6 fd ff ff       	call   d10 <morecore>
+ f3a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f3d:	85 c0                	test   %eax,%eax
+ f3f:	0f 84 8b 00 00 00    	je     fd0 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ f45:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ f48:	8b 0c 9d c0 16 00 00 	mov    0x16c0(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ f4f:	31 d2                	xor    %edx,%edx
+ f51:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ f54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f57:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ f5a:	eb 06                	jmp    f62 <malloc+0xf2>
+ f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ f60:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ f62:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ f64:	42                   	inc    %edx
+ f65:	89 c1                	mov    %eax,%ecx
+ f67:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ f6a:	39 d7                	cmp    %edx,%edi
+ f6c:	75 f2                	jne    f60 <malloc+0xf0>
+ f6e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ f71:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ f74:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ f77:	89 04 9d c0 16 00 00 	mov    %eax,0x16c0(,%ebx,4)
+ f7e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ f81:	29 f0                	sub    %esi,%eax
+ f83:	01 c2                	add    %eax,%edx
+ f85:	89 d0                	mov    %edx,%eax
+ f87:	e9 71 ff ff ff       	jmp    efd <malloc+0x8d>
+ f8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ f90:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ f93:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ f96:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ f98:	89 58 04             	mov    %ebx,0x4(%eax)
+ f9b:	e9 3d ff ff ff       	jmp    edd <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ fa0:	89 c1                	mov    %eax,%ecx
+ fa2:	8b 00                	mov    (%eax),%eax
+ fa4:	85 c0                	test   %eax,%eax
+ fa6:	0f 85 17 ff ff ff    	jne    ec3 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ fac:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ faf:	74 1f                	je     fd0 <malloc+0x160>
+ fb1:	8d 43 08             	lea    0x8(%ebx),%eax
+ fb4:	e8 57 fd ff ff       	call   d10 <morecore>
+ fb9:	85 c0                	test   %eax,%eax
+ fbb:	74 13                	je     fd0 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ fbd:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ fc3:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ fc6:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ fc9:	e9 41 ff ff ff       	jmp    f0f <malloc+0x9f>
+ fce:	66 90                	xchg   %ax,%ax
+      return 0;
+ fd0:	31 c0                	xor    %eax,%eax
+ fd2:	e9 38 ff ff ff       	jmp    f0f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ fd7:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ fdc:	31 db                	xor    %ebx,%ebx
+ fde:	e9 0f ff ff ff       	jmp    ef2 <malloc+0x82>
@@ -0,0 +1,2991 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 e4 f0             	and    $0xfffffff0,%esp
+       6:	83 ec 10             	sub    $0x10,%esp
+  static char buf[100];
+  int fd;
+  int fdpath;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       9:	eb 0e                	jmp    19 <main+0x19>
+       b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+       f:	90                   	nop
+    if(fd >= 3){
+      10:	83 f8 02             	cmp    $0x2,%eax
+      13:	0f 8f 0b 01 00 00    	jg     124 <main+0x124>
+  while((fd = open("console", O_RDWR)) >= 0){
+      19:	c7 04 24 8b 18 00 00 	movl   $0x188b,(%esp)
+      20:	b8 02 00 00 00       	mov    $0x2,%eax
+      25:	89 44 24 04          	mov    %eax,0x4(%esp)
+      29:	e8 55 11 00 00       	call   1183 <open>
+      2e:	85 c0                	test   %eax,%eax
+      30:	79 de                	jns    10 <main+0x10>
+
+  //check if path file exists ' create it if not.'
+  int init_path_size=2;
+  char *  init_path= "/:";
+  
+  if(open("path",O_RDONLY ) < 0 ){
+      32:	c7 04 24 c4 18 00 00 	movl   $0x18c4,(%esp)
+      39:	31 c0                	xor    %eax,%eax
+      3b:	89 44 24 04          	mov    %eax,0x4(%esp)
+      3f:	e8 3f 11 00 00       	call   1183 <open>
+      44:	85 c0                	test   %eax,%eax
+      46:	79 2a                	jns    72 <main+0x72>
+      48:	e9 06 01 00 00       	jmp    153 <main+0x153>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      50:	e8 e6 10 00 00       	call   113b <fork>
+  if(pid == -1)
+      55:	83 f8 ff             	cmp    $0xffffffff,%eax
+      58:	0f 84 46 01 00 00    	je     1a4 <main+0x1a4>
+    if(fork1() == 0)
+      5e:	85 c0                	test   %eax,%eax
+      60:	0f 84 d9 00 00 00    	je     13f <main+0x13f>
+    wait(0);
+      66:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      6d:	e8 d9 10 00 00       	call   114b <wait>
+  printf(2, "$ ");
+      72:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+      79:	ba e4 17 00 00       	mov    $0x17e4,%edx
+      7e:	89 54 24 04          	mov    %edx,0x4(%esp)
+      82:	e8 89 12 00 00       	call   1310 <printf>
+  memset(buf, 0, nbuf);
+      87:	b9 64 00 00 00       	mov    $0x64,%ecx
+      8c:	31 c0                	xor    %eax,%eax
+      8e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+      92:	89 44 24 04          	mov    %eax,0x4(%esp)
+      96:	c7 04 24 60 1f 00 00 	movl   $0x1f60,(%esp)
+      9d:	e8 0e 0f 00 00       	call   fb0 <memset>
+  gets(buf, nbuf);
+      a2:	b8 64 00 00 00       	mov    $0x64,%eax
+      a7:	89 44 24 04          	mov    %eax,0x4(%esp)
+      ab:	c7 04 24 60 1f 00 00 	movl   $0x1f60,(%esp)
+      b2:	e8 59 0f 00 00       	call   1010 <gets>
+  if(buf[0] == 0) // EOF
+      b7:	0f b6 05 60 1f 00 00 	movzbl 0x1f60,%eax
+      be:	84 c0                	test   %al,%al
+      c0:	74 73                	je     135 <main+0x135>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      c2:	3c 63                	cmp    $0x63,%al
+      c4:	75 8a                	jne    50 <main+0x50>
+      c6:	80 3d 61 1f 00 00 64 	cmpb   $0x64,0x1f61
+      cd:	75 81                	jne    50 <main+0x50>
+      cf:	80 3d 62 1f 00 00 20 	cmpb   $0x20,0x1f62
+      d6:	0f 85 74 ff ff ff    	jne    50 <main+0x50>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      dc:	c7 04 24 60 1f 00 00 	movl   $0x1f60,(%esp)
+      e3:	e8 98 0e 00 00       	call   f80 <strlen>
+      if(chdir(buf+3) < 0)
+      e8:	c7 04 24 63 1f 00 00 	movl   $0x1f63,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ef:	c6 80 5f 1f 00 00 00 	movb   $0x0,0x1f5f(%eax)
+      if(chdir(buf+3) < 0)
+      f6:	e8 b8 10 00 00       	call   11b3 <chdir>
+      fb:	85 c0                	test   %eax,%eax
+      fd:	0f 89 6f ff ff ff    	jns    72 <main+0x72>
+        printf(2, "cannot cd %s\n", buf+3);
+     103:	c7 44 24 08 63 1f 00 	movl   $0x1f63,0x8(%esp)
+     10a:	00 
+     10b:	c7 44 24 04 c9 18 00 	movl   $0x18c9,0x4(%esp)
+     112:	00 
+     113:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     11a:	e8 f1 11 00 00       	call   1310 <printf>
+     11f:	e9 4e ff ff ff       	jmp    72 <main+0x72>
+      close(fd);
+     124:	89 04 24             	mov    %eax,(%esp)
+     127:	e8 3f 10 00 00       	call   116b <close>
+      break;
+     12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     130:	e9 fd fe ff ff       	jmp    32 <main+0x32>
+  exit(0);
+     135:	31 c0                	xor    %eax,%eax
+     137:	89 04 24             	mov    %eax,(%esp)
+     13a:	e8 04 10 00 00       	call   1143 <exit>
+      runcmd(parsecmd(buf));
+     13f:	c7 04 24 60 1f 00 00 	movl   $0x1f60,(%esp)
+     146:	e8 35 0d 00 00       	call   e80 <parsecmd>
+     14b:	89 04 24             	mov    %eax,(%esp)
+     14e:	e8 0d 01 00 00       	call   260 <runcmd>
+    if((fdpath = open("path", O_CREATE| O_RDWR ))>=0 ){
+     153:	c7 44 24 04 02 02 00 	movl   $0x202,0x4(%esp)
+     15a:	00 
+     15b:	c7 04 24 c4 18 00 00 	movl   $0x18c4,(%esp)
+     162:	e8 1c 10 00 00       	call   1183 <open>
+     167:	85 c0                	test   %eax,%eax
+     169:	78 2d                	js     198 <main+0x198>
+      if(write(fdpath,init_path,init_path_size)!=init_path_size){
+     16b:	c7 44 24 08 02 00 00 	movl   $0x2,0x8(%esp)
+     172:	00 
+     173:	c7 44 24 04 93 18 00 	movl   $0x1893,0x4(%esp)
+     17a:	00 
+     17b:	89 04 24             	mov    %eax,(%esp)
+     17e:	e8 e0 0f 00 00       	call   1163 <write>
+     183:	83 f8 02             	cmp    $0x2,%eax
+     186:	0f 84 e6 fe ff ff    	je     72 <main+0x72>
+        panic("could not write to file");
+     18c:	c7 04 24 96 18 00 00 	movl   $0x1896,(%esp)
+     193:	e8 78 00 00 00       	call   210 <panic>
+      panic("could not create file path");
+     198:	c7 04 24 ae 18 00 00 	movl   $0x18ae,(%esp)
+     19f:	e8 6c 00 00 00       	call   210 <panic>
+    panic("fork");
+     1a4:	c7 04 24 e7 17 00 00 	movl   $0x17e7,(%esp)
+     1ab:	e8 60 00 00 00       	call   210 <panic>
+
+000001b0 <getcmd>:
+{
+     1b0:	55                   	push   %ebp
+  printf(2, "$ ");
+     1b1:	b8 e4 17 00 00       	mov    $0x17e4,%eax
+{
+     1b6:	89 e5                	mov    %esp,%ebp
+     1b8:	83 ec 18             	sub    $0x18,%esp
+     1bb:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+     1be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1c1:	89 75 fc             	mov    %esi,-0x4(%ebp)
+     1c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     1c7:	89 44 24 04          	mov    %eax,0x4(%esp)
+     1cb:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     1d2:	e8 39 11 00 00       	call   1310 <printf>
+  memset(buf, 0, nbuf);
+     1d7:	31 d2                	xor    %edx,%edx
+     1d9:	89 74 24 08          	mov    %esi,0x8(%esp)
+     1dd:	89 54 24 04          	mov    %edx,0x4(%esp)
+     1e1:	89 1c 24             	mov    %ebx,(%esp)
+     1e4:	e8 c7 0d 00 00       	call   fb0 <memset>
+  gets(buf, nbuf);
+     1e9:	89 74 24 04          	mov    %esi,0x4(%esp)
+     1ed:	89 1c 24             	mov    %ebx,(%esp)
+     1f0:	e8 1b 0e 00 00       	call   1010 <gets>
+}
+     1f5:	8b 75 fc             	mov    -0x4(%ebp),%esi
+  if(buf[0] == 0) // EOF
+     1f8:	80 3b 01             	cmpb   $0x1,(%ebx)
+}
+     1fb:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+  if(buf[0] == 0) // EOF
+     1fe:	19 c0                	sbb    %eax,%eax
+}
+     200:	89 ec                	mov    %ebp,%esp
+     202:	5d                   	pop    %ebp
+     203:	c3                   	ret
+     204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     20f:	90                   	nop
+
+00000210 <panic>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 18             	sub    $0x18,%esp
+  printf(2, "%s\n", s);
+     216:	8b 45 08             	mov    0x8(%ebp),%eax
+     219:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     220:	89 44 24 08          	mov    %eax,0x8(%esp)
+     224:	b8 87 18 00 00       	mov    $0x1887,%eax
+     229:	89 44 24 04          	mov    %eax,0x4(%esp)
+     22d:	e8 de 10 00 00       	call   1310 <printf>
+  exit(0);
+     232:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     239:	e8 05 0f 00 00       	call   1143 <exit>
+     23e:	66 90                	xchg   %ax,%ax
+
+00000240 <fork1>:
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	83 ec 18             	sub    $0x18,%esp
+  pid = fork();
+     246:	e8 f0 0e 00 00       	call   113b <fork>
+  if(pid == -1)
+     24b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     24e:	74 04                	je     254 <fork1+0x14>
+  return pid;
+}
+     250:	89 ec                	mov    %ebp,%esp
+     252:	5d                   	pop    %ebp
+     253:	c3                   	ret
+    panic("fork");
+     254:	c7 04 24 e7 17 00 00 	movl   $0x17e7,(%esp)
+     25b:	e8 b0 ff ff ff       	call   210 <panic>
+
+00000260 <runcmd>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	56                   	push   %esi
+     265:	53                   	push   %ebx
+     266:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+     26c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     26f:	85 db                	test   %ebx,%ebx
+     271:	74 3d                	je     2b0 <runcmd+0x50>
+  switch(cmd->type){
+     273:	83 3b 05             	cmpl   $0x5,(%ebx)
+     276:	0f 87 80 01 00 00    	ja     3fc <runcmd+0x19c>
+     27c:	8b 03                	mov    (%ebx),%eax
+     27e:	ff 24 85 d8 18 00 00 	jmp    *0x18d8(,%eax,4)
+        printf(2, "exec %s failed\n", ecmd->argv[0]);
+     285:	8b 43 04             	mov    0x4(%ebx),%eax
+     288:	c7 44 24 04 f9 17 00 	movl   $0x17f9,0x4(%esp)
+     28f:	00 
+     290:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     297:	89 44 24 08          	mov    %eax,0x8(%esp)
+     29b:	e8 70 10 00 00       	call   1310 <printf>
+  close(fd);
+     2a0:	89 34 24             	mov    %esi,(%esp)
+     2a3:	e8 c3 0e 00 00       	call   116b <close>
+    break;
+     2a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2af:	90                   	nop
+      exit(0);
+     2b0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     2b7:	e8 87 0e 00 00       	call   1143 <exit>
+    if(fork1() == 0)
+     2bc:	e8 7f ff ff ff       	call   240 <fork1>
+     2c1:	85 c0                	test   %eax,%eax
+     2c3:	75 eb                	jne    2b0 <runcmd+0x50>
+     2c5:	e9 27 01 00 00       	jmp    3f1 <runcmd+0x191>
+    if(ecmd->argv[0] == 0)
+     2ca:	8b 43 04             	mov    0x4(%ebx),%eax
+     2cd:	85 c0                	test   %eax,%eax
+     2cf:	90                   	nop
+     2d0:	74 de                	je     2b0 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     2d2:	8d 53 04             	lea    0x4(%ebx),%edx
+  int stringLocation = 0;
+     2d5:	31 ff                	xor    %edi,%edi
+    exec(ecmd->argv[0], ecmd->argv);
+     2d7:	89 95 d0 fd ff ff    	mov    %edx,-0x230(%ebp)
+     2dd:	89 54 24 04          	mov    %edx,0x4(%esp)
+     2e1:	89 04 24             	mov    %eax,(%esp)
+     2e4:	e8 92 0e 00 00       	call   117b <exec>
+    fd = open("/path",O_RDONLY);
+     2e9:	31 c0                	xor    %eax,%eax
+     2eb:	89 44 24 04          	mov    %eax,0x4(%esp)
+     2ef:	c7 04 24 f3 17 00 00 	movl   $0x17f3,(%esp)
+     2f6:	e8 88 0e 00 00       	call   1183 <open>
+     2fb:	89 c6                	mov    %eax,%esi
+    myCmd = ecmd->argv[0];
+     2fd:	8b 43 04             	mov    0x4(%ebx),%eax
+    if (myCmd[0] != '/'){
+     300:	80 38 2f             	cmpb   $0x2f,(%eax)
+    myCmd = ecmd->argv[0];
+     303:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    if (myCmd[0] != '/'){
+     309:	0f 84 ea 01 00 00    	je     4f9 <runcmd+0x299>
+     30f:	90                   	nop
+      while (read(fd,c,1) != 0){
+     310:	89 34 24             	mov    %esi,(%esp)
+     313:	b8 01 00 00 00       	mov    $0x1,%eax
+     318:	89 44 24 08          	mov    %eax,0x8(%esp)
+     31c:	8d 85 df fd ff ff    	lea    -0x221(%ebp),%eax
+     322:	89 44 24 04          	mov    %eax,0x4(%esp)
+     326:	e8 30 0e 00 00       	call   115b <read>
+     32b:	85 c0                	test   %eax,%eax
+     32d:	0f 84 52 ff ff ff    	je     285 <runcmd+0x25>
+        if (c[0]!=':'){
+     333:	0f b6 85 df fd ff ff 	movzbl -0x221(%ebp),%eax
+     33a:	3c 3a                	cmp    $0x3a,%al
+     33c:	0f 84 c6 00 00 00    	je     408 <runcmd+0x1a8>
+          s[stringLocation] = c[0];
+     342:	88 84 3d e8 fd ff ff 	mov    %al,-0x218(%ebp,%edi,1)
+          stringLocation++;
+     349:	47                   	inc    %edi
+     34a:	eb c4                	jmp    310 <runcmd+0xb0>
+    if(pipe(p) < 0)
+     34c:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+     352:	89 04 24             	mov    %eax,(%esp)
+     355:	e8 f9 0d 00 00       	call   1153 <pipe>
+     35a:	85 c0                	test   %eax,%eax
+     35c:	0f 88 0b 01 00 00    	js     46d <runcmd+0x20d>
+    if(fork1() == 0){
+     362:	e8 d9 fe ff ff       	call   240 <fork1>
+     367:	85 c0                	test   %eax,%eax
+     369:	0f 84 0a 01 00 00    	je     479 <runcmd+0x219>
+    if(fork1() == 0){
+     36f:	90                   	nop
+     370:	e8 cb fe ff ff       	call   240 <fork1>
+     375:	85 c0                	test   %eax,%eax
+     377:	0f 84 3d 01 00 00    	je     4ba <runcmd+0x25a>
+    close(p[0]);
+     37d:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+     383:	89 04 24             	mov    %eax,(%esp)
+     386:	e8 e0 0d 00 00       	call   116b <close>
+    close(p[1]);
+     38b:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+     391:	89 04 24             	mov    %eax,(%esp)
+     394:	e8 d2 0d 00 00       	call   116b <close>
+    wait(0);
+     399:	31 c0                	xor    %eax,%eax
+     39b:	89 04 24             	mov    %eax,(%esp)
+     39e:	e8 a8 0d 00 00       	call   114b <wait>
+    wait(0);
+     3a3:	31 d2                	xor    %edx,%edx
+     3a5:	89 14 24             	mov    %edx,(%esp)
+     3a8:	e8 9e 0d 00 00       	call   114b <wait>
+    break;
+     3ad:	e9 fe fe ff ff       	jmp    2b0 <runcmd+0x50>
+    if(fork1() == 0)
+     3b2:	e8 89 fe ff ff       	call   240 <fork1>
+     3b7:	85 c0                	test   %eax,%eax
+     3b9:	74 36                	je     3f1 <runcmd+0x191>
+    wait(0);
+     3bb:	31 f6                	xor    %esi,%esi
+     3bd:	89 34 24             	mov    %esi,(%esp)
+     3c0:	e8 86 0d 00 00       	call   114b <wait>
+    runcmd(lcmd->right);
+     3c5:	8b 43 08             	mov    0x8(%ebx),%eax
+     3c8:	89 04 24             	mov    %eax,(%esp)
+     3cb:	e8 90 fe ff ff       	call   260 <runcmd>
+    close(rcmd->fd);
+     3d0:	8b 43 14             	mov    0x14(%ebx),%eax
+     3d3:	89 04 24             	mov    %eax,(%esp)
+     3d6:	e8 90 0d 00 00       	call   116b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     3db:	8b 43 10             	mov    0x10(%ebx),%eax
+     3de:	89 44 24 04          	mov    %eax,0x4(%esp)
+     3e2:	8b 43 08             	mov    0x8(%ebx),%eax
+     3e5:	89 04 24             	mov    %eax,(%esp)
+     3e8:	e8 96 0d 00 00       	call   1183 <open>
+     3ed:	85 c0                	test   %eax,%eax
+     3ef:	78 5c                	js     44d <runcmd+0x1ed>
+      runcmd(bcmd->cmd);
+     3f1:	8b 43 04             	mov    0x4(%ebx),%eax
+     3f4:	89 04 24             	mov    %eax,(%esp)
+     3f7:	e8 64 fe ff ff       	call   260 <runcmd>
+    panic("runcmd");
+     3fc:	c7 04 24 ec 17 00 00 	movl   $0x17ec,(%esp)
+     403:	e8 08 fe ff ff       	call   210 <panic>
+          while(myCmd[cmdName] != 0){
+     408:	8b 8d d4 fd ff ff    	mov    -0x22c(%ebp),%ecx
+     40e:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+     414:	0f b6 01             	movzbl (%ecx),%eax
+     417:	29 f9                	sub    %edi,%ecx
+     419:	84 c0                	test   %al,%al
+     41b:	74 0f                	je     42c <runcmd+0x1cc>
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+            s[stringLocation] = myCmd[cmdName];
+     420:	88 04 3a             	mov    %al,(%edx,%edi,1)
+            stringLocation++;
+     423:	47                   	inc    %edi
+          while(myCmd[cmdName] != 0){
+     424:	0f b6 04 39          	movzbl (%ecx,%edi,1),%eax
+     428:	84 c0                	test   %al,%al
+     42a:	75 f4                	jne    420 <runcmd+0x1c0>
+          s[stringLocation] = 0;
+     42c:	c6 84 3d e8 fd ff ff 	movb   $0x0,-0x218(%ebp,%edi,1)
+     433:	00 
+          exec(s, ecmd->argv);
+     434:	8b 85 d0 fd ff ff    	mov    -0x230(%ebp),%eax
+          stringLocation = 0;
+     43a:	31 ff                	xor    %edi,%edi
+          exec(s, ecmd->argv);
+     43c:	89 14 24             	mov    %edx,(%esp)
+     43f:	89 44 24 04          	mov    %eax,0x4(%esp)
+     443:	e8 33 0d 00 00       	call   117b <exec>
+     448:	e9 c3 fe ff ff       	jmp    310 <runcmd+0xb0>
+      printf(2, "open %s failed\n", rcmd->file);
+     44d:	8b 43 08             	mov    0x8(%ebx),%eax
+     450:	c7 44 24 04 09 18 00 	movl   $0x1809,0x4(%esp)
+     457:	00 
+     458:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     45f:	89 44 24 08          	mov    %eax,0x8(%esp)
+     463:	e8 a8 0e 00 00       	call   1310 <printf>
+     468:	e9 43 fe ff ff       	jmp    2b0 <runcmd+0x50>
+      panic("pipe");
+     46d:	c7 04 24 19 18 00 00 	movl   $0x1819,(%esp)
+     474:	e8 97 fd ff ff       	call   210 <panic>
+      close(1);
+     479:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     480:	e8 e6 0c 00 00       	call   116b <close>
+      dup(p[1]);
+     485:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+     48b:	89 04 24             	mov    %eax,(%esp)
+     48e:	e8 28 0d 00 00       	call   11bb <dup>
+      close(p[0]);
+     493:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+     499:	89 04 24             	mov    %eax,(%esp)
+     49c:	e8 ca 0c 00 00       	call   116b <close>
+      close(p[1]);
+     4a1:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+     4a7:	89 04 24             	mov    %eax,(%esp)
+     4aa:	e8 bc 0c 00 00       	call   116b <close>
+      runcmd(pcmd->left);
+     4af:	8b 43 04             	mov    0x4(%ebx),%eax
+     4b2:	89 04 24             	mov    %eax,(%esp)
+     4b5:	e8 a6 fd ff ff       	call   260 <runcmd>
+      close(0);
+     4ba:	31 c9                	xor    %ecx,%ecx
+     4bc:	89 0c 24             	mov    %ecx,(%esp)
+     4bf:	e8 a7 0c 00 00       	call   116b <close>
+      dup(p[0]);
+     4c4:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+     4ca:	89 04 24             	mov    %eax,(%esp)
+     4cd:	e8 e9 0c 00 00       	call   11bb <dup>
+      close(p[0]);
+     4d2:	8b 85 e0 fd ff ff    	mov    -0x220(%ebp),%eax
+     4d8:	89 04 24             	mov    %eax,(%esp)
+     4db:	e8 8b 0c 00 00       	call   116b <close>
+      close(p[1]);
+     4e0:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+     4e6:	89 04 24             	mov    %eax,(%esp)
+     4e9:	e8 7d 0c 00 00       	call   116b <close>
+      runcmd(pcmd->right);
+     4ee:	8b 43 08             	mov    0x8(%ebx),%eax
+     4f1:	89 04 24             	mov    %eax,(%esp)
+     4f4:	e8 67 fd ff ff       	call   260 <runcmd>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     4f9:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+     4ff:	c7 44 24 04 f9 17 00 	movl   $0x17f9,0x4(%esp)
+     506:	00 
+     507:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     50e:	89 44 24 08          	mov    %eax,0x8(%esp)
+     512:	e8 f9 0d 00 00       	call   1310 <printf>
+     517:	e9 84 fd ff ff       	jmp    2a0 <runcmd+0x40>
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	83 ec 18             	sub    $0x18,%esp
+     526:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     529:	c7 04 24 54 00 00 00 	movl   $0x54,(%esp)
+     530:	e8 3b 11 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     535:	31 d2                	xor    %edx,%edx
+     537:	89 54 24 04          	mov    %edx,0x4(%esp)
+  cmd = malloc(sizeof(*cmd));
+     53b:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     53d:	b8 54 00 00 00       	mov    $0x54,%eax
+     542:	89 1c 24             	mov    %ebx,(%esp)
+     545:	89 44 24 08          	mov    %eax,0x8(%esp)
+     549:	e8 62 0a 00 00       	call   fb0 <memset>
+  cmd->type = EXEC;
+  return (struct cmd*)cmd;
+}
+     54e:	89 d8                	mov    %ebx,%eax
+  cmd->type = EXEC;
+     550:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+}
+     556:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     559:	89 ec                	mov    %ebp,%esp
+     55b:	5d                   	pop    %ebp
+     55c:	c3                   	ret
+     55d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000560 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	83 ec 18             	sub    $0x18,%esp
+     566:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     569:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+     570:	e8 fb 10 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     575:	31 d2                	xor    %edx,%edx
+     577:	89 54 24 04          	mov    %edx,0x4(%esp)
+  cmd = malloc(sizeof(*cmd));
+     57b:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     57d:	b8 18 00 00 00       	mov    $0x18,%eax
+     582:	89 1c 24             	mov    %ebx,(%esp)
+     585:	89 44 24 08          	mov    %eax,0x8(%esp)
+     589:	e8 22 0a 00 00       	call   fb0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     58e:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     591:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     597:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     59d:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     5a0:	8b 45 10             	mov    0x10(%ebp),%eax
+     5a3:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     5a6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5a9:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     5ac:	8b 45 18             	mov    0x18(%ebp),%eax
+     5af:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     5b2:	89 d8                	mov    %ebx,%eax
+     5b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b7:	89 ec                	mov    %ebp,%esp
+     5b9:	5d                   	pop    %ebp
+     5ba:	c3                   	ret
+     5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5bf:	90                   	nop
+
+000005c0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	83 ec 18             	sub    $0x18,%esp
+     5c6:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     5c9:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+     5d0:	e8 9b 10 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5d5:	31 d2                	xor    %edx,%edx
+     5d7:	89 54 24 04          	mov    %edx,0x4(%esp)
+  cmd = malloc(sizeof(*cmd));
+     5db:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5dd:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5e2:	89 1c 24             	mov    %ebx,(%esp)
+     5e5:	89 44 24 08          	mov    %eax,0x8(%esp)
+     5e9:	e8 c2 09 00 00       	call   fb0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     5ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     5f1:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     5f7:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     5fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5fd:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     600:	89 d8                	mov    %ebx,%eax
+     602:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     605:	89 ec                	mov    %ebp,%esp
+     607:	5d                   	pop    %ebp
+     608:	c3                   	ret
+     609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	83 ec 18             	sub    $0x18,%esp
+     616:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     619:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+     620:	e8 4b 10 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     625:	31 d2                	xor    %edx,%edx
+     627:	89 54 24 04          	mov    %edx,0x4(%esp)
+  cmd = malloc(sizeof(*cmd));
+     62b:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     62d:	b8 0c 00 00 00       	mov    $0xc,%eax
+     632:	89 1c 24             	mov    %ebx,(%esp)
+     635:	89 44 24 08          	mov    %eax,0x8(%esp)
+     639:	e8 72 09 00 00       	call   fb0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     63e:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     641:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     647:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     64a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     64d:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     650:	89 d8                	mov    %ebx,%eax
+     652:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     655:	89 ec                	mov    %ebp,%esp
+     657:	5d                   	pop    %ebp
+     658:	c3                   	ret
+     659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	83 ec 18             	sub    $0x18,%esp
+     666:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     669:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     670:	e8 fb 0f 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     675:	31 d2                	xor    %edx,%edx
+     677:	89 54 24 04          	mov    %edx,0x4(%esp)
+  cmd = malloc(sizeof(*cmd));
+     67b:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     67d:	b8 08 00 00 00       	mov    $0x8,%eax
+     682:	89 1c 24             	mov    %ebx,(%esp)
+     685:	89 44 24 08          	mov    %eax,0x8(%esp)
+     689:	e8 22 09 00 00       	call   fb0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     68e:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     691:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     697:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     69a:	89 d8                	mov    %ebx,%eax
+     69c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     69f:	89 ec                	mov    %ebp,%esp
+     6a1:	5d                   	pop    %ebp
+     6a2:	c3                   	ret
+     6a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006b0 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	57                   	push   %edi
+     6b4:	56                   	push   %esi
+     6b5:	53                   	push   %ebx
+     6b6:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     6bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6bf:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     6c2:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     6c4:	39 df                	cmp    %ebx,%edi
+     6c6:	72 0d                	jb     6d5 <gettoken+0x25>
+     6c8:	eb 22                	jmp    6ec <gettoken+0x3c>
+     6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     6d0:	47                   	inc    %edi
+  while(s < es && strchr(whitespace, *s))
+     6d1:	39 fb                	cmp    %edi,%ebx
+     6d3:	74 17                	je     6ec <gettoken+0x3c>
+     6d5:	0f be 07             	movsbl (%edi),%eax
+     6d8:	c7 04 24 3c 1f 00 00 	movl   $0x1f3c,(%esp)
+     6df:	89 44 24 04          	mov    %eax,0x4(%esp)
+     6e3:	e8 e8 08 00 00       	call   fd0 <strchr>
+     6e8:	85 c0                	test   %eax,%eax
+     6ea:	75 e4                	jne    6d0 <gettoken+0x20>
+  if(q)
+     6ec:	85 f6                	test   %esi,%esi
+     6ee:	74 02                	je     6f2 <gettoken+0x42>
+    *q = s;
+     6f0:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     6f2:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     6f5:	3c 3c                	cmp    $0x3c,%al
+     6f7:	0f 8f d3 00 00 00    	jg     7d0 <gettoken+0x120>
+     6fd:	3c 3a                	cmp    $0x3a,%al
+     6ff:	0f 8f b9 00 00 00    	jg     7be <gettoken+0x10e>
+     705:	84 c0                	test   %al,%al
+     707:	75 47                	jne    750 <gettoken+0xa0>
+     709:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     70b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     70e:	85 c9                	test   %ecx,%ecx
+     710:	74 05                	je     717 <gettoken+0x67>
+    *eq = s;
+     712:	8b 45 14             	mov    0x14(%ebp),%eax
+     715:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     717:	39 df                	cmp    %ebx,%edi
+     719:	72 0a                	jb     725 <gettoken+0x75>
+     71b:	eb 1f                	jmp    73c <gettoken+0x8c>
+     71d:	8d 76 00             	lea    0x0(%esi),%esi
+    s++;
+     720:	47                   	inc    %edi
+  while(s < es && strchr(whitespace, *s))
+     721:	39 fb                	cmp    %edi,%ebx
+     723:	74 17                	je     73c <gettoken+0x8c>
+     725:	0f be 07             	movsbl (%edi),%eax
+     728:	c7 04 24 3c 1f 00 00 	movl   $0x1f3c,(%esp)
+     72f:	89 44 24 04          	mov    %eax,0x4(%esp)
+     733:	e8 98 08 00 00       	call   fd0 <strchr>
+     738:	85 c0                	test   %eax,%eax
+     73a:	75 e4                	jne    720 <gettoken+0x70>
+  *ps = s;
+     73c:	8b 45 08             	mov    0x8(%ebp),%eax
+     73f:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     741:	83 c4 1c             	add    $0x1c,%esp
+     744:	89 f0                	mov    %esi,%eax
+     746:	5b                   	pop    %ebx
+     747:	5e                   	pop    %esi
+     748:	5f                   	pop    %edi
+     749:	5d                   	pop    %ebp
+     74a:	c3                   	ret
+     74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+  switch(*s){
+     750:	79 5e                	jns    7b0 <gettoken+0x100>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     752:	39 df                	cmp    %ebx,%edi
+     754:	72 36                	jb     78c <gettoken+0xdc>
+  if(eq)
+     756:	8b 55 14             	mov    0x14(%ebp),%edx
+     759:	85 d2                	test   %edx,%edx
+     75b:	0f 84 ab 00 00 00    	je     80c <gettoken+0x15c>
+    *eq = s;
+     761:	8b 45 14             	mov    0x14(%ebp),%eax
+     764:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     766:	e9 a1 00 00 00       	jmp    80c <gettoken+0x15c>
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     770:	0f be 07             	movsbl (%edi),%eax
+     773:	c7 04 24 34 1f 00 00 	movl   $0x1f34,(%esp)
+     77a:	89 44 24 04          	mov    %eax,0x4(%esp)
+     77e:	e8 4d 08 00 00       	call   fd0 <strchr>
+     783:	85 c0                	test   %eax,%eax
+     785:	75 1c                	jne    7a3 <gettoken+0xf3>
+      s++;
+     787:	47                   	inc    %edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     788:	39 fb                	cmp    %edi,%ebx
+     78a:	74 72                	je     7fe <gettoken+0x14e>
+     78c:	0f be 07             	movsbl (%edi),%eax
+     78f:	c7 04 24 3c 1f 00 00 	movl   $0x1f3c,(%esp)
+     796:	89 44 24 04          	mov    %eax,0x4(%esp)
+     79a:	e8 31 08 00 00       	call   fd0 <strchr>
+     79f:	85 c0                	test   %eax,%eax
+     7a1:	74 cd                	je     770 <gettoken+0xc0>
+    ret = 'a';
+     7a3:	be 61 00 00 00       	mov    $0x61,%esi
+     7a8:	e9 5e ff ff ff       	jmp    70b <gettoken+0x5b>
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+  switch(*s){
+     7b0:	3c 26                	cmp    $0x26,%al
+     7b2:	74 0a                	je     7be <gettoken+0x10e>
+     7b4:	88 c1                	mov    %al,%cl
+     7b6:	80 e9 28             	sub    $0x28,%cl
+     7b9:	80 f9 01             	cmp    $0x1,%cl
+     7bc:	77 94                	ja     752 <gettoken+0xa2>
+  ret = *s;
+     7be:	0f be f0             	movsbl %al,%esi
+    s++;
+     7c1:	47                   	inc    %edi
+    break;
+     7c2:	e9 44 ff ff ff       	jmp    70b <gettoken+0x5b>
+     7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ce:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     7d0:	3c 3e                	cmp    $0x3e,%al
+     7d2:	75 14                	jne    7e8 <gettoken+0x138>
+    if(*s == '>'){
+     7d4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     7d8:	74 17                	je     7f1 <gettoken+0x141>
+    s++;
+     7da:	47                   	inc    %edi
+  ret = *s;
+     7db:	be 3e 00 00 00       	mov    $0x3e,%esi
+     7e0:	e9 26 ff ff ff       	jmp    70b <gettoken+0x5b>
+     7e5:	8d 76 00             	lea    0x0(%esi),%esi
+  switch(*s){
+     7e8:	3c 7c                	cmp    $0x7c,%al
+     7ea:	74 d2                	je     7be <gettoken+0x10e>
+     7ec:	e9 61 ff ff ff       	jmp    752 <gettoken+0xa2>
+      s++;
+     7f1:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     7f4:	be 2b 00 00 00       	mov    $0x2b,%esi
+     7f9:	e9 0d ff ff ff       	jmp    70b <gettoken+0x5b>
+  if(eq)
+     7fe:	8b 45 14             	mov    0x14(%ebp),%eax
+     801:	85 c0                	test   %eax,%eax
+     803:	74 05                	je     80a <gettoken+0x15a>
+    *eq = s;
+     805:	8b 45 14             	mov    0x14(%ebp),%eax
+     808:	89 18                	mov    %ebx,(%eax)
+      s++;
+     80a:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     80c:	be 61 00 00 00       	mov    $0x61,%esi
+     811:	e9 26 ff ff ff       	jmp    73c <gettoken+0x8c>
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	83 ec 1c             	sub    $0x1c,%esp
+     829:	8b 7d 08             	mov    0x8(%ebp),%edi
+     82c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     82f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     831:	39 f3                	cmp    %esi,%ebx
+     833:	72 10                	jb     845 <peek+0x25>
+     835:	eb 25                	jmp    85c <peek+0x3c>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+    s++;
+     840:	43                   	inc    %ebx
+  while(s < es && strchr(whitespace, *s))
+     841:	39 de                	cmp    %ebx,%esi
+     843:	74 17                	je     85c <peek+0x3c>
+     845:	0f be 03             	movsbl (%ebx),%eax
+     848:	c7 04 24 3c 1f 00 00 	movl   $0x1f3c,(%esp)
+     84f:	89 44 24 04          	mov    %eax,0x4(%esp)
+     853:	e8 78 07 00 00       	call   fd0 <strchr>
+     858:	85 c0                	test   %eax,%eax
+     85a:	75 e4                	jne    840 <peek+0x20>
+  *ps = s;
+     85c:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     85e:	31 c0                	xor    %eax,%eax
+     860:	0f be 13             	movsbl (%ebx),%edx
+     863:	84 d2                	test   %dl,%dl
+     865:	75 09                	jne    870 <peek+0x50>
+}
+     867:	83 c4 1c             	add    $0x1c,%esp
+     86a:	5b                   	pop    %ebx
+     86b:	5e                   	pop    %esi
+     86c:	5f                   	pop    %edi
+     86d:	5d                   	pop    %ebp
+     86e:	c3                   	ret
+     86f:	90                   	nop
+  return *s && strchr(toks, *s);
+     870:	89 54 24 04          	mov    %edx,0x4(%esp)
+     874:	8b 45 10             	mov    0x10(%ebp),%eax
+     877:	89 04 24             	mov    %eax,(%esp)
+     87a:	e8 51 07 00 00       	call   fd0 <strchr>
+     87f:	85 c0                	test   %eax,%eax
+     881:	0f 95 c0             	setne  %al
+}
+     884:	83 c4 1c             	add    $0x1c,%esp
+     887:	5b                   	pop    %ebx
+  return *s && strchr(toks, *s);
+     888:	0f b6 c0             	movzbl %al,%eax
+}
+     88b:	5e                   	pop    %esi
+     88c:	5f                   	pop    %edi
+     88d:	5d                   	pop    %ebp
+     88e:	c3                   	ret
+     88f:	90                   	nop
+
+00000890 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	57                   	push   %edi
+     894:	56                   	push   %esi
+     895:	53                   	push   %ebx
+     896:	83 ec 3c             	sub    $0x3c,%esp
+     899:	8b 75 0c             	mov    0xc(%ebp),%esi
+     89c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     89f:	90                   	nop
+     8a0:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     8a4:	b8 3b 18 00 00       	mov    $0x183b,%eax
+     8a9:	89 44 24 08          	mov    %eax,0x8(%esp)
+     8ad:	89 34 24             	mov    %esi,(%esp)
+     8b0:	e8 6b ff ff ff       	call   820 <peek>
+     8b5:	85 c0                	test   %eax,%eax
+     8b7:	0f 84 13 01 00 00    	je     9d0 <parseredirs+0x140>
+    tok = gettoken(ps, es, 0, 0);
+     8bd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     8c1:	31 c0                	xor    %eax,%eax
+     8c3:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     8c7:	31 c0                	xor    %eax,%eax
+     8c9:	89 44 24 08          	mov    %eax,0x8(%esp)
+     8cd:	89 34 24             	mov    %esi,(%esp)
+     8d0:	e8 db fd ff ff       	call   6b0 <gettoken>
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     8d5:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     8d9:	89 34 24             	mov    %esi,(%esp)
+    tok = gettoken(ps, es, 0, 0);
+     8dc:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     8de:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     8e1:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     8e5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     8e8:	89 44 24 08          	mov    %eax,0x8(%esp)
+     8ec:	e8 bf fd ff ff       	call   6b0 <gettoken>
+     8f1:	83 f8 61             	cmp    $0x61,%eax
+     8f4:	0f 85 e1 00 00 00    	jne    9db <parseredirs+0x14b>
+      panic("missing file for redirection");
+    switch(tok){
+     8fa:	83 ff 3c             	cmp    $0x3c,%edi
+     8fd:	74 71                	je     970 <parseredirs+0xe0>
+     8ff:	83 ff 3e             	cmp    $0x3e,%edi
+     902:	74 05                	je     909 <parseredirs+0x79>
+     904:	83 ff 2b             	cmp    $0x2b,%edi
+     907:	75 97                	jne    8a0 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     909:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     90c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     90f:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     912:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     915:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+     91c:	e8 4f 0d 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     921:	ba 18 00 00 00       	mov    $0x18,%edx
+     926:	31 c9                	xor    %ecx,%ecx
+     928:	89 54 24 08          	mov    %edx,0x8(%esp)
+     92c:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+     930:	89 04 24             	mov    %eax,(%esp)
+  cmd = malloc(sizeof(*cmd));
+     933:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     935:	e8 76 06 00 00       	call   fb0 <memset>
+  cmd->type = REDIR;
+     93a:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     940:	8b 45 08             	mov    0x8(%ebp),%eax
+     943:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     946:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     949:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     94c:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     94f:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->fd = fd;
+     956:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+  cmd->efile = efile;
+     95d:	89 57 0c             	mov    %edx,0xc(%edi)
+      break;
+     960:	89 7d 08             	mov    %edi,0x8(%ebp)
+     963:	e9 38 ff ff ff       	jmp    8a0 <parseredirs+0x10>
+     968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96f:	90                   	nop
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     970:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     973:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     976:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     979:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     97c:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+     983:	e8 e8 0c 00 00       	call   1670 <malloc>
+     988:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     98a:	b8 18 00 00 00       	mov    $0x18,%eax
+     98f:	89 44 24 08          	mov    %eax,0x8(%esp)
+     993:	31 c0                	xor    %eax,%eax
+     995:	89 44 24 04          	mov    %eax,0x4(%esp)
+     999:	89 3c 24             	mov    %edi,(%esp)
+     99c:	e8 0f 06 00 00       	call   fb0 <memset>
+  cmd->cmd = subcmd;
+     9a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     9a4:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->file = file;
+     9aa:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  cmd->mode = mode;
+     9ad:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->efile = efile;
+     9b4:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->fd = fd;
+     9b7:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  cmd->cmd = subcmd;
+     9be:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     9c1:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     9c4:	89 57 0c             	mov    %edx,0xc(%edi)
+      break;
+     9c7:	89 7d 08             	mov    %edi,0x8(%ebp)
+     9ca:	e9 d1 fe ff ff       	jmp    8a0 <parseredirs+0x10>
+     9cf:	90                   	nop
+    }
+  }
+  return cmd;
+}
+     9d0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d3:	83 c4 3c             	add    $0x3c,%esp
+     9d6:	5b                   	pop    %ebx
+     9d7:	5e                   	pop    %esi
+     9d8:	5f                   	pop    %edi
+     9d9:	5d                   	pop    %ebp
+     9da:	c3                   	ret
+      panic("missing file for redirection");
+     9db:	c7 04 24 1e 18 00 00 	movl   $0x181e,(%esp)
+     9e2:	e8 29 f8 ff ff       	call   210 <panic>
+     9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     9f0:	55                   	push   %ebp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     9f1:	b8 3e 18 00 00       	mov    $0x183e,%eax
+{
+     9f6:	89 e5                	mov    %esp,%ebp
+     9f8:	57                   	push   %edi
+     9f9:	56                   	push   %esi
+     9fa:	53                   	push   %ebx
+     9fb:	83 ec 3c             	sub    $0x3c,%esp
+     9fe:	8b 75 08             	mov    0x8(%ebp),%esi
+     a01:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(peek(ps, es, "("))
+     a04:	89 44 24 08          	mov    %eax,0x8(%esp)
+     a08:	89 34 24             	mov    %esi,(%esp)
+     a0b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     a0f:	e8 0c fe ff ff       	call   820 <peek>
+     a14:	85 c0                	test   %eax,%eax
+     a16:	0f 85 cc 00 00 00    	jne    ae8 <parseexec+0xf8>
+  cmd = malloc(sizeof(*cmd));
+     a1c:	c7 04 24 54 00 00 00 	movl   $0x54,(%esp)
+     a23:	89 c3                	mov    %eax,%ebx
+     a25:	e8 46 0c 00 00       	call   1670 <malloc>
+     a2a:	89 c2                	mov    %eax,%edx
+  memset(cmd, 0, sizeof(*cmd));
+     a2c:	b8 54 00 00 00       	mov    $0x54,%eax
+     a31:	89 44 24 08          	mov    %eax,0x8(%esp)
+     a35:	31 c0                	xor    %eax,%eax
+     a37:	89 14 24             	mov    %edx,(%esp)
+     a3a:	89 44 24 04          	mov    %eax,0x4(%esp)
+     a3e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     a41:	e8 6a 05 00 00       	call   fb0 <memset>
+  cmd->type = EXEC;
+     a46:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     a49:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     a4f:	89 7c 24 08          	mov    %edi,0x8(%esp)
+     a53:	89 74 24 04          	mov    %esi,0x4(%esp)
+     a57:	89 14 24             	mov    %edx,(%esp)
+     a5a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     a5d:	e8 2e fe ff ff       	call   890 <parseredirs>
+     a62:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     a65:	eb 1f                	jmp    a86 <parseexec+0x96>
+     a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     a70:	89 7c 24 08          	mov    %edi,0x8(%esp)
+     a74:	89 74 24 04          	mov    %esi,0x4(%esp)
+     a78:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     a7b:	89 04 24             	mov    %eax,(%esp)
+     a7e:	e8 0d fe ff ff       	call   890 <parseredirs>
+     a83:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     a86:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     a8a:	b8 55 18 00 00       	mov    $0x1855,%eax
+     a8f:	89 44 24 08          	mov    %eax,0x8(%esp)
+     a93:	89 34 24             	mov    %esi,(%esp)
+     a96:	e8 85 fd ff ff       	call   820 <peek>
+     a9b:	85 c0                	test   %eax,%eax
+     a9d:	75 61                	jne    b00 <parseexec+0x110>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     a9f:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     aa3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     aa6:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     aaa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     aad:	89 44 24 08          	mov    %eax,0x8(%esp)
+     ab1:	89 34 24             	mov    %esi,(%esp)
+     ab4:	e8 f7 fb ff ff       	call   6b0 <gettoken>
+     ab9:	85 c0                	test   %eax,%eax
+     abb:	74 43                	je     b00 <parseexec+0x110>
+    if(tok != 'a')
+     abd:	83 f8 61             	cmp    $0x61,%eax
+     ac0:	75 58                	jne    b1a <parseexec+0x12a>
+    cmd->argv[argc] = q;
+     ac2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ac5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     ac8:	89 44 99 04          	mov    %eax,0x4(%ecx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     acc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     acf:	89 44 99 2c          	mov    %eax,0x2c(%ecx,%ebx,4)
+    argc++;
+     ad3:	43                   	inc    %ebx
+    if(argc >= MAXARGS)
+     ad4:	83 fb 0a             	cmp    $0xa,%ebx
+     ad7:	75 97                	jne    a70 <parseexec+0x80>
+      panic("too many args");
+     ad9:	c7 04 24 47 18 00 00 	movl   $0x1847,(%esp)
+     ae0:	e8 2b f7 ff ff       	call   210 <panic>
+     ae5:	8d 76 00             	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     ae8:	89 7d 0c             	mov    %edi,0xc(%ebp)
+     aeb:	89 75 08             	mov    %esi,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     aee:	83 c4 3c             	add    $0x3c,%esp
+     af1:	5b                   	pop    %ebx
+     af2:	5e                   	pop    %esi
+     af3:	5f                   	pop    %edi
+     af4:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     af5:	e9 16 02 00 00       	jmp    d10 <parseblock>
+     afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     b00:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->argv[argc] = 0;
+     b03:	31 c0                	xor    %eax,%eax
+  cmd->eargv[argc] = 0;
+     b05:	31 c9                	xor    %ecx,%ecx
+  cmd->argv[argc] = 0;
+     b07:	89 44 9a 04          	mov    %eax,0x4(%edx,%ebx,4)
+}
+     b0b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  cmd->eargv[argc] = 0;
+     b0e:	89 4c 9a 2c          	mov    %ecx,0x2c(%edx,%ebx,4)
+}
+     b12:	83 c4 3c             	add    $0x3c,%esp
+     b15:	5b                   	pop    %ebx
+     b16:	5e                   	pop    %esi
+     b17:	5f                   	pop    %edi
+     b18:	5d                   	pop    %ebp
+     b19:	c3                   	ret
+      panic("syntax");
+     b1a:	c7 04 24 40 18 00 00 	movl   $0x1840,(%esp)
+     b21:	e8 ea f6 ff ff       	call   210 <panic>
+     b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <parsepipe>:
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	83 ec 28             	sub    $0x28,%esp
+     b36:	89 75 f8             	mov    %esi,-0x8(%ebp)
+     b39:	8b 75 08             	mov    0x8(%ebp),%esi
+     b3c:	89 7d fc             	mov    %edi,-0x4(%ebp)
+     b3f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     b42:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  cmd = parseexec(ps, es);
+     b45:	89 34 24             	mov    %esi,(%esp)
+     b48:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     b4c:	e8 9f fe ff ff       	call   9f0 <parseexec>
+  if(peek(ps, es, "|")){
+     b51:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     b55:	89 34 24             	mov    %esi,(%esp)
+  cmd = parseexec(ps, es);
+     b58:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     b5a:	b8 5a 18 00 00       	mov    $0x185a,%eax
+     b5f:	89 44 24 08          	mov    %eax,0x8(%esp)
+     b63:	e8 b8 fc ff ff       	call   820 <peek>
+     b68:	85 c0                	test   %eax,%eax
+     b6a:	75 14                	jne    b80 <parsepipe+0x50>
+}
+     b6c:	8b 75 f8             	mov    -0x8(%ebp),%esi
+     b6f:	89 d8                	mov    %ebx,%eax
+     b71:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+     b74:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     b77:	89 ec                	mov    %ebp,%esp
+     b79:	5d                   	pop    %ebp
+     b7a:	c3                   	ret
+     b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     b80:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     b84:	31 d2                	xor    %edx,%edx
+     b86:	31 c0                	xor    %eax,%eax
+     b88:	89 54 24 08          	mov    %edx,0x8(%esp)
+     b8c:	89 34 24             	mov    %esi,(%esp)
+     b8f:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     b93:	e8 18 fb ff ff       	call   6b0 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     b98:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     b9c:	89 34 24             	mov    %esi,(%esp)
+     b9f:	e8 8c ff ff ff       	call   b30 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     ba4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     bab:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     bad:	e8 be 0a 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     bb2:	b9 0c 00 00 00       	mov    $0xc,%ecx
+     bb7:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  cmd = malloc(sizeof(*cmd));
+     bbb:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     bbd:	31 c0                	xor    %eax,%eax
+     bbf:	89 34 24             	mov    %esi,(%esp)
+     bc2:	89 44 24 04          	mov    %eax,0x4(%esp)
+     bc6:	e8 e5 03 00 00       	call   fb0 <memset>
+  cmd->left = left;
+     bcb:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     bce:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     bd0:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     bd6:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     bd8:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     bdb:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+     bde:	8b 75 f8             	mov    -0x8(%ebp),%esi
+     be1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     be4:	89 ec                	mov    %ebp,%esp
+     be6:	5d                   	pop    %ebp
+     be7:	c3                   	ret
+     be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <parseline>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	83 ec 2c             	sub    $0x2c,%esp
+     bf9:	8b 75 08             	mov    0x8(%ebp),%esi
+     bfc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     bff:	89 34 24             	mov    %esi,(%esp)
+     c02:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     c06:	e8 25 ff ff ff       	call   b30 <parsepipe>
+     c0b:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     c0d:	eb 4f                	jmp    c5e <parseline+0x6e>
+     c0f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     c10:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     c14:	31 c0                	xor    %eax,%eax
+     c16:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     c1a:	31 c0                	xor    %eax,%eax
+     c1c:	89 44 24 08          	mov    %eax,0x8(%esp)
+     c20:	89 34 24             	mov    %esi,(%esp)
+     c23:	e8 88 fa ff ff       	call   6b0 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     c28:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     c2f:	e8 3c 0a 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c34:	b9 08 00 00 00       	mov    $0x8,%ecx
+     c39:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  cmd = malloc(sizeof(*cmd));
+     c3d:	89 c2                	mov    %eax,%edx
+  memset(cmd, 0, sizeof(*cmd));
+     c3f:	31 c0                	xor    %eax,%eax
+     c41:	89 14 24             	mov    %edx,(%esp)
+     c44:	89 44 24 04          	mov    %eax,0x4(%esp)
+     c48:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     c4b:	e8 60 03 00 00       	call   fb0 <memset>
+  cmd->type = BACK;
+     c50:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     c53:	89 5a 04             	mov    %ebx,0x4(%edx)
+     c56:	89 d3                	mov    %edx,%ebx
+  cmd->type = BACK;
+     c58:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  while(peek(ps, es, "&")){
+     c5e:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     c62:	b8 5c 18 00 00       	mov    $0x185c,%eax
+     c67:	89 44 24 08          	mov    %eax,0x8(%esp)
+     c6b:	89 34 24             	mov    %esi,(%esp)
+     c6e:	e8 ad fb ff ff       	call   820 <peek>
+     c73:	85 c0                	test   %eax,%eax
+     c75:	75 99                	jne    c10 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     c77:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     c7b:	b8 58 18 00 00       	mov    $0x1858,%eax
+     c80:	89 44 24 08          	mov    %eax,0x8(%esp)
+     c84:	89 34 24             	mov    %esi,(%esp)
+     c87:	e8 94 fb ff ff       	call   820 <peek>
+     c8c:	85 c0                	test   %eax,%eax
+     c8e:	75 10                	jne    ca0 <parseline+0xb0>
+}
+     c90:	83 c4 2c             	add    $0x2c,%esp
+     c93:	89 d8                	mov    %ebx,%eax
+     c95:	5b                   	pop    %ebx
+     c96:	5e                   	pop    %esi
+     c97:	5f                   	pop    %edi
+     c98:	5d                   	pop    %ebp
+     c99:	c3                   	ret
+     c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     ca0:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     ca4:	31 d2                	xor    %edx,%edx
+     ca6:	31 c0                	xor    %eax,%eax
+     ca8:	89 54 24 08          	mov    %edx,0x8(%esp)
+     cac:	89 34 24             	mov    %esi,(%esp)
+     caf:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     cb3:	e8 f8 f9 ff ff       	call   6b0 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     cb8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+     cbc:	89 34 24             	mov    %esi,(%esp)
+     cbf:	e8 2c ff ff ff       	call   bf0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     cc4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     ccb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     ccd:	e8 9e 09 00 00       	call   1670 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     cd2:	b9 0c 00 00 00       	mov    $0xc,%ecx
+     cd7:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  cmd = malloc(sizeof(*cmd));
+     cdb:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     cdd:	31 c0                	xor    %eax,%eax
+     cdf:	89 34 24             	mov    %esi,(%esp)
+     ce2:	89 44 24 04          	mov    %eax,0x4(%esp)
+     ce6:	e8 c5 02 00 00       	call   fb0 <memset>
+  cmd->left = left;
+     ceb:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     cee:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     cf0:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     cf6:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     cf8:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     cfb:	83 c4 2c             	add    $0x2c,%esp
+     cfe:	5b                   	pop    %ebx
+     cff:	5e                   	pop    %esi
+     d00:	5f                   	pop    %edi
+     d01:	5d                   	pop    %ebp
+     d02:	c3                   	ret
+     d03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d10 <parseblock>:
+{
+     d10:	55                   	push   %ebp
+  if(!peek(ps, es, "("))
+     d11:	b8 3e 18 00 00       	mov    $0x183e,%eax
+{
+     d16:	89 e5                	mov    %esp,%ebp
+     d18:	83 ec 28             	sub    $0x28,%esp
+     d1b:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+     d1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d21:	89 75 f8             	mov    %esi,-0x8(%ebp)
+     d24:	8b 75 0c             	mov    0xc(%ebp),%esi
+     d27:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  if(!peek(ps, es, "("))
+     d2a:	89 44 24 08          	mov    %eax,0x8(%esp)
+     d2e:	89 1c 24             	mov    %ebx,(%esp)
+     d31:	89 74 24 04          	mov    %esi,0x4(%esp)
+     d35:	e8 e6 fa ff ff       	call   820 <peek>
+     d3a:	85 c0                	test   %eax,%eax
+     d3c:	74 74                	je     db2 <parseblock+0xa2>
+  gettoken(ps, es, 0, 0);
+     d3e:	89 74 24 04          	mov    %esi,0x4(%esp)
+     d42:	31 c9                	xor    %ecx,%ecx
+     d44:	31 ff                	xor    %edi,%edi
+     d46:	89 4c 24 0c          	mov    %ecx,0xc(%esp)
+     d4a:	89 7c 24 08          	mov    %edi,0x8(%esp)
+     d4e:	89 1c 24             	mov    %ebx,(%esp)
+     d51:	e8 5a f9 ff ff       	call   6b0 <gettoken>
+  cmd = parseline(ps, es);
+     d56:	89 74 24 04          	mov    %esi,0x4(%esp)
+     d5a:	89 1c 24             	mov    %ebx,(%esp)
+     d5d:	e8 8e fe ff ff       	call   bf0 <parseline>
+  if(!peek(ps, es, ")"))
+     d62:	89 74 24 04          	mov    %esi,0x4(%esp)
+     d66:	89 1c 24             	mov    %ebx,(%esp)
+  cmd = parseline(ps, es);
+     d69:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     d6b:	b8 7a 18 00 00       	mov    $0x187a,%eax
+     d70:	89 44 24 08          	mov    %eax,0x8(%esp)
+     d74:	e8 a7 fa ff ff       	call   820 <peek>
+     d79:	85 c0                	test   %eax,%eax
+     d7b:	74 41                	je     dbe <parseblock+0xae>
+  gettoken(ps, es, 0, 0);
+     d7d:	89 74 24 04          	mov    %esi,0x4(%esp)
+     d81:	31 d2                	xor    %edx,%edx
+     d83:	31 c0                	xor    %eax,%eax
+     d85:	89 54 24 08          	mov    %edx,0x8(%esp)
+     d89:	89 1c 24             	mov    %ebx,(%esp)
+     d8c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+     d90:	e8 1b f9 ff ff       	call   6b0 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     d95:	89 74 24 08          	mov    %esi,0x8(%esp)
+     d99:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     d9d:	89 3c 24             	mov    %edi,(%esp)
+     da0:	e8 eb fa ff ff       	call   890 <parseredirs>
+}
+     da5:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+     da8:	8b 75 f8             	mov    -0x8(%ebp),%esi
+     dab:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     dae:	89 ec                	mov    %ebp,%esp
+     db0:	5d                   	pop    %ebp
+     db1:	c3                   	ret
+    panic("parseblock");
+     db2:	c7 04 24 5e 18 00 00 	movl   $0x185e,(%esp)
+     db9:	e8 52 f4 ff ff       	call   210 <panic>
+    panic("syntax - missing )");
+     dbe:	c7 04 24 69 18 00 00 	movl   $0x1869,(%esp)
+     dc5:	e8 46 f4 ff ff       	call   210 <panic>
+     dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000dd0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	83 ec 18             	sub    $0x18,%esp
+     dd6:	89 5d fc             	mov    %ebx,-0x4(%ebp)
+     dd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     ddc:	85 db                	test   %ebx,%ebx
+     dde:	0f 84 8c 00 00 00    	je     e70 <nulterminate+0xa0>
+    return 0;
+
+  switch(cmd->type){
+     de4:	83 3b 05             	cmpl   $0x5,(%ebx)
+     de7:	77 25                	ja     e0e <nulterminate+0x3e>
+     de9:	8b 03                	mov    (%ebx),%eax
+     deb:	ff 24 85 f0 18 00 00 	jmp    *0x18f0(,%eax,4)
+     df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     df8:	8b 43 04             	mov    0x4(%ebx),%eax
+     dfb:	89 04 24             	mov    %eax,(%esp)
+     dfe:	e8 cd ff ff ff       	call   dd0 <nulterminate>
+    nulterminate(lcmd->right);
+     e03:	8b 43 08             	mov    0x8(%ebx),%eax
+     e06:	89 04 24             	mov    %eax,(%esp)
+     e09:	e8 c2 ff ff ff       	call   dd0 <nulterminate>
+    return 0;
+     e0e:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     e10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e13:	89 ec                	mov    %ebp,%esp
+     e15:	5d                   	pop    %ebp
+     e16:	c3                   	ret
+     e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     e20:	8b 43 04             	mov    0x4(%ebx),%eax
+     e23:	89 04 24             	mov    %eax,(%esp)
+     e26:	e8 a5 ff ff ff       	call   dd0 <nulterminate>
+    break;
+     e2b:	eb e1                	jmp    e0e <nulterminate+0x3e>
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(i=0; ecmd->argv[i]; i++)
+     e30:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     e33:	8d 43 08             	lea    0x8(%ebx),%eax
+     e36:	85 c9                	test   %ecx,%ecx
+     e38:	74 d4                	je     e0e <nulterminate+0x3e>
+     e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     e40:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     e43:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     e46:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     e49:	8b 50 fc             	mov    -0x4(%eax),%edx
+     e4c:	85 d2                	test   %edx,%edx
+     e4e:	75 f0                	jne    e40 <nulterminate+0x70>
+     e50:	eb bc                	jmp    e0e <nulterminate+0x3e>
+     e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     e58:	8b 43 04             	mov    0x4(%ebx),%eax
+     e5b:	89 04 24             	mov    %eax,(%esp)
+     e5e:	e8 6d ff ff ff       	call   dd0 <nulterminate>
+    *rcmd->efile = 0;
+     e63:	8b 43 0c             	mov    0xc(%ebx),%eax
+     e66:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     e69:	eb a3                	jmp    e0e <nulterminate+0x3e>
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+    return 0;
+     e70:	31 c0                	xor    %eax,%eax
+     e72:	eb 9c                	jmp    e10 <nulterminate+0x40>
+     e74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+
+00000e80 <parsecmd>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	56                   	push   %esi
+     e84:	53                   	push   %ebx
+     e85:	83 ec 10             	sub    $0x10,%esp
+  es = s + strlen(s);
+     e88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e8b:	89 1c 24             	mov    %ebx,(%esp)
+     e8e:	e8 ed 00 00 00       	call   f80 <strlen>
+     e93:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     e95:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+     e99:	8d 45 08             	lea    0x8(%ebp),%eax
+     e9c:	89 04 24             	mov    %eax,(%esp)
+     e9f:	e8 4c fd ff ff       	call   bf0 <parseline>
+  peek(&s, es, "");
+     ea4:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+  cmd = parseline(&s, es);
+     ea8:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     eaa:	b8 08 18 00 00       	mov    $0x1808,%eax
+     eaf:	89 44 24 08          	mov    %eax,0x8(%esp)
+     eb3:	8d 45 08             	lea    0x8(%ebp),%eax
+     eb6:	89 04 24             	mov    %eax,(%esp)
+     eb9:	e8 62 f9 ff ff       	call   820 <peek>
+  if(s != es){
+     ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+     ec1:	39 d8                	cmp    %ebx,%eax
+     ec3:	75 11                	jne    ed6 <parsecmd+0x56>
+  nulterminate(cmd);
+     ec5:	89 34 24             	mov    %esi,(%esp)
+     ec8:	e8 03 ff ff ff       	call   dd0 <nulterminate>
+}
+     ecd:	83 c4 10             	add    $0x10,%esp
+     ed0:	89 f0                	mov    %esi,%eax
+     ed2:	5b                   	pop    %ebx
+     ed3:	5e                   	pop    %esi
+     ed4:	5d                   	pop    %ebp
+     ed5:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     ed6:	89 44 24 08          	mov    %eax,0x8(%esp)
+     eda:	c7 44 24 04 7c 18 00 	movl   $0x187c,0x4(%esp)
+     ee1:	00 
+     ee2:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     ee9:	e8 22 04 00 00       	call   1310 <printf>
+    panic("syntax");
+     eee:	c7 04 24 40 18 00 00 	movl   $0x1840,(%esp)
+     ef5:	e8 16 f3 ff ff       	call   210 <panic>
+     efa:	66 90                	xchg   %ax,%ax
+     efc:	66 90                	xchg   %ax,%ax
+     efe:	66 90                	xchg   %ax,%ax
+
+00000f00 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     f00:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     f01:	31 c0                	xor    %eax,%eax
+{
+     f03:	89 e5                	mov    %esp,%ebp
+     f05:	53                   	push   %ebx
+     f06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     f10:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     f14:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     f17:	40                   	inc    %eax
+     f18:	84 d2                	test   %dl,%dl
+     f1a:	75 f4                	jne    f10 <strcpy+0x10>
+    ;
+  return os;
+}
+     f1c:	5b                   	pop    %ebx
+     f1d:	89 c8                	mov    %ecx,%eax
+     f1f:	5d                   	pop    %ebp
+     f20:	c3                   	ret
+     f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+
+00000f30 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	53                   	push   %ebx
+     f34:	8b 55 08             	mov    0x8(%ebp),%edx
+     f37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+     f3a:	0f b6 02             	movzbl (%edx),%eax
+     f3d:	84 c0                	test   %al,%al
+     f3f:	75 15                	jne    f56 <strcmp+0x26>
+     f41:	eb 30                	jmp    f73 <strcmp+0x43>
+     f43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f47:	90                   	nop
+     f48:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     f4c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+     f4f:	42                   	inc    %edx
+  while(*p && *p == *q)
+     f50:	84 c0                	test   %al,%al
+     f52:	74 14                	je     f68 <strcmp+0x38>
+    p++, q++;
+     f54:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+     f56:	0f b6 0b             	movzbl (%ebx),%ecx
+     f59:	38 c1                	cmp    %al,%cl
+     f5b:	74 eb                	je     f48 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+     f5d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+     f5e:	29 c8                	sub    %ecx,%eax
+}
+     f60:	5d                   	pop    %ebp
+     f61:	c3                   	ret
+     f62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     f68:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+     f6c:	31 c0                	xor    %eax,%eax
+}
+     f6e:	5b                   	pop    %ebx
+     f6f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+     f70:	29 c8                	sub    %ecx,%eax
+}
+     f72:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     f73:	0f b6 0b             	movzbl (%ebx),%ecx
+     f76:	31 c0                	xor    %eax,%eax
+     f78:	eb e3                	jmp    f5d <strcmp+0x2d>
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f80 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     f86:	80 3a 00             	cmpb   $0x0,(%edx)
+     f89:	74 15                	je     fa0 <strlen+0x20>
+     f8b:	31 c0                	xor    %eax,%eax
+     f8d:	8d 76 00             	lea    0x0(%esi),%esi
+     f90:	40                   	inc    %eax
+     f91:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     f95:	89 c1                	mov    %eax,%ecx
+     f97:	75 f7                	jne    f90 <strlen+0x10>
+    ;
+  return n;
+}
+     f99:	5d                   	pop    %ebp
+     f9a:	89 c8                	mov    %ecx,%eax
+     f9c:	c3                   	ret
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+     fa0:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+     fa1:	31 c9                	xor    %ecx,%ecx
+}
+     fa3:	89 c8                	mov    %ecx,%eax
+     fa5:	c3                   	ret
+     fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fb0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     fb7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     fba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     fbd:	89 d7                	mov    %edx,%edi
+     fbf:	fc                   	cld
+     fc0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     fc2:	5f                   	pop    %edi
+     fc3:	89 d0                	mov    %edx,%eax
+     fc5:	5d                   	pop    %ebp
+     fc6:	c3                   	ret
+     fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fce:	66 90                	xchg   %ax,%ax
+
+00000fd0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fd6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     fda:	0f b6 10             	movzbl (%eax),%edx
+     fdd:	84 d2                	test   %dl,%dl
+     fdf:	75 10                	jne    ff1 <strchr+0x21>
+     fe1:	eb 1d                	jmp    1000 <strchr+0x30>
+     fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fe7:	90                   	nop
+     fe8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     fec:	40                   	inc    %eax
+     fed:	84 d2                	test   %dl,%dl
+     fef:	74 0f                	je     1000 <strchr+0x30>
+    if(*s == c)
+     ff1:	38 d1                	cmp    %dl,%cl
+     ff3:	75 f3                	jne    fe8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     ff5:	5d                   	pop    %ebp
+     ff6:	c3                   	ret
+     ff7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ffe:	66 90                	xchg   %ax,%ax
+    1000:	5d                   	pop    %ebp
+  return 0;
+    1001:	31 c0                	xor    %eax,%eax
+}
+    1003:	c3                   	ret
+    1004:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+
+00001010 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	57                   	push   %edi
+    1014:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    1015:	31 f6                	xor    %esi,%esi
+{
+    1017:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+    1018:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+    101b:	83 ec 3c             	sub    $0x3c,%esp
+    101e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+    1021:	eb 32                	jmp    1055 <gets+0x45>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    cc = read(0, &c, 1);
+    1028:	89 7c 24 04          	mov    %edi,0x4(%esp)
+    102c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1031:	89 44 24 08          	mov    %eax,0x8(%esp)
+    1035:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    103c:	e8 1a 01 00 00       	call   115b <read>
+    if(cc < 1)
+    1041:	85 c0                	test   %eax,%eax
+    1043:	7e 19                	jle    105e <gets+0x4e>
+      break;
+    buf[i++] = c;
+    1045:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1049:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+    104d:	3c 0a                	cmp    $0xa,%al
+    104f:	74 10                	je     1061 <gets+0x51>
+    1051:	3c 0d                	cmp    $0xd,%al
+    1053:	74 0c                	je     1061 <gets+0x51>
+  for(i=0; i+1 < max; ){
+    1055:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1058:	46                   	inc    %esi
+    1059:	3b 75 0c             	cmp    0xc(%ebp),%esi
+    105c:	7c ca                	jl     1028 <gets+0x18>
+    105e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+    1061:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+    1065:	83 c4 3c             	add    $0x3c,%esp
+    1068:	89 d8                	mov    %ebx,%eax
+    106a:	5b                   	pop    %ebx
+    106b:	5e                   	pop    %esi
+    106c:	5f                   	pop    %edi
+    106d:	5d                   	pop    %ebp
+    106e:	c3                   	ret
+    106f:	90                   	nop
+
+00001070 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1070:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1071:	31 c0                	xor    %eax,%eax
+{
+    1073:	89 e5                	mov    %esp,%ebp
+    1075:	83 ec 18             	sub    $0x18,%esp
+    1078:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+    107b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+    107e:	89 44 24 04          	mov    %eax,0x4(%esp)
+    1082:	8b 45 08             	mov    0x8(%ebp),%eax
+    1085:	89 04 24             	mov    %eax,(%esp)
+    1088:	e8 f6 00 00 00       	call   1183 <open>
+  if(fd < 0)
+    108d:	85 c0                	test   %eax,%eax
+    108f:	78 2f                	js     10c0 <stat+0x50>
+    1091:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    1093:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1096:	89 1c 24             	mov    %ebx,(%esp)
+    1099:	89 44 24 04          	mov    %eax,0x4(%esp)
+    109d:	e8 f9 00 00 00       	call   119b <fstat>
+  close(fd);
+    10a2:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    10a5:	89 c6                	mov    %eax,%esi
+  close(fd);
+    10a7:	e8 bf 00 00 00       	call   116b <close>
+  return r;
+}
+    10ac:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+    10af:	89 f0                	mov    %esi,%eax
+    10b1:	8b 75 fc             	mov    -0x4(%ebp),%esi
+    10b4:	89 ec                	mov    %ebp,%esp
+    10b6:	5d                   	pop    %ebp
+    10b7:	c3                   	ret
+    10b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+    return -1;
+    10c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10c5:	eb e5                	jmp    10ac <stat+0x3c>
+    10c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ce:	66 90                	xchg   %ax,%ax
+
+000010d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    10d7:	0f be 02             	movsbl (%edx),%eax
+    10da:	88 c1                	mov    %al,%cl
+    10dc:	80 e9 30             	sub    $0x30,%cl
+    10df:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    10e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    10e7:	77 1c                	ja     1105 <atoi+0x35>
+    10e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+    10f0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    10f3:	42                   	inc    %edx
+    10f4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    10f8:	0f be 02             	movsbl (%edx),%eax
+    10fb:	88 c3                	mov    %al,%bl
+    10fd:	80 eb 30             	sub    $0x30,%bl
+    1100:	80 fb 09             	cmp    $0x9,%bl
+    1103:	76 eb                	jbe    10f0 <atoi+0x20>
+  return n;
+}
+    1105:	5b                   	pop    %ebx
+    1106:	89 c8                	mov    %ecx,%eax
+    1108:	5d                   	pop    %ebp
+    1109:	c3                   	ret
+    110a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001110 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	8b 45 10             	mov    0x10(%ebp),%eax
+    1118:	8b 55 08             	mov    0x8(%ebp),%edx
+    111b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    111e:	85 c0                	test   %eax,%eax
+    1120:	7e 13                	jle    1135 <memmove+0x25>
+    1122:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1124:	89 d7                	mov    %edx,%edi
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1130:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1131:	39 f8                	cmp    %edi,%eax
+    1133:	75 fb                	jne    1130 <memmove+0x20>
+  return vdst;
+}
+    1135:	5e                   	pop    %esi
+    1136:	89 d0                	mov    %edx,%eax
+    1138:	5f                   	pop    %edi
+    1139:	5d                   	pop    %ebp
+    113a:	c3                   	ret
+
+0000113b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    113b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1140:	cd 40                	int    $0x40
+    1142:	c3                   	ret
+
+00001143 <exit>:
+SYSCALL(exit)
+    1143:	b8 02 00 00 00       	mov    $0x2,%eax
+    1148:	cd 40                	int    $0x40
+    114a:	c3                   	ret
+
+0000114b <wait>:
+SYSCALL(wait)
+    114b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1150:	cd 40                	int    $0x40
+    1152:	c3                   	ret
+
+00001153 <pipe>:
+SYSCALL(pipe)
+    1153:	b8 04 00 00 00       	mov    $0x4,%eax
+    1158:	cd 40                	int    $0x40
+    115a:	c3                   	ret
+
+0000115b <read>:
+SYSCALL(read)
+    115b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1160:	cd 40                	int    $0x40
+    1162:	c3                   	ret
+
+00001163 <write>:
+SYSCALL(write)
+    1163:	b8 10 00 00 00       	mov    $0x10,%eax
+    1168:	cd 40                	int    $0x40
+    116a:	c3                   	ret
+
+0000116b <close>:
+SYSCALL(close)
+    116b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1170:	cd 40                	int    $0x40
+    1172:	c3                   	ret
+
+00001173 <kill>:
+SYSCALL(kill)
+    1173:	b8 06 00 00 00       	mov    $0x6,%eax
+    1178:	cd 40                	int    $0x40
+    117a:	c3                   	ret
+
+0000117b <exec>:
+SYSCALL(exec)
+    117b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1180:	cd 40                	int    $0x40
+    1182:	c3                   	ret
+
+00001183 <open>:
+SYSCALL(open)
+    1183:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1188:	cd 40                	int    $0x40
+    118a:	c3                   	ret
+
+0000118b <mknod>:
+SYSCALL(mknod)
+    118b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1190:	cd 40                	int    $0x40
+    1192:	c3                   	ret
+
+00001193 <unlink>:
+SYSCALL(unlink)
+    1193:	b8 12 00 00 00       	mov    $0x12,%eax
+    1198:	cd 40                	int    $0x40
+    119a:	c3                   	ret
+
+0000119b <fstat>:
+SYSCALL(fstat)
+    119b:	b8 08 00 00 00       	mov    $0x8,%eax
+    11a0:	cd 40                	int    $0x40
+    11a2:	c3                   	ret
+
+000011a3 <link>:
+SYSCALL(link)
+    11a3:	b8 13 00 00 00       	mov    $0x13,%eax
+    11a8:	cd 40                	int    $0x40
+    11aa:	c3                   	ret
+
+000011ab <mkdir>:
+SYSCALL(mkdir)
+    11ab:	b8 14 00 00 00       	mov    $0x14,%eax
+    11b0:	cd 40                	int    $0x40
+    11b2:	c3                   	ret
+
+000011b3 <chdir>:
+SYSCALL(chdir)
+    11b3:	b8 09 00 00 00       	mov    $0x9,%eax
+    11b8:	cd 40                	int    $0x40
+    11ba:	c3                   	ret
+
+000011bb <dup>:
+SYSCALL(dup)
+    11bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    11c0:	cd 40                	int    $0x40
+    11c2:	c3                   	ret
+
+000011c3 <getpid>:
+SYSCALL(getpid)
+    11c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    11c8:	cd 40                	int    $0x40
+    11ca:	c3                   	ret
+
+000011cb <sbrk>:
+SYSCALL(sbrk)
+    11cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    11d0:	cd 40                	int    $0x40
+    11d2:	c3                   	ret
+
+000011d3 <sleep>:
+SYSCALL(sleep)
+    11d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    11d8:	cd 40                	int    $0x40
+    11da:	c3                   	ret
+
+000011db <uptime>:
+SYSCALL(uptime)
+    11db:	b8 0e 00 00 00       	mov    $0xe,%eax
+    11e0:	cd 40                	int    $0x40
+    11e2:	c3                   	ret
+
+000011e3 <detach>:
+SYSCALL(detach)
+    11e3:	b8 16 00 00 00       	mov    $0x16,%eax
+    11e8:	cd 40                	int    $0x40
+    11ea:	c3                   	ret
+
+000011eb <policy>:
+SYSCALL(policy)
+    11eb:	b8 17 00 00 00       	mov    $0x17,%eax
+    11f0:	cd 40                	int    $0x40
+    11f2:	c3                   	ret
+
+000011f3 <priority>:
+SYSCALL(priority)
+    11f3:	b8 18 00 00 00       	mov    $0x18,%eax
+    11f8:	cd 40                	int    $0x40
+    11fa:	c3                   	ret
+
+000011fb <wait_stat>:
+SYSCALL(wait_stat)
+    11fb:	b8 19 00 00 00       	mov    $0x19,%eax
+    1200:	cd 40                	int    $0x40
+    1202:	c3                   	ret
+
+00001203 <lockstat>:
+SYSCALL(lockstat)
+    1203:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1208:	cd 40                	int    $0x40
+    120a:	c3                   	ret
+
+0000120b <mmap>:
+SYSCALL(mmap)
+    120b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1210:	cd 40                	int    $0x40
+    1212:	c3                   	ret
+
+00001213 <munmap>:
+SYSCALL(munmap)
+    1213:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1218:	cd 40                	int    $0x40
+    121a:	c3                   	ret
+
+0000121b <shmget>:
+SYSCALL(shmget)
+    121b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1220:	cd 40                	int    $0x40
+    1222:	c3                   	ret
+
+00001223 <shmat>:
+SYSCALL(shmat)
+    1223:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1228:	cd 40                	int    $0x40
+    122a:	c3                   	ret
+
+0000122b <shmdt>:
+SYSCALL(shmdt)
+    122b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1230:	cd 40                	int    $0x40
+    1232:	c3                   	ret
+
+00001233 <memstat>:
+SYSCALL(memstat)
+    1233:	b8 20 00 00 00       	mov    $0x20,%eax
+    1238:	cd 40                	int    $0x40
+    123a:	c3                   	ret
+
+0000123b <getprocs>:
+SYSCALL(getprocs)
+    123b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1240:	cd 40                	int    $0x40
+    1242:	c3                   	ret
+
+00001243 <shmctl>:
+SYSCALL(shmctl)
+    1243:	b8 22 00 00 00       	mov    $0x22,%eax
+    1248:	cd 40                	int    $0x40
+    124a:	c3                   	ret
+    124b:	66 90                	xchg   %ax,%ax
+    124d:	66 90                	xchg   %ax,%ax
+    124f:	90                   	nop
+
+00001250 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	57                   	push   %edi
+    1254:	56                   	push   %esi
+    1255:	53                   	push   %ebx
+    1256:	89 cb                	mov    %ecx,%ebx
+    1258:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    125b:	89 d1                	mov    %edx,%ecx
+{
+    125d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+    1260:	89 d0                	mov    %edx,%eax
+    1262:	c1 e8 1f             	shr    $0x1f,%eax
+    1265:	84 c0                	test   %al,%al
+    1267:	0f 84 93 00 00 00    	je     1300 <printint+0xb0>
+    126d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1271:	0f 84 89 00 00 00    	je     1300 <printint+0xb0>
+    x = -xx;
+    1277:	f7 d9                	neg    %ecx
+    neg = 1;
+    1279:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    127e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+    1285:	8d 75 d7             	lea    -0x29(%ebp),%esi
+    1288:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    128b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    128f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+    1290:	89 c8                	mov    %ecx,%eax
+    1292:	31 d2                	xor    %edx,%edx
+    1294:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+    1297:	f7 f3                	div    %ebx
+    1299:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    129c:	0f b6 92 68 19 00 00 	movzbl 0x1968(%edx),%edx
+    12a3:	8d 47 01             	lea    0x1(%edi),%eax
+    12a6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    12a9:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+    12ad:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+    12af:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+    12b2:	39 da                	cmp    %ebx,%edx
+    12b4:	73 da                	jae    1290 <printint+0x40>
+  if(neg)
+    12b6:	8b 45 b8             	mov    -0x48(%ebp),%eax
+    12b9:	85 c0                	test   %eax,%eax
+    12bb:	74 0a                	je     12c7 <printint+0x77>
+    buf[i++] = '-';
+    12bd:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    12c0:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+    12c5:	89 c7                	mov    %eax,%edi
+    12c7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    12ca:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+    12ce:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    12d0:	0f b6 07             	movzbl (%edi),%eax
+    12d3:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    12d6:	b8 01 00 00 00       	mov    $0x1,%eax
+    12db:	89 44 24 08          	mov    %eax,0x8(%esp)
+    12df:	89 74 24 04          	mov    %esi,0x4(%esp)
+    12e3:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    12e6:	89 04 24             	mov    %eax,(%esp)
+    12e9:	e8 75 fe ff ff       	call   1163 <write>
+  while(--i >= 0)
+    12ee:	89 f8                	mov    %edi,%eax
+    12f0:	4f                   	dec    %edi
+    12f1:	39 d8                	cmp    %ebx,%eax
+    12f3:	75 db                	jne    12d0 <printint+0x80>
+}
+    12f5:	83 c4 4c             	add    $0x4c,%esp
+    12f8:	5b                   	pop    %ebx
+    12f9:	5e                   	pop    %esi
+    12fa:	5f                   	pop    %edi
+    12fb:	5d                   	pop    %ebp
+    12fc:	c3                   	ret
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+    1300:	31 c0                	xor    %eax,%eax
+    1302:	e9 77 ff ff ff       	jmp    127e <printint+0x2e>
+    1307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130e:	66 90                	xchg   %ax,%ax
+
+00001310 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	57                   	push   %edi
+    1314:	56                   	push   %esi
+    1315:	53                   	push   %ebx
+    1316:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1319:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    131c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    131f:	0f b6 1e             	movzbl (%esi),%ebx
+    1322:	84 db                	test   %bl,%bl
+    1324:	74 6f                	je     1395 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+    1326:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+    1329:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+    132b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+    132e:	88 d9                	mov    %bl,%cl
+    1330:	46                   	inc    %esi
+    1331:	89 d3                	mov    %edx,%ebx
+    1333:	eb 2b                	jmp    1360 <printf+0x50>
+    1335:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1338:	83 f8 25             	cmp    $0x25,%eax
+    133b:	74 4b                	je     1388 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+    133d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+    1340:	b8 01 00 00 00       	mov    $0x1,%eax
+    1345:	89 44 24 08          	mov    %eax,0x8(%esp)
+    1349:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    134c:	89 44 24 04          	mov    %eax,0x4(%esp)
+    1350:	89 3c 24             	mov    %edi,(%esp)
+    1353:	e8 0b fe ff ff       	call   1163 <write>
+  for(i = 0; fmt[i]; i++){
+    1358:	0f b6 0e             	movzbl (%esi),%ecx
+    135b:	46                   	inc    %esi
+    135c:	84 c9                	test   %cl,%cl
+    135e:	74 35                	je     1395 <printf+0x85>
+    if(state == 0){
+    1360:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+    1362:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+    1365:	74 d1                	je     1338 <printf+0x28>
+      }
+    } else if(state == '%'){
+    1367:	83 fb 25             	cmp    $0x25,%ebx
+    136a:	75 ec                	jne    1358 <printf+0x48>
+      if(c == 'd'){
+    136c:	83 f8 25             	cmp    $0x25,%eax
+    136f:	0f 84 53 01 00 00    	je     14c8 <printf+0x1b8>
+    1375:	83 e8 63             	sub    $0x63,%eax
+    1378:	83 f8 15             	cmp    $0x15,%eax
+    137b:	77 23                	ja     13a0 <printf+0x90>
+    137d:	ff 24 85 10 19 00 00 	jmp    *0x1910(,%eax,4)
+    1384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+    1388:	0f b6 0e             	movzbl (%esi),%ecx
+    138b:	46                   	inc    %esi
+        state = '%';
+    138c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+    1391:	84 c9                	test   %cl,%cl
+    1393:	75 cb                	jne    1360 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1395:	83 c4 3c             	add    $0x3c,%esp
+    1398:	5b                   	pop    %ebx
+    1399:	5e                   	pop    %esi
+    139a:	5f                   	pop    %edi
+    139b:	5d                   	pop    %ebp
+    139c:	c3                   	ret
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+    13a0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+    13a3:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    13a6:	b8 01 00 00 00       	mov    $0x1,%eax
+    13ab:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    13af:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+    13b3:	89 44 24 08          	mov    %eax,0x8(%esp)
+    13b7:	89 3c 24             	mov    %edi,(%esp)
+    13ba:	e8 a4 fd ff ff       	call   1163 <write>
+        putc(fd, c);
+    13bf:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+    13c3:	ba 01 00 00 00       	mov    $0x1,%edx
+    13c8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+    13cb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+    13cf:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+    13d1:	89 54 24 08          	mov    %edx,0x8(%esp)
+    13d5:	89 3c 24             	mov    %edi,(%esp)
+    13d8:	e8 86 fd ff ff       	call   1163 <write>
+    13dd:	e9 76 ff ff ff       	jmp    1358 <printf+0x48>
+    13e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+    13e8:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    13eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    13f0:	8b 13                	mov    (%ebx),%edx
+    13f2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+    13f9:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    13fc:	89 f8                	mov    %edi,%eax
+    13fe:	e8 4d fe ff ff       	call   1250 <printint>
+        ap++;
+    1403:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+    1406:	31 db                	xor    %ebx,%ebx
+    1408:	e9 4b ff ff ff       	jmp    1358 <printf+0x48>
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1410:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1413:	8b 08                	mov    (%eax),%ecx
+        ap++;
+    1415:	83 c0 04             	add    $0x4,%eax
+    1418:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+    141b:	85 c9                	test   %ecx,%ecx
+    141d:	0f 84 cd 00 00 00    	je     14f0 <printf+0x1e0>
+        while(*s != 0){
+    1423:	0f b6 01             	movzbl (%ecx),%eax
+    1426:	84 c0                	test   %al,%al
+    1428:	0f 84 ce 00 00 00    	je     14fc <printf+0x1ec>
+    142e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    1431:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    1434:	89 ce                	mov    %ecx,%esi
+    1436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+    1440:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1443:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+    1448:	46                   	inc    %esi
+  write(fd, &c, 1);
+    1449:	89 44 24 08          	mov    %eax,0x8(%esp)
+    144d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+    1451:	89 3c 24             	mov    %edi,(%esp)
+    1454:	e8 0a fd ff ff       	call   1163 <write>
+        while(*s != 0){
+    1459:	0f b6 06             	movzbl (%esi),%eax
+    145c:	84 c0                	test   %al,%al
+    145e:	75 e0                	jne    1440 <printf+0x130>
+      state = 0;
+    1460:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1463:	31 db                	xor    %ebx,%ebx
+    1465:	e9 ee fe ff ff       	jmp    1358 <printf+0x48>
+    146a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1470:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    1473:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1478:	8b 13                	mov    (%ebx),%edx
+    147a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1481:	e9 73 ff ff ff       	jmp    13f9 <printf+0xe9>
+    1486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+    1490:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+    1493:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+    1498:	8b 10                	mov    (%eax),%edx
+    149a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    149d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+    14a1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    14a4:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+    14a8:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    14ab:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+    14af:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+    14b1:	89 3c 24             	mov    %edi,(%esp)
+    14b4:	e8 aa fc ff ff       	call   1163 <write>
+        ap++;
+    14b9:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+    14bd:	e9 96 fe ff ff       	jmp    1358 <printf+0x48>
+    14c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+    14c8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+    14cb:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    14ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+    14d3:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+    14d7:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+    14d9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+    14dd:	89 3c 24             	mov    %edi,(%esp)
+    14e0:	e8 7e fc ff ff       	call   1163 <write>
+    14e5:	e9 6e fe ff ff       	jmp    1358 <printf+0x48>
+    14ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    14f0:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+    14f2:	b9 08 19 00 00       	mov    $0x1908,%ecx
+    14f7:	e9 32 ff ff ff       	jmp    142e <printf+0x11e>
+      state = 0;
+    14fc:	31 db                	xor    %ebx,%ebx
+    14fe:	66 90                	xchg   %ax,%ax
+    1500:	e9 53 fe ff ff       	jmp    1358 <printf+0x48>
+    1505:	66 90                	xchg   %ax,%ax
+    1507:	66 90                	xchg   %ax,%ax
+    1509:	66 90                	xchg   %ax,%ax
+    150b:	66 90                	xchg   %ax,%ax
+    150d:	66 90                	xchg   %ax,%ax
+    150f:	90                   	nop
+
+00001510 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	83 ec 18             	sub    $0x18,%esp
+    1516:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+    1519:	89 c3                	mov    %eax,%ebx
+    151b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+    151e:	a1 e4 1f 00 00       	mov    0x1fe4,%eax
+    1523:	8b 15 e0 1f 00 00    	mov    0x1fe0,%edx
+    1529:	29 c2                	sub    %eax,%edx
+    152b:	39 da                	cmp    %ebx,%edx
+    152d:	72 19                	jb     1548 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+    152f:	01 c3                	add    %eax,%ebx
+    1531:	89 1d e4 1f 00 00    	mov    %ebx,0x1fe4
+  return p;
+}
+    1537:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+    153a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+    153d:	89 ec                	mov    %ebp,%esp
+    153f:	5d                   	pop    %ebp
+    1540:	c3                   	ret
+    1541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+    1548:	b8 00 00 01 00       	mov    $0x10000,%eax
+    154d:	39 c3                	cmp    %eax,%ebx
+    154f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+    1552:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+    1555:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+    1557:	e8 6f fc ff ff       	call   11cb <sbrk>
+    if(p == (char*)-1)
+    155c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+    155f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+    1561:	74 1d                	je     1580 <morecore+0x70>
+    if(p != arenaend)
+    1563:	39 05 e0 1f 00 00    	cmp    %eax,0x1fe0
+    1569:	74 0d                	je     1578 <morecore+0x68>
+    arenaend = p + grow;
+    156b:	01 f2                	add    %esi,%edx
+    156d:	89 15 e0 1f 00 00    	mov    %edx,0x1fe0
+    1573:	eb ba                	jmp    152f <morecore+0x1f>
+    1575:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+    1578:	a1 e4 1f 00 00       	mov    0x1fe4,%eax
+    157d:	eb ec                	jmp    156b <morecore+0x5b>
+    157f:	90                   	nop
+      return 0;
+    1580:	31 c0                	xor    %eax,%eax
+    1582:	eb b3                	jmp    1537 <morecore+0x27>
+    1584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    158f:	90                   	nop
+
+00001590 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+    1590:	55                   	push   %ebp
+    1591:	89 e5                	mov    %esp,%ebp
+    1593:	83 ec 0c             	sub    $0xc,%esp
+    1596:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+    1599:	8b 45 08             	mov    0x8(%ebp),%eax
+    159c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+    159f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+    15a2:	85 c0                	test   %eax,%eax
+    15a4:	74 1e                	je     15c4 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+    15a6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+    15a9:	83 fa 08             	cmp    $0x8,%edx
+    15ac:	77 16                	ja     15c4 <free+0x34>
+  h = (Header*)ap - 1;
+    15ae:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+    15b1:	74 25                	je     15d8 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+    15b3:	8b 3c 95 00 20 00 00 	mov    0x2000(,%edx,4),%edi
+    15ba:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+    15bd:	89 0c 95 00 20 00 00 	mov    %ecx,0x2000(,%edx,4)
+}
+    15c4:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    15c7:	8b 75 f8             	mov    -0x8(%ebp),%esi
+    15ca:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    15cd:	89 ec                	mov    %ebp,%esp
+    15cf:	5d                   	pop    %ebp
+    15d0:	c3                   	ret
+    15d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+    15d8:	8b 15 20 20 00 00    	mov    0x2020,%edx
+    15de:	85 d2                	test   %edx,%edx
+    15e0:	74 54                	je     1636 <free+0xa6>
+    15e2:	39 ca                	cmp    %ecx,%edx
+    15e4:	73 36                	jae    161c <free+0x8c>
+    15e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ed:	8d 76 00             	lea    0x0(%esi),%esi
+    15f0:	89 d3                	mov    %edx,%ebx
+    15f2:	8b 12                	mov    (%edx),%edx
+    15f4:	85 d2                	test   %edx,%edx
+    15f6:	74 12                	je     160a <free+0x7a>
+    15f8:	39 ca                	cmp    %ecx,%edx
+    15fa:	72 f4                	jb     15f0 <free+0x60>
+  if(p && END(h) == p){
+    15fc:	85 d2                	test   %edx,%edx
+    15fe:	74 0a                	je     160a <free+0x7a>
+    1600:	8b 70 fc             	mov    -0x4(%eax),%esi
+    1603:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+    1606:	39 fa                	cmp    %edi,%edx
+    1608:	74 4b                	je     1655 <free+0xc5>
+  h->s.u.next = p;
+    160a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+    160d:	8b 53 04             	mov    0x4(%ebx),%edx
+    1610:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+    1614:	39 f1                	cmp    %esi,%ecx
+    1616:	74 29                	je     1641 <free+0xb1>
+    prev->s.u.next = h;
+    1618:	89 0b                	mov    %ecx,(%ebx)
+    161a:	eb a8                	jmp    15c4 <free+0x34>
+  if(p && END(h) == p){
+    161c:	85 d2                	test   %edx,%edx
+    161e:	74 16                	je     1636 <free+0xa6>
+    1620:	8b 58 fc             	mov    -0x4(%eax),%ebx
+    1623:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+    1626:	39 f2                	cmp    %esi,%edx
+    1628:	75 0c                	jne    1636 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+    162a:	8b 72 04             	mov    0x4(%edx),%esi
+    162d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+    1631:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+    1634:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+    1636:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+    1639:	89 0d 20 20 00 00    	mov    %ecx,0x2020
+    163f:	eb 83                	jmp    15c4 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+    1641:	8b 48 fc             	mov    -0x4(%eax),%ecx
+    1644:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+    1648:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+    164b:	8b 40 f8             	mov    -0x8(%eax),%eax
+    164e:	89 03                	mov    %eax,(%ebx)
+    1650:	e9 6f ff ff ff       	jmp    15c4 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+    1655:	8b 7a 04             	mov    0x4(%edx),%edi
+    1658:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+    165c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+    165f:	8b 12                	mov    (%edx),%edx
+    1661:	eb a7                	jmp    160a <free+0x7a>
+    1663:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001670 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	56                   	push   %esi
+    1675:	53                   	push   %ebx
+    1676:	83 ec 2c             	sub    $0x2c,%esp
+    1679:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+    167c:	83 f8 10             	cmp    $0x10,%eax
+    167f:	0f 86 52 01 00 00    	jbe    17d7 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+    1685:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+    1687:	ba 01 00 00 00       	mov    $0x1,%edx
+    168c:	eb 0d                	jmp    169b <malloc+0x2b>
+    168e:	66 90                	xchg   %ax,%ax
+    1690:	83 c1 05             	add    $0x5,%ecx
+    1693:	89 d6                	mov    %edx,%esi
+    1695:	d3 e6                	shl    %cl,%esi
+    1697:	39 c6                	cmp    %eax,%esi
+    1699:	73 55                	jae    16f0 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+    169b:	89 d9                	mov    %ebx,%ecx
+    169d:	43                   	inc    %ebx
+    169e:	83 fb 08             	cmp    $0x8,%ebx
+    16a1:	75 ed                	jne    1690 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+    16a3:	8d 58 07             	lea    0x7(%eax),%ebx
+    16a6:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+    16a9:	39 c3                	cmp    %eax,%ebx
+    16ab:	0f 82 1f 01 00 00    	jb     17d0 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+    16b1:	a1 20 20 00 00       	mov    0x2020,%eax
+    16b6:	85 c0                	test   %eax,%eax
+    16b8:	0f 84 ee 00 00 00    	je     17ac <malloc+0x13c>
+    16be:	b9 20 20 00 00       	mov    $0x2020,%ecx
+    h = *pp;
+    if(h->s.size < size)
+    16c3:	8b 50 04             	mov    0x4(%eax),%edx
+    16c6:	39 da                	cmp    %ebx,%edx
+    16c8:	0f 82 d2 00 00 00    	jb     17a0 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+    16ce:	29 da                	sub    %ebx,%edx
+    16d0:	83 fa 17             	cmp    $0x17,%edx
+    16d3:	0f 87 b7 00 00 00    	ja     1790 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+    16d9:	8b 10                	mov    (%eax),%edx
+    16db:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+    16dd:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+    16e3:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+    16e6:	83 c0 08             	add    $0x8,%eax
+}
+    16e9:	5b                   	pop    %ebx
+    16ea:	5e                   	pop    %esi
+    16eb:	5f                   	pop    %edi
+    16ec:	5d                   	pop    %ebp
+    16ed:	c3                   	ret
+    16ee:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+    16f0:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+    16f2:	8b 04 9d 00 20 00 00 	mov    0x2000(,%ebx,4),%eax
+    16f9:	85 c0                	test   %eax,%eax
+    16fb:	74 23                	je     1720 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+    16fd:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+    16ff:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+    1702:	89 14 9d 00 20 00 00 	mov    %edx,0x2000(,%ebx,4)
+    h->s.u.cls = cls;
+    1709:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+    170c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+    170f:	83 c4 2c             	add    $0x2c,%esp
+    1712:	5b                   	pop    %ebx
+    1713:	5e                   	pop    %esi
+    1714:	5f                   	pop    %edi
+    1715:	5d                   	pop    %ebp
+    1716:	c3                   	ret
+    1717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+    1720:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+    1723:	31 d2                	xor    %edx,%edx
+    1725:	b8 00 10 00 00       	mov    $0x1000,%eax
+    172a:	f7 f6                	div    %esi
+    172c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+    172f:	0f af c6             	imul   %esi,%eax
+    1732:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1735:	e8 d6 fd ff ff       	call   1510 <morecore>
+    173a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    173d:	85 c0                	test   %eax,%eax
+    173f:	0f 84 8b 00 00 00    	je     17d0 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+    1745:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+    1748:	8b 0c 9d 00 20 00 00 	mov    0x2000(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+    174f:	31 d2                	xor    %edx,%edx
+    1751:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+    1754:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1757:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    175a:	eb 06                	jmp    1762 <malloc+0xf2>
+    175c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+    1760:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+    1762:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+    1764:	42                   	inc    %edx
+    1765:	89 c1                	mov    %eax,%ecx
+    1767:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+    176a:	39 d7                	cmp    %edx,%edi
+    176c:	75 f2                	jne    1760 <malloc+0xf0>
+    176e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+    1771:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1774:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1777:	89 04 9d 00 20 00 00 	mov    %eax,0x2000(,%ebx,4)
+    177e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1781:	29 f0                	sub    %esi,%eax
+    1783:	01 c2                	add    %eax,%edx
+    1785:	89 d0                	mov    %edx,%eax
+    1787:	e9 71 ff ff ff       	jmp    16fd <malloc+0x8d>
+    178c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+    1790:	8d 4a f8             	lea    -0x8(%edx),%ecx
+    1793:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+    1796:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+    1798:	89 58 04             	mov    %ebx,0x4(%eax)
+    179b:	e9 3d ff ff ff       	jmp    16dd <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+    17a0:	89 c1                	mov    %eax,%ecx
+    17a2:	8b 00                	mov    (%eax),%eax
+    17a4:	85 c0                	test   %eax,%eax
+    17a6:	0f 85 17 ff ff ff    	jne    16c3 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+    17ac:	83 fb f8             	cmp    $0xfffffff8,%ebx
+    17af:	74 1f                	je     17d0 <malloc+0x160>
+    17b1:	8d 43 08             	lea    0x8(%ebx),%eax
+    17b4:	e8 57 fd ff ff       	call   1510 <morecore>
+    17b9:	85 c0                	test   %eax,%eax
+    17bb:	74 13                	je     17d0 <malloc+0x160>
+  h->s.u.cls = LARGE;
+    17bd:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+    17c3:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+    17c6:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+    17c9:	e9 41 ff ff ff       	jmp    170f <malloc+0x9f>
+    17ce:	66 90                	xchg   %ax,%ax
+      return 0;
+    17d0:	31 c0                	xor    %eax,%eax
+    17d2:	e9 38 ff ff ff       	jmp    170f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+    17d7:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+    17dc:	31 db                	xor    %ebx,%ebx
+    17de:	e9 0f ff ff ff       	jmp    16f2 <malloc+0x82>
@@ -0,0 +1,191 @@
+// System V style shared memory segments.
+//
+// shmget() finds or creates a segment of physical pages by key,
+// shmat() maps all of them into the calling process as a vma,
+// and shmdt() unmaps it again. The same physical pages appear in
+// every attached process, so data written by one is immediately
+// visible to the others without copying.
+//
+// Segment pages are reference counted like any other page (see
+// kalloc.c): the segment holds one reference and every mapping
+// of a page holds another. A segment is freed when its last
+// attachment goes away, by shmdt(), exit() or exec(), or by
+// shmctl(IPC_RMID) if it has none, e.g. was never attached. A
+// removed segment that is still attached can no longer be found
+// or attached, and is freed when its last attachment goes.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "mman.h"
+
+struct shmseg {
+  int used;
+  int removed;                 // shmctl(IPC_RMID) was called
+  int key;                     // IPC_PRIVATE segments can't be found by key
+  int nattach;                 // Number of vmas mapping the segment
+  int npages;
+  char *pages[SHMMAXPAGES];
+};
+
+struct {
+  struct spinlock lock;
+  struct shmseg seg[NSHM];
+} shmtable;
+
+void
+shminit(void)
+{
+  initlock(&shmtable.lock, "shm");
+}
+
+// Free the pages of segment s. Caller must hold shmtable.lock.
+static void
+shmfree(struct shmseg *s)
+{
+  int i;
+
+  for(i = 0; i < s->npages; i++)
+    kfree(s->pages[i]);
+  s->npages = 0;
+  s->used = 0;
+}
+
+// Return the id of the segment with the given key, creating a
+// zero-filled segment of size bytes if there is none (or if key
+// is IPC_PRIVATE). Returns -1 if an existing segment is smaller
+// than size, or if no segment or memory is available.
+int
+shmget(int key, uint size)
+{
+  struct shmseg *s;
+  uint npages;
+
+  npages = PGROUNDUP(size) / PGSIZE;
+  if(size == 0 || npages > SHMMAXPAGES)
+    return -1;
+
+  acquire(&shmtable.lock);
+  if(key != IPC_PRIVATE){
+    for(s = shmtable.seg; s < &shmtable.seg[NSHM]; s++){
+      if(s->used && !s->removed && s->key == key){
+        release(&shmtable.lock);
+        if(npages > s->npages)
+          return -1;
+        return s - shmtable.seg;
+      }
+    }
+  }
+  for(s = shmtable.seg; s < &shmtable.seg[NSHM]; s++)
+    if(!s->used)
+      break;
+  if(s == &shmtable.seg[NSHM]){
+    release(&shmtable.lock);
+    return -1;
+  }
+  s->used = 1;
+  s->removed = 0;
+  s->key = key;
+  s->nattach = 0;
+  for(s->npages = 0; s->npages < npages; s->npages++){
+    if((s->pages[s->npages] = kzalloc()) == 0){
+      shmfree(s);
+      release(&shmtable.lock);
+      return -1;
+    }
+  }
+  release(&shmtable.lock);
+  return s - shmtable.seg;
+}
+
+// Record another mapping of segment id, e.g. by fork().
+void
+shmdup(int id)
+{
+  acquire(&shmtable.lock);
+  shmtable.seg[id].nattach++;
+  release(&shmtable.lock);
+}
+
+// Drop a mapping of segment id, freeing it after the last one.
+void
+shmput(int id)
+{
+  struct shmseg *s = &shmtable.seg[id];
+
+  acquire(&shmtable.lock);
+  if(--s->nattach == 0)
+    shmfree(s);
+  release(&shmtable.lock);
+}
+
+// Map segment id into the current process.
+// Returns its address, or -1 on failure.
+int
+shmat(int id)
+{
+  struct shmseg *s;
+  uint addr, len;
+
+  if(id < 0 || id >= NSHM)
+    return -1;
+  s = &shmtable.seg[id];
+  acquire(&shmtable.lock);
+  if(!s->used || s->removed){
+    release(&shmtable.lock);
+    return -1;
+  }
+  s->nattach++;
+  len = s->npages * PGSIZE;
+  release(&shmtable.lock);
+
+  // The vma now owns the attachment taken above.
+  if((addr = mmap(0, id, 0, len, PTE_W|PTE_U, MAP_SHARED|VMA_SHM)) == 0){
+    shmput(id);
+    return -1;
+  }
+  if(mapshared(myproc()->pgdir, addr, s->pages, s->npages, PTE_W|PTE_U) < 0){
+    munmap(addr, len);
+    return -1;
+  }
+  return addr;
+}
+
+// Unmap the segment attached at addr from the current process.
+int
+shmdt(uint addr)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->end && (v->flags & VMA_SHM) && v->start == addr)
+      return munmap(v->start, v->end - v->start);
+  return -1;
+}
+
+// Control segment id. The only command is IPC_RMID: remove the
+// segment now if nothing has it attached, else once nothing does.
+int
+shmctl(int id, int cmd)
+{
+  struct shmseg *s;
+
+  if(id < 0 || id >= NSHM || cmd != IPC_RMID)
+    return -1;
+  s = &shmtable.seg[id];
+  acquire(&shmtable.lock);
+  if(!s->used || s->removed){
+    release(&shmtable.lock);
+    return -1;
+  }
+  s->removed = 1;
+  if(s->nattach == 0)
+    shmfree(s);
+  release(&shmtable.lock);
+  return 0;
+}
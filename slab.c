@@ -0,0 +1,252 @@
+// Slab allocator for fixed-size kernel objects.
+//
+// A slab cache hands out objects of one size, carved from
+// single-page slabs obtained from kalloc(). Each slab starts with
+// a struct slab header holding a stack of the indices of its free
+// objects, so free objects are never written to: an object handed
+// back to the cache stays in its constructed state, and the
+// constructor only runs when a slab is first created.
+//
+// Each CPU keeps a few free objects per cache, so most
+// slaballoc()/slabfree() calls don't take the cache's lock;
+// they move SLABBATCH objects at a time to and from the slabs.
+// A cache keeps at most one completely free slab; other empty
+// slabs are returned to kalloc. slabreclaim() gives back that
+// one too, for callers that need whole pages.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define NSLABCACHE  16            // maximum number of slab caches
+#define SLABCPU     8             // free objects cached per CPU
+#define SLABBATCH   (SLABCPU/2)
+
+struct slab {
+  struct slab *next;              // On the cache's partial list
+  struct slab *prev;
+  struct slabcache *cache;
+  char *objs;                     // First object
+  int nfree;                      // Number of entries in free[]
+  ushort free[];                  // Indices of free objects
+};
+
+struct objcache {
+  int n;
+  void *objs[SLABCPU];
+};
+
+struct slabcache {
+  struct spinlock lock;
+  char *name;
+  uint size;                      // Object size, rounded up
+  uint perslab;                   // Objects per slab
+  uint objoff;                    // Offset of the first object in a slab
+  void (*ctor)(void*);            // Constructor, or 0
+  struct slab partial;            // Slabs with free objects (circular list)
+  int nslab;                      // Slabs owned by the cache
+  int nempty;                     // Completely free slabs on partial
+  struct objcache cpu[NCPU];
+};
+
+struct {
+  struct spinlock lock;
+  int n;
+  struct slabcache cache[NSLABCACHE];
+} slabs;
+
+void
+slabinit(void)
+{
+  initlock(&slabs.lock, "slabs");
+}
+
+// Create a cache of objects of the given size. If ctor is not 0,
+// it is applied to every object once, when its slab is created.
+// The name is also the lock class for lockstat.
+struct slabcache*
+slabcreate(char *name, uint size, void (*ctor)(void*))
+{
+  struct slabcache *c;
+
+  size = (size + 7) & ~7;
+  acquire(&slabs.lock);
+  if(slabs.n == NSLABCACHE)
+    panic("slabcreate: too many caches");
+  c = &slabs.cache[slabs.n++];
+  release(&slabs.lock);
+
+  memset(c, 0, sizeof(*c));
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = size;
+  c->ctor = ctor;
+  c->perslab = (PGSIZE - sizeof(struct slab)) / (size + sizeof(ushort));
+  for(;;){
+    c->objoff = (sizeof(struct slab) + c->perslab*sizeof(ushort) + 7) & ~7;
+    if(c->perslab == 0 || c->objoff + c->perslab*size <= PGSIZE)
+      break;
+    c->perslab--;
+  }
+  if(c->perslab == 0)
+    panic("slabcreate: object too big");
+  c->partial.next = c->partial.prev = &c->partial;
+  return c;
+}
+
+static void
+slabunlink(struct slab *s)
+{
+  s->prev->next = s->next;
+  s->next->prev = s->prev;
+}
+
+static void
+slabpush(struct slabcache *c, struct slab *s)
+{
+  s->next = c->partial.next;
+  s->prev = &c->partial;
+  c->partial.next->prev = s;
+  c->partial.next = s;
+}
+
+// Allocate and construct a new slab for c.
+// Caller must hold c->lock.
+static struct slab*
+slabgrow(struct slabcache *c)
+{
+  struct slab *s;
+  uint i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->objs = (char*)s + c->objoff;
+  s->nfree = c->perslab;
+  for(i = 0; i < c->perslab; i++){
+    s->free[i] = c->perslab - 1 - i;
+    if(c->ctor)
+      c->ctor(s->objs + i*c->size);
+  }
+  c->nslab++;
+  c->nempty++;
+  slabpush(c, s);
+  return s;
+}
+
+// Take one object from the slabs of c.
+// Caller must hold c->lock.
+static void*
+slabget(struct slabcache *c)
+{
+  struct slab *s;
+
+  s = c->partial.next;
+  if(s == &c->partial && (s = slabgrow(c)) == 0)
+    return 0;
+  if(s->nfree == c->perslab)
+    c->nempty--;
+  if(--s->nfree == 0)
+    slabunlink(s);
+  return s->objs + s->free[s->nfree]*c->size;
+}
+
+// Return obj to its slab.
+// Caller must hold c->lock.
+static void
+slabput(struct slabcache *c, void *obj)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)obj);
+  if(s->cache != c)
+    panic("slabfree: wrong cache");
+  if(s->nfree == 0)
+    slabpush(c, s);
+  s->free[s->nfree++] = ((char*)obj - s->objs) / c->size;
+  if(s->nfree < c->perslab)
+    return;
+  if(c->nempty == 0){
+    c->nempty++;
+    return;
+  }
+  slabunlink(s);
+  c->nslab--;
+  kfree((char*)s);
+}
+
+// Allocate a constructed object from c.
+// Returns 0 if memory is exhausted.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct objcache *oc;
+  void *obj;
+
+  pushcli();
+  oc = &c->cpu[cpuid()];
+  if(oc->n == 0){
+    acquire(&c->lock);
+    while(oc->n < SLABBATCH && (obj = slabget(c)) != 0)
+      oc->objs[oc->n++] = obj;
+    release(&c->lock);
+  }
+  obj = 0;
+  if(oc->n > 0)
+    obj = oc->objs[--oc->n];
+  popcli();
+  return obj;
+}
+
+// Give obj, allocated from c, back to c. It must be
+// in its constructed state again.
+void
+slabfree(struct slabcache *c, void *obj)
+{
+  struct objcache *oc;
+
+  pushcli();
+  oc = &c->cpu[cpuid()];
+  if(oc->n == SLABCPU){
+    acquire(&c->lock);
+    while(oc->n > SLABCPU - SLABBATCH)
+      slabput(c, oc->objs[--oc->n]);
+    release(&c->lock);
+  }
+  oc->objs[oc->n++] = obj;
+  popcli();
+}
+
+// Give c's completely free slabs back to kalloc, after first
+// returning this CPU's cached objects to their slabs.
+// Returns the number of pages freed.
+int
+slabreclaim(struct slabcache *c)
+{
+  struct objcache *oc;
+  struct slab *s, *next;
+  int n;
+
+  pushcli();
+  oc = &c->cpu[cpuid()];
+  acquire(&c->lock);
+  n = c->nslab;
+  while(oc->n > 0)
+    slabput(c, oc->objs[--oc->n]);
+  // Including the one empty slab slabput() keeps.
+  for(s = c->partial.next; s != &c->partial; s = next){
+    next = s->next;
+    if(s->nfree == c->perslab){
+      slabunlink(s);
+      c->nslab--;
+      c->nempty--;
+      kfree((char*)s);
+    }
+  }
+  n -= c->nslab;
+  release(&c->lock);
+  popcli();
+  return n;
+}
@@ -9,12 +9,57 @@
 #include "proc.h"
 #include "spinlock.h"
 
+#define NLOCKSTAT 32
+
+// Per-class contention statistics. Locks are grouped by name, so
+// e.g. every pipe lock adds to the single "pipe" entry. The last
+// entry collects whatever does not fit.
+static struct lockstat lockstats[NLOCKSTAT];
+
+struct lockcount {
+  uint nacquire;             // Number of acquisitions.
+  uint ncontended;           // Acquisitions that had to wait.
+  unsigned long long spin;   // TSC cycles spent waiting.
+};
+
+// The counts are kept per CPU and summed by lockdump(), so that
+// counting doesn't make CPUs that take different locks of one
+// class share a cache line.
+static struct lockcount lockcounts[NCPU][NLOCKSTAT];
+static uint nlockstat;
+static uint lockstatguard;
+
+static struct lockstat*
+lockstatlookup(char *name)
+{
+  struct lockstat *ls;
+
+  // initlock() may run before mycpu() works, so the table is
+  // guarded by a bare xchg rather than by a spinlock.
+  while(xchg(&lockstatguard, 1) != 0)
+    ;
+  for(ls = lockstats; ls < &lockstats[nlockstat]; ls++)
+    if(strncmp(ls->name, name, 16) == 0)
+      goto found;
+  if(nlockstat < NLOCKSTAT)
+    nlockstat++;
+  ls = &lockstats[nlockstat-1];
+  if(ls->name == 0)
+    ls->name = nlockstat < NLOCKSTAT ? name : "other";
+
+found:
+  xchg(&lockstatguard, 0);
+  return ls;
+}
+
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->stat = lockstatlookup(name);
 }
 
 // Acquire the lock.
@@ -24,13 +69,29 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket;
+  unsigned long long t0;
+  struct lockcount *c;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // Interrupts are off, so this CPU's counts can't be touched
+  // by anyone else and need no atomic updates.
+  c = &lockcounts[cpuid()][lk->stat - lockstats];
+
+  // The fetch-and-add is atomic, so every CPU gets a distinct
+  // ticket and the lock is handed out in ticket order.
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+  if(lk->owner != ticket){
+    t0 = rdtsc();
+    while(lk->owner != ticket)
+      pause();
+    c->ncontended++;
+    c->spin += rdtsc() - t0;
+  }
+  c->nacquire++;
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -59,10 +120,10 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Serve the next ticket, equivalent to lk->owner++.
+  // Only the holder writes owner, so no lock prefix is needed,
+  // but the increment must still be a single store.
+  asm volatile("incl %0" : "+m" (lk->owner) : );
 
   popcli();
 }
@@ -91,11 +152,42 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->owner != lock->next && lock->cpu == mycpu();
   popcli();
   return r;
 }
 
+// Print lock contention statistics to the console.
+// Runs when user types ^L on console, or via the lockstat
+// system call. Spin time is in units of 1024 TSC cycles.
+// If reset is set, the counters are cleared afterwards.
+void
+lockdump(int reset)
+{
+  struct lockcount sum, *c;
+  int i, n;
+
+  cprintf("name acquire contended spin(Kcyc)\n");
+  for(i = 0; i < nlockstat; i++){
+    sum.nacquire = sum.ncontended = 0;
+    sum.spin = 0;
+    for(n = 0; n < NCPU; n++){
+      c = &lockcounts[n][i];
+      sum.nacquire += c->nacquire;
+      sum.ncontended += c->ncontended;
+      sum.spin += c->spin;
+      if(reset){
+        c->nacquire = 0;
+        c->ncontended = 0;
+        c->spin = 0;
+      }
+    }
+    if(sum.nacquire == 0)
+      continue;
+    cprintf("%s %d %d %d\n", lockstats[i].name, sum.nacquire,
+            sum.ncontended, (uint)(sum.spin >> 10));
+  }
+}
 
 // Pushcli/popcli are like cli/sti except that they are matched:
 // it takes two popcli to undo two pushcli.  Also, if interrupts
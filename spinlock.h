@@ -1,11 +1,23 @@
+#pragma once
+
+// A lock class for contention statistics: all locks with the
+// same name. The counts are kept per CPU, in spinlock.c.
+struct lockstat {
+  char *name;                // Name of the lock class.
+};
+
 // Mutual exclusion lock.
+// A ticket lock: acquire() takes the next ticket and waits
+// until owner reaches it, so waiters are served in FIFO order.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;         // Next ticket to hand out.
+  uint owner;        // Ticket now holding the lock.
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+  struct lockstat *stat; // Contention statistics for this lock's class.
 };
 
@@ -0,0 +1,1465 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+  int fd, i;
+  char path[] = "stressfs0";
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+   1:	ba 24 0a 00 00       	mov    $0xa24,%edx
+{
+   6:	89 e5                	mov    %esp,%ebp
+  char path[] = "stressfs0";
+   8:	b8 73 74 72 65       	mov    $0x65727473,%eax
+{
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  memset(data, 'a', sizeof(data));
+  10:	bb 61 00 00 00       	mov    $0x61,%ebx
+{
+  15:	83 e4 f0             	and    $0xfffffff0,%esp
+  18:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  1e:	89 44 24 16          	mov    %eax,0x16(%esp)
+  memset(data, 'a', sizeof(data));
+  22:	8d 74 24 20          	lea    0x20(%esp),%esi
+  char path[] = "stressfs0";
+  26:	b8 73 73 66 73       	mov    $0x73667373,%eax
+  printf(1, "stressfs starting\n");
+  2b:	89 54 24 04          	mov    %edx,0x4(%esp)
+  2f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  char path[] = "stressfs0";
+  36:	89 44 24 1a          	mov    %eax,0x1a(%esp)
+  3a:	66 c7 44 24 1e 30 00 	movw   $0x30,0x1e(%esp)
+  printf(1, "stressfs starting\n");
+  41:	e8 0a 05 00 00       	call   550 <printf>
+  memset(data, 'a', sizeof(data));
+  46:	b9 00 02 00 00       	mov    $0x200,%ecx
+  4b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+
+  for(i = 0; i < 4; i++)
+  4f:	31 db                	xor    %ebx,%ebx
+  memset(data, 'a', sizeof(data));
+  51:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  55:	89 34 24             	mov    %esi,(%esp)
+  58:	e8 93 01 00 00       	call   1f0 <memset>
+    if(fork() > 0)
+  5d:	e8 19 03 00 00       	call   37b <fork>
+  62:	85 c0                	test   %eax,%eax
+  64:	7f 06                	jg     6c <main+0x6c>
+  for(i = 0; i < 4; i++)
+  66:	43                   	inc    %ebx
+  67:	83 fb 04             	cmp    $0x4,%ebx
+  6a:	75 f1                	jne    5d <main+0x5d>
+      break;
+
+  printf(1, "write %d\n", i);
+  6c:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  70:	b8 37 0a 00 00       	mov    $0xa37,%eax
+  75:	89 44 24 04          	mov    %eax,0x4(%esp)
+  79:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80:	e8 cb 04 00 00       	call   550 <printf>
+
+  path[8] += i;
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	b8 02 02 00 00       	mov    $0x202,%eax
+  8a:	89 44 24 04          	mov    %eax,0x4(%esp)
+  8e:	8d 44 24 16          	lea    0x16(%esp),%eax
+  92:	89 04 24             	mov    %eax,(%esp)
+  path[8] += i;
+  95:	00 5c 24 1e          	add    %bl,0x1e(%esp)
+  fd = open(path, O_CREATE | O_RDWR);
+  99:	bb 14 00 00 00       	mov    $0x14,%ebx
+  9e:	e8 20 03 00 00       	call   3c3 <open>
+  a3:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  b4:	b8 00 02 00 00       	mov    $0x200,%eax
+  b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  bd:	89 3c 24             	mov    %edi,(%esp)
+  c0:	e8 de 02 00 00       	call   3a3 <write>
+  for(i = 0; i < 20; i++)
+  c5:	4b                   	dec    %ebx
+  c6:	75 e8                	jne    b0 <main+0xb0>
+  close(fd);
+  c8:	89 3c 24             	mov    %edi,(%esp)
+
+  printf(1, "read\n");
+
+  fd = open(path, O_RDONLY);
+  cb:	bb 14 00 00 00       	mov    $0x14,%ebx
+  close(fd);
+  d0:	e8 d6 02 00 00       	call   3ab <close>
+  printf(1, "read\n");
+  d5:	ba 41 0a 00 00       	mov    $0xa41,%edx
+  da:	89 54 24 04          	mov    %edx,0x4(%esp)
+  de:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  e5:	e8 66 04 00 00       	call   550 <printf>
+  fd = open(path, O_RDONLY);
+  ea:	8d 44 24 16          	lea    0x16(%esp),%eax
+  ee:	31 c9                	xor    %ecx,%ecx
+  f0:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  f4:	89 04 24             	mov    %eax,(%esp)
+  f7:	e8 c7 02 00 00       	call   3c3 <open>
+  fc:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+  fe:	66 90                	xchg   %ax,%ax
+    read(fd, data, sizeof(data));
+ 100:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 104:	b8 00 02 00 00       	mov    $0x200,%eax
+ 109:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 10d:	89 3c 24             	mov    %edi,(%esp)
+ 110:	e8 86 02 00 00       	call   39b <read>
+  for (i = 0; i < 20; i++)
+ 115:	4b                   	dec    %ebx
+ 116:	75 e8                	jne    100 <main+0x100>
+  close(fd);
+ 118:	89 3c 24             	mov    %edi,(%esp)
+ 11b:	e8 8b 02 00 00       	call   3ab <close>
+
+  wait(0);
+ 120:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 127:	e8 5f 02 00 00       	call   38b <wait>
+
+  exit(0);
+ 12c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 133:	e8 4b 02 00 00       	call   383 <exit>
+ 138:	66 90                	xchg   %ax,%ax
+ 13a:	66 90                	xchg   %ax,%ax
+ 13c:	66 90                	xchg   %ax,%ax
+ 13e:	66 90                	xchg   %ax,%ax
+
+00000140 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 140:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 141:	31 c0                	xor    %eax,%eax
+{
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	53                   	push   %ebx
+ 146:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 150:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 154:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 157:	40                   	inc    %eax
+ 158:	84 d2                	test   %dl,%dl
+ 15a:	75 f4                	jne    150 <strcpy+0x10>
+    ;
+  return os;
+}
+ 15c:	5b                   	pop    %ebx
+ 15d:	89 c8                	mov    %ecx,%eax
+ 15f:	5d                   	pop    %ebp
+ 160:	c3                   	ret
+ 161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+ 177:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 17a:	0f b6 02             	movzbl (%edx),%eax
+ 17d:	84 c0                	test   %al,%al
+ 17f:	75 15                	jne    196 <strcmp+0x26>
+ 181:	eb 30                	jmp    1b3 <strcmp+0x43>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 18c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 18f:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 190:	84 c0                	test   %al,%al
+ 192:	74 14                	je     1a8 <strcmp+0x38>
+    p++, q++;
+ 194:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 196:	0f b6 0b             	movzbl (%ebx),%ecx
+ 199:	38 c1                	cmp    %al,%cl
+ 19b:	74 eb                	je     188 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 19d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 19e:	29 c8                	sub    %ecx,%eax
+}
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1a8:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 1ac:	31 c0                	xor    %eax,%eax
+}
+ 1ae:	5b                   	pop    %ebx
+ 1af:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 1b0:	29 c8                	sub    %ecx,%eax
+}
+ 1b2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1b3:	0f b6 0b             	movzbl (%ebx),%ecx
+ 1b6:	31 c0                	xor    %eax,%eax
+ 1b8:	eb e3                	jmp    19d <strcmp+0x2d>
+ 1ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1c9:	74 15                	je     1e0 <strlen+0x20>
+ 1cb:	31 c0                	xor    %eax,%eax
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	40                   	inc    %eax
+ 1d1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1d5:	89 c1                	mov    %eax,%ecx
+ 1d7:	75 f7                	jne    1d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1d9:	5d                   	pop    %ebp
+ 1da:	89 c8                	mov    %ecx,%eax
+ 1dc:	c3                   	ret
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1e0:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 1e1:	31 c9                	xor    %ecx,%ecx
+}
+ 1e3:	89 c8                	mov    %ecx,%eax
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	89 d7                	mov    %edx,%edi
+ 1ff:	fc                   	cld
+ 200:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 202:	5f                   	pop    %edi
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	5d                   	pop    %ebp
+ 206:	c3                   	ret
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 10                	jne    231 <strchr+0x21>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	40                   	inc    %eax
+ 22d:	84 d2                	test   %dl,%dl
+ 22f:	74 0f                	je     240 <strchr+0x30>
+    if(*s == c)
+ 231:	38 d1                	cmp    %dl,%cl
+ 233:	75 f3                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 235:	5d                   	pop    %ebp
+ 236:	c3                   	ret
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+ 240:	5d                   	pop    %ebp
+  return 0;
+ 241:	31 c0                	xor    %eax,%eax
+}
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 255:	31 f6                	xor    %esi,%esi
+{
+ 257:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 258:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 25b:	83 ec 3c             	sub    $0x3c,%esp
+ 25e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 261:	eb 32                	jmp    295 <gets+0x45>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+    cc = read(0, &c, 1);
+ 268:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 26c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 271:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 275:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 27c:	e8 1a 01 00 00       	call   39b <read>
+    if(cc < 1)
+ 281:	85 c0                	test   %eax,%eax
+ 283:	7e 19                	jle    29e <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 285:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 289:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 28d:	3c 0a                	cmp    $0xa,%al
+ 28f:	74 10                	je     2a1 <gets+0x51>
+ 291:	3c 0d                	cmp    $0xd,%al
+ 293:	74 0c                	je     2a1 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 295:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 298:	46                   	inc    %esi
+ 299:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 29c:	7c ca                	jl     268 <gets+0x18>
+ 29e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2a1:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 2a5:	83 c4 3c             	add    $0x3c,%esp
+ 2a8:	89 d8                	mov    %ebx,%eax
+ 2aa:	5b                   	pop    %ebx
+ 2ab:	5e                   	pop    %esi
+ 2ac:	5f                   	pop    %edi
+ 2ad:	5d                   	pop    %ebp
+ 2ae:	c3                   	ret
+ 2af:	90                   	nop
+
+000002b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2b0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b1:	31 c0                	xor    %eax,%eax
+{
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	83 ec 18             	sub    $0x18,%esp
+ 2b8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 2bb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 2be:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	89 04 24             	mov    %eax,(%esp)
+ 2c8:	e8 f6 00 00 00       	call   3c3 <open>
+  if(fd < 0)
+ 2cd:	85 c0                	test   %eax,%eax
+ 2cf:	78 2f                	js     300 <stat+0x50>
+ 2d1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d6:	89 1c 24             	mov    %ebx,(%esp)
+ 2d9:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 2dd:	e8 f9 00 00 00       	call   3db <fstat>
+  close(fd);
+ 2e2:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2e5:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2e7:	e8 bf 00 00 00       	call   3ab <close>
+  return r;
+}
+ 2ec:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 2ef:	89 f0                	mov    %esi,%eax
+ 2f1:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 2f4:	89 ec                	mov    %ebp,%esp
+ 2f6:	5d                   	pop    %ebp
+ 2f7:	c3                   	ret
+ 2f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+    return -1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 305:	eb e5                	jmp    2ec <stat+0x3c>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	88 c1                	mov    %al,%cl
+ 31c:	80 e9 30             	sub    $0x30,%cl
+ 31f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 322:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 327:	77 1c                	ja     345 <atoi+0x35>
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 330:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 333:	42                   	inc    %edx
+ 334:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 338:	0f be 02             	movsbl (%edx),%eax
+ 33b:	88 c3                	mov    %al,%bl
+ 33d:	80 eb 30             	sub    $0x30,%bl
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+}
+ 345:	5b                   	pop    %ebx
+ 346:	89 c8                	mov    %ecx,%eax
+ 348:	5d                   	pop    %ebp
+ 349:	c3                   	ret
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+
+0000037b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 37b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <exit>:
+SYSCALL(exit)
+ 383:	b8 02 00 00 00       	mov    $0x2,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <wait>:
+SYSCALL(wait)
+ 38b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <pipe>:
+SYSCALL(pipe)
+ 393:	b8 04 00 00 00       	mov    $0x4,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <read>:
+SYSCALL(read)
+ 39b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <write>:
+SYSCALL(write)
+ 3a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <close>:
+SYSCALL(close)
+ 3ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <kill>:
+SYSCALL(kill)
+ 3b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <exec>:
+SYSCALL(exec)
+ 3bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <open>:
+SYSCALL(open)
+ 3c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mknod>:
+SYSCALL(mknod)
+ 3cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <unlink>:
+SYSCALL(unlink)
+ 3d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <fstat>:
+SYSCALL(fstat)
+ 3db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <link>:
+SYSCALL(link)
+ 3e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mkdir>:
+SYSCALL(mkdir)
+ 3eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <chdir>:
+SYSCALL(chdir)
+ 3f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <dup>:
+SYSCALL(dup)
+ 3fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getpid>:
+SYSCALL(getpid)
+ 403:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <sbrk>:
+SYSCALL(sbrk)
+ 40b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <sleep>:
+SYSCALL(sleep)
+ 413:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <uptime>:
+SYSCALL(uptime)
+ 41b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <detach>:
+SYSCALL(detach)
+ 423:	b8 16 00 00 00       	mov    $0x16,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <policy>:
+SYSCALL(policy)
+ 42b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <priority>:
+SYSCALL(priority)
+ 433:	b8 18 00 00 00       	mov    $0x18,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <wait_stat>:
+SYSCALL(wait_stat)
+ 43b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <lockstat>:
+SYSCALL(lockstat)
+ 443:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mmap>:
+SYSCALL(mmap)
+ 44b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <munmap>:
+SYSCALL(munmap)
+ 453:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <shmget>:
+SYSCALL(shmget)
+ 45b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <shmat>:
+SYSCALL(shmat)
+ 463:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <shmdt>:
+SYSCALL(shmdt)
+ 46b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <memstat>:
+SYSCALL(memstat)
+ 473:	b8 20 00 00 00       	mov    $0x20,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <getprocs>:
+SYSCALL(getprocs)
+ 47b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <shmctl>:
+SYSCALL(shmctl)
+ 483:	b8 22 00 00 00       	mov    $0x22,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+ 48b:	66 90                	xchg   %ax,%ax
+ 48d:	66 90                	xchg   %ax,%ax
+ 48f:	90                   	nop
+
+00000490 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	89 cb                	mov    %ecx,%ebx
+ 498:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 49b:	89 d1                	mov    %edx,%ecx
+{
+ 49d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 4a0:	89 d0                	mov    %edx,%eax
+ 4a2:	c1 e8 1f             	shr    $0x1f,%eax
+ 4a5:	84 c0                	test   %al,%al
+ 4a7:	0f 84 93 00 00 00    	je     540 <printint+0xb0>
+ 4ad:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4b1:	0f 84 89 00 00 00    	je     540 <printint+0xb0>
+    x = -xx;
+ 4b7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4be:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 4c5:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 4c8:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	31 d2                	xor    %edx,%edx
+ 4d4:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 4d7:	f7 f3                	div    %ebx
+ 4d9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 4dc:	0f b6 92 a8 0a 00 00 	movzbl 0xaa8(%edx),%edx
+ 4e3:	8d 47 01             	lea    0x1(%edi),%eax
+ 4e6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4e9:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 4ed:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 4ef:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 4f2:	39 da                	cmp    %ebx,%edx
+ 4f4:	73 da                	jae    4d0 <printint+0x40>
+  if(neg)
+ 4f6:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 4f9:	85 c0                	test   %eax,%eax
+ 4fb:	74 0a                	je     507 <printint+0x77>
+    buf[i++] = '-';
+ 4fd:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 500:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 505:	89 c7                	mov    %eax,%edi
+ 507:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 50a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 50e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 510:	0f b6 07             	movzbl (%edi),%eax
+ 513:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 516:	b8 01 00 00 00       	mov    $0x1,%eax
+ 51b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 51f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 523:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 526:	89 04 24             	mov    %eax,(%esp)
+ 529:	e8 75 fe ff ff       	call   3a3 <write>
+  while(--i >= 0)
+ 52e:	89 f8                	mov    %edi,%eax
+ 530:	4f                   	dec    %edi
+ 531:	39 d8                	cmp    %ebx,%eax
+ 533:	75 db                	jne    510 <printint+0x80>
+}
+ 535:	83 c4 4c             	add    $0x4c,%esp
+ 538:	5b                   	pop    %ebx
+ 539:	5e                   	pop    %esi
+ 53a:	5f                   	pop    %edi
+ 53b:	5d                   	pop    %ebp
+ 53c:	c3                   	ret
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 540:	31 c0                	xor    %eax,%eax
+ 542:	e9 77 ff ff ff       	jmp    4be <printint+0x2e>
+ 547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 559:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 55c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 55f:	0f b6 1e             	movzbl (%esi),%ebx
+ 562:	84 db                	test   %bl,%bl
+ 564:	74 6f                	je     5d5 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 566:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 569:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 56b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 56e:	88 d9                	mov    %bl,%cl
+ 570:	46                   	inc    %esi
+ 571:	89 d3                	mov    %edx,%ebx
+ 573:	eb 2b                	jmp    5a0 <printf+0x50>
+ 575:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 578:	83 f8 25             	cmp    $0x25,%eax
+ 57b:	74 4b                	je     5c8 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 57d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 580:	b8 01 00 00 00       	mov    $0x1,%eax
+ 585:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 589:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 58c:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 590:	89 3c 24             	mov    %edi,(%esp)
+ 593:	e8 0b fe ff ff       	call   3a3 <write>
+  for(i = 0; fmt[i]; i++){
+ 598:	0f b6 0e             	movzbl (%esi),%ecx
+ 59b:	46                   	inc    %esi
+ 59c:	84 c9                	test   %cl,%cl
+ 59e:	74 35                	je     5d5 <printf+0x85>
+    if(state == 0){
+ 5a0:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 5a2:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 5a5:	74 d1                	je     578 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5a7:	83 fb 25             	cmp    $0x25,%ebx
+ 5aa:	75 ec                	jne    598 <printf+0x48>
+      if(c == 'd'){
+ 5ac:	83 f8 25             	cmp    $0x25,%eax
+ 5af:	0f 84 53 01 00 00    	je     708 <printf+0x1b8>
+ 5b5:	83 e8 63             	sub    $0x63,%eax
+ 5b8:	83 f8 15             	cmp    $0x15,%eax
+ 5bb:	77 23                	ja     5e0 <printf+0x90>
+ 5bd:	ff 24 85 50 0a 00 00 	jmp    *0xa50(,%eax,4)
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 5c8:	0f b6 0e             	movzbl (%esi),%ecx
+ 5cb:	46                   	inc    %esi
+        state = '%';
+ 5cc:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 5d1:	84 c9                	test   %cl,%cl
+ 5d3:	75 cb                	jne    5a0 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5d5:	83 c4 3c             	add    $0x3c,%esp
+ 5d8:	5b                   	pop    %ebx
+ 5d9:	5e                   	pop    %esi
+ 5da:	5f                   	pop    %edi
+ 5db:	5d                   	pop    %ebp
+ 5dc:	c3                   	ret
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5e0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 5e3:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5e6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5eb:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ef:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 5f3:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 5f7:	89 3c 24             	mov    %edi,(%esp)
+ 5fa:	e8 a4 fd ff ff       	call   3a3 <write>
+        putc(fd, c);
+ 5ff:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 603:	ba 01 00 00 00       	mov    $0x1,%edx
+ 608:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 60b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 60f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 611:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 615:	89 3c 24             	mov    %edi,(%esp)
+ 618:	e8 86 fd ff ff       	call   3a3 <write>
+ 61d:	e9 76 ff ff ff       	jmp    598 <printf+0x48>
+ 622:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 628:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 62b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 630:	8b 13                	mov    (%ebx),%edx
+ 632:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 639:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 63c:	89 f8                	mov    %edi,%eax
+ 63e:	e8 4d fe ff ff       	call   490 <printint>
+        ap++;
+ 643:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 646:	31 db                	xor    %ebx,%ebx
+ 648:	e9 4b ff ff ff       	jmp    598 <printf+0x48>
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 650:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 653:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 655:	83 c0 04             	add    $0x4,%eax
+ 658:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 65b:	85 c9                	test   %ecx,%ecx
+ 65d:	0f 84 cd 00 00 00    	je     730 <printf+0x1e0>
+        while(*s != 0){
+ 663:	0f b6 01             	movzbl (%ecx),%eax
+ 666:	84 c0                	test   %al,%al
+ 668:	0f 84 ce 00 00 00    	je     73c <printf+0x1ec>
+ 66e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 671:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 674:	89 ce                	mov    %ecx,%esi
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 680:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 683:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 688:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 689:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 68d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 691:	89 3c 24             	mov    %edi,(%esp)
+ 694:	e8 0a fd ff ff       	call   3a3 <write>
+        while(*s != 0){
+ 699:	0f b6 06             	movzbl (%esi),%eax
+ 69c:	84 c0                	test   %al,%al
+ 69e:	75 e0                	jne    680 <printf+0x130>
+      state = 0;
+ 6a0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6a3:	31 db                	xor    %ebx,%ebx
+ 6a5:	e9 ee fe ff ff       	jmp    598 <printf+0x48>
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6b0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 6b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6b8:	8b 13                	mov    (%ebx),%edx
+ 6ba:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 6c1:	e9 73 ff ff ff       	jmp    639 <printf+0xe9>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 6d0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 6d3:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 6d8:	8b 10                	mov    (%eax),%edx
+ 6da:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 6dd:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 6e1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6e4:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 6e8:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 6eb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 6ef:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 6f1:	89 3c 24             	mov    %edi,(%esp)
+ 6f4:	e8 aa fc ff ff       	call   3a3 <write>
+        ap++;
+ 6f9:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 6fd:	e9 96 fe ff ff       	jmp    598 <printf+0x48>
+ 702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 708:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 70b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 70e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 713:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 717:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 719:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 71d:	89 3c 24             	mov    %edi,(%esp)
+ 720:	e8 7e fc ff ff       	call   3a3 <write>
+ 725:	e9 6e fe ff ff       	jmp    598 <printf+0x48>
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 730:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 732:	b9 47 0a 00 00       	mov    $0xa47,%ecx
+ 737:	e9 32 ff ff ff       	jmp    66e <printf+0x11e>
+      state = 0;
+ 73c:	31 db                	xor    %ebx,%ebx
+ 73e:	66 90                	xchg   %ax,%ax
+ 740:	e9 53 fe ff ff       	jmp    598 <printf+0x48>
+ 745:	66 90                	xchg   %ax,%ax
+ 747:	66 90                	xchg   %ax,%ax
+ 749:	66 90                	xchg   %ax,%ax
+ 74b:	66 90                	xchg   %ax,%ax
+ 74d:	66 90                	xchg   %ax,%ax
+ 74f:	90                   	nop
+
+00000750 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	83 ec 18             	sub    $0x18,%esp
+ 756:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 759:	89 c3                	mov    %eax,%ebx
+ 75b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 75e:	a1 64 0d 00 00       	mov    0xd64,%eax
+ 763:	8b 15 60 0d 00 00    	mov    0xd60,%edx
+ 769:	29 c2                	sub    %eax,%edx
+ 76b:	39 da                	cmp    %ebx,%edx
+ 76d:	72 19                	jb     788 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 76f:	01 c3                	add    %eax,%ebx
+ 771:	89 1d 64 0d 00 00    	mov    %ebx,0xd64
+  return p;
+}
+ 777:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 77a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 77d:	89 ec                	mov    %ebp,%esp
+ 77f:	5d                   	pop    %ebp
+ 780:	c3                   	ret
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 788:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 78d:	39 c3                	cmp    %eax,%ebx
+ 78f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 792:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 795:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 797:	e8 6f fc ff ff       	call   40b <sbrk>
+    if(p == (char*)-1)
+ 79c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 79f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 7a1:	74 1d                	je     7c0 <morecore+0x70>
+    if(p != arenaend)
+ 7a3:	39 05 60 0d 00 00    	cmp    %eax,0xd60
+ 7a9:	74 0d                	je     7b8 <morecore+0x68>
+    arenaend = p + grow;
+ 7ab:	01 f2                	add    %esi,%edx
+ 7ad:	89 15 60 0d 00 00    	mov    %edx,0xd60
+ 7b3:	eb ba                	jmp    76f <morecore+0x1f>
+ 7b5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 7b8:	a1 64 0d 00 00       	mov    0xd64,%eax
+ 7bd:	eb ec                	jmp    7ab <morecore+0x5b>
+ 7bf:	90                   	nop
+      return 0;
+ 7c0:	31 c0                	xor    %eax,%eax
+ 7c2:	eb b3                	jmp    777 <morecore+0x27>
+ 7c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+
+000007d0 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7dc:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 7df:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 7e2:	85 c0                	test   %eax,%eax
+ 7e4:	74 1e                	je     804 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 7e6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 7e9:	83 fa 08             	cmp    $0x8,%edx
+ 7ec:	77 16                	ja     804 <free+0x34>
+  h = (Header*)ap - 1;
+ 7ee:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 7f1:	74 25                	je     818 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 7f3:	8b 3c 95 80 0d 00 00 	mov    0xd80(,%edx,4),%edi
+ 7fa:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 7fd:	89 0c 95 80 0d 00 00 	mov    %ecx,0xd80(,%edx,4)
+}
+ 804:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 807:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 80a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 80d:	89 ec                	mov    %ebp,%esp
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 818:	8b 15 a0 0d 00 00    	mov    0xda0,%edx
+ 81e:	85 d2                	test   %edx,%edx
+ 820:	74 54                	je     876 <free+0xa6>
+ 822:	39 ca                	cmp    %ecx,%edx
+ 824:	73 36                	jae    85c <free+0x8c>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+ 830:	89 d3                	mov    %edx,%ebx
+ 832:	8b 12                	mov    (%edx),%edx
+ 834:	85 d2                	test   %edx,%edx
+ 836:	74 12                	je     84a <free+0x7a>
+ 838:	39 ca                	cmp    %ecx,%edx
+ 83a:	72 f4                	jb     830 <free+0x60>
+  if(p && END(h) == p){
+ 83c:	85 d2                	test   %edx,%edx
+ 83e:	74 0a                	je     84a <free+0x7a>
+ 840:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 843:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 846:	39 fa                	cmp    %edi,%edx
+ 848:	74 4b                	je     895 <free+0xc5>
+  h->s.u.next = p;
+ 84a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 84d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 850:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 854:	39 f1                	cmp    %esi,%ecx
+ 856:	74 29                	je     881 <free+0xb1>
+    prev->s.u.next = h;
+ 858:	89 0b                	mov    %ecx,(%ebx)
+ 85a:	eb a8                	jmp    804 <free+0x34>
+  if(p && END(h) == p){
+ 85c:	85 d2                	test   %edx,%edx
+ 85e:	74 16                	je     876 <free+0xa6>
+ 860:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 863:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 866:	39 f2                	cmp    %esi,%edx
+ 868:	75 0c                	jne    876 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 86a:	8b 72 04             	mov    0x4(%edx),%esi
+ 86d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 871:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 874:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 876:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 879:	89 0d a0 0d 00 00    	mov    %ecx,0xda0
+ 87f:	eb 83                	jmp    804 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 881:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 884:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 888:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 88b:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 88e:	89 03                	mov    %eax,(%ebx)
+ 890:	e9 6f ff ff ff       	jmp    804 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 895:	8b 7a 04             	mov    0x4(%edx),%edi
+ 898:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 89c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 89f:	8b 12                	mov    (%edx),%edx
+ 8a1:	eb a7                	jmp    84a <free+0x7a>
+ 8a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 2c             	sub    $0x2c,%esp
+ 8b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 8bc:	83 f8 10             	cmp    $0x10,%eax
+ 8bf:	0f 86 52 01 00 00    	jbe    a17 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 8c5:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 8c7:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8cc:	eb 0d                	jmp    8db <malloc+0x2b>
+ 8ce:	66 90                	xchg   %ax,%ax
+ 8d0:	83 c1 05             	add    $0x5,%ecx
+ 8d3:	89 d6                	mov    %edx,%esi
+ 8d5:	d3 e6                	shl    %cl,%esi
+ 8d7:	39 c6                	cmp    %eax,%esi
+ 8d9:	73 55                	jae    930 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 8db:	89 d9                	mov    %ebx,%ecx
+ 8dd:	43                   	inc    %ebx
+ 8de:	83 fb 08             	cmp    $0x8,%ebx
+ 8e1:	75 ed                	jne    8d0 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 8e3:	8d 58 07             	lea    0x7(%eax),%ebx
+ 8e6:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 8e9:	39 c3                	cmp    %eax,%ebx
+ 8eb:	0f 82 1f 01 00 00    	jb     a10 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 8f1:	a1 a0 0d 00 00       	mov    0xda0,%eax
+ 8f6:	85 c0                	test   %eax,%eax
+ 8f8:	0f 84 ee 00 00 00    	je     9ec <malloc+0x13c>
+ 8fe:	b9 a0 0d 00 00       	mov    $0xda0,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 903:	8b 50 04             	mov    0x4(%eax),%edx
+ 906:	39 da                	cmp    %ebx,%edx
+ 908:	0f 82 d2 00 00 00    	jb     9e0 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 90e:	29 da                	sub    %ebx,%edx
+ 910:	83 fa 17             	cmp    $0x17,%edx
+ 913:	0f 87 b7 00 00 00    	ja     9d0 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 919:	8b 10                	mov    (%eax),%edx
+ 91b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 91d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 923:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 926:	83 c0 08             	add    $0x8,%eax
+}
+ 929:	5b                   	pop    %ebx
+ 92a:	5e                   	pop    %esi
+ 92b:	5f                   	pop    %edi
+ 92c:	5d                   	pop    %ebp
+ 92d:	c3                   	ret
+ 92e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 930:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 932:	8b 04 9d 80 0d 00 00 	mov    0xd80(,%ebx,4),%eax
+ 939:	85 c0                	test   %eax,%eax
+ 93b:	74 23                	je     960 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 93d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 93f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 942:	89 14 9d 80 0d 00 00 	mov    %edx,0xd80(,%ebx,4)
+    h->s.u.cls = cls;
+ 949:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 94c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 94f:	83 c4 2c             	add    $0x2c,%esp
+ 952:	5b                   	pop    %ebx
+ 953:	5e                   	pop    %esi
+ 954:	5f                   	pop    %edi
+ 955:	5d                   	pop    %ebp
+ 956:	c3                   	ret
+ 957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 960:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 963:	31 d2                	xor    %edx,%edx
+ 965:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 96a:	f7 f6                	div    %esi
+ 96c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 96f:	0f af c6             	imul   %esi,%eax
+ 972:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 975:	e8 d6 fd ff ff       	call   750 <morecore>
+ 97a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 97d:	85 c0                	test   %eax,%eax
+ 97f:	0f 84 8b 00 00 00    	je     a10 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 985:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 988:	8b 0c 9d 80 0d 00 00 	mov    0xd80(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 994:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 997:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 99a:	eb 06                	jmp    9a2 <malloc+0xf2>
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 9a0:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 9a2:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 9a4:	42                   	inc    %edx
+ 9a5:	89 c1                	mov    %eax,%ecx
+ 9a7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 9aa:	39 d7                	cmp    %edx,%edi
+ 9ac:	75 f2                	jne    9a0 <malloc+0xf0>
+ 9ae:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 9b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 9b4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 9b7:	89 04 9d 80 0d 00 00 	mov    %eax,0xd80(,%ebx,4)
+ 9be:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 9c1:	29 f0                	sub    %esi,%eax
+ 9c3:	01 c2                	add    %eax,%edx
+ 9c5:	89 d0                	mov    %edx,%eax
+ 9c7:	e9 71 ff ff ff       	jmp    93d <malloc+0x8d>
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 9d0:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 9d3:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 9d6:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 9d8:	89 58 04             	mov    %ebx,0x4(%eax)
+ 9db:	e9 3d ff ff ff       	jmp    91d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 9e0:	89 c1                	mov    %eax,%ecx
+ 9e2:	8b 00                	mov    (%eax),%eax
+ 9e4:	85 c0                	test   %eax,%eax
+ 9e6:	0f 85 17 ff ff ff    	jne    903 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 9ec:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 9ef:	74 1f                	je     a10 <malloc+0x160>
+ 9f1:	8d 43 08             	lea    0x8(%ebx),%eax
+ 9f4:	e8 57 fd ff ff       	call   750 <morecore>
+ 9f9:	85 c0                	test   %eax,%eax
+ 9fb:	74 13                	je     a10 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 9fd:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ a03:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ a06:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ a09:	e9 41 ff ff ff       	jmp    94f <malloc+0x9f>
+ a0e:	66 90                	xchg   %ax,%ax
+      return 0;
+ a10:	31 c0                	xor    %eax,%eax
+ a12:	e9 38 ff ff ff       	jmp    94f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ a17:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ a1c:	31 db                	xor    %ebx,%ebx
+ a1e:	e9 0f ff ff ff       	jmp    932 <malloc+0x82>
@@ -17,9 +17,7 @@
 int
 fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
-
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(addr+4 < addr || addr+4 > uvmlimit(addr))
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -43,12 +41,10 @@ int
 fetchstr(uint addr, char **pp)
 {
   char *s, *ep;
-  struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
+  if((ep = (char*)uvmlimit(addr)) == 0)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
     if(*s == 0)
       return s - *pp;
@@ -64,23 +60,40 @@ argint(int n, int *ip)
 }
 
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+argbuf(int n, char **pp, int size, int write)
 {
   int i;
-  struct proc *curproc = myproc();
 
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || (uint)i+size < (uint)i || (uint)i+size > uvmlimit(i))
+    return -1;
+  // Fault the buffer in now: callers may use it with a spinlock
+  // or the backing inode's lock held, when faulting can't sleep.
+  if(prefault(i, size, write) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 0);
+}
+
+// Like argptr, for a block the kernel is going to write to.
+// Also check that it is writable (mmap() can map read-only pages).
+int
+argwptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -119,6 +132,15 @@ extern int sys_detach(void);
 extern int sys_policy(void);
 extern int sys_priority(void);
 extern int sys_wait_stat(void);
+extern int sys_lockstat(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_memstat(void);
+extern int sys_getprocs(void);
+extern int sys_shmctl(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -146,6 +168,15 @@ static int (*syscalls[])(void) = {
 [SYS_policy]  sys_policy,
 [SYS_priority] sys_priority,
 [SYS_wait_stat] sys_wait_stat,
+[SYS_lockstat] sys_lockstat,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_shmget]  sys_shmget,
+[SYS_shmat]   sys_shmat,
+[SYS_shmdt]   sys_shmdt,
+[SYS_memstat] sys_memstat,
+[SYS_getprocs] sys_getprocs,
+[SYS_shmctl]  sys_shmctl,
 
 };
 
@@ -24,3 +24,12 @@
 #define SYS_policy 23
 #define SYS_priority 24
 #define SYS_wait_stat 25
+#define SYS_lockstat 26
+#define SYS_mmap   27
+#define SYS_munmap 28
+#define SYS_shmget 29
+#define SYS_shmat  30
+#define SYS_shmdt  31
+#define SYS_memstat 32
+#define SYS_getprocs 33
+#define SYS_shmctl 34
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "memstat.h"
 
 int
 sys_fork(void)
@@ -48,7 +49,11 @@ sys_wait_stat(void)
 {
   int * status;
   struct perf * spref;
-  if(argint(0,(int *)(&status))<0 || argptr(1,(char **) &spref , sizeof(spref))<0)
+  if(argint(0,(int *)(&status))<0 || argwptr(1,(char **) &spref , sizeof(*spref))<0)
+    return -1;
+  // wait_stat() stores the status with locks held, so a
+  // non-null status must be writable now.
+  if(status != 0 && argwptr(0,(char **) &status, sizeof(int))<0)
     return -1;
 
   return wait_stat(status, spref);
@@ -60,6 +65,10 @@ sys_wait(void)
 
   if(argint(0,(int *)(&status))<0 )
     return -1;
+  // wait() stores the status with locks held, so a non-null
+  // status must be writable now.
+  if(status != 0 && argwptr(0,(char **) &status, sizeof(int))<0)
+    return -1;
 
   return wait(status);
 }
@@ -88,6 +97,19 @@ sys_priority(void)
   return 0;
 }
 
+// print lock contention statistics to the console,
+// clearing them afterwards if reset is non-zero.
+int
+sys_lockstat(void)
+{
+  int reset;
+
+  if(argint(0, &reset) < 0)
+    return -1;
+  lockdump(reset);
+  return 0;
+}
+
 int
 sys_getpid(void)
 {
@@ -141,3 +163,68 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+int
+sys_shmget(void)
+{
+  int key, size;
+
+  if(argint(0, &key) < 0 || argint(1, &size) < 0 || size <= 0)
+    return -1;
+  return shmget(key, size);
+}
+
+int
+sys_shmat(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return shmat(id);
+}
+
+int
+sys_shmdt(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmdt(addr);
+}
+
+int
+sys_shmctl(void)
+{
+  int id, cmd;
+
+  if(argint(0, &id) < 0 || argint(1, &cmd) < 0)
+    return -1;
+  return shmctl(id, cmd);
+}
+
+int
+sys_memstat(void)
+{
+  struct memstat *ms;
+
+  if(argwptr(0, (char**)&ms, sizeof(*ms)) < 0)
+    return -1;
+  kmemstat(ms);
+  ms->ptpages = vmptpages();
+  return 0;
+}
+
+int
+sys_getprocs(void)
+{
+  struct procinfo *pi;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NPROC)
+    return -1;
+  if(argwptr(0, (char**)&pi, n*sizeof(*pi)) < 0)
+    return -1;
+  return getprocs(pi, n);
+}
@@ -36,6 +36,8 @@ idtinit(void)
 void
 trap(struct trapframe *tf)
 {
+  uint va;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit(0);
@@ -78,6 +80,18 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Copy-on-write and other recoverable faults, from user
+    // mode or from the kernel touching user memory. Reloading
+    // a page from a file may sleep, so restore interrupts if
+    // the faulting code had them on (and so held no spinlocks).
+    va = rcr2();
+    if(tf->eflags & FL_IF)
+      sti();
+    if(pagefault(va, tf->err) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -1,90 +1,186 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
-#include "param.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Segregated size-class allocator.
+//
+// Requests of up to MAXSMALL bytes are rounded up to a power-of-two
+// size class and served from that class's free list; when the list
+// is empty, a page's worth of blocks is carved from the arena at
+// once. Larger requests get their own block from the arena and go
+// back on a single address-ordered list of large blocks when freed,
+// where neighbours merge; a large block found first fit is split
+// if it is bigger than needed. Every block starts with a header
+// naming its class, so freeing a small block is a push onto a list.
+// The arena grows through sbrk() ARENAGROW bytes at a time.
 
-typedef long Align;
+#define NCLASS     8             // Size classes 16, 32, ... 2048
+#define MINSHIFT   4
+#define MAXSMALL   (1 << (MINSHIFT + NCLASS - 1))
+#define LARGE      NCLASS        // Class of blocks bigger than MAXSMALL
+#define CARVE      4096          // Bytes carved for a class at once
+#define ARENAGROW  65536
+
+typedef union header Header;
 
 union header {
   struct {
-    union header *ptr;
-    uint size;
+    union {
+      uint cls;                  // Size class, or LARGE, while in use
+      Header *next;              // Next free block, while free
+    } u;
+    uint size;                   // Usable bytes in the block
   } s;
-  Align x;
+  double align;
 };
 
-typedef union header Header;
+static Header *freelist[NCLASS + 1];
 
-static Header base;
-static Header *freep;
+// The header just past the end of block h.
+#define END(h) ((Header*)((char*)((h) + 1) + (h)->s.size))
+static char *arena, *arenaend;
 
-void
-free(void *ap)
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
 {
-  Header *bp, *p;
-
-  bp = (Header*)ap - 1;
-  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if(bp + bp->s.size == p->s.ptr){
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if(p + p->s.size == bp){
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+    grow = n < ARENAGROW ? ARENAGROW : n;
+    p = sbrk(grow);
+    if(p == (char*)-1)
+      return 0;
+    // A fresh region not adjacent to the old one (someone else
+    // called sbrk) abandons the old leftover.
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+  return p;
 }
 
-static Header*
-morecore(uint nu)
+// Return the size class for nbytes, or LARGE.
+static uint
+sizeclass(uint nbytes)
 {
+  uint cls;
+
+  for(cls = 0; cls < NCLASS; cls++)
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+      return cls;
+  return LARGE;
+}
+
+// Fill the free list of class cls with one CARVE-sized batch.
+static int
+refill(uint cls)
+{
+  uint bsize, n, i;
   char *p;
-  Header *hp;
+  Header *h;
 
-  if(nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if(p == (char*)-1)
-    return 0;
-  hp = (Header*)p;
-  hp->s.size = nu;
-  free((void*)(hp + 1));
-  return freep;
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+  n = CARVE / bsize;
+  if(n == 0)
+    n = 1;
+  if((p = morecore(n * bsize)) == 0)
+    return -1;
+  for(i = 0; i < n; i++, p += bsize){
+    h = (Header*)p;
+    h->s.u.next = freelist[cls];
+    freelist[cls] = h;
+  }
+  return 0;
+}
+
+// Put large block h on the address-ordered list of free large
+// blocks, merging it with the blocks next to it.
+static void
+lfree(Header *h)
+{
+  Header *p, *prev;
+
+  prev = 0;
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+    prev = p;
+  if(p && END(h) == p){
+    h->s.size += sizeof(Header) + p->s.size;
+    p = p->s.u.next;
+  }
+  h->s.u.next = p;
+  if(prev && END(prev) == h){
+    prev->s.size += sizeof(Header) + h->s.size;
+    prev->s.u.next = h->s.u.next;
+  } else if(prev)
+    prev->s.u.next = h;
+  else
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+  if(cls > LARGE)
+    return;  // not ours
+  if(cls == LARGE){
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+  freelist[cls] = h;
 }
 
 void*
 malloc(uint nbytes)
 {
-  Header *p, *prevp;
-  uint nunits;
+  Header *h, **pp;
+  uint cls, size;
+  char *p;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
-  if((prevp = freep) == 0){
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
+  cls = sizeclass(nbytes);
+  if(cls < LARGE){
+    if(freelist[cls] == 0 && refill(cls) < 0)
+      return 0;
+    h = freelist[cls];
+    freelist[cls] = h->s.u.next;
+    h->s.u.cls = cls;
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
   }
-  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
-    if(p->s.size >= nunits){
-      if(p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void*)(p + 1);
-    }
-    if(p == freep)
-      if((p = morecore(nunits)) == 0)
-        return 0;
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+  if(size < nbytes)
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+    h = *pp;
+    if(h->s.size < size)
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+    h->s.u.cls = LARGE;
+    return (void*)(h + 1);
   }
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
 }
@@ -1,6 +1,8 @@
 struct stat;
 struct rtcdate;
 struct perf;
+struct memstat;
+struct procinfo;
 
 
 // system calls
@@ -29,6 +31,15 @@ int detach(int pid);
 void policy(int policy);
 void priority(int priority);
 int wait_stat(int *status, struct perf *performance);
+int lockstat(int reset);
+void* mmap(void *addr, int length, int prot, int flags, int fd, int offset);
+int munmap(void *addr, int length);
+int shmget(int key, int size);
+void* shmat(int shmid);
+int shmdt(void *addr);
+int memstat(struct memstat*);
+int getprocs(struct procinfo*, int n);
+int shmctl(int shmid, int cmd);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -6,10 +6,14 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "mman.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 
+// Page directory and page table pages in use by user page tables.
+static uint nptpages;
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
@@ -26,7 +30,16 @@ seginit(void)
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+  c->gdt[SEG_TSS] = SEG16(STS_T32A, &c->ts, sizeof(c->ts)-1, 0);
+  c->gdt[SEG_TSS].s = 0;
   lgdt(c->gdt, sizeof(c->gdt));
+
+  // The TSS is loaded once; switchuvm() only updates esp0.
+  c->ts.ss0 = SEG_KDATA << 3;
+  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
+  // forbids I/O instructions (e.g., inb and outb) from user space
+  c->ts.iomb = (ushort) 0xFFFF;
+  ltr(SEG_TSS << 3);
 }
 
 // Return the address of the PTE in page table pgdir
@@ -42,10 +55,10 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
+      return 0;
+    __sync_fetch_and_add(&nptpages, 1);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -85,7 +98,8 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // page protection bits prevent user code from using the kernel's
 // mappings.
 //
-// setupkvm() and exec() set up every page table like this:
+// kvmalloc() builds kpgdir like this, and setupkvm() copies its
+// kernel half into every page table:
 //
 //   0..KERNBASE: user memory (text+data+stack+heap), mapped to
 //                phys memory allocated by the kernel
@@ -96,42 +110,60 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
+// The first 4MB above KERNBASE use one 4KB page table, shared by all
+// page tables, so that the kernel text can be read-only; everything
+// else is mapped with 4MB PTE_PS pages. All kernel mappings are
+// PTE_G, so they stay in the TLB across %cr3 loads.
+//
 // The kernel allocates physical memory for its heap and for user memory
 // between V2P(end) and the end of physical memory (PHYSTOP)
 // (directly addressable from end..P2V(PHYSTOP)).
 
-// This table defines the kernel's mappings, which are present in
-// every process's page table.
-static struct kmap {
-  void *virt;
-  uint phys_start;
-  uint phys_end;
+// Build the kernel's mappings in a fresh page directory.
+static pde_t*
+kvminit(void)
+{
+  pde_t *pgdir;
+  pte_t *pgtab;
+  uint a;
   int perm;
-} kmap[] = {
- { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
- { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
- { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
-};
+
+  if (P2V(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  if (V2P(data) > SUPERPGSIZE)
+    panic("kernel text too big");
+  if((pgdir = (pde_t*)kzalloc()) == 0 || (pgtab = (pte_t*)kzalloc()) == 0)
+    panic("kvminit");
+
+  // I/O space and kernel text+rodata, in 4KB pages.
+  for(a = 0; a < SUPERPGSIZE; a += PGSIZE){
+    perm = PTE_W;
+    if(a >= V2P(KERNLINK) && a < V2P(data))
+      perm = 0;
+    pgtab[PTX(a)] = a | perm | PTE_P | PTE_G;
+  }
+  pgdir[PDX(KERNBASE)] = V2P(pgtab) | PTE_P | PTE_W;
+
+  // Rest of physical memory, and the devices at the top.
+  for(a = SUPERPGSIZE; a < PHYSTOP; a += SUPERPGSIZE)
+    pgdir[PDX(P2V(a))] = a | PTE_P | PTE_W | PTE_PS | PTE_G;
+  for(a = DEVSPACE; a != 0; a += SUPERPGSIZE)
+    pgdir[PDX(a)] = a | PTE_P | PTE_W | PTE_PS | PTE_G;
+  return pgdir;
+}
 
 // Set up kernel part of a page table.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  __sync_fetch_and_add(&nptpages, 1);
+  memset(pgdir, 0, PDX(KERNBASE)*sizeof(pde_t));
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE))*sizeof(pde_t));
   return pgdir;
 }
 
@@ -140,7 +172,7 @@ setupkvm(void)
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  kpgdir = kvminit();
   switchkvm();
 }
 
@@ -153,9 +185,15 @@ switchkvm(void)
 }
 
 // Switch TSS and h/w page table to correspond to process p.
+// %cr3 is only reloaded if this CPU has a different page table
+// loaded, or if p has run on another CPU since it last ran here
+// (its page table may have changed without this CPU's TLB being
+// flushed). Back-to-back runs of p keep its TLB entries.
 void
 switchuvm(struct proc *p)
 {
+  struct cpu *c;
+
   if(p == 0)
     panic("switchuvm: no process");
   if(p->kstack == 0)
@@ -164,16 +202,13 @@ switchuvm(struct proc *p)
     panic("switchuvm: no pgdir");
 
   pushcli();
-  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
-                                sizeof(mycpu()->ts)-1, 0);
-  mycpu()->gdt[SEG_TSS].s = 0;
-  mycpu()->ts.ss0 = SEG_KDATA << 3;
-  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
-  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
-  // forbids I/O instructions (e.g., inb and outb) from user space
-  mycpu()->ts.iomb = (ushort) 0xFFFF;
-  ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  c = mycpu();
+  c->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+  if(c->pgdir != p->pgdir || p->lastcpu != c){
+    lcr3(V2P(p->pgdir));  // switch to process's address space
+    c->pgdir = p->pgdir;
+  }
+  p->lastcpu = c;
   popcli();
 }
 
@@ -186,8 +221,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -231,13 +265,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kzalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -279,7 +312,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part. The kernel part is shared with kpgdir.
 void
 freevm(pde_t *pgdir)
 {
@@ -287,14 +320,21 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
+  // A CPU may still have pgdir loaded while it looks for the next
+  // process to run (see scheduler); wait for it to move on.
+  for(i = 0; i < ncpu; i++)
+    while(cpus[i].pgdir == pgdir)
+      pause();
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
+      __sync_fetch_and_sub(&nptpages, 1);
     }
   }
   kfree((char*)pgdir);
+  __sync_fetch_and_sub(&nptpages, 1);
 }
 
 // Clear PTE_U on a page. Used to create an inaccessible
@@ -310,40 +350,476 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Share the present pages of [start, end) in pgdir with d.
+// Writable pages of private memory become read-only PTE_COW
+// pages in both page tables and are copied by cowpage() on
+// the first write; shared memory keeps its mappings as is.
+// Pages not touched yet (see growproc) stay lazy in d.
+static int
+copyrange(pde_t *pgdir, pde_t *d, uint start, uint end, int shared)
+{
+  pte_t *pte;
+  uint pa, i, flags;
+
+  for(i = start; i < end; i += PGSIZE){
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(!(*pte & PTE_P))
+      continue;
+    if(!shared && (*pte & PTE_W))
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+    pa = PTE_ADDR(*pte);
+    flags = PTE_FLAGS(*pte) & ~PTE_D;
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+      return -1;
+    kincref(P2V(pa));
+  }
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child: memory below sz, plus the mmap()ed
+// ranges in vma. No pages are copied; see copyrange().
+// pgdir must be the current page table.
 pde_t*
-copyuvm(pde_t *pgdir, uint sz)
+copyuvm(pde_t *pgdir, uint sz, struct vma *vma)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
+  struct vma *v;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
+  if(copyrange(pgdir, d, 0, sz, 0) < 0)
+    goto bad;
+  for(v = vma; v < &vma[NVMA]; v++){
+    if(v->end == 0 || (v->flags & VMA_EXEC))
+      continue;
+    if(copyrange(pgdir, d, v->start, v->end, v->flags & MAP_SHARED) < 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
-    }
   }
+  // Flush the parent's now read-only mappings from the TLB.
+  lcr3(rcr3());
   return d;
 
 bad:
+  lcr3(rcr3());
   freevm(d);
   return 0;
 }
 
+// Give pgdir a private, writable copy of the copy-on-write
+// page at va. If no one else references the page any more,
+// it is simply made writable again.
+// Returns 0 on success, -1 if va is not a COW page or
+// memory is exhausted.
+static int
+cowpage(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *old, *mem;
+
+  pte = walkpgdir(pgdir, (void*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  if(krefcount(old) == 1){
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | ((PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W);
+    kfree(old);
+  }
+  if(pgdir == myproc()->pgdir)
+    invlpg((void*)va);
+  return 0;
+}
+
+// Map a zeroed page at va, which lies inside the process but
+// has not been touched since sbrk() grew the process over it,
+// or inside anonymous mmap()ed memory.
+static int
+zeropage(pde_t *pgdir, uint va, int perm)
+{
+  char *mem;
+
+  if((mem = kzalloc()) == 0)
+    return -1;
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Fill the page at va from the file backing v.
+// Bytes past the end of the file read as zero.
+static int
+filepage(pde_t *pgdir, struct vma *v, uint va)
+{
+  char *mem;
+  uint n, voff;
+
+  // readi() may sleep, which is only allowed if the faulting code
+  // held no spinlocks, i.e. ran with interrupts enabled. System
+  // calls that touch user memory under a spinlock prefault it
+  // first; see argptr() and argwptr().
+  if(!(readeflags() & FL_IF))
+    return -1;
+  if((mem = kzalloc()) == 0)
+    return -1;
+  voff = va - v->start;
+  if(voff < v->filesz){
+    n = v->filesz - voff;
+    if(n > PGSIZE)
+      n = PGSIZE;
+    ilock(v->ip);
+    readi(v->ip, mem, v->off + voff, n);
+    iunlock(v->ip);
+  }
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), v->perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault at va in the current process.
+// err is the error code pushed by the processor.
+// Returns 0 if the faulting access can be retried,
+// -1 if it is a genuine fault.
+int
+pagefault(uint va, uint err)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+
+  if(curproc == 0 || va >= KERNBASE)
+    return -1;
+  if(!(err & FEC_P)){
+    for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+      if(v->end == 0 || va < v->start || va >= PGROUNDUP(v->end))
+        continue;
+      if(v->flags & VMA_SHM)
+        return -1;  // shmat() maps every page up front
+      if(v->ip)
+        return filepage(curproc->pgdir, v, PGROUNDDOWN(va));
+      return zeropage(curproc->pgdir, PGROUNDDOWN(va), v->perm);
+    }
+    if(va < curproc->sz)
+      return zeropage(curproc->pgdir, PGROUNDDOWN(va), PTE_W|PTE_U);
+    return -1;
+  }
+  if((err & (FEC_P|FEC_WR)) == (FEC_P|FEC_WR))
+    return cowpage(curproc->pgdir, PGROUNDDOWN(va));
+  return -1;
+}
+
+// Make sure the pages of [va, va+len) in the current process
+// are present, and writable if write is set, so the kernel can
+// then use them while holding a spinlock. Returns 0 on success,
+// -1 if some page is invalid or read-only.
+int
+prefault(uint va, uint len, int write)
+{
+  pte_t *pte;
+  uint a, last;
+
+  if(len == 0)
+    return 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  for(;; a += PGSIZE){
+    pte = walkpgdir(myproc()->pgdir, (char*)a, 0);
+    if(pte == 0 || !(*pte & PTE_P)){
+      if(pagefault(a, 0) < 0)
+        return -1;
+      pte = walkpgdir(myproc()->pgdir, (char*)a, 0);
+    }
+    if(write && !(*pte & PTE_W) && pagefault(a, FEC_P|FEC_WR) < 0)
+      return -1;
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
+// Free the first n entries of vma, dropping their file references.
+// Must be called inside a transaction, since iput() may write.
+void
+vmaclear(struct vma *vma, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(vma[i].ip)
+      iput(vma[i].ip);
+    if(vma[i].end && (vma[i].flags & VMA_SHM))
+      shmput(vma[i].off);
+    memset(&vma[i], 0, sizeof(vma[i]));
+  }
+}
+
+// Write the dirty pages of [start, end) of MAP_SHARED file
+// mapping v back to the file. Pages are written in chunks
+// small enough for one log transaction each, as in filewrite().
+static void
+syncrange(pde_t *pgdir, struct vma *v, uint start, uint end)
+{
+  int max = ((MAXOPBLOCKS-1-1-2-2) / 2) * 512;
+  pte_t *pte;
+  char *mem;
+  uint a, voff, n, i, m;
+
+  if(v->ip == 0 || !(v->flags & MAP_SHARED))
+    return;
+  for(a = start; a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_D)) != (PTE_P|PTE_D))
+      continue;
+    voff = a - v->start;
+    if(voff >= v->filesz)
+      continue;
+    n = v->filesz - voff;
+    if(n > PGSIZE)
+      n = PGSIZE;
+    mem = P2V(PTE_ADDR(*pte));
+    for(i = 0; i < n; i += m){
+      m = n - i;
+      if(m > max)
+        m = max;
+      begin_op();
+      ilock(v->ip);
+      writei(v->ip, mem + i, v->off + voff + i, m);
+      iunlock(v->ip);
+      end_op();
+    }
+  }
+}
+
+// Write back all dirty pages of v, if it is a MAP_SHARED file
+// mapping. Called before v's pages are unmapped.
+void
+vmasync(pde_t *pgdir, struct vma *v)
+{
+  syncrange(pgdir, v, v->start, v->end);
+}
+
+// Map the n physical pages in pages at va in pgdir, taking a
+// reference on each for the mapping. Used by shmat().
+int
+mapshared(pde_t *pgdir, uint va, char **pages, int n, int perm)
+{
+  int i;
+
+  for(i = 0; i < n; i++, va += PGSIZE){
+    if(mappages(pgdir, (char*)va, PGSIZE, V2P(pages[i]), perm) < 0)
+      return -1;
+    kincref(pages[i]);
+  }
+  return 0;
+}
+
+// Return the end of the valid region of the current process's
+// memory that contains va: sz for memory below sz, or the end
+// of the mmap()ed range holding va. Returns 0 if va is not valid.
+uint
+uvmlimit(uint va)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+
+  if(va < curproc->sz)
+    return curproc->sz;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->end && !(v->flags & VMA_EXEC) && va >= v->start && va < v->end)
+      return v->end;
+  return 0;
+}
+
+// Find a free range of len bytes for a new mapping in the current
+// process, searching down from KERNBASE so that mappings and the
+// heap grow towards each other. Returns 0 if there is no room.
+static uint
+mmapaddr(uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  uint top;
+
+  top = KERNBASE;
+again:
+  if(top < len || top - len < PGROUNDUP(curproc->sz))
+    return 0;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->end == 0 || (v->flags & VMA_EXEC))
+      continue;
+    if(v->start < top && v->end > top - len){
+      top = v->start;
+      goto again;
+    }
+  }
+  return top - len;
+}
+
+// Map len bytes of ip starting at file offset off into the current
+// process, or anonymous memory if ip is 0. filesz is the number of
+// bytes the file actually has there. perm is the PTE permissions,
+// flags MAP_SHARED or MAP_PRIVATE. Pages are filled on first touch,
+// except for MAP_SHARED memory, which is filled now so that children
+// forked later share the same pages.
+// Returns the address of the mapping, or 0 on failure.
+uint
+mmap(struct inode *ip, uint off, uint filesz, uint len, int perm, int flags)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  uint addr;
+
+  if(len == 0 || PGROUNDUP(len) < len)
+    return 0;
+  len = PGROUNDUP(len);
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->end == 0)
+      break;
+  if(v == &curproc->vma[NVMA])
+    return 0;
+  if((addr = mmapaddr(len)) == 0)
+    return 0;
+
+  v->start = addr;
+  v->end = addr + len;
+  v->ip = ip ? idup(ip) : 0;
+  v->off = off;
+  v->filesz = filesz;
+  v->perm = perm;
+  v->flags = flags;
+
+  if((flags & (MAP_SHARED|VMA_SHM)) == MAP_SHARED && prefault(addr, len, 0) < 0){
+    munmap(addr, len);
+    return 0;
+  }
+  return addr;
+}
+
+// Unmap the pages of the current process in [addr, addr+len)
+// that belong to mmap()ed ranges, writing MAP_SHARED file pages
+// back first. A range may be cut at either end or split in two.
+// Returns 0 on success, -1 on a bad range, a shared memory segment
+// only partly in range, or a split with no free vma slot; nothing
+// is unmapped then.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v, *nv;
+  uint end, s, e;
+  int nsplit, nfree;
+
+  if(addr % PGSIZE || len == 0 || addr + len < addr || addr + len > KERNBASE)
+    return -1;
+  end = PGROUNDUP(addr + len);
+
+  // Check every vma in the range before changing any, so that
+  // a failing call leaves the address space as it was.
+  nsplit = nfree = 0;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->end == 0){
+      nfree++;
+      continue;
+    }
+    if((v->flags & VMA_EXEC) || v->end <= addr || v->start >= end)
+      continue;
+    s = addr > v->start ? addr : v->start;
+    e = end < v->end ? end : v->end;
+    if((v->flags & VMA_SHM) && (s != v->start || e != v->end))
+      return -1;  // segments are only detached whole
+    if(s > v->start && e < v->end)
+      nsplit++;
+  }
+  if(nsplit > nfree)
+    return -1;
+
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++){
+    if(v->end == 0 || (v->flags & VMA_EXEC))
+      continue;
+    if(v->end <= addr || v->start >= end)
+      continue;
+    s = addr > v->start ? addr : v->start;
+    e = end < v->end ? end : v->end;
+
+    nv = 0;
+    if(s > v->start && e < v->end){
+      for(nv = curproc->vma; nv < &curproc->vma[NVMA]; nv++)
+        if(nv->end == 0)
+          break;
+    }
+
+    syncrange(curproc->pgdir, v, s, e);
+    deallocuvm(curproc->pgdir, e, s);
+
+    if(nv){
+      // Split: nv keeps [e, end).
+      *nv = *v;
+      if(nv->ip)
+        idup(nv->ip);
+      nv->start = e;
+      nv->off += e - v->start;
+      nv->filesz = v->filesz > e - v->start ? v->filesz - (e - v->start) : 0;
+      v->end = s;
+    } else if(s == v->start && e == v->end){
+      begin_op();
+      vmaclear(v, 1);
+      end_op();
+      continue;
+    } else if(s == v->start){
+      v->off += e - v->start;
+      v->filesz = v->filesz > e - v->start ? v->filesz - (e - v->start) : 0;
+      v->start = e;
+    } else {
+      v->end = s;
+    }
+    if(v->filesz > v->end - v->start)
+      v->filesz = v->end - v->start;
+  }
+  lcr3(rcr3());
+  return 0;
+}
+
+// Return the number of pages used by user page tables.
+uint
+vmptpages(void)
+{
+  return nptpages;
+}
+
+// Count the resident user pages of pgdir into *rss, and its
+// page directory and page table pages into *pt. Pages shared
+// with other processes are counted in each of them.
+// pgdir may be another process's and change underneath us,
+// so the counts are only a snapshot.
+void
+uvmstat(pde_t *pgdir, uint *rss, uint *pt)
+{
+  pte_t *pgtab;
+  uint i, j;
+
+  *rss = 0;
+  *pt = 1;
+  for(i = 0; i < PDX(KERNBASE); i++){
+    if(!(pgdir[i] & PTE_P) || PTE_ADDR(pgdir[i]) >= PHYSTOP)
+      continue;
+    (*pt)++;
+    pgtab = (pte_t*)P2V(PTE_ADDR(pgdir[i]));
+    for(j = 0; j < NPTENTRIES; j++)
+      if((pgtab[j] & (PTE_P|PTE_U)) == (PTE_P|PTE_U))
+        (*rss)++;
+  }
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,7 +828,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -367,10 +843,16 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte == 0)
+      return -1;
+    if((*pte & PTE_COW) && cowpage(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
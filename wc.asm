@@ -0,0 +1,1527 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 e4 f0             	and    $0xfffffff0,%esp
+   9:	83 ec 10             	sub    $0x10,%esp
+  int fd, i;
+
+  if(argc <= 1){
+   c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  10:	7e 6f                	jle    81 <main+0x81>
+  12:	8b 45 0c             	mov    0xc(%ebp),%eax
+    wc(0, "");
+    exit(0);
+  }
+
+  for(i = 1; i < argc; i++){
+  15:	be 01 00 00 00       	mov    $0x1,%esi
+  1a:	8d 78 04             	lea    0x4(%eax),%edi
+  1d:	eb 1e                	jmp    3d <main+0x3d>
+  1f:	90                   	nop
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit(0);
+    }
+    wc(fd, argv[i]);
+  20:	89 44 24 04          	mov    %eax,0x4(%esp)
+  for(i = 1; i < argc; i++){
+  24:	46                   	inc    %esi
+  25:	83 c7 04             	add    $0x4,%edi
+    wc(fd, argv[i]);
+  28:	89 1c 24             	mov    %ebx,(%esp)
+  2b:	e8 70 00 00 00       	call   a0 <wc>
+    close(fd);
+  30:	89 1c 24             	mov    %ebx,(%esp)
+  33:	e8 e3 03 00 00       	call   41b <close>
+  for(i = 1; i < argc; i++){
+  38:	39 75 08             	cmp    %esi,0x8(%ebp)
+  3b:	74 3a                	je     77 <main+0x77>
+    if((fd = open(argv[i], 0)) < 0){
+  3d:	31 c9                	xor    %ecx,%ecx
+  3f:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+  43:	8b 07                	mov    (%edi),%eax
+  45:	89 04 24             	mov    %eax,(%esp)
+  48:	e8 e6 03 00 00       	call   433 <open>
+  4d:	89 c3                	mov    %eax,%ebx
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  4f:	8b 07                	mov    (%edi),%eax
+    if((fd = open(argv[i], 0)) < 0){
+  51:	85 db                	test   %ebx,%ebx
+  53:	79 cb                	jns    20 <main+0x20>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  55:	89 44 24 08          	mov    %eax,0x8(%esp)
+  59:	c7 44 24 04 b7 0a 00 	movl   $0xab7,0x4(%esp)
+  60:	00 
+  61:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  68:	e8 53 05 00 00       	call   5c0 <printf>
+      exit(0);
+  6d:	31 d2                	xor    %edx,%edx
+  6f:	89 14 24             	mov    %edx,(%esp)
+  72:	e8 7c 03 00 00       	call   3f3 <exit>
+  }
+  exit(0);
+  77:	31 c0                	xor    %eax,%eax
+  79:	89 04 24             	mov    %eax,(%esp)
+  7c:	e8 72 03 00 00       	call   3f3 <exit>
+    wc(0, "");
+  81:	c7 44 24 04 a9 0a 00 	movl   $0xaa9,0x4(%esp)
+  88:	00 
+  89:	31 db                	xor    %ebx,%ebx
+    exit(0);
+  8b:	31 f6                	xor    %esi,%esi
+    wc(0, "");
+  8d:	89 1c 24             	mov    %ebx,(%esp)
+  90:	e8 0b 00 00 00       	call   a0 <wc>
+    exit(0);
+  95:	89 34 24             	mov    %esi,(%esp)
+  98:	e8 56 03 00 00       	call   3f3 <exit>
+  9d:	66 90                	xchg   %ax,%ax
+  9f:	90                   	nop
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  a7:	53                   	push   %ebx
+  l = w = c = 0;
+  a8:	31 db                	xor    %ebx,%ebx
+{
+  aa:	83 ec 3c             	sub    $0x3c,%esp
+  inword = 0;
+  ad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+  b4:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  bb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  be:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	b9 00 02 00 00       	mov    $0x200,%ecx
+  c5:	be 20 0e 00 00       	mov    $0xe20,%esi
+  ca:	89 74 24 04          	mov    %esi,0x4(%esp)
+  ce:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	89 04 24             	mov    %eax,(%esp)
+  d8:	e8 2e 03 00 00       	call   40b <read>
+  dd:	85 c0                	test   %eax,%eax
+  df:	89 c6                	mov    %eax,%esi
+  e1:	7e 6d                	jle    150 <wc+0xb0>
+    for(i=0; i<n; i++){
+  e3:	31 ff                	xor    %edi,%edi
+  e5:	eb 15                	jmp    fc <wc+0x5c>
+  e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ee:	66 90                	xchg   %ax,%ax
+        inword = 0;
+  f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  f7:	47                   	inc    %edi
+  f8:	39 fe                	cmp    %edi,%esi
+  fa:	74 44                	je     140 <wc+0xa0>
+      if(strchr(" \r\t\n\v", buf[i]))
+  fc:	c7 04 24 94 0a 00 00 	movl   $0xa94,(%esp)
+      if(buf[i] == '\n')
+ 103:	0f be 87 20 0e 00 00 	movsbl 0xe20(%edi),%eax
+        l++;
+ 10a:	31 c9                	xor    %ecx,%ecx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 10c:	89 44 24 04          	mov    %eax,0x4(%esp)
+        l++;
+ 110:	3c 0a                	cmp    $0xa,%al
+ 112:	0f 94 c1             	sete   %cl
+ 115:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 117:	e8 64 01 00 00       	call   280 <strchr>
+ 11c:	85 c0                	test   %eax,%eax
+ 11e:	75 d0                	jne    f0 <wc+0x50>
+      else if(!inword){
+ 120:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 123:	85 c0                	test   %eax,%eax
+ 125:	75 d0                	jne    f7 <wc+0x57>
+        w++;
+ 127:	ff 45 e0             	incl   -0x20(%ebp)
+    for(i=0; i<n; i++){
+ 12a:	47                   	inc    %edi
+ 12b:	39 fe                	cmp    %edi,%esi
+        inword = 1;
+ 12d:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+ 134:	75 c6                	jne    fc <wc+0x5c>
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+      c++;
+ 140:	01 75 dc             	add    %esi,-0x24(%ebp)
+ 143:	e9 78 ff ff ff       	jmp    c0 <wc+0x20>
+ 148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+  if(n < 0){
+ 150:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 153:	75 33                	jne    188 <wc+0xe8>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	89 54 24 10          	mov    %edx,0x10(%esp)
+ 15c:	89 44 24 14          	mov    %eax,0x14(%esp)
+ 160:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 163:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 167:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 16e:	89 44 24 0c          	mov    %eax,0xc(%esp)
+ 172:	b8 aa 0a 00 00       	mov    $0xaaa,%eax
+ 177:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 17b:	e8 40 04 00 00       	call   5c0 <printf>
+}
+ 180:	83 c4 3c             	add    $0x3c,%esp
+ 183:	5b                   	pop    %ebx
+ 184:	5e                   	pop    %esi
+ 185:	5f                   	pop    %edi
+ 186:	5d                   	pop    %ebp
+ 187:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 188:	c7 44 24 04 9a 0a 00 	movl   $0xa9a,0x4(%esp)
+ 18f:	00 
+ 190:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 197:	e8 24 04 00 00       	call   5c0 <printf>
+    exit(0);
+ 19c:	31 d2                	xor    %edx,%edx
+ 19e:	89 14 24             	mov    %edx,(%esp)
+ 1a1:	e8 4d 02 00 00       	call   3f3 <exit>
+ 1a6:	66 90                	xchg   %ax,%ax
+ 1a8:	66 90                	xchg   %ax,%ax
+ 1aa:	66 90                	xchg   %ax,%ax
+ 1ac:	66 90                	xchg   %ax,%ax
+ 1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1b1:	31 c0                	xor    %eax,%eax
+{
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	53                   	push   %ebx
+ 1b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1c7:	40                   	inc    %eax
+ 1c8:	84 d2                	test   %dl,%dl
+ 1ca:	75 f4                	jne    1c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1cc:	5b                   	pop    %ebx
+ 1cd:	89 c8                	mov    %ecx,%eax
+ 1cf:	5d                   	pop    %ebp
+ 1d0:	c3                   	ret
+ 1d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	53                   	push   %ebx
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+ 1ea:	0f b6 02             	movzbl (%edx),%eax
+ 1ed:	84 c0                	test   %al,%al
+ 1ef:	75 15                	jne    206 <strcmp+0x26>
+ 1f1:	eb 30                	jmp    223 <strcmp+0x43>
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+ 1f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1fc:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 1ff:	42                   	inc    %edx
+  while(*p && *p == *q)
+ 200:	84 c0                	test   %al,%al
+ 202:	74 14                	je     218 <strcmp+0x38>
+    p++, q++;
+ 204:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+ 206:	0f b6 0b             	movzbl (%ebx),%ecx
+ 209:	38 c1                	cmp    %al,%cl
+ 20b:	74 eb                	je     1f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+ 20d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+ 20e:	29 c8                	sub    %ecx,%eax
+}
+ 210:	5d                   	pop    %ebp
+ 211:	c3                   	ret
+ 212:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 218:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+ 21c:	31 c0                	xor    %eax,%eax
+}
+ 21e:	5b                   	pop    %ebx
+ 21f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+ 220:	29 c8                	sub    %ecx,%eax
+}
+ 222:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 223:	0f b6 0b             	movzbl (%ebx),%ecx
+ 226:	31 c0                	xor    %eax,%eax
+ 228:	eb e3                	jmp    20d <strcmp+0x2d>
+ 22a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	40                   	inc    %eax
+ 241:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	75 f7                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 249:	5d                   	pop    %ebp
+ 24a:	89 c8                	mov    %ecx,%eax
+ 24c:	c3                   	ret
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+ 250:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+ 251:	31 c9                	xor    %ecx,%ecx
+}
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	5f                   	pop    %edi
+ 273:	89 d0                	mov    %edx,%eax
+ 275:	5d                   	pop    %ebp
+ 276:	c3                   	ret
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 10                	jne    2a1 <strchr+0x21>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	40                   	inc    %eax
+ 29d:	84 d2                	test   %dl,%dl
+ 29f:	74 0f                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a1:	38 d1                	cmp    %dl,%cl
+ 2a3:	75 f3                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a5:	5d                   	pop    %ebp
+ 2a6:	c3                   	ret
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+ 2b0:	5d                   	pop    %ebp
+  return 0;
+ 2b1:	31 c0                	xor    %eax,%eax
+}
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2c5:	31 f6                	xor    %esi,%esi
+{
+ 2c7:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 2c8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 2cb:	83 ec 3c             	sub    $0x3c,%esp
+ 2ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 2d1:	eb 32                	jmp    305 <gets+0x45>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+    cc = read(0, &c, 1);
+ 2d8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 2dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e1:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 2e5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 2ec:	e8 1a 01 00 00       	call   40b <read>
+    if(cc < 1)
+ 2f1:	85 c0                	test   %eax,%eax
+ 2f3:	7e 19                	jle    30e <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 2f5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2f9:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2fd:	3c 0a                	cmp    $0xa,%al
+ 2ff:	74 10                	je     311 <gets+0x51>
+ 301:	3c 0d                	cmp    $0xd,%al
+ 303:	74 0c                	je     311 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 305:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 308:	46                   	inc    %esi
+ 309:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 30c:	7c ca                	jl     2d8 <gets+0x18>
+ 30e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 311:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 315:	83 c4 3c             	add    $0x3c,%esp
+ 318:	89 d8                	mov    %ebx,%eax
+ 31a:	5b                   	pop    %ebx
+ 31b:	5e                   	pop    %esi
+ 31c:	5f                   	pop    %edi
+ 31d:	5d                   	pop    %ebp
+ 31e:	c3                   	ret
+ 31f:	90                   	nop
+
+00000320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 320:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 321:	31 c0                	xor    %eax,%eax
+{
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	83 ec 18             	sub    $0x18,%esp
+ 328:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 32b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 32e:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 332:	8b 45 08             	mov    0x8(%ebp),%eax
+ 335:	89 04 24             	mov    %eax,(%esp)
+ 338:	e8 f6 00 00 00       	call   433 <open>
+  if(fd < 0)
+ 33d:	85 c0                	test   %eax,%eax
+ 33f:	78 2f                	js     370 <stat+0x50>
+ 341:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 343:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 346:	89 1c 24             	mov    %ebx,(%esp)
+ 349:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 34d:	e8 f9 00 00 00       	call   44b <fstat>
+  close(fd);
+ 352:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 355:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 357:	e8 bf 00 00 00       	call   41b <close>
+  return r;
+}
+ 35c:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 35f:	89 f0                	mov    %esi,%eax
+ 361:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 364:	89 ec                	mov    %ebp,%esp
+ 366:	5d                   	pop    %ebp
+ 367:	c3                   	ret
+ 368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+    return -1;
+ 370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 375:	eb e5                	jmp    35c <stat+0x3c>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 387:	0f be 02             	movsbl (%edx),%eax
+ 38a:	88 c1                	mov    %al,%cl
+ 38c:	80 e9 30             	sub    $0x30,%cl
+ 38f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 392:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 397:	77 1c                	ja     3b5 <atoi+0x35>
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 3a0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3a3:	42                   	inc    %edx
+ 3a4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3a8:	0f be 02             	movsbl (%edx),%eax
+ 3ab:	88 c3                	mov    %al,%bl
+ 3ad:	80 eb 30             	sub    $0x30,%bl
+ 3b0:	80 fb 09             	cmp    $0x9,%bl
+ 3b3:	76 eb                	jbe    3a0 <atoi+0x20>
+  return n;
+}
+ 3b5:	5b                   	pop    %ebx
+ 3b6:	89 c8                	mov    %ecx,%eax
+ 3b8:	5d                   	pop    %ebp
+ 3b9:	c3                   	ret
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+  return vdst;
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+
+000003eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <exit>:
+SYSCALL(exit)
+ 3f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <wait>:
+SYSCALL(wait)
+ 3fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <pipe>:
+SYSCALL(pipe)
+ 403:	b8 04 00 00 00       	mov    $0x4,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <read>:
+SYSCALL(read)
+ 40b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <write>:
+SYSCALL(write)
+ 413:	b8 10 00 00 00       	mov    $0x10,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <close>:
+SYSCALL(close)
+ 41b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <kill>:
+SYSCALL(kill)
+ 423:	b8 06 00 00 00       	mov    $0x6,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <exec>:
+SYSCALL(exec)
+ 42b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <open>:
+SYSCALL(open)
+ 433:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mknod>:
+SYSCALL(mknod)
+ 43b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <unlink>:
+SYSCALL(unlink)
+ 443:	b8 12 00 00 00       	mov    $0x12,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <fstat>:
+SYSCALL(fstat)
+ 44b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <link>:
+SYSCALL(link)
+ 453:	b8 13 00 00 00       	mov    $0x13,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mkdir>:
+SYSCALL(mkdir)
+ 45b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <chdir>:
+SYSCALL(chdir)
+ 463:	b8 09 00 00 00       	mov    $0x9,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <dup>:
+SYSCALL(dup)
+ 46b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getpid>:
+SYSCALL(getpid)
+ 473:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <sbrk>:
+SYSCALL(sbrk)
+ 47b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <sleep>:
+SYSCALL(sleep)
+ 483:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <uptime>:
+SYSCALL(uptime)
+ 48b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <detach>:
+SYSCALL(detach)
+ 493:	b8 16 00 00 00       	mov    $0x16,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <policy>:
+SYSCALL(policy)
+ 49b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <priority>:
+SYSCALL(priority)
+ 4a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <wait_stat>:
+SYSCALL(wait_stat)
+ 4ab:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <lockstat>:
+SYSCALL(lockstat)
+ 4b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mmap>:
+SYSCALL(mmap)
+ 4bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <munmap>:
+SYSCALL(munmap)
+ 4c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <shmget>:
+SYSCALL(shmget)
+ 4cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <shmat>:
+SYSCALL(shmat)
+ 4d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <shmdt>:
+SYSCALL(shmdt)
+ 4db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <memstat>:
+SYSCALL(memstat)
+ 4e3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getprocs>:
+SYSCALL(getprocs)
+ 4eb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <shmctl>:
+SYSCALL(shmctl)
+ 4f3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+ 4fb:	66 90                	xchg   %ax,%ax
+ 4fd:	66 90                	xchg   %ax,%ax
+ 4ff:	90                   	nop
+
+00000500 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	89 cb                	mov    %ecx,%ebx
+ 508:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 50b:	89 d1                	mov    %edx,%ecx
+{
+ 50d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 510:	89 d0                	mov    %edx,%eax
+ 512:	c1 e8 1f             	shr    $0x1f,%eax
+ 515:	84 c0                	test   %al,%al
+ 517:	0f 84 93 00 00 00    	je     5b0 <printint+0xb0>
+ 51d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 521:	0f 84 89 00 00 00    	je     5b0 <printint+0xb0>
+    x = -xx;
+ 527:	f7 d9                	neg    %ecx
+    neg = 1;
+ 529:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 52e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 535:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 538:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 540:	89 c8                	mov    %ecx,%eax
+ 542:	31 d2                	xor    %edx,%edx
+ 544:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 547:	f7 f3                	div    %ebx
+ 549:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 54c:	0f b6 92 2c 0b 00 00 	movzbl 0xb2c(%edx),%edx
+ 553:	8d 47 01             	lea    0x1(%edi),%eax
+ 556:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 559:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 55d:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 55f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 562:	39 da                	cmp    %ebx,%edx
+ 564:	73 da                	jae    540 <printint+0x40>
+  if(neg)
+ 566:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 569:	85 c0                	test   %eax,%eax
+ 56b:	74 0a                	je     577 <printint+0x77>
+    buf[i++] = '-';
+ 56d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 570:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 575:	89 c7                	mov    %eax,%edi
+ 577:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 57a:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 57e:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 580:	0f b6 07             	movzbl (%edi),%eax
+ 583:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 586:	b8 01 00 00 00       	mov    $0x1,%eax
+ 58b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 58f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 593:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 596:	89 04 24             	mov    %eax,(%esp)
+ 599:	e8 75 fe ff ff       	call   413 <write>
+  while(--i >= 0)
+ 59e:	89 f8                	mov    %edi,%eax
+ 5a0:	4f                   	dec    %edi
+ 5a1:	39 d8                	cmp    %ebx,%eax
+ 5a3:	75 db                	jne    580 <printint+0x80>
+}
+ 5a5:	83 c4 4c             	add    $0x4c,%esp
+ 5a8:	5b                   	pop    %ebx
+ 5a9:	5e                   	pop    %esi
+ 5aa:	5f                   	pop    %edi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 5b0:	31 c0                	xor    %eax,%eax
+ 5b2:	e9 77 ff ff ff       	jmp    52e <printint+0x2e>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d2:	84 db                	test   %bl,%bl
+ 5d4:	74 6f                	je     645 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 5d6:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 5d9:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 5db:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 5de:	88 d9                	mov    %bl,%cl
+ 5e0:	46                   	inc    %esi
+ 5e1:	89 d3                	mov    %edx,%ebx
+ 5e3:	eb 2b                	jmp    610 <printf+0x50>
+ 5e5:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 5e8:	83 f8 25             	cmp    $0x25,%eax
+ 5eb:	74 4b                	je     638 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5ed:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5f5:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 5f9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fc:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 600:	89 3c 24             	mov    %edi,(%esp)
+ 603:	e8 0b fe ff ff       	call   413 <write>
+  for(i = 0; fmt[i]; i++){
+ 608:	0f b6 0e             	movzbl (%esi),%ecx
+ 60b:	46                   	inc    %esi
+ 60c:	84 c9                	test   %cl,%cl
+ 60e:	74 35                	je     645 <printf+0x85>
+    if(state == 0){
+ 610:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 612:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 615:	74 d1                	je     5e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 617:	83 fb 25             	cmp    $0x25,%ebx
+ 61a:	75 ec                	jne    608 <printf+0x48>
+      if(c == 'd'){
+ 61c:	83 f8 25             	cmp    $0x25,%eax
+ 61f:	0f 84 53 01 00 00    	je     778 <printf+0x1b8>
+ 625:	83 e8 63             	sub    $0x63,%eax
+ 628:	83 f8 15             	cmp    $0x15,%eax
+ 62b:	77 23                	ja     650 <printf+0x90>
+ 62d:	ff 24 85 d4 0a 00 00 	jmp    *0xad4(,%eax,4)
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 638:	0f b6 0e             	movzbl (%esi),%ecx
+ 63b:	46                   	inc    %esi
+        state = '%';
+ 63c:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 641:	84 c9                	test   %cl,%cl
+ 643:	75 cb                	jne    610 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 645:	83 c4 3c             	add    $0x3c,%esp
+ 648:	5b                   	pop    %ebx
+ 649:	5e                   	pop    %esi
+ 64a:	5f                   	pop    %edi
+ 64b:	5d                   	pop    %ebp
+ 64c:	c3                   	ret
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+ 650:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 653:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 656:	b8 01 00 00 00       	mov    $0x1,%eax
+ 65b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 65f:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 663:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 667:	89 3c 24             	mov    %edi,(%esp)
+ 66a:	e8 a4 fd ff ff       	call   413 <write>
+        putc(fd, c);
+ 66f:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 673:	ba 01 00 00 00       	mov    $0x1,%edx
+ 678:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 67b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 67f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 681:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 685:	89 3c 24             	mov    %edi,(%esp)
+ 688:	e8 86 fd ff ff       	call   413 <write>
+ 68d:	e9 76 ff ff ff       	jmp    608 <printf+0x48>
+ 692:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 698:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 69b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6a0:	8b 13                	mov    (%ebx),%edx
+ 6a2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 6a9:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6ac:	89 f8                	mov    %edi,%eax
+ 6ae:	e8 4d fe ff ff       	call   500 <printint>
+        ap++;
+ 6b3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 6b6:	31 db                	xor    %ebx,%ebx
+ 6b8:	e9 4b ff ff ff       	jmp    608 <printf+0x48>
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 6c3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 6cb:	85 c9                	test   %ecx,%ecx
+ 6cd:	0f 84 cd 00 00 00    	je     7a0 <printf+0x1e0>
+        while(*s != 0){
+ 6d3:	0f b6 01             	movzbl (%ecx),%eax
+ 6d6:	84 c0                	test   %al,%al
+ 6d8:	0f 84 ce 00 00 00    	je     7ac <printf+0x1ec>
+ 6de:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 6e1:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 6e4:	89 ce                	mov    %ecx,%esi
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 6f0:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f3:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 6f8:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 6f9:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 6fd:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 701:	89 3c 24             	mov    %edi,(%esp)
+ 704:	e8 0a fd ff ff       	call   413 <write>
+        while(*s != 0){
+ 709:	0f b6 06             	movzbl (%esi),%eax
+ 70c:	84 c0                	test   %al,%al
+ 70e:	75 e0                	jne    6f0 <printf+0x130>
+      state = 0;
+ 710:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 713:	31 db                	xor    %ebx,%ebx
+ 715:	e9 ee fe ff ff       	jmp    608 <printf+0x48>
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 723:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 728:	8b 13                	mov    (%ebx),%edx
+ 72a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 731:	e9 73 ff ff ff       	jmp    6a9 <printf+0xe9>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 740:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 743:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 748:	8b 10                	mov    (%eax),%edx
+ 74a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 74d:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 751:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 754:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 758:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 75b:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 75f:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 761:	89 3c 24             	mov    %edi,(%esp)
+ 764:	e8 aa fc ff ff       	call   413 <write>
+        ap++;
+ 769:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 76d:	e9 96 fe ff ff       	jmp    608 <printf+0x48>
+ 772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 778:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 77b:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 77e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 783:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 787:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 789:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 78d:	89 3c 24             	mov    %edi,(%esp)
+ 790:	e8 7e fc ff ff       	call   413 <write>
+ 795:	e9 6e fe ff ff       	jmp    608 <printf+0x48>
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 7a0:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 7a2:	b9 cb 0a 00 00       	mov    $0xacb,%ecx
+ 7a7:	e9 32 ff ff ff       	jmp    6de <printf+0x11e>
+      state = 0;
+ 7ac:	31 db                	xor    %ebx,%ebx
+ 7ae:	66 90                	xchg   %ax,%ax
+ 7b0:	e9 53 fe ff ff       	jmp    608 <printf+0x48>
+ 7b5:	66 90                	xchg   %ax,%ax
+ 7b7:	66 90                	xchg   %ax,%ax
+ 7b9:	66 90                	xchg   %ax,%ax
+ 7bb:	66 90                	xchg   %ax,%ax
+ 7bd:	66 90                	xchg   %ax,%ax
+ 7bf:	90                   	nop
+
+000007c0 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	83 ec 18             	sub    $0x18,%esp
+ 7c6:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 7c9:	89 c3                	mov    %eax,%ebx
+ 7cb:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 7ce:	a1 24 10 00 00       	mov    0x1024,%eax
+ 7d3:	8b 15 20 10 00 00    	mov    0x1020,%edx
+ 7d9:	29 c2                	sub    %eax,%edx
+ 7db:	39 da                	cmp    %ebx,%edx
+ 7dd:	72 19                	jb     7f8 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 7df:	01 c3                	add    %eax,%ebx
+ 7e1:	89 1d 24 10 00 00    	mov    %ebx,0x1024
+  return p;
+}
+ 7e7:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 7ea:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 7ed:	89 ec                	mov    %ebp,%esp
+ 7ef:	5d                   	pop    %ebp
+ 7f0:	c3                   	ret
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 7f8:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 7fd:	39 c3                	cmp    %eax,%ebx
+ 7ff:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 802:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 805:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 807:	e8 6f fc ff ff       	call   47b <sbrk>
+    if(p == (char*)-1)
+ 80c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 80f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 811:	74 1d                	je     830 <morecore+0x70>
+    if(p != arenaend)
+ 813:	39 05 20 10 00 00    	cmp    %eax,0x1020
+ 819:	74 0d                	je     828 <morecore+0x68>
+    arenaend = p + grow;
+ 81b:	01 f2                	add    %esi,%edx
+ 81d:	89 15 20 10 00 00    	mov    %edx,0x1020
+ 823:	eb ba                	jmp    7df <morecore+0x1f>
+ 825:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 828:	a1 24 10 00 00       	mov    0x1024,%eax
+ 82d:	eb ec                	jmp    81b <morecore+0x5b>
+ 82f:	90                   	nop
+      return 0;
+ 830:	31 c0                	xor    %eax,%eax
+ 832:	eb b3                	jmp    7e7 <morecore+0x27>
+ 834:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+
+00000840 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	83 ec 0c             	sub    $0xc,%esp
+ 846:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 849:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84c:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 84f:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 852:	85 c0                	test   %eax,%eax
+ 854:	74 1e                	je     874 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 856:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 859:	83 fa 08             	cmp    $0x8,%edx
+ 85c:	77 16                	ja     874 <free+0x34>
+  h = (Header*)ap - 1;
+ 85e:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 861:	74 25                	je     888 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 863:	8b 3c 95 40 10 00 00 	mov    0x1040(,%edx,4),%edi
+ 86a:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 86d:	89 0c 95 40 10 00 00 	mov    %ecx,0x1040(,%edx,4)
+}
+ 874:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 877:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 87a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 87d:	89 ec                	mov    %ebp,%esp
+ 87f:	5d                   	pop    %ebp
+ 880:	c3                   	ret
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 888:	8b 15 60 10 00 00    	mov    0x1060,%edx
+ 88e:	85 d2                	test   %edx,%edx
+ 890:	74 54                	je     8e6 <free+0xa6>
+ 892:	39 ca                	cmp    %ecx,%edx
+ 894:	73 36                	jae    8cc <free+0x8c>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+ 8a0:	89 d3                	mov    %edx,%ebx
+ 8a2:	8b 12                	mov    (%edx),%edx
+ 8a4:	85 d2                	test   %edx,%edx
+ 8a6:	74 12                	je     8ba <free+0x7a>
+ 8a8:	39 ca                	cmp    %ecx,%edx
+ 8aa:	72 f4                	jb     8a0 <free+0x60>
+  if(p && END(h) == p){
+ 8ac:	85 d2                	test   %edx,%edx
+ 8ae:	74 0a                	je     8ba <free+0x7a>
+ 8b0:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 8b3:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 8b6:	39 fa                	cmp    %edi,%edx
+ 8b8:	74 4b                	je     905 <free+0xc5>
+  h->s.u.next = p;
+ 8ba:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 8bd:	8b 53 04             	mov    0x4(%ebx),%edx
+ 8c0:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 8c4:	39 f1                	cmp    %esi,%ecx
+ 8c6:	74 29                	je     8f1 <free+0xb1>
+    prev->s.u.next = h;
+ 8c8:	89 0b                	mov    %ecx,(%ebx)
+ 8ca:	eb a8                	jmp    874 <free+0x34>
+  if(p && END(h) == p){
+ 8cc:	85 d2                	test   %edx,%edx
+ 8ce:	74 16                	je     8e6 <free+0xa6>
+ 8d0:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 8d3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 8d6:	39 f2                	cmp    %esi,%edx
+ 8d8:	75 0c                	jne    8e6 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 8da:	8b 72 04             	mov    0x4(%edx),%esi
+ 8dd:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 8e1:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 8e4:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 8e6:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 8e9:	89 0d 60 10 00 00    	mov    %ecx,0x1060
+ 8ef:	eb 83                	jmp    874 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 8f1:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 8f4:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 8f8:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 8fb:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 8fe:	89 03                	mov    %eax,(%ebx)
+ 900:	e9 6f ff ff ff       	jmp    874 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 905:	8b 7a 04             	mov    0x4(%edx),%edi
+ 908:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 90c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 90f:	8b 12                	mov    (%edx),%edx
+ 911:	eb a7                	jmp    8ba <free+0x7a>
+ 913:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000920 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 2c             	sub    $0x2c,%esp
+ 929:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 92c:	83 f8 10             	cmp    $0x10,%eax
+ 92f:	0f 86 52 01 00 00    	jbe    a87 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 935:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 937:	ba 01 00 00 00       	mov    $0x1,%edx
+ 93c:	eb 0d                	jmp    94b <malloc+0x2b>
+ 93e:	66 90                	xchg   %ax,%ax
+ 940:	83 c1 05             	add    $0x5,%ecx
+ 943:	89 d6                	mov    %edx,%esi
+ 945:	d3 e6                	shl    %cl,%esi
+ 947:	39 c6                	cmp    %eax,%esi
+ 949:	73 55                	jae    9a0 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 94b:	89 d9                	mov    %ebx,%ecx
+ 94d:	43                   	inc    %ebx
+ 94e:	83 fb 08             	cmp    $0x8,%ebx
+ 951:	75 ed                	jne    940 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 953:	8d 58 07             	lea    0x7(%eax),%ebx
+ 956:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 959:	39 c3                	cmp    %eax,%ebx
+ 95b:	0f 82 1f 01 00 00    	jb     a80 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 961:	a1 60 10 00 00       	mov    0x1060,%eax
+ 966:	85 c0                	test   %eax,%eax
+ 968:	0f 84 ee 00 00 00    	je     a5c <malloc+0x13c>
+ 96e:	b9 60 10 00 00       	mov    $0x1060,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 973:	8b 50 04             	mov    0x4(%eax),%edx
+ 976:	39 da                	cmp    %ebx,%edx
+ 978:	0f 82 d2 00 00 00    	jb     a50 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 97e:	29 da                	sub    %ebx,%edx
+ 980:	83 fa 17             	cmp    $0x17,%edx
+ 983:	0f 87 b7 00 00 00    	ja     a40 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 989:	8b 10                	mov    (%eax),%edx
+ 98b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 98d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 993:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 996:	83 c0 08             	add    $0x8,%eax
+}
+ 999:	5b                   	pop    %ebx
+ 99a:	5e                   	pop    %esi
+ 99b:	5f                   	pop    %edi
+ 99c:	5d                   	pop    %ebp
+ 99d:	c3                   	ret
+ 99e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 9a0:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 9a2:	8b 04 9d 40 10 00 00 	mov    0x1040(,%ebx,4),%eax
+ 9a9:	85 c0                	test   %eax,%eax
+ 9ab:	74 23                	je     9d0 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 9ad:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 9af:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 9b2:	89 14 9d 40 10 00 00 	mov    %edx,0x1040(,%ebx,4)
+    h->s.u.cls = cls;
+ 9b9:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 9bc:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 9bf:	83 c4 2c             	add    $0x2c,%esp
+ 9c2:	5b                   	pop    %ebx
+ 9c3:	5e                   	pop    %esi
+ 9c4:	5f                   	pop    %edi
+ 9c5:	5d                   	pop    %ebp
+ 9c6:	c3                   	ret
+ 9c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ce:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 9d0:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 9d3:	31 d2                	xor    %edx,%edx
+ 9d5:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 9da:	f7 f6                	div    %esi
+ 9dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 9df:	0f af c6             	imul   %esi,%eax
+ 9e2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 9e5:	e8 d6 fd ff ff       	call   7c0 <morecore>
+ 9ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 9ed:	85 c0                	test   %eax,%eax
+ 9ef:	0f 84 8b 00 00 00    	je     a80 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 9f5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 9f8:	8b 0c 9d 40 10 00 00 	mov    0x1040(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ a04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a07:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ a0a:	eb 06                	jmp    a12 <malloc+0xf2>
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ a10:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ a12:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ a14:	42                   	inc    %edx
+ a15:	89 c1                	mov    %eax,%ecx
+ a17:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ a1a:	39 d7                	cmp    %edx,%edi
+ a1c:	75 f2                	jne    a10 <malloc+0xf0>
+ a1e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ a21:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ a24:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ a27:	89 04 9d 40 10 00 00 	mov    %eax,0x1040(,%ebx,4)
+ a2e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ a31:	29 f0                	sub    %esi,%eax
+ a33:	01 c2                	add    %eax,%edx
+ a35:	89 d0                	mov    %edx,%eax
+ a37:	e9 71 ff ff ff       	jmp    9ad <malloc+0x8d>
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ a40:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ a43:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ a46:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ a48:	89 58 04             	mov    %ebx,0x4(%eax)
+ a4b:	e9 3d ff ff ff       	jmp    98d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ a50:	89 c1                	mov    %eax,%ecx
+ a52:	8b 00                	mov    (%eax),%eax
+ a54:	85 c0                	test   %eax,%eax
+ a56:	0f 85 17 ff ff ff    	jne    973 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ a5c:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ a5f:	74 1f                	je     a80 <malloc+0x160>
+ a61:	8d 43 08             	lea    0x8(%ebx),%eax
+ a64:	e8 57 fd ff ff       	call   7c0 <morecore>
+ a69:	85 c0                	test   %eax,%eax
+ a6b:	74 13                	je     a80 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ a6d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ a73:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ a76:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ a79:	e9 41 ff ff ff       	jmp    9bf <malloc+0x9f>
+ a7e:	66 90                	xchg   %ax,%ax
+      return 0;
+ a80:	31 c0                	xor    %eax,%eax
+ a82:	e9 38 ff ff ff       	jmp    9bf <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ a87:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ a8c:	31 db                	xor    %ebx,%ebx
+ a8e:	e9 0f ff ff ff       	jmp    9a2 <malloc+0x82>
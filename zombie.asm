@@ -0,0 +1,1349 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+   6:	83 ec 10             	sub    $0x10,%esp
+  if(fork() > 0)
+   9:	e8 5d 02 00 00       	call   26b <fork>
+   e:	85 c0                	test   %eax,%eax
+  10:	7e 0c                	jle    1e <main+0x1e>
+    sleep(5);  // Let child exit before parent.
+  12:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+  19:	e8 e5 02 00 00       	call   303 <sleep>
+  exit(0);
+  1e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  25:	e8 49 02 00 00       	call   273 <exit>
+  2a:	66 90                	xchg   %ax,%ax
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	40                   	inc    %eax
+  48:	84 d2                	test   %dl,%dl
+  4a:	75 f4                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4c:	5b                   	pop    %ebx
+  4d:	89 c8                	mov    %ecx,%eax
+  4f:	5d                   	pop    %ebp
+  50:	c3                   	ret
+  51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 15                	jne    86 <strcmp+0x26>
+  71:	eb 30                	jmp    a3 <strcmp+0x43>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  7f:	42                   	inc    %edx
+  while(*p && *p == *q)
+  80:	84 c0                	test   %al,%al
+  82:	74 14                	je     98 <strcmp+0x38>
+    p++, q++;
+  84:	89 cb                	mov    %ecx,%ebx
+  while(*p && *p == *q)
+  86:	0f b6 0b             	movzbl (%ebx),%ecx
+  89:	38 c1                	cmp    %al,%cl
+  8b:	74 eb                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+}
+  8d:	5b                   	pop    %ebx
+  return (uchar)*p - (uchar)*q;
+  8e:	29 c8                	sub    %ecx,%eax
+}
+  90:	5d                   	pop    %ebp
+  91:	c3                   	ret
+  92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  98:	0f b6 4b 01          	movzbl 0x1(%ebx),%ecx
+  9c:	31 c0                	xor    %eax,%eax
+}
+  9e:	5b                   	pop    %ebx
+  9f:	5d                   	pop    %ebp
+  return (uchar)*p - (uchar)*q;
+  a0:	29 c8                	sub    %ecx,%eax
+}
+  a2:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  a3:	0f b6 0b             	movzbl (%ebx),%ecx
+  a6:	31 c0                	xor    %eax,%eax
+  a8:	eb e3                	jmp    8d <strcmp+0x2d>
+  aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  b6:	80 3a 00             	cmpb   $0x0,(%edx)
+  b9:	74 15                	je     d0 <strlen+0x20>
+  bb:	31 c0                	xor    %eax,%eax
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+  c0:	40                   	inc    %eax
+  c1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  c5:	89 c1                	mov    %eax,%ecx
+  c7:	75 f7                	jne    c0 <strlen+0x10>
+    ;
+  return n;
+}
+  c9:	5d                   	pop    %ebp
+  ca:	89 c8                	mov    %ecx,%eax
+  cc:	c3                   	ret
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	5d                   	pop    %ebp
+  for(n = 0; s[n]; n++)
+  d1:	31 c9                	xor    %ecx,%ecx
+}
+  d3:	89 c8                	mov    %ecx,%eax
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ed:	89 d7                	mov    %edx,%edi
+  ef:	fc                   	cld
+  f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  f2:	5f                   	pop    %edi
+  f3:	89 d0                	mov    %edx,%eax
+  f5:	5d                   	pop    %ebp
+  f6:	c3                   	ret
+  f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fe:	66 90                	xchg   %ax,%ax
+
+00000100 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 45 08             	mov    0x8(%ebp),%eax
+ 106:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 10a:	0f b6 10             	movzbl (%eax),%edx
+ 10d:	84 d2                	test   %dl,%dl
+ 10f:	75 10                	jne    121 <strchr+0x21>
+ 111:	eb 1d                	jmp    130 <strchr+0x30>
+ 113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 117:	90                   	nop
+ 118:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 11c:	40                   	inc    %eax
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	74 0f                	je     130 <strchr+0x30>
+    if(*s == c)
+ 121:	38 d1                	cmp    %dl,%cl
+ 123:	75 f3                	jne    118 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+ 130:	5d                   	pop    %ebp
+  return 0;
+ 131:	31 c0                	xor    %eax,%eax
+}
+ 133:	c3                   	ret
+ 134:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+
+00000140 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 145:	31 f6                	xor    %esi,%esi
+{
+ 147:	53                   	push   %ebx
+    cc = read(0, &c, 1);
+ 148:	8d 7d e7             	lea    -0x19(%ebp),%edi
+{
+ 14b:	83 ec 3c             	sub    $0x3c,%esp
+ 14e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i=0; i+1 < max; ){
+ 151:	eb 32                	jmp    185 <gets+0x45>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+    cc = read(0, &c, 1);
+ 158:	89 7c 24 04          	mov    %edi,0x4(%esp)
+ 15c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 161:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 165:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 16c:	e8 1a 01 00 00       	call   28b <read>
+    if(cc < 1)
+ 171:	85 c0                	test   %eax,%eax
+ 173:	7e 19                	jle    18e <gets+0x4e>
+      break;
+    buf[i++] = c;
+ 175:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 179:	88 44 33 ff          	mov    %al,-0x1(%ebx,%esi,1)
+    if(c == '\n' || c == '\r')
+ 17d:	3c 0a                	cmp    $0xa,%al
+ 17f:	74 10                	je     191 <gets+0x51>
+ 181:	3c 0d                	cmp    $0xd,%al
+ 183:	74 0c                	je     191 <gets+0x51>
+  for(i=0; i+1 < max; ){
+ 185:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 188:	46                   	inc    %esi
+ 189:	3b 75 0c             	cmp    0xc(%ebp),%esi
+ 18c:	7c ca                	jl     158 <gets+0x18>
+ 18e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      break;
+  }
+  buf[i] = '\0';
+ 191:	c6 04 33 00          	movb   $0x0,(%ebx,%esi,1)
+  return buf;
+}
+ 195:	83 c4 3c             	add    $0x3c,%esp
+ 198:	89 d8                	mov    %ebx,%eax
+ 19a:	5b                   	pop    %ebx
+ 19b:	5e                   	pop    %esi
+ 19c:	5f                   	pop    %edi
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+
+000001a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1a0:	55                   	push   %ebp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	83 ec 18             	sub    $0x18,%esp
+ 1a8:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 1ab:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  fd = open(n, O_RDONLY);
+ 1ae:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 1b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b5:	89 04 24             	mov    %eax,(%esp)
+ 1b8:	e8 f6 00 00 00       	call   2b3 <open>
+  if(fd < 0)
+ 1bd:	85 c0                	test   %eax,%eax
+ 1bf:	78 2f                	js     1f0 <stat+0x50>
+ 1c1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c6:	89 1c 24             	mov    %ebx,(%esp)
+ 1c9:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 1cd:	e8 f9 00 00 00       	call   2cb <fstat>
+  close(fd);
+ 1d2:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1d5:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1d7:	e8 bf 00 00 00       	call   29b <close>
+  return r;
+}
+ 1dc:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 1df:	89 f0                	mov    %esi,%eax
+ 1e1:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 1e4:	89 ec                	mov    %ebp,%esp
+ 1e6:	5d                   	pop    %ebp
+ 1e7:	c3                   	ret
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb e5                	jmp    1dc <stat+0x3c>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	88 c1                	mov    %al,%cl
+ 20c:	80 e9 30             	sub    $0x30,%cl
+ 20f:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 212:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 217:	77 1c                	ja     235 <atoi+0x35>
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *s++ - '0';
+ 220:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 223:	42                   	inc    %edx
+ 224:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 228:	0f be 02             	movsbl (%edx),%eax
+ 22b:	88 c3                	mov    %al,%bl
+ 22d:	80 eb 30             	sub    $0x30,%bl
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	5b                   	pop    %ebx
+ 236:	89 c8                	mov    %ecx,%eax
+ 238:	5d                   	pop    %ebp
+ 239:	c3                   	ret
+ 23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+
+0000026b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <exit>:
+SYSCALL(exit)
+ 273:	b8 02 00 00 00       	mov    $0x2,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <wait>:
+SYSCALL(wait)
+ 27b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <pipe>:
+SYSCALL(pipe)
+ 283:	b8 04 00 00 00       	mov    $0x4,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <read>:
+SYSCALL(read)
+ 28b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <write>:
+SYSCALL(write)
+ 293:	b8 10 00 00 00       	mov    $0x10,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <close>:
+SYSCALL(close)
+ 29b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <kill>:
+SYSCALL(kill)
+ 2a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <exec>:
+SYSCALL(exec)
+ 2ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <open>:
+SYSCALL(open)
+ 2b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <mknod>:
+SYSCALL(mknod)
+ 2bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <unlink>:
+SYSCALL(unlink)
+ 2c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <fstat>:
+SYSCALL(fstat)
+ 2cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <link>:
+SYSCALL(link)
+ 2d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <mkdir>:
+SYSCALL(mkdir)
+ 2db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <chdir>:
+SYSCALL(chdir)
+ 2e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <dup>:
+SYSCALL(dup)
+ 2eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <getpid>:
+SYSCALL(getpid)
+ 2f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <sbrk>:
+SYSCALL(sbrk)
+ 2fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <sleep>:
+SYSCALL(sleep)
+ 303:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <uptime>:
+SYSCALL(uptime)
+ 30b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <detach>:
+SYSCALL(detach)
+ 313:	b8 16 00 00 00       	mov    $0x16,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <policy>:
+SYSCALL(policy)
+ 31b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <priority>:
+SYSCALL(priority)
+ 323:	b8 18 00 00 00       	mov    $0x18,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <wait_stat>:
+SYSCALL(wait_stat)
+ 32b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <lockstat>:
+SYSCALL(lockstat)
+ 333:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <mmap>:
+SYSCALL(mmap)
+ 33b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <munmap>:
+SYSCALL(munmap)
+ 343:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <shmget>:
+SYSCALL(shmget)
+ 34b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <shmat>:
+SYSCALL(shmat)
+ 353:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <shmdt>:
+SYSCALL(shmdt)
+ 35b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <memstat>:
+SYSCALL(memstat)
+ 363:	b8 20 00 00 00       	mov    $0x20,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <getprocs>:
+SYSCALL(getprocs)
+ 36b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <shmctl>:
+SYSCALL(shmctl)
+ 373:	b8 22 00 00 00       	mov    $0x22,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+ 37b:	66 90                	xchg   %ax,%ax
+ 37d:	66 90                	xchg   %ax,%ax
+ 37f:	90                   	nop
+
+00000380 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	53                   	push   %ebx
+ 386:	89 cb                	mov    %ecx,%ebx
+ 388:	83 ec 4c             	sub    $0x4c,%esp
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 38b:	89 d1                	mov    %edx,%ecx
+{
+ 38d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  if(sgn && xx < 0){
+ 390:	89 d0                	mov    %edx,%eax
+ 392:	c1 e8 1f             	shr    $0x1f,%eax
+ 395:	84 c0                	test   %al,%al
+ 397:	0f 84 93 00 00 00    	je     430 <printint+0xb0>
+ 39d:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3a1:	0f 84 89 00 00 00    	je     430 <printint+0xb0>
+    x = -xx;
+ 3a7:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3ae:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 3b5:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 3b8:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+  do{
+    buf[i++] = digits[x % base];
+ 3c0:	89 c8                	mov    %ecx,%eax
+ 3c2:	31 d2                	xor    %edx,%edx
+ 3c4:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+ 3c7:	f7 f3                	div    %ebx
+ 3c9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 3cc:	0f b6 92 74 09 00 00 	movzbl 0x974(%edx),%edx
+ 3d3:	8d 47 01             	lea    0x1(%edi),%eax
+ 3d6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3d9:	88 54 3e 01          	mov    %dl,0x1(%esi,%edi,1)
+ 3dd:	89 ca                	mov    %ecx,%edx
+  }while((x /= base) != 0);
+ 3df:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 3e2:	39 da                	cmp    %ebx,%edx
+ 3e4:	73 da                	jae    3c0 <printint+0x40>
+  if(neg)
+ 3e6:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 3e9:	85 c0                	test   %eax,%eax
+ 3eb:	74 0a                	je     3f7 <printint+0x77>
+    buf[i++] = '-';
+ 3ed:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 3f0:	c6 44 05 d8 2d       	movb   $0x2d,-0x28(%ebp,%eax,1)
+    buf[i++] = digits[x % base];
+ 3f5:	89 c7                	mov    %eax,%edi
+ 3f7:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 3fa:	8d 7c 3d d8          	lea    -0x28(%ebp,%edi,1),%edi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 400:	0f b6 07             	movzbl (%edi),%eax
+ 403:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 406:	b8 01 00 00 00       	mov    $0x1,%eax
+ 40b:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 40f:	89 74 24 04          	mov    %esi,0x4(%esp)
+ 413:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 416:	89 04 24             	mov    %eax,(%esp)
+ 419:	e8 75 fe ff ff       	call   293 <write>
+  while(--i >= 0)
+ 41e:	89 f8                	mov    %edi,%eax
+ 420:	4f                   	dec    %edi
+ 421:	39 d8                	cmp    %ebx,%eax
+ 423:	75 db                	jne    400 <printint+0x80>
+}
+ 425:	83 c4 4c             	add    $0x4c,%esp
+ 428:	5b                   	pop    %ebx
+ 429:	5e                   	pop    %esi
+ 42a:	5f                   	pop    %edi
+ 42b:	5d                   	pop    %ebp
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+  neg = 0;
+ 430:	31 c0                	xor    %eax,%eax
+ 432:	e9 77 ff ff ff       	jmp    3ae <printint+0x2e>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 3c             	sub    $0x3c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 449:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 44c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 44f:	0f b6 1e             	movzbl (%esi),%ebx
+ 452:	84 db                	test   %bl,%bl
+ 454:	74 6f                	je     4c5 <printf+0x85>
+  ap = (uint*)(void*)&fmt + 1;
+ 456:	8d 45 10             	lea    0x10(%ebp),%eax
+  state = 0;
+ 459:	31 d2                	xor    %edx,%edx
+  ap = (uint*)(void*)&fmt + 1;
+ 45b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  write(fd, &c, 1);
+ 45e:	88 d9                	mov    %bl,%cl
+ 460:	46                   	inc    %esi
+ 461:	89 d3                	mov    %edx,%ebx
+ 463:	eb 2b                	jmp    490 <printf+0x50>
+ 465:	8d 76 00             	lea    0x0(%esi),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 468:	83 f8 25             	cmp    $0x25,%eax
+ 46b:	74 4b                	je     4b8 <printf+0x78>
+        state = '%';
+      } else {
+        putc(fd, c);
+ 46d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 470:	b8 01 00 00 00       	mov    $0x1,%eax
+ 475:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 479:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 47c:	89 44 24 04          	mov    %eax,0x4(%esp)
+ 480:	89 3c 24             	mov    %edi,(%esp)
+ 483:	e8 0b fe ff ff       	call   293 <write>
+  for(i = 0; fmt[i]; i++){
+ 488:	0f b6 0e             	movzbl (%esi),%ecx
+ 48b:	46                   	inc    %esi
+ 48c:	84 c9                	test   %cl,%cl
+ 48e:	74 35                	je     4c5 <printf+0x85>
+    if(state == 0){
+ 490:	85 db                	test   %ebx,%ebx
+    c = fmt[i] & 0xff;
+ 492:	0f b6 c1             	movzbl %cl,%eax
+    if(state == 0){
+ 495:	74 d1                	je     468 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 497:	83 fb 25             	cmp    $0x25,%ebx
+ 49a:	75 ec                	jne    488 <printf+0x48>
+      if(c == 'd'){
+ 49c:	83 f8 25             	cmp    $0x25,%eax
+ 49f:	0f 84 53 01 00 00    	je     5f8 <printf+0x1b8>
+ 4a5:	83 e8 63             	sub    $0x63,%eax
+ 4a8:	83 f8 15             	cmp    $0x15,%eax
+ 4ab:	77 23                	ja     4d0 <printf+0x90>
+ 4ad:	ff 24 85 1c 09 00 00 	jmp    *0x91c(,%eax,4)
+ 4b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 4b8:	0f b6 0e             	movzbl (%esi),%ecx
+ 4bb:	46                   	inc    %esi
+        state = '%';
+ 4bc:	bb 25 00 00 00       	mov    $0x25,%ebx
+  for(i = 0; fmt[i]; i++){
+ 4c1:	84 c9                	test   %cl,%cl
+ 4c3:	75 cb                	jne    490 <printf+0x50>
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4c5:	83 c4 3c             	add    $0x3c,%esp
+ 4c8:	5b                   	pop    %ebx
+ 4c9:	5e                   	pop    %esi
+ 4ca:	5f                   	pop    %edi
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4d0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+  write(fd, &c, 1);
+ 4d3:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 4d6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4db:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4df:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 4e3:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 4e7:	89 3c 24             	mov    %edi,(%esp)
+ 4ea:	e8 a4 fd ff ff       	call   293 <write>
+        putc(fd, c);
+ 4ef:	0f b6 4d d0          	movzbl -0x30(%ebp),%ecx
+  write(fd, &c, 1);
+ 4f3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4f8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+ 4fb:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 4ff:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 501:	89 54 24 08          	mov    %edx,0x8(%esp)
+ 505:	89 3c 24             	mov    %edi,(%esp)
+ 508:	e8 86 fd ff ff       	call   293 <write>
+ 50d:	e9 76 ff ff ff       	jmp    488 <printf+0x48>
+ 512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 16, 0);
+ 518:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 51b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 520:	8b 13                	mov    (%ebx),%edx
+ 522:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+        ap++;
+ 529:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 52c:	89 f8                	mov    %edi,%eax
+ 52e:	e8 4d fe ff ff       	call   380 <printint>
+        ap++;
+ 533:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      state = 0;
+ 536:	31 db                	xor    %ebx,%ebx
+ 538:	e9 4b ff ff ff       	jmp    488 <printf+0x48>
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 540:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 543:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 545:	83 c0 04             	add    $0x4,%eax
+ 548:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        if(s == 0)
+ 54b:	85 c9                	test   %ecx,%ecx
+ 54d:	0f 84 cd 00 00 00    	je     620 <printf+0x1e0>
+        while(*s != 0){
+ 553:	0f b6 01             	movzbl (%ecx),%eax
+ 556:	84 c0                	test   %al,%al
+ 558:	0f 84 ce 00 00 00    	je     62c <printf+0x1ec>
+ 55e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 561:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 564:	89 ce                	mov    %ecx,%esi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+          putc(fd, *s);
+ 570:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 573:	b8 01 00 00 00       	mov    $0x1,%eax
+          s++;
+ 578:	46                   	inc    %esi
+  write(fd, &c, 1);
+ 579:	89 44 24 08          	mov    %eax,0x8(%esp)
+ 57d:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+ 581:	89 3c 24             	mov    %edi,(%esp)
+ 584:	e8 0a fd ff ff       	call   293 <write>
+        while(*s != 0){
+ 589:	0f b6 06             	movzbl (%esi),%eax
+ 58c:	84 c0                	test   %al,%al
+ 58e:	75 e0                	jne    570 <printf+0x130>
+      state = 0;
+ 590:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 593:	31 db                	xor    %ebx,%ebx
+ 595:	e9 ee fe ff ff       	jmp    488 <printf+0x48>
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5a0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 5a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5a8:	8b 13                	mov    (%ebx),%edx
+ 5aa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 5b1:	e9 73 ff ff ff       	jmp    529 <printf+0xe9>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        putc(fd, *ap);
+ 5c0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  write(fd, &c, 1);
+ 5c3:	bb 01 00 00 00       	mov    $0x1,%ebx
+        putc(fd, *ap);
+ 5c8:	8b 10                	mov    (%eax),%edx
+ 5ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 5cd:	0f b6 45 d0          	movzbl -0x30(%ebp),%eax
+ 5d1:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d4:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+ 5d8:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5db:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 5df:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 5e1:	89 3c 24             	mov    %edi,(%esp)
+ 5e4:	e8 aa fc ff ff       	call   293 <write>
+        ap++;
+ 5e9:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+ 5ed:	e9 96 fe ff ff       	jmp    488 <printf+0x48>
+ 5f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(fd, c);
+ 5f8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5fb:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 5fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 603:	89 5c 24 04          	mov    %ebx,0x4(%esp)
+      state = 0;
+ 607:	31 db                	xor    %ebx,%ebx
+  write(fd, &c, 1);
+ 609:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+ 60d:	89 3c 24             	mov    %edi,(%esp)
+ 610:	e8 7e fc ff ff       	call   293 <write>
+ 615:	e9 6e fe ff ff       	jmp    488 <printf+0x48>
+ 61a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 620:	b0 28                	mov    $0x28,%al
+          s = "(null)";
+ 622:	b9 14 09 00 00       	mov    $0x914,%ecx
+ 627:	e9 32 ff ff ff       	jmp    55e <printf+0x11e>
+      state = 0;
+ 62c:	31 db                	xor    %ebx,%ebx
+ 62e:	66 90                	xchg   %ax,%ax
+ 630:	e9 53 fe ff ff       	jmp    488 <printf+0x48>
+ 635:	66 90                	xchg   %ax,%ax
+ 637:	66 90                	xchg   %ax,%ax
+ 639:	66 90                	xchg   %ax,%ax
+ 63b:	66 90                	xchg   %ax,%ax
+ 63d:	66 90                	xchg   %ax,%ax
+ 63f:	90                   	nop
+
+00000640 <morecore>:
+static char *arena, *arenaend;
+
+// Take n bytes from the arena, growing it if needed.
+static char*
+morecore(uint n)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	83 ec 18             	sub    $0x18,%esp
+ 646:	89 5d f8             	mov    %ebx,-0x8(%ebp)
+ 649:	89 c3                	mov    %eax,%ebx
+ 64b:	89 75 fc             	mov    %esi,-0x4(%ebp)
+  char *p;
+  uint grow;
+
+  if(arenaend - arena < n){
+ 64e:	a1 44 0c 00 00       	mov    0xc44,%eax
+ 653:	8b 15 40 0c 00 00    	mov    0xc40,%edx
+ 659:	29 c2                	sub    %eax,%edx
+ 65b:	39 da                	cmp    %ebx,%edx
+ 65d:	72 19                	jb     678 <morecore+0x38>
+    if(p != arenaend)
+      arena = p;
+    arenaend = p + grow;
+  }
+  p = arena;
+  arena += n;
+ 65f:	01 c3                	add    %eax,%ebx
+ 661:	89 1d 44 0c 00 00    	mov    %ebx,0xc44
+  return p;
+}
+ 667:	8b 5d f8             	mov    -0x8(%ebp),%ebx
+ 66a:	8b 75 fc             	mov    -0x4(%ebp),%esi
+ 66d:	89 ec                	mov    %ebp,%esp
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 678:	b8 00 00 01 00       	mov    $0x10000,%eax
+ 67d:	39 c3                	cmp    %eax,%ebx
+ 67f:	0f 43 c3             	cmovae %ebx,%eax
+    p = sbrk(grow);
+ 682:	89 04 24             	mov    %eax,(%esp)
+    grow = n < ARENAGROW ? ARENAGROW : n;
+ 685:	89 c6                	mov    %eax,%esi
+    p = sbrk(grow);
+ 687:	e8 6f fc ff ff       	call   2fb <sbrk>
+    if(p == (char*)-1)
+ 68c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    p = sbrk(grow);
+ 68f:	89 c2                	mov    %eax,%edx
+    if(p == (char*)-1)
+ 691:	74 1d                	je     6b0 <morecore+0x70>
+    if(p != arenaend)
+ 693:	39 05 40 0c 00 00    	cmp    %eax,0xc40
+ 699:	74 0d                	je     6a8 <morecore+0x68>
+    arenaend = p + grow;
+ 69b:	01 f2                	add    %esi,%edx
+ 69d:	89 15 40 0c 00 00    	mov    %edx,0xc40
+ 6a3:	eb ba                	jmp    65f <morecore+0x1f>
+ 6a5:	8d 76 00             	lea    0x0(%esi),%esi
+  p = arena;
+ 6a8:	a1 44 0c 00 00       	mov    0xc44,%eax
+ 6ad:	eb ec                	jmp    69b <morecore+0x5b>
+ 6af:	90                   	nop
+      return 0;
+ 6b0:	31 c0                	xor    %eax,%eax
+ 6b2:	eb b3                	jmp    667 <morecore+0x27>
+ 6b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+
+000006c0 <free>:
+    freelist[LARGE] = h;
+}
+
+void
+free(void *ap)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+ 6c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cc:	89 75 f8             	mov    %esi,-0x8(%ebp)
+ 6cf:	89 7d fc             	mov    %edi,-0x4(%ebp)
+  Header *h;
+  uint cls;
+
+  if(ap == 0)
+ 6d2:	85 c0                	test   %eax,%eax
+ 6d4:	74 1e                	je     6f4 <free+0x34>
+    return;
+  h = (Header*)ap - 1;
+  cls = h->s.u.cls;
+ 6d6:	8b 50 f8             	mov    -0x8(%eax),%edx
+  if(cls > LARGE)
+ 6d9:	83 fa 08             	cmp    $0x8,%edx
+ 6dc:	77 16                	ja     6f4 <free+0x34>
+  h = (Header*)ap - 1;
+ 6de:	8d 48 f8             	lea    -0x8(%eax),%ecx
+    return;  // not ours
+  if(cls == LARGE){
+ 6e1:	74 25                	je     708 <free+0x48>
+    lfree(h);
+    return;
+  }
+  h->s.u.next = freelist[cls];
+ 6e3:	8b 3c 95 60 0c 00 00 	mov    0xc60(,%edx,4),%edi
+ 6ea:	89 78 f8             	mov    %edi,-0x8(%eax)
+  freelist[cls] = h;
+ 6ed:	89 0c 95 60 0c 00 00 	mov    %ecx,0xc60(,%edx,4)
+}
+ 6f4:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+ 6f7:	8b 75 f8             	mov    -0x8(%ebp),%esi
+ 6fa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 6fd:	89 ec                	mov    %ebp,%esp
+ 6ff:	5d                   	pop    %ebp
+ 700:	c3                   	ret
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freelist[LARGE]; p && p < h; p = p->s.u.next)
+ 708:	8b 15 80 0c 00 00    	mov    0xc80,%edx
+ 70e:	85 d2                	test   %edx,%edx
+ 710:	74 54                	je     766 <free+0xa6>
+ 712:	39 ca                	cmp    %ecx,%edx
+ 714:	73 36                	jae    74c <free+0x8c>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+ 720:	89 d3                	mov    %edx,%ebx
+ 722:	8b 12                	mov    (%edx),%edx
+ 724:	85 d2                	test   %edx,%edx
+ 726:	74 12                	je     73a <free+0x7a>
+ 728:	39 ca                	cmp    %ecx,%edx
+ 72a:	72 f4                	jb     720 <free+0x60>
+  if(p && END(h) == p){
+ 72c:	85 d2                	test   %edx,%edx
+ 72e:	74 0a                	je     73a <free+0x7a>
+ 730:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 733:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+ 736:	39 fa                	cmp    %edi,%edx
+ 738:	74 4b                	je     785 <free+0xc5>
+  h->s.u.next = p;
+ 73a:	89 50 f8             	mov    %edx,-0x8(%eax)
+  if(prev && END(prev) == h){
+ 73d:	8b 53 04             	mov    0x4(%ebx),%edx
+ 740:	8d 74 13 08          	lea    0x8(%ebx,%edx,1),%esi
+ 744:	39 f1                	cmp    %esi,%ecx
+ 746:	74 29                	je     771 <free+0xb1>
+    prev->s.u.next = h;
+ 748:	89 0b                	mov    %ecx,(%ebx)
+ 74a:	eb a8                	jmp    6f4 <free+0x34>
+  if(p && END(h) == p){
+ 74c:	85 d2                	test   %edx,%edx
+ 74e:	74 16                	je     766 <free+0xa6>
+ 750:	8b 58 fc             	mov    -0x4(%eax),%ebx
+ 753:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+ 756:	39 f2                	cmp    %esi,%edx
+ 758:	75 0c                	jne    766 <free+0xa6>
+    h->s.size += sizeof(Header) + p->s.size;
+ 75a:	8b 72 04             	mov    0x4(%edx),%esi
+ 75d:	8d 5c 33 08          	lea    0x8(%ebx,%esi,1),%ebx
+ 761:	89 58 fc             	mov    %ebx,-0x4(%eax)
+    p = p->s.u.next;
+ 764:	8b 12                	mov    (%edx),%edx
+  h->s.u.next = p;
+ 766:	89 50 f8             	mov    %edx,-0x8(%eax)
+    freelist[LARGE] = h;
+ 769:	89 0d 80 0c 00 00    	mov    %ecx,0xc80
+ 76f:	eb 83                	jmp    6f4 <free+0x34>
+    prev->s.size += sizeof(Header) + h->s.size;
+ 771:	8b 48 fc             	mov    -0x4(%eax),%ecx
+ 774:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+ 778:	89 53 04             	mov    %edx,0x4(%ebx)
+    prev->s.u.next = h->s.u.next;
+ 77b:	8b 40 f8             	mov    -0x8(%eax),%eax
+ 77e:	89 03                	mov    %eax,(%ebx)
+ 780:	e9 6f ff ff ff       	jmp    6f4 <free+0x34>
+    h->s.size += sizeof(Header) + p->s.size;
+ 785:	8b 7a 04             	mov    0x4(%edx),%edi
+ 788:	8d 74 3e 08          	lea    0x8(%esi,%edi,1),%esi
+ 78c:	89 70 fc             	mov    %esi,-0x4(%eax)
+    p = p->s.u.next;
+ 78f:	8b 12                	mov    (%edx),%edx
+ 791:	eb a7                	jmp    73a <free+0x7a>
+ 793:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007a0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 2c             	sub    $0x2c,%esp
+ 7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 7ac:	83 f8 10             	cmp    $0x10,%eax
+ 7af:	0f 86 52 01 00 00    	jbe    907 <malloc+0x167>
+  for(cls = 0; cls < NCLASS; cls++)
+ 7b5:	31 db                	xor    %ebx,%ebx
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 7b7:	ba 01 00 00 00       	mov    $0x1,%edx
+ 7bc:	eb 0d                	jmp    7cb <malloc+0x2b>
+ 7be:	66 90                	xchg   %ax,%ax
+ 7c0:	83 c1 05             	add    $0x5,%ecx
+ 7c3:	89 d6                	mov    %edx,%esi
+ 7c5:	d3 e6                	shl    %cl,%esi
+ 7c7:	39 c6                	cmp    %eax,%esi
+ 7c9:	73 55                	jae    820 <malloc+0x80>
+  for(cls = 0; cls < NCLASS; cls++)
+ 7cb:	89 d9                	mov    %ebx,%ecx
+ 7cd:	43                   	inc    %ebx
+ 7ce:	83 fb 08             	cmp    $0x8,%ebx
+ 7d1:	75 ed                	jne    7c0 <malloc+0x20>
+    h->s.size = 1 << (MINSHIFT + cls);
+    return (void*)(h + 1);
+  }
+
+  // Large: first fit among freed large blocks, else a new block.
+  size = (nbytes + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ 7d3:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7d6:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(size < nbytes)
+ 7d9:	39 c3                	cmp    %eax,%ebx
+ 7db:	0f 82 1f 01 00 00    	jb     900 <malloc+0x160>
+    return 0;
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 7e1:	a1 80 0c 00 00       	mov    0xc80,%eax
+ 7e6:	85 c0                	test   %eax,%eax
+ 7e8:	0f 84 ee 00 00 00    	je     8dc <malloc+0x13c>
+ 7ee:	b9 80 0c 00 00       	mov    $0xc80,%ecx
+    h = *pp;
+    if(h->s.size < size)
+ 7f3:	8b 50 04             	mov    0x4(%eax),%edx
+ 7f6:	39 da                	cmp    %ebx,%edx
+ 7f8:	0f 82 d2 00 00 00    	jb     8d0 <malloc+0x130>
+      continue;
+    if(h->s.size - size >= sizeof(Header) + (1 << MINSHIFT)){
+ 7fe:	29 da                	sub    %ebx,%edx
+ 800:	83 fa 17             	cmp    $0x17,%edx
+ 803:	0f 87 b7 00 00 00    	ja     8c0 <malloc+0x120>
+      // Split, handing out the tail; the rest stays in place.
+      h->s.size -= sizeof(Header) + size;
+      h = END(h);
+      h->s.size = size;
+    } else
+      *pp = h->s.u.next;
+ 809:	8b 10                	mov    (%eax),%edx
+ 80b:	89 11                	mov    %edx,(%ecx)
+    h->s.u.cls = LARGE;
+ 80d:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+    return 0;
+  h = (Header*)p;
+  h->s.u.cls = LARGE;
+  h->s.size = size;
+  return (void*)(h + 1);
+}
+ 813:	83 c4 2c             	add    $0x2c,%esp
+    return (void*)(h + 1);
+ 816:	83 c0 08             	add    $0x8,%eax
+}
+ 819:	5b                   	pop    %ebx
+ 81a:	5e                   	pop    %esi
+ 81b:	5f                   	pop    %edi
+ 81c:	5d                   	pop    %ebp
+ 81d:	c3                   	ret
+ 81e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 820:	89 f7                	mov    %esi,%edi
+    if(freelist[cls] == 0 && refill(cls) < 0)
+ 822:	8b 04 9d 60 0c 00 00 	mov    0xc60(,%ebx,4),%eax
+ 829:	85 c0                	test   %eax,%eax
+ 82b:	74 23                	je     850 <malloc+0xb0>
+    freelist[cls] = h->s.u.next;
+ 82d:	8b 10                	mov    (%eax),%edx
+    return (void*)(h + 1);
+ 82f:	83 c0 08             	add    $0x8,%eax
+    freelist[cls] = h->s.u.next;
+ 832:	89 14 9d 60 0c 00 00 	mov    %edx,0xc60(,%ebx,4)
+    h->s.u.cls = cls;
+ 839:	89 58 f8             	mov    %ebx,-0x8(%eax)
+    h->s.size = 1 << (MINSHIFT + cls);
+ 83c:	89 78 fc             	mov    %edi,-0x4(%eax)
+}
+ 83f:	83 c4 2c             	add    $0x2c,%esp
+ 842:	5b                   	pop    %ebx
+ 843:	5e                   	pop    %esi
+ 844:	5f                   	pop    %edi
+ 845:	5d                   	pop    %ebp
+ 846:	c3                   	ret
+ 847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84e:	66 90                	xchg   %ax,%ax
+  bsize = sizeof(Header) + (1 << (MINSHIFT + cls));
+ 850:	8d 77 08             	lea    0x8(%edi),%esi
+  n = CARVE / bsize;
+ 853:	31 d2                	xor    %edx,%edx
+ 855:	b8 00 10 00 00       	mov    $0x1000,%eax
+ 85a:	f7 f6                	div    %esi
+ 85c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((p = morecore(n * bsize)) == 0)
+ 85f:	0f af c6             	imul   %esi,%eax
+ 862:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 865:	e8 d6 fd ff ff       	call   640 <morecore>
+ 86a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 86d:	85 c0                	test   %eax,%eax
+ 86f:	0f 84 8b 00 00 00    	je     900 <malloc+0x160>
+  for(i = 0; i < n; i++, p += bsize){
+ 875:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    h->s.u.next = freelist[cls];
+ 878:	8b 0c 9d 60 0c 00 00 	mov    0xc60(,%ebx,4),%ecx
+  for(i = 0; i < n; i++, p += bsize){
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    h->s.u.next = freelist[cls];
+ 884:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 887:	8b 7d e0             	mov    -0x20(%ebp),%edi
+ 88a:	eb 06                	jmp    892 <malloc+0xf2>
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++, p += bsize){
+ 890:	89 d8                	mov    %ebx,%eax
+    h->s.u.next = freelist[cls];
+ 892:	89 08                	mov    %ecx,(%eax)
+  for(i = 0; i < n; i++, p += bsize){
+ 894:	42                   	inc    %edx
+ 895:	89 c1                	mov    %eax,%ecx
+ 897:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+ 89a:	39 d7                	cmp    %edx,%edi
+ 89c:	75 f2                	jne    890 <malloc+0xf0>
+ 89e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 8a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 8a4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 8a7:	89 04 9d 60 0c 00 00 	mov    %eax,0xc60(,%ebx,4)
+ 8ae:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 8b1:	29 f0                	sub    %esi,%eax
+ 8b3:	01 c2                	add    %eax,%edx
+ 8b5:	89 d0                	mov    %edx,%eax
+ 8b7:	e9 71 ff ff ff       	jmp    82d <malloc+0x8d>
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      h->s.size -= sizeof(Header) + size;
+ 8c0:	8d 4a f8             	lea    -0x8(%edx),%ecx
+ 8c3:	89 48 04             	mov    %ecx,0x4(%eax)
+      h = END(h);
+ 8c6:	01 d0                	add    %edx,%eax
+      h->s.size = size;
+ 8c8:	89 58 04             	mov    %ebx,0x4(%eax)
+ 8cb:	e9 3d ff ff ff       	jmp    80d <malloc+0x6d>
+  for(pp = &freelist[LARGE]; *pp; pp = &(*pp)->s.u.next){
+ 8d0:	89 c1                	mov    %eax,%ecx
+ 8d2:	8b 00                	mov    (%eax),%eax
+ 8d4:	85 c0                	test   %eax,%eax
+ 8d6:	0f 85 17 ff ff ff    	jne    7f3 <malloc+0x53>
+  if(size + sizeof(Header) < size || (p = morecore(size + sizeof(Header))) == 0)
+ 8dc:	83 fb f8             	cmp    $0xfffffff8,%ebx
+ 8df:	74 1f                	je     900 <malloc+0x160>
+ 8e1:	8d 43 08             	lea    0x8(%ebx),%eax
+ 8e4:	e8 57 fd ff ff       	call   640 <morecore>
+ 8e9:	85 c0                	test   %eax,%eax
+ 8eb:	74 13                	je     900 <malloc+0x160>
+  h->s.u.cls = LARGE;
+ 8ed:	c7 00 08 00 00 00    	movl   $0x8,(%eax)
+  return (void*)(h + 1);
+ 8f3:	83 c0 08             	add    $0x8,%eax
+  h->s.size = size;
+ 8f6:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  return (void*)(h + 1);
+ 8f9:	e9 41 ff ff ff       	jmp    83f <malloc+0x9f>
+ 8fe:	66 90                	xchg   %ax,%ax
+      return 0;
+ 900:	31 c0                	xor    %eax,%eax
+ 902:	e9 38 ff ff ff       	jmp    83f <malloc+0x9f>
+    if(nbytes <= (1 << (MINSHIFT + cls)))
+ 907:	bf 10 00 00 00       	mov    $0x10,%edi
+  for(cls = 0; cls < NCLASS; cls++)
+ 90c:	31 db                	xor    %ebx,%ebx
+ 90e:	e9 0f ff ff ff       	jmp    822 <malloc+0x82>